@@ -157,6 +157,7 @@ SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-excepti
 		<flag id="jit_fullSpeedDebug" value="true"/>
 		<flag id="jit_gcOnResolveSupport" value="true"/>
 		<flag id="jit_newInstancePrototype" value="true"/>
+		<flag id="jit_runtimeInstrumentation" value="true"/>
 		<flag id="jit_supportsDirectJNI" value="true"/>
 		<flag id="module_algorithm_test" value="true"/>
 		<flag id="module_bcutil" value="true"/>
@@ -223,6 +224,7 @@ SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-excepti
 		<flag id="opt_zlibCompression" value="true"/>
 		<flag id="opt_zlibSupport" value="true"/>
 		<flag id="port_omrsigSupport" value="true"/>
+		<flag id="port_runtimeInstrumentation" value="true"/>
 		<flag id="port_signalSupport" value="true"/>
 		<flag id="prof_eventReporting" value="true"/>
 		<flag id="ras_dumpAgents" value="true"/>
@@ -28,7 +28,6 @@ import java.security.ProtectionDomain;
 import java.security.Permissions;
 /*[IF JAVA_SPEC_VERSION >= 12]*/
 import java.lang.constant.ClassDesc;
-import jdk.internal.reflect.ReflectionFactory;
 /*[ENDIF] JAVA_SPEC_VERSION >= 12*/
 import java.lang.reflect.*;
 import java.net.URL;
@@ -77,12 +76,14 @@ import java.io.IOException;
 import jdk.internal.reflect.Reflection;
 import jdk.internal.reflect.CallerSensitive;
 import jdk.internal.reflect.ConstantPool;
+import jdk.internal.reflect.ReflectionFactory;
 /*[ELSE]*/
 import sun.misc.Unsafe;
 import sun.misc.SharedSecrets;
 import sun.reflect.Reflection;
 import sun.reflect.CallerSensitive;
 import sun.reflect.ConstantPool;
+import sun.reflect.ReflectionFactory;
 /*[ENDIF]*/
 
 import java.util.ArrayList;
@@ -2414,7 +2415,7 @@ public T newInstance() throws IllegalAccessException, InstantiationException {
 	Class<?> callerClazz = getStackClass(1);
 	if (callerClazz.classLoader == ClassLoader.bootstrapClassLoader) {
 		/* newInstanceImpl() is required for all bootstrap classes to avoid an infinite loop
-		 * when calling copyConstructor.invoke() in cacheConstructor() at the bootstrap stage
+		 * when copying the constructor in cacheConstructor() at the bootstrap stage
 		 * as the constructors of bootstrap classes are not yet cached for use at that time.
 		 */
 		return (T)J9VMInternals.newInstanceImpl(this);
@@ -3949,10 +3950,10 @@ private String getParameterTypesSignature(boolean throwException, String name, C
 }
 
 /*[PR CMVC 114820, CMVC 115873, CMVC 116166] add reflection cache */
-private static Method copyMethod, copyField, copyConstructor;
+/* copies cached reflect objects directly rather than invoking their copy() methods reflectively */
+private static ReflectionFactory reflectCacheFactory;
 private static Field methodParameterTypesField;
 private static Field constructorParameterTypesField;
-private static final Object[] NoArgs = new Object[0];
 
 /*[PR JAZZ 107786] constructorParameterTypesField should be initialized regardless of reflectCacheEnabled or not */
 static void initCacheIds(boolean cacheEnabled, boolean cacheDebug) {
@@ -3990,18 +3991,7 @@ static void doInitCacheIds() {
 	constructorParameterTypesField.setAccessible(true);
 	methodParameterTypesField.setAccessible(true);
 	if (reflectCacheEnabled) {
-		copyConstructor = getAccessibleMethod(Constructor.class, "copy");
-		copyMethod = getAccessibleMethod(Method.class, "copy");
-		copyField = getAccessibleMethod(Field.class, "copy");
-	}
-}
-private static Method getAccessibleMethod(Class<?> cls, String name) {
-	try {
-		Method method = cls.getDeclaredMethod(name, EmptyParameters);
-		method.setAccessible(true);
-		return method;
-	} catch (NoSuchMethodException e) {
-		throw newInternalError(e);
+		reflectCacheFactory = ReflectionFactory.getReflectionFactory();
 	}
 }
 
@@ -4454,14 +4444,10 @@ private Method lookupCachedMethod(String methodName, Class<?>[] parameters) {
 		// use a null returnType to find the Method with the largest depth
 		Method method = (Method) cache.find(CacheKey.newMethodKey(methodName, parameters, null));
 		if (method != null) {
-			try {
-				Class<?>[] orgParams = getParameterTypes(method);
-				// ensure the parameter classes are identical
-				if (sameTypes(parameters, orgParams)) {
-					return (Method) copyMethod.invoke(method, NoArgs);
-				}
-			} catch (IllegalAccessException | IllegalArgumentException | InvocationTargetException e) {
-				throw newInternalError(e);
+			Class<?>[] orgParams = getParameterTypes(method);
+			// ensure the parameter classes are identical
+			if (sameTypes(parameters, orgParams)) {
+				return reflectCacheFactory.copyMethod(method);
 			}
 		}
 	}
@@ -4474,35 +4460,31 @@ private Method cacheMethod(Method method) {
 	if (reflectCacheAppOnly && ClassLoader.getStackClassLoader(2) == ClassLoader.bootstrapClassLoader) {
 		return method;
 	}
-	if (copyMethod == null) return method;
+	if (reflectCacheFactory == null) return method;
 	if (reflectCacheDebug) {
 		reflectCacheDebugHelper(null, 0, "cache Method: ", getName(), ".", method.getName());	//$NON-NLS-1$ //$NON-NLS-2$
 	}
+	Class<?>[] parameterTypes = getParameterTypes(method);
+	CacheKey key = CacheKey.newMethodKey(method.getName(), parameterTypes, method.getReturnType());
+	Class<?> declaringClass = method.getDeclaringClass();
+	ReflectCache cache = declaringClass.acquireReflectCache();
 	try {
-		Class<?>[] parameterTypes = getParameterTypes(method);
-		CacheKey key = CacheKey.newMethodKey(method.getName(), parameterTypes, method.getReturnType());
-		Class<?> declaringClass = method.getDeclaringClass();
-		ReflectCache cache = declaringClass.acquireReflectCache();
-		try {
-			/*[PR CMVC 116493] store inherited methods in their declaringClass */
-			method = cache.insertIfAbsent(key, method);
-		} finally {
-			if (declaringClass != this) {
-				cache.release();
-				cache = acquireReflectCache();
-			}
-		}
-		try {
-			// cache the Method with the largest depth with a null returnType		
-			CacheKey lookupKey = CacheKey.newMethodKey(method.getName(), parameterTypes, null);
-			cache.insert(lookupKey, method);
-		} finally {
+		/*[PR CMVC 116493] store inherited methods in their declaringClass */
+		method = cache.insertIfAbsent(key, method);
+	} finally {
+		if (declaringClass != this) {
 			cache.release();
+			cache = acquireReflectCache();
 		}
-		return (Method)copyMethod.invoke(method, NoArgs);
-	} catch (IllegalAccessException | IllegalArgumentException | InvocationTargetException e) {
-		throw newInternalError(e);
 	}
+	try {
+		// cache the Method with the largest depth with a null returnType		
+		CacheKey lookupKey = CacheKey.newMethodKey(method.getName(), parameterTypes, null);
+		cache.insert(lookupKey, method);
+	} finally {
+		cache.release();
+	}
+	return reflectCacheFactory.copyMethod(method);
 }
 
 private Field lookupCachedField(String fieldName) {
@@ -4515,11 +4497,7 @@ private Field lookupCachedField(String fieldName) {
 		/*[PR 124746] Field cache cannot handle same field name with multiple types */
 		Field field = (Field) cache.find(CacheKey.newFieldKey(fieldName, null));
 		if (field != null) {
-			try {
-				return (Field)copyField.invoke(field, NoArgs);
-			} catch (IllegalAccessException | IllegalArgumentException | InvocationTargetException e) {
-				throw newInternalError(e);
-			}
+			return reflectCacheFactory.copyField(field);
 		}
 	}
 	return null;
@@ -4531,7 +4509,7 @@ private Field cacheField(Field field) {
 	if (reflectCacheAppOnly && ClassLoader.getStackClassLoader(2) == ClassLoader.bootstrapClassLoader) {
 		return field;
 	}
-	if (copyField == null) return field;
+	if (reflectCacheFactory == null) return field;
 	if (reflectCacheDebug) {
 		reflectCacheDebugHelper(null, 0, "cache Field: ", getName(), ".", field.getName());	//$NON-NLS-1$ //$NON-NLS-2$
 	}
@@ -4550,11 +4528,7 @@ private Field cacheField(Field field) {
 	} finally {
 		cache.release();
 	}
-	try {
-		return (Field) copyField.invoke(field, NoArgs);
-	} catch (IllegalAccessException | IllegalArgumentException | InvocationTargetException e) {
-		throw newInternalError(e);
-	}
+	return reflectCacheFactory.copyField(field);
 }
 
 private Constructor<T> lookupCachedConstructor(Class<?>[] parameters) {
@@ -4568,13 +4542,9 @@ private Constructor<T> lookupCachedConstructor(Class<?>[] parameters) {
 		Constructor<?> constructor = (Constructor<?>) cache.find(CacheKey.newConstructorKey(parameters));
 		if (constructor != null) {
 			Class<?>[] orgParams = getParameterTypes(constructor);
-			try {
-				// ensure the parameter classes are identical
-				if (sameTypes(orgParams, parameters)) {
-					return (Constructor<T>) copyConstructor.invoke(constructor, NoArgs);
-				}
-			} catch (IllegalAccessException | IllegalArgumentException | InvocationTargetException e) {
-				throw newInternalError(e);
+			// ensure the parameter classes are identical
+			if (sameTypes(orgParams, parameters)) {
+				return (Constructor<T>) reflectCacheFactory.copyConstructor(constructor);
 			}
 		}
 	}
@@ -4587,7 +4557,7 @@ private Constructor<T> cacheConstructor(Constructor<T> constructor) {
 	if (reflectCacheAppOnly && ClassLoader.getStackClassLoader(2) == ClassLoader.bootstrapClassLoader) {
 		return constructor;
 	}
-	if (copyConstructor == null) return constructor;
+	if (reflectCacheFactory == null) return constructor;
 	if (reflectCacheDebug) {
 		reflectCacheDebugHelper(constructor.getParameterTypes(), 1, "cache Constructor: ", getName());	//$NON-NLS-1$
 	}
@@ -4598,23 +4568,15 @@ private Constructor<T> cacheConstructor(Constructor<T> constructor) {
 	} finally {
 		cache.release();
 	}
-	try {
-		return (Constructor<T>) copyConstructor.invoke(constructor, NoArgs);
-	} catch (IllegalAccessException | IllegalArgumentException | InvocationTargetException e) {
-		throw newInternalError(e);
-	}
+	return reflectCacheFactory.copyConstructor(constructor);
 }
 
 private static Method[] copyMethods(Method[] methods) {
 	Method[] result = new Method[methods.length];
-	try {
-		for (int i=0; i<methods.length; i++) {
-			result[i] = (Method)copyMethod.invoke(methods[i], NoArgs);
-		}
-		return result;
-	} catch (IllegalAccessException | IllegalArgumentException | InvocationTargetException e) {
-		throw newInternalError(e);
+	for (int i=0; i<methods.length; i++) {
+		result[i] = reflectCacheFactory.copyMethod(methods[i]);
 	}
+	return result;
 }
 
 private Method[] lookupCachedMethods(CacheKey cacheKey) {
@@ -4639,7 +4601,7 @@ private Method[] cacheMethods(Method[] methods, CacheKey cacheKey) {
 	if (reflectCacheAppOnly && ClassLoader.getStackClassLoader(2) == ClassLoader.bootstrapClassLoader) {
 		return methods;
 	}
-	if (copyMethod == null) return methods;
+	if (reflectCacheFactory == null) return methods;
 	if (reflectCacheDebug) {
 		reflectCacheDebugHelper(null, 0, "cache Methods in: ", getName());	//$NON-NLS-1$
 	}
@@ -4678,14 +4640,10 @@ private Method[] cacheMethods(Method[] methods, CacheKey cacheKey) {
 
 private static Field[] copyFields(Field[] fields) {
 	Field[] result = new Field[fields.length];
-	try {
-		for (int i=0; i<fields.length; i++) {
-			result[i] = (Field)copyField.invoke(fields[i], NoArgs);
-		}
-		return result;
-	} catch (IllegalAccessException | IllegalArgumentException | InvocationTargetException e) {
-		throw newInternalError(e);
+	for (int i=0; i<fields.length; i++) {
+		result[i] = reflectCacheFactory.copyField(fields[i]);
 	}
+	return result;
 }
 
 private Field[] lookupCachedFields(CacheKey cacheKey) {
@@ -4710,7 +4668,7 @@ private Field[] cacheFields(Field[] fields, CacheKey cacheKey) {
 	if (reflectCacheAppOnly && ClassLoader.getStackClassLoader(2) == ClassLoader.bootstrapClassLoader) {
 		return fields;
 	}
-	if (copyField == null) return fields;
+	if (reflectCacheFactory == null) return fields;
 	if (reflectCacheDebug) {
 		reflectCacheDebugHelper(null, 0, "cache Fields in: ", getName());	//$NON-NLS-1$
 	}
@@ -4749,14 +4707,10 @@ private Field[] cacheFields(Field[] fields, CacheKey cacheKey) {
 
 private static <T> Constructor<T>[] copyConstructors(Constructor<T>[] constructors) {
 	Constructor<T>[] result = new Constructor[constructors.length];
-	try {
-		for (int i=0; i<constructors.length; i++) {
-			result[i] = (Constructor<T>) copyConstructor.invoke(constructors[i], NoArgs);
-		}
-		return result;
-	} catch (IllegalAccessException | IllegalArgumentException | InvocationTargetException e) {
-		throw newInternalError(e);
+	for (int i=0; i<constructors.length; i++) {
+		result[i] = reflectCacheFactory.copyConstructor(constructors[i]);
 	}
+	return result;
 }
 
 private Constructor<T>[] lookupCachedConstructors(CacheKey cacheKey) {
@@ -4781,7 +4735,7 @@ private Constructor<T>[] cacheConstructors(Constructor<T>[] constructors, CacheK
 	if (reflectCacheAppOnly && ClassLoader.getStackClassLoader(2) == ClassLoader.bootstrapClassLoader) {
 		return constructors;
 	}
-	if (copyConstructor == null) return constructors;
+	if (reflectCacheFactory == null) return constructors;
 	if (reflectCacheDebug) {
 		reflectCacheDebugHelper(null, 0, "cache Constructors in: ", getName());	//$NON-NLS-1$
 	}
@@ -54,6 +54,8 @@ public final class StackWalker {
 	private final static int J9_RETAIN_CLASS_REFERENCE = 1;
 	private final static int J9_SHOW_REFLECT_FRAMES = 2;
 	private final static int J9_SHOW_HIDDEN_FRAMES = 4;
+	/* J9_FRAME_VALID = 8 is reserved for the native walk state */
+	private final static int J9_CLASS_ONLY = 16;
 
 	final Set<Option> walkerOptions;
 
@@ -176,7 +178,7 @@ public final class StackWalker {
 		 * Get the top two stack frames: the client calling getCallerClass and
 		 * the client's caller. Ignore reflection and special frames.
 		 */
-		List<StackFrame> result = StackWalker.walkWrapperImpl(J9_RETAIN_CLASS_REFERENCE, "getCallerClass", //$NON-NLS-1$
+		List<StackFrame> result = StackWalker.walkWrapperImpl(J9_RETAIN_CLASS_REFERENCE | J9_CLASS_ONLY, "getCallerClass", //$NON-NLS-1$
 				s -> s.limit(2).collect(Collectors.toList()));
 		if (result.size() < 2) {
 			/*[MSG "K0640", "getCallerClass() called from method with no caller"]*/
@@ -109,14 +109,16 @@ abstract class ViewVarHandle extends VarHandle {
 		}
 		
 		static final void boundsCheck(int capacity, int viewTypeSize, int index) {
-			if ((index < 0) || (index > (capacity - viewTypeSize))) {
+			/* Unsigned comparison covers both index < 0 and index > capacity - viewTypeSize with a single branch. */
+			if ((index & 0xFFFFFFFFL) > ((long)capacity - viewTypeSize)) {
 				/*[MSG "K0621", "Index {0} is not within the bounds of the provided array of size {1}."]*/
 				throw new ArrayIndexOutOfBoundsException(com.ibm.oti.util.Msg.getString("K0621", Integer.toString(index), Integer.toString(capacity))); //$NON-NLS-1$
 			}
 		}
 		
 		static final void alignmentCheck(long offset, int viewTypeSize, boolean allowUnaligned) {
-			if ((!allowUnaligned) && ((offset % viewTypeSize) != 0)) {
+			/* View type sizes are powers of two, so a mask is equivalent to the remainder. */
+			if ((!allowUnaligned) && ((offset & (viewTypeSize - 1)) != 0)) {
 				/*[MSG "K062A", "The requested access mode does not permit unaligned access."]*/
 				throw new IllegalStateException(com.ibm.oti.util.Msg.getString("K062A")); //$NON-NLS-1$
 			}
@@ -714,6 +714,8 @@ public final class ManagementUtils {
 
 		private static final String HYPERVISOR_MXBEAN_NAME = "com.ibm.virtualization.management:type=Hypervisor"; //$NON-NLS-1$
 
+		private static final String COMPILATION_COST_MXBEAN_NAME = "com.ibm.lang.management:type=CompilationCost"; //$NON-NLS-1$
+
 		private static final String JVM_CPU_MONITOR_MXBEAN_NAME = "com.ibm.lang.management:type=JvmCpuMonitor"; //$NON-NLS-1$
 		private static final String OPENJ9_DIAGNOSTICS_MXBEAN_NAME = "openj9.lang.management:type=OpenJ9Diagnostics"; //$NON-NLS-1$
 
@@ -760,6 +762,10 @@ public final class ManagementUtils {
 				.addInterface(com.ibm.virtualization.management.HypervisorMXBean.class)
 				.validateAndRegister();
 
+			create(COMPILATION_COST_MXBEAN_NAME, com.ibm.lang.management.internal.CompilationCostMXBeanImpl.getInstance())
+				.addInterface(com.ibm.lang.management.CompilationCostMXBean.class)
+				.validateAndRegister();
+
 			create(JVM_CPU_MONITOR_MXBEAN_NAME, com.ibm.lang.management.internal.JvmCpuMonitor.getInstance())
 				.addInterface(com.ibm.lang.management.JvmCpuMonitorMXBean.class)
 				.validateAndRegister();
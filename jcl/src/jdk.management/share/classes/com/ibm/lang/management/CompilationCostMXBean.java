@@ -0,0 +1,84 @@
+/*[INCLUDE-IF Sidecar17]*/
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package com.ibm.lang.management;
+
+import java.lang.management.PlatformManagedObject;
+
+/**
+ * This interface provides the per-method cost of JIT compilation: the CPU time
+ * spent compiling each method, the peak scratch memory used by its compilations,
+ * how many times it was compiled and recompiled and the size of its current body.
+ * It can be used to find the methods that dominate JIT CPU time and to spot
+ * methods that are recompiled over and over again.
+ * <p>
+ * The information is only collected when the JVM is started with
+ * <code>-Xjit:compilationCostLedger</code>; otherwise no methods are reported.
+ * Methods whose classes are unloaded are removed.
+ * </p>
+ * <br>
+ * <table border="1">
+ * <caption><b>Usage example for the {@link CompilationCostMXBean}</b></caption>
+ * <tr> <td> <pre>
+ * {@code
+ * ...
+ * try {
+ *	mxbeanName = new ObjectName("com.ibm.lang.management:type=CompilationCost");
+ * } catch (MalformedObjectNameException e) {
+ *	// Exception Handling
+ * }
+ * try {
+ *	MBeanServer mbeanServer = ManagementFactory.getPlatformMBeanServer();
+ *	if (true != mbeanServer.isRegistered(mxbeanName)) {
+ *		// CompilationCostMXBean not registered
+ *	}
+ *	CompilationCostMXBean costBean = JMX.newMXBeanProxy(mbeanServer, mxbeanName, CompilationCostMXBean.class);
+ *	for (MethodCompilationCost cost : costBean.getTopCompilationCosts(20)) {
+ *		System.out.println(cost);
+ *	}
+ * } catch (Exception e) {
+ *	// Exception Handling
+ * }
+ * }
+ * </pre></td></tr>
+ * </table>
+ */
+public interface CompilationCostMXBean extends PlatformManagedObject {
+
+	/**
+	 * The maximum number of methods returned by {@link #getTopCompilationCosts(int)}.
+	 */
+	public static final int MAX_TOP_COMPILATION_COSTS = 256;
+
+	/**
+	 * Returns the methods that took the most JIT compilation CPU time so far,
+	 * the most expensive method first.
+	 *
+	 * @param count the maximum number of methods to return; values above
+	 * {@link #MAX_TOP_COMPILATION_COSTS} are reduced to that limit
+	 * @return the compilation costs of at most <code>count</code> methods;
+	 * an empty array if the ledger is not enabled
+	 * @throws IllegalArgumentException if <code>count</code> is negative
+	 */
+	public MethodCompilationCost[] getTopCompilationCosts(int count);
+
+}
@@ -0,0 +1,213 @@
+/*[INCLUDE-IF Sidecar17]*/
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package com.ibm.lang.management;
+
+import javax.management.openmbean.CompositeData;
+import javax.management.openmbean.InvalidKeyException;
+
+import com.ibm.lang.management.internal.MethodCompilationCostUtil;
+
+/**
+ * <code>MethodCompilationCost</code> is a snapshot of what the JIT compiler
+ * has spent on one method.
+ *
+ * @see CompilationCostMXBean
+ */
+public final class MethodCompilationCost {
+
+	private final String methodName;
+	private final long cpuTime;
+	private final long peakScratchMemory;
+	private final long compilations;
+	private final long recompilations;
+	private final long failures;
+	private final long codeSize;
+
+	/**
+	 * Create a new <code>MethodCompilationCost</code> instance with the given info.
+	 *
+	 * @param methodName
+	 * @param cpuTime
+	 * @param peakScratchMemory
+	 * @param compilations
+	 * @param recompilations
+	 * @param failures
+	 * @param codeSize
+	 * @throws IllegalArgumentException
+	 */
+	public MethodCompilationCost(String methodName, long cpuTime, long peakScratchMemory,
+			long compilations, long recompilations, long failures, long codeSize) throws IllegalArgumentException {
+		super();
+		if (null == methodName || cpuTime < 0 || peakScratchMemory < 0 || compilations < 0
+				|| recompilations < 0 || failures < 0 || codeSize < 0) {
+			throw new IllegalArgumentException();
+		}
+		this.methodName = methodName;
+		this.cpuTime = cpuTime;
+		this.peakScratchMemory = peakScratchMemory;
+		this.compilations = compilations;
+		this.recompilations = recompilations;
+		this.failures = failures;
+		this.codeSize = codeSize;
+	}
+
+	/**
+	 * Returns the signature of the method; long signatures are truncated.
+	 *
+	 * @return the method signature, for example <code>java/lang/String.hashCode()I</code>
+	 */
+	public String getMethodName() {
+		return this.methodName;
+	}
+
+	/**
+	 * Returns the CPU time spent compiling the method, summed over all its
+	 * compilations, AOT loads and failed compilations.
+	 *
+	 * @return the compilation CPU time in nanoseconds
+	 */
+	public long getCpuTime() {
+		return this.cpuTime;
+	}
+
+	/**
+	 * Returns the largest amount of scratch memory used by a single compilation of the method.
+	 *
+	 * @return the peak scratch memory in bytes
+	 */
+	public long getPeakScratchMemory() {
+		return this.peakScratchMemory;
+	}
+
+	/**
+	 * Returns the number of times the method was compiled, including AOT loads,
+	 * recompilations and failed compilations.
+	 *
+	 * @return the number of compilations
+	 */
+	public long getCompilations() {
+		return this.compilations;
+	}
+
+	/**
+	 * Returns the number of compilations that replaced an existing body of the method.
+	 *
+	 * @return the number of recompilations
+	 */
+	public long getRecompilations() {
+		return this.recompilations;
+	}
+
+	/**
+	 * Returns the number of compilations of the method that did not produce a body.
+	 *
+	 * @return the number of failed compilations
+	 */
+	public long getFailures() {
+		return this.failures;
+	}
+
+	/**
+	 * Returns the size of the latest body generated for the method.
+	 *
+	 * @return the code size in bytes; 0 if no compilation succeeded
+	 */
+	public long getCodeSize() {
+		return this.codeSize;
+	}
+
+	/**
+	 * Receives a {@link CompositeData} representing a <code>MethodCompilationCost</code>
+	 * object and attempts to return the root <code>MethodCompilationCost</code> instance.
+	 *
+	 * @param cd a <code>CompositeDate</code> that represents a <code>MethodCompilationCost</code>.
+	 * @return	if <code>cd</code> is non- <code>null</code>, returns a new instance of
+	 * 		{@link MethodCompilationCost},
+	 * 		 If <code>cd</code> is <code>null</code>, returns <code>null</code>.
+	 *
+	 * @throws IllegalArgumentException	if argument <code>cd</code> does not correspond to a
+	 * 		{@link MethodCompilationCost} with the following attributes:
+	 * 		<ul>
+	 *		<li><code>methodName</code>(<code>java.lang.String</code>)</li>
+	 *		<li><code>cpuTime</code>(<code>java.lang.Long</code>)</li>
+	 *		<li><code>peakScratchMemory</code>(<code>java.lang.Long</code>)</li>
+	 *		<li><code>compilations</code>(<code>java.lang.Long</code>)</li>
+	 *		<li><code>recompilations</code>(<code>java.lang.Long</code>)</li>
+	 *		<li><code>failures</code>(<code>java.lang.Long</code>)</li>
+	 *		<li><code>codeSize</code>(<code>java.lang.Long</code>)</li>
+	 * 		</ul>
+	 */
+	public static MethodCompilationCost from(CompositeData cd) {
+		MethodCompilationCost result = null;
+
+		if (null != cd) {
+			// Is the new received CompositeData of the required type to create
+			// a new MethodCompilationCost ?
+			if (!MethodCompilationCostUtil.getCompositeType().isValue(cd)) {
+				/*[MSG "K05E5", "CompositeData is not of the expected type."]*/
+				throw new IllegalArgumentException(com.ibm.oti.util.Msg.getString("K05E5")); //$NON-NLS-1$
+			}
+
+			try {
+				result = new MethodCompilationCost(
+						(String) cd.get("methodName"), //$NON-NLS-1$
+						((Long) cd.get("cpuTime")).longValue(), //$NON-NLS-1$
+						((Long) cd.get("peakScratchMemory")).longValue(), //$NON-NLS-1$
+						((Long) cd.get("compilations")).longValue(), //$NON-NLS-1$
+						((Long) cd.get("recompilations")).longValue(), //$NON-NLS-1$
+						((Long) cd.get("failures")).longValue(), //$NON-NLS-1$
+						((Long) cd.get("codeSize")).longValue()); //$NON-NLS-1$
+			} catch (InvalidKeyException e) {
+				/*[MSG "K05E6", "CompositeData object does not contain expected key."]*/
+				throw new IllegalArgumentException(com.ibm.oti.util.Msg.getString("K05E6")); //$NON-NLS-1$
+			}
+		}
+
+		return result;
+	}
+
+	/**
+	 * Text description of this {@link MethodCompilationCost} object.
+	 *
+	 * @return Text description of this {@link MethodCompilationCost} object.
+	 */
+	@Override
+	public String toString() {
+		StringBuilder sb = new StringBuilder();
+		sb.append(this.methodName);
+		sb.append(" cpuTime="); //$NON-NLS-1$
+		sb.append(this.cpuTime);
+		sb.append("ns peakScratchMemory="); //$NON-NLS-1$
+		sb.append(this.peakScratchMemory);
+		sb.append(" compilations="); //$NON-NLS-1$
+		sb.append(this.compilations);
+		sb.append(" recompilations="); //$NON-NLS-1$
+		sb.append(this.recompilations);
+		sb.append(" failures="); //$NON-NLS-1$
+		sb.append(this.failures);
+		sb.append(" codeSize="); //$NON-NLS-1$
+		sb.append(this.codeSize);
+		return sb.toString();
+	}
+
+}
@@ -0,0 +1,97 @@
+/*[INCLUDE-IF Sidecar17]*/
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package com.ibm.lang.management.internal;
+
+import javax.management.MalformedObjectNameException;
+import javax.management.ObjectName;
+
+import com.ibm.lang.management.CompilationCostMXBean;
+import com.ibm.lang.management.MethodCompilationCost;
+
+/**
+ * Runtime type for {@link CompilationCostMXBean}.
+ * <p>
+ * Reads the compilation cost ledger kept by the JIT compiler.
+ * </p>
+ */
+public final class CompilationCostMXBeanImpl implements CompilationCostMXBean {
+
+	/* Number of values returned by getCompilationCostsImpl() for each method */
+	private static final int VALUES_PER_METHOD = 6;
+
+	private static final CompilationCostMXBeanImpl instance = new CompilationCostMXBeanImpl();
+
+	/**
+	 * Singleton accessor method. Returns an instance of {@link CompilationCostMXBeanImpl}
+	 *
+	 * @return a static instance of {@link CompilationCostMXBeanImpl}
+	 */
+	public static CompilationCostMXBeanImpl getInstance() {
+		return instance;
+	}
+
+	private CompilationCostMXBeanImpl() {
+		super();
+	}
+
+	/**
+	 * Returns the object name of the MXBean
+	 *
+	 * @return objectName representing the MXBean
+	 */
+	@Override
+	public ObjectName getObjectName() {
+		try {
+			ObjectName name = new ObjectName("com.ibm.lang.management:type=CompilationCost"); //$NON-NLS-1$
+			return name;
+		} catch (MalformedObjectNameException e) {
+			return null;
+		}
+	}
+
+	/**
+	 * {@inheritDoc}
+	 */
+	@Override
+	public MethodCompilationCost[] getTopCompilationCosts(int count) {
+		if (count < 0) {
+			throw new IllegalArgumentException();
+		}
+		count = Math.min(count, MAX_TOP_COMPILATION_COSTS);
+
+		String[] methodNames = new String[count];
+		long[] values = new long[count * VALUES_PER_METHOD];
+		int filled = getCompilationCostsImpl(count, methodNames, values);
+
+		MethodCompilationCost[] costs = new MethodCompilationCost[filled];
+		for (int i = 0; i < filled; ++i) {
+			int base = i * VALUES_PER_METHOD;
+			costs[i] = new MethodCompilationCost(methodNames[i], values[base], values[base + 1],
+					values[base + 2], values[base + 3], values[base + 4], values[base + 5]);
+		}
+		return costs;
+	}
+
+	/* Native implementation that fills in the names and the values of the most expensive methods */
+	private native int getCompilationCostsImpl(int count, String[] methodNames, long[] values);
+}
@@ -0,0 +1,73 @@
+/*[INCLUDE-IF Sidecar17]*/
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package com.ibm.lang.management.internal;
+
+import javax.management.openmbean.CompositeType;
+import javax.management.openmbean.OpenDataException;
+import javax.management.openmbean.OpenType;
+import javax.management.openmbean.SimpleType;
+
+import com.ibm.java.lang.management.internal.ManagementUtils;
+import com.ibm.lang.management.MethodCompilationCost;
+
+/**
+ * Support for the {@link MethodCompilationCost} class.
+ */
+public final class MethodCompilationCostUtil {
+
+	private static CompositeType compositeType;
+
+	/**
+	 * @return an instance of (@link CompositeType} for the {@link MethodCompilationCost} class
+	 */
+	public static CompositeType getCompositeType() {
+		if (null == compositeType) {
+			try {
+				String[] names = { "methodName", "cpuTime", "peakScratchMemory", //$NON-NLS-1$ //$NON-NLS-2$ //$NON-NLS-3$
+						"compilations", "recompilations", "failures", "codeSize" }; //$NON-NLS-1$ //$NON-NLS-2$ //$NON-NLS-3$ //$NON-NLS-4$
+				String[] descs = { "methodName", "cpuTime", "peakScratchMemory", //$NON-NLS-1$ //$NON-NLS-2$ //$NON-NLS-3$
+						"compilations", "recompilations", "failures", "codeSize" }; //$NON-NLS-1$ //$NON-NLS-2$ //$NON-NLS-3$ //$NON-NLS-4$
+				OpenType<?>[] types = { SimpleType.STRING, SimpleType.LONG, SimpleType.LONG,
+						SimpleType.LONG, SimpleType.LONG, SimpleType.LONG, SimpleType.LONG };
+
+				compositeType = new CompositeType(
+						MethodCompilationCost.class.getName(),
+						MethodCompilationCost.class.getName(),
+						names,
+						descs,
+						types);
+			} catch (OpenDataException e) {
+				if (ManagementUtils.VERBOSE_MODE) {
+					e.printStackTrace(System.err);
+				}
+			}
+		}
+
+		return compositeType;
+	}
+
+	private MethodCompilationCostUtil() {
+		super();
+	}
+
+}
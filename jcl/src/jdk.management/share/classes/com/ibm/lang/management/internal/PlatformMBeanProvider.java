@@ -29,6 +29,7 @@ import java.util.List;
 
 import com.ibm.java.lang.management.internal.ComponentBuilder;
 import com.ibm.java.lang.management.internal.ManagementUtils;
+import com.ibm.lang.management.CompilationCostMXBean;
 import com.ibm.lang.management.JvmCpuMonitorMXBean;
 import com.ibm.virtualization.management.internal.GuestOS;
 import com.ibm.virtualization.management.internal.HypervisorMXBeanImpl;
@@ -88,6 +89,10 @@ public final class PlatformMBeanProvider extends sun.management.spi.PlatformMBea
 			.addInterface(com.ibm.virtualization.management.HypervisorMXBean.class)
 			.register(allComponents);
 
+		ComponentBuilder.create("com.ibm.lang.management:type=CompilationCost", CompilationCostMXBeanImpl.getInstance()) //$NON-NLS-1$
+			.addInterface(CompilationCostMXBean.class)
+			.register(allComponents);
+
 		ComponentBuilder.create("com.ibm.lang.management:type=JvmCpuMonitor", JvmCpuMonitor.getInstance()) //$NON-NLS-1$
 			.addInterface(JvmCpuMonitorMXBean.class)
 			.register(allComponents);
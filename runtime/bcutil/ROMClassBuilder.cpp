@@ -1390,6 +1390,13 @@ ROMClassBuilder::compareROMClassForEquality(U_8 *romClass,bool romClassIsShared,
 
 			ret = compareCursor.isEqual();
 		}
+	} else if (classFileOracle->getClassFileSize() != ((J9ROMClass *)romClass)->classFileSize) {
+		/*
+		 * The class file size is written into the ROMClass and always compared for non-lambda classes,
+		 * so the classes cannot be equal. Avoid the comparing pass, which walks the entire ROMClass even
+		 * after the first mismatch is found.
+		 */
+		ret = false;
 	} else {
 		ComparingCursor compareCursor(_javaVM, srpOffsetTable, srpKeyProducer, classFileOracle, romClass, romClassIsShared, context, isLambda);
 		romClassWriter->writeROMClass(&compareCursor,
@@ -169,6 +169,9 @@ bcutil_J9VMDllMain(J9JavaVM* vm, IDATA stage, void* reserved)
 				returnVal = J9VMDLLMAIN_FAILED;
 			}
 			vm->mapMemoryBuffer = vm->mapMemoryResultsBuffer + MAP_MEMORY_RESULTS_BUFFER_SIZE;
+			if (J9VMDLLMAIN_OK == returnVal) {
+				j9mapcache_Initialize(vm);
+			}
 			break;
 
 		case AGENTS_STARTED :
@@ -185,6 +188,7 @@ bcutil_J9VMDllMain(J9JavaVM* vm, IDATA stage, void* reserved)
 				vm->dynamicLoadBuffers = 0;
 			}
 
+			j9mapcache_Shutdown(vm);
 			j9mem_free_memory(vm->mapMemoryResultsBuffer);
 			if (vm->mapMemoryBufferMutex) {
 				omrthread_monitor_destroy(vm->mapMemoryBufferMutex);
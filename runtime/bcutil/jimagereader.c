@@ -179,8 +179,21 @@ j9bcutil_loadJImage(J9PortLibrary *portlib, const char *fileName, J9JImage **pji
 	if (0 != pageSize) {
 		mapSize = ROUND_UP_TO(pageSize, mapSize);
 	}
+#if defined(J9VM_ENV_DATA64)
+	/* There is enough address space to map the resources as well, which lets the OS read ahead
+	 * and share the pages, and avoids a seek and a read for every resource. Only attempted where
+	 * read-only mappings are supported natively; if it fails, only the tables are mapped below.
+	 */
+	if (((U_64)fileSize > (U_64)mapSize)
+		&& J9_ARE_ALL_BITS_SET(j9mmap_capabilities(), J9PORT_MMAP_CAPABILITY_READ)
+	) {
+		jimage->jimageMmap = j9mmap_map_file(jimagefd, 0, (UDATA)fileSize, fileName, J9PORT_MMAP_FLAG_READ, J9MEM_CATEGORY_CLASSES);
+	}
+#endif /* defined(J9VM_ENV_DATA64) */
 
-	jimage->jimageMmap = j9mmap_map_file(jimagefd, 0, mapSize, fileName, J9PORT_MMAP_FLAG_READ, J9MEM_CATEGORY_CLASSES);
+	if (NULL == jimage->jimageMmap) {
+		jimage->jimageMmap = j9mmap_map_file(jimagefd, 0, mapSize, fileName, J9PORT_MMAP_FLAG_READ, J9MEM_CATEGORY_CLASSES);
+	}
 	if (NULL == jimage->jimageMmap) {
 		I_32 portlibErrCode = j9error_last_error_number();
 		const char *portlibErrMsg = j9error_last_error_message();
@@ -538,6 +551,9 @@ j9bcutil_getJImageResource(J9PortLibrary *portlib, J9JImage *jimage, J9JImageLoc
 	IDATA bytesRead = 0;
 	U_8 *inputBuffer = NULL;
 	U_8 *outputBuffer = NULL;
+	U_8 *mappedResource = NULL;
+	U_64 resourceSize = 0;
+	U_64 mappedLength = 0;
 	I_32 rc = J9JIMAGE_NO_ERROR;
 
 	PORT_ACCESS_FROM_PORT(portlib);
@@ -550,13 +566,28 @@ j9bcutil_getJImageResource(J9PortLibrary *portlib, J9JImage *jimage, J9JImageLoc
 	j9jimageHeader = jimage->j9jimageHeader;
 	jimageHeader = j9jimageHeader->jimageHeader;
 
-	seekResult = j9file_seek(jimage->fd, (I_64)j9jimageLocation->resourceOffset, EsSeekSet);
-	if (-1 == seekResult) {
-		I_32 portlibErrCode = j9error_last_error_number();
-		const char *portlibErrMsg = j9error_last_error_message();
-		Trc_BCU_getJImageResource_JImageFileSeekFailed(jimage->fileName, j9jimageLocation->resourceOffset, portlibErrCode, portlibErrMsg);
-		rc = J9JIMAGE_FILE_SEEK_ERROR;
-		goto _end;
+	if (0 != j9jimageLocation->compressedSize) {
+		resourceSize = j9jimageLocation->compressedSize;
+	} else {
+		resourceSize = (dataBufferSize < j9jimageLocation->uncompressedSize) ? dataBufferSize : j9jimageLocation->uncompressedSize;
+	}
+
+	/* The mapping may extend past the end of the file to a page boundary */
+	mappedLength = (jimage->fileLength < (U_64)jimage->jimageMmap->size) ? jimage->fileLength : (U_64)jimage->jimageMmap->size;
+	if ((j9jimageLocation->resourceOffset <= mappedLength)
+		&& (resourceSize <= (mappedLength - j9jimageLocation->resourceOffset))
+	) {
+		/* The resource lies within the mapped part of the image */
+		mappedResource = (U_8 *)jimage->jimageMmap->pointer + j9jimageLocation->resourceOffset;
+	} else {
+		seekResult = j9file_seek(jimage->fd, (I_64)j9jimageLocation->resourceOffset, EsSeekSet);
+		if (-1 == seekResult) {
+			I_32 portlibErrCode = j9error_last_error_number();
+			const char *portlibErrMsg = j9error_last_error_message();
+			Trc_BCU_getJImageResource_JImageFileSeekFailed(jimage->fileName, j9jimageLocation->resourceOffset, portlibErrCode, portlibErrMsg);
+			rc = J9JIMAGE_FILE_SEEK_ERROR;
+			goto _end;
+		}
 	}
 
 	if (0 != j9jimageLocation->compressedSize) {
@@ -569,7 +600,12 @@ j9bcutil_getJImageResource(J9PortLibrary *portlib, J9JImage *jimage, J9JImageLoc
 			rc = J9JIMAGE_OUT_OF_MEMORY;
 			goto _end;
 		}
-		bytesRead = j9file_read(jimage->fd, inputBuffer, (UDATA)j9jimageLocation->compressedSize);
+		if (NULL != mappedResource) {
+			memcpy(inputBuffer, mappedResource, (UDATA)j9jimageLocation->compressedSize);
+			bytesRead = (IDATA)j9jimageLocation->compressedSize;
+		} else {
+			bytesRead = j9file_read(jimage->fd, inputBuffer, (UDATA)j9jimageLocation->compressedSize);
+		}
 		if (j9jimageLocation->compressedSize != bytesRead) {
 			I_32 portlibErrCode = j9error_last_error_number();
 			const char *portlibErrMsg = j9error_last_error_message();
@@ -632,8 +668,13 @@ j9bcutil_getJImageResource(J9PortLibrary *portlib, J9JImage *jimage, J9JImageLoc
 			j9mem_free_memory(decompressorInfo);
 		} while (0 == decompressorInfo->decompressorFlag);
 	} else {
-		IDATA bytesToRead = (dataBufferSize < j9jimageLocation->uncompressedSize) ? (IDATA)dataBufferSize : (IDATA)j9jimageLocation->uncompressedSize;
-		bytesRead = j9file_read(jimage->fd, dataBuffer, bytesToRead);
+		IDATA bytesToRead = (IDATA)resourceSize;
+		if (NULL != mappedResource) {
+			memcpy(dataBuffer, mappedResource, (UDATA)bytesToRead);
+			bytesRead = bytesToRead;
+		} else {
+			bytesRead = j9file_read(jimage->fd, dataBuffer, bytesToRead);
+		}
 		if (bytesToRead != bytesRead) {
 			I_32 portlibErrCode = j9error_last_error_number();
 			const char *portlibErrMsg = j9error_last_error_message();
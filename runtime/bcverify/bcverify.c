@@ -2401,6 +2401,10 @@ j9bcv_verifyBytecodes (J9PortLibrary * portLib, J9Class * clazz, J9ROMClass * ro
 
 	verifyData->romClass = romClass;
 	verifyData->errorPC = 0;
+	/* The class cache only lives for the verification of a single class */
+	memset(verifyData->classCache, 0, sizeof(verifyData->classCache));
+	verifyData->classCacheHits = 0;
+	verifyData->classCacheMisses = 0;
 	
 	verifyData->romClassInSharedClasses = j9shr_Query_IsAddressInCache(verifyData->javaVM, romClass, romClass->romSize);
 
@@ -2628,6 +2632,7 @@ _done:
 		ALWAYS_TRIGGER_J9HOOK_VM_CLASS_VERIFICATION_END(verifyData->javaVM->hookInterface, verifyData, newFormat);
 	}
 
+	Trc_BCV_j9bcv_verifyBytecodes_ClassCacheStats(verifyData->vmStruct, verifyData->classCacheHits, verifyData->classCacheMisses);
 	Trc_BCV_j9bcv_verifyBytecodes_Exit(verifyData->vmStruct, result);
 
 	return result;
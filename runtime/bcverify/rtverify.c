@@ -61,6 +61,30 @@ j9rtv_verifierGetRAMClass( J9BytecodeVerificationData *verifyData, J9ClassLoader
 	JavaVM* jniVM = (JavaVM*)verifyData->javaVM;
 	J9ThreadEnv* threadEnv = NULL;
 	J9JavaVM *vm = verifyData->vmStruct->javaVM;
+	UDATA cacheIndex = 0;
+
+	Trc_RTV_j9rtv_verifierGetRAMClass_Entry(verifyData->vmStruct, classLoader, nameLength, className);
+
+	/* The same few classes are looked up repeatedly while merging types, so check the per-class cache
+	 * before taking the classTableMutex. The name of the cached class is compared, since the slot is
+	 * only selected by a hash of the name.
+	 */
+	if (0 != nameLength) {
+		cacheIndex = ((nameLength * 31) + className[nameLength >> 1] + className[nameLength - 1]) % J9_BCV_CLASS_CACHE_SIZE;
+		found = verifyData->classCache[cacheIndex];
+		if ((NULL != found) && !J9_IS_CLASS_OBSOLETE(found)) {
+			J9UTF8 *foundName = J9ROMCLASS_CLASSNAME(found->romClass);
+			if (J9UTF8_DATA_EQUALS(J9UTF8_DATA(foundName), J9UTF8_LENGTH(foundName), className, nameLength)) {
+				verifyData->classCacheHits += 1;
+				Trc_RTV_j9rtv_verifierGetRAMClass_found(verifyData->vmStruct);
+				Trc_RTV_j9rtv_verifierGetRAMClass_Exit(verifyData->vmStruct);
+				return found;
+			}
+		}
+		found = NULL;
+	}
+	verifyData->classCacheMisses += 1;
+
 	(*jniVM)->GetEnv(jniVM, (void**)&threadEnv, J9THREAD_VERSION_1_1);
 
 #ifdef J9VM_THR_PREEMPTIVE
@@ -68,7 +92,6 @@ j9rtv_verifierGetRAMClass( J9BytecodeVerificationData *verifyData, J9ClassLoader
 #endif
 
 	/* Sniff the class table to see if already loaded */
-	Trc_RTV_j9rtv_verifierGetRAMClass_Entry(verifyData->vmStruct, classLoader, nameLength, className);
 	found = vm->internalVMFunctions->hashClassTableAt (classLoader, className, nameLength);
 
 #ifdef J9VM_THR_PREEMPTIVE
@@ -144,6 +167,10 @@ j9rtv_verifierGetRAMClass( J9BytecodeVerificationData *verifyData, J9ClassLoader
 		Trc_RTV_j9rtv_verifierGetRAMClass_found(verifyData->vmStruct);
 	}
 
+	if ((NULL != found) && (0 != nameLength)) {
+		verifyData->classCache[cacheIndex] = found;
+	}
+
 	Trc_RTV_j9rtv_verifierGetRAMClass_Exit(verifyData->vmStruct);
 
 	return found;
@@ -28,7 +28,9 @@ set(J9VM_ENV_DATA64 ON CACHE BOOL "")
 set(J9VM_GC_ENABLE_DOUBLE_MAP OFF CACHE BOOL "")
 set(J9VM_INTERP_SIG_QUIT_THREAD_USES_SEMAPHORES OFF CACHE BOOL "")
 set(J9VM_JIT_NEW_DUAL_HELPERS OFF CACHE BOOL "")
+set(J9VM_JIT_RUNTIME_INSTRUMENTATION ON CACHE BOOL "")
 set(J9VM_OPT_ZERO ON CACHE BOOL "")
+set(J9VM_PORT_RUNTIME_INSTRUMENTATION ON CACHE BOOL "")
 
 set(OMR_GC_CONCURRENT_SCAVENGER ON CACHE BOOL "")
 set(OMR_GC_IDLE_HEAP_MANAGER ON CACHE BOOL "")
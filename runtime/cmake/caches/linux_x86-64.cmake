@@ -29,12 +29,14 @@ set(J9VM_ENV_LITTLE_ENDIAN ON CACHE BOOL "")
 set(J9VM_INTERP_ATOMIC_FREE_JNI ON CACHE BOOL "")
 set(J9VM_INTERP_ATOMIC_FREE_JNI_USES_FLUSH ON CACHE BOOL "")
 set(J9VM_INTERP_TWO_PASS_EXCLUSIVE ON CACHE BOOL "")
+set(J9VM_JIT_RUNTIME_INSTRUMENTATION ON CACHE BOOL "")
 set(J9VM_MODULE_CODEGEN_IA32 ON CACHE BOOL "")
 set(J9VM_MODULE_CODERT_IA32 ON CACHE BOOL "")
 set(J9VM_MODULE_JIT_IA32 ON CACHE BOOL "")
 set(J9VM_MODULE_JITRT_IA32 ON CACHE BOOL "")
 set(J9VM_MODULE_MASM2GAS ON CACHE BOOL "")
 set(J9VM_OPT_SWITCH_STACKS_FOR_SIGNAL_HANDLER ON CACHE BOOL "")
+set(J9VM_PORT_RUNTIME_INSTRUMENTATION ON CACHE BOOL "")
 
 set(OMR_GC_CONCURRENT_SCAVENGER ON CACHE BOOL "")
 set(OMR_GC_IDLE_HEAP_MANAGER ON CACHE BOOL "")
@@ -28,6 +28,7 @@
 #include "codegen/CodeGenerator.hpp"
 #include "codegen/CodeGenerator_inlines.hpp"
 #include "codegen/GenerateInstructions.hpp"
+#include "env/CompilerEnv.hpp"
 #include "runtime/CodeCacheManager.hpp"
 
 extern void TEMPORARY_initJ9ARM64TreeEvaluatorTable(TR::CodeGenerator *cg);
@@ -65,6 +66,10 @@ J9::ARM64::CodeGenerator::initialize()
    cg->setSupportsDivCheck();
    if (!comp()->getOption(TR_FullSpeedDebug))
       cg->setSupportsDirectJNICalls();
+
+   if (!comp()->getOption(TR_DisableSIMDStringHashCode) &&
+       !TR::Compiler->om.canGenerateArraylets())
+      cg->setSupportsInlineStringHashCode();
    }
 
 TR::Linkage *
@@ -68,6 +68,7 @@ extern void TEMPORARY_initJ9ARM64TreeEvaluatorTable(TR::CodeGenerator *cg)
    tet[TR::variableNewArray] = TR::TreeEvaluator::anewArrayEvaluator;
    tet[TR::multianewarray] = TR::TreeEvaluator::multianewArrayEvaluator;
    tet[TR::arraylength] = TR::TreeEvaluator::arraylengthEvaluator;
+   tet[TR::l2a] = TR::TreeEvaluator::l2aEvaluator;
    tet[TR::ZEROCHK] = TR::TreeEvaluator::ZEROCHKEvaluator;
    tet[TR::ResolveCHK] = TR::TreeEvaluator::resolveCHKEvaluator;
    tet[TR::DIVCHK] = TR::TreeEvaluator::DIVCHKEvaluator;
@@ -466,18 +467,37 @@ VMnonNullSrcWrtBarCardCheckEvaluator(
        *
        *   ldrimmx temp1Reg, [dstReg, #offsetOfHeaderFlags]
        *   tstimmw temp1Reg, J9_OBJECT_HEADER_REMEMBERED_MASK_FOR_TEST
-       *   b.ne    doneLabel
+       *   b.eq    wrtBarSnippetLabel
+       *
+       * The helper call is rarely taken, so it is placed in a snippet to keep it
+       * off the mainline:
+       *
+       * wrtBarSnippetLabel:
        *   bl      jitWriteBarrierGenerational
+       *   b       doneLabel
        */
       static_assert(J9_OBJECT_HEADER_REMEMBERED_MASK_FOR_TEST == 0xf0, "We assume that J9_OBJECT_HEADER_REMEMBERED_MASK_FOR_TEST is 0xf0");
       generateTrg1MemInstruction(cg, (TR::Compiler->om.compressObjectReferences() ? TR::InstOpCode::ldrimmw : TR::InstOpCode::ldrimmx), node, temp1Reg, new (cg->trHeapMemory()) TR::MemoryReference(dstReg, TR::Compiler->om.offsetOfHeaderFlags(), cg));
       generateTestImmInstruction(cg, node, temp1Reg, 0x703, false); // 0x703 is immr:imms for 0xf0
-      generateConditionalBranchInstruction(cg, TR::InstOpCode::b_cond, node, doneLabel, TR::CC_NE);
-
-      cg->generateDebugCounter(TR::DebugCounter::debugCounterName(comp, "wrtbarEvaluator:010VMnonNullSrcWrtBarCardCheckEvaluator:06rememberedBitCheckDone"), *srm);
 
       srm->reclaimScratchRegister(temp1Reg);
       srm->reclaimScratchRegister(temp2Reg);
+
+      static bool disableOOLWrtBarHelper = feGetEnv("TR_AArch64DisableOOLWrtBarHelper") != NULL;
+      if (!disableOOLWrtBarHelper)
+         {
+         TR::LabelSymbol *wrtBarSnippetLabel = generateLabelSymbol(cg);
+         TR::Snippet *snippet = new (cg->trHeapMemory()) TR::ARM64HelperCallSnippet(cg, node, wrtBarSnippetLabel, wbRef, doneLabel);
+         cg->addSnippet(snippet);
+         generateConditionalBranchInstruction(cg, TR::InstOpCode::b_cond, node, wrtBarSnippetLabel, TR::CC_EQ);
+         // ARM64HelperCallSnippet generates "bl" instruction
+         cg->machine()->setLinkRegisterKilled(true);
+         return;
+         }
+
+      generateConditionalBranchInstruction(cg, TR::InstOpCode::b_cond, node, doneLabel, TR::CC_NE);
+
+      cg->generateDebugCounter(TR::DebugCounter::debugCounterName(comp, "wrtbarEvaluator:010VMnonNullSrcWrtBarCardCheckEvaluator:06rememberedBitCheckDone"), *srm);
       }
    generateImmSymInstruction(cg, TR::InstOpCode::bl, node, reinterpret_cast<uintptr_t>(wbRef->getMethodAddress()), NULL, wbRef, NULL);
    cg->machine()->setLinkRegisterKilled(true);
@@ -2889,6 +2909,61 @@ J9::ARM64::TreeEvaluator::arraylengthEvaluator(TR::Node *node, TR::CodeGenerator
    return lengthReg;
    }
 
+TR::Register *
+J9::ARM64::TreeEvaluator::l2aEvaluator(TR::Node *node, TR::CodeGenerator *cg)
+   {
+   TR::Compilation *comp = cg->comp();
+   TR::Node *firstChild = node->getFirstChild();
+   static bool disableFoldDecompression = feGetEnv("TR_AArch64DisableFoldDecompression") != NULL;
+
+   if (!comp->useCompressedPointers() || disableFoldDecompression)
+      return TR::TreeEvaluator::passThroughEvaluator(node, cg);
+
+   // Match the decompression sequence created by lowerTrees
+   //
+   //    l2a
+   //      lshl              <- only present when the shift is not 0
+   //        iu2l
+   //          iloadi f      <- compressed reference
+   //        iconst shift
+   //
+   // and generate a single "ubfiz trgReg, srcReg, #shift, #32" which zero extends
+   // the compressed reference and shifts it at once, rather than a uxtw followed by a lsl.
+   TR::Node *shiftNode = NULL;
+   TR::Node *extendNode = firstChild;
+   if (firstChild->getOpCodeValue() == TR::lshl)
+      {
+      shiftNode = firstChild;
+      extendNode = firstChild->getFirstChild();
+      }
+
+   if (extendNode->getOpCodeValue() != TR::iu2l
+       || extendNode->getReferenceCount() != 1 || extendNode->getRegister() != NULL
+       || (shiftNode != NULL
+           && (shiftNode->getReferenceCount() != 1 || shiftNode->getRegister() != NULL
+               || shiftNode->getSecondChild()->getOpCodeValue() != TR::iconst)))
+      return TR::TreeEvaluator::passThroughEvaluator(node, cg);
+
+   uint32_t shift = (shiftNode != NULL) ? (shiftNode->getSecondChild()->getInt() & 0x3f) : 0;
+   TR::Node *compressedRefNode = extendNode->getFirstChild();
+   TR::Register *srcReg = cg->evaluate(compressedRefNode);
+   TR::Register *trgReg = cg->allocateCollectedReferenceRegister();
+
+   // ubfiz is an alias of ubfm with immr = (64 - shift) % 64 and imms = 31
+   generateTrg1Src1ImmInstruction(cg, TR::InstOpCode::ubfmx, node, trgReg, srcReg, ((((64 - shift) & 0x3f) << 6) | 31));
+
+   cg->decReferenceCount(compressedRefNode);
+   if (shiftNode != NULL)
+      {
+      cg->decReferenceCount(extendNode);
+      cg->decReferenceCount(shiftNode->getSecondChild());
+      }
+   cg->decReferenceCount(firstChild);
+   node->setRegister(trgReg);
+
+   return trgReg;
+   }
+
 TR::Register *
 J9::ARM64::TreeEvaluator::ZEROCHKEvaluator(TR::Node *node, TR::CodeGenerator *cg)
    {
@@ -3357,6 +3432,151 @@ VMinlineCompareAndSwap(TR::Node *node, TR::CodeGenerator *cg, bool isLong)
    return resultReg;
    }
 
+// Generates an inline loop for java/lang/String.hashCodeImpl{Compressed,Decompressed}(value, offset, count),
+// computing hash = 31 * hash + value[i] over the elements of the backing array.
+//
+// The main loop consumes four elements per iteration as
+//
+//    hash = hash * 31^4 + (c0 * 31^3 + c1 * 31^2 + c2 * 31 + c3)
+//
+// so that only one multiply-add per four elements depends on the previous hash.
+// The remaining elements are consumed one at a time:
+//
+//    mov   hash, #0
+//    add   addr, value, offset, lsl #shift
+//    add   addr, addr, #headerSize
+//    add   end, addr, count, lsl #shift
+//    sub   limit, end, #4 * elementSize
+//    cmp   addr, limit
+//    b.hi  residue
+// unrolledLoop:
+//    ldrb/ldrh  c0..c3, [addr, #0..3 * elementSize]
+//    add   addr, addr, #4 * elementSize
+//    madd  c3, c0, 31^3, c3
+//    madd  c3, c1, 31^2, c3
+//    add   c3, c3, c2, lsl #5
+//    sub   c3, c3, c2
+//    madd  hash, hash, 31^4, c3
+//    cmp   addr, limit
+//    b.ls  unrolledLoop
+// residue:
+//    cmp   addr, end
+//    b.hs  done
+// residueLoop:
+//    ldrb/ldrh  c0, [addr]
+//    add   addr, addr, #elementSize
+//    add   c0, c0, hash, lsl #5
+//    sub   hash, c0, hash
+//    cmp   addr, end
+//    b.lo  residueLoop
+// done:
+//
+static TR::Register *
+inlineStringHashCode(TR::Node *node, bool isCompressed, TR::CodeGenerator *cg)
+   {
+   TR::Node *valueNode = node->getChild(0);
+   TR::Node *offsetNode = node->getChild(1);
+   TR::Node *countNode = node->getChild(2);
+   const int32_t elementShift = isCompressed ? 0 : 1;
+   const int32_t elementSize = 1 << elementShift;
+   const TR::InstOpCode::Mnemonic loadOp = isCompressed ? TR::InstOpCode::ldrbimm : TR::InstOpCode::ldrhimm;
+
+   TR::Register *valueReg = cg->evaluate(valueNode);
+   TR::Register *offsetReg = cg->evaluate(offsetNode);
+   TR::Register *countReg = cg->evaluate(countNode);
+   TR::Register *hashReg = cg->allocateRegister();
+   TR::Register *addrReg = cg->allocateRegister();
+   TR::Register *endReg = cg->allocateRegister();
+   TR::Register *limitReg = cg->allocateRegister();
+   TR::Register *charRegs[4];
+   for (int32_t i = 0; i < 4; i++)
+      charRegs[i] = cg->allocateRegister();
+   TR::Register *mult2Reg = cg->allocateRegister();
+   TR::Register *mult3Reg = cg->allocateRegister();
+   TR::Register *mult4Reg = cg->allocateRegister();
+
+   TR::LabelSymbol *startLabel = generateLabelSymbol(cg);
+   TR::LabelSymbol *unrolledLoopLabel = generateLabelSymbol(cg);
+   TR::LabelSymbol *residueLabel = generateLabelSymbol(cg);
+   TR::LabelSymbol *residueLoopLabel = generateLabelSymbol(cg);
+   TR::LabelSymbol *doneLabel = generateLabelSymbol(cg);
+   startLabel->setStartInternalControlFlow();
+   doneLabel->setEndInternalControlFlow();
+
+   loadConstant32(cg, node, 0, hashReg);
+   loadConstant32(cg, node, 31 * 31, mult2Reg);
+   loadConstant32(cg, node, 31 * 31 * 31, mult3Reg);
+   loadConstant32(cg, node, 31 * 31 * 31 * 31, mult4Reg);
+
+   // offset and count are non-negative, so zero extending them is enough
+   generateTrg1Src1ImmInstruction(cg, TR::InstOpCode::ubfmx, node, addrReg, offsetReg, 31); // uxtw
+   generateTrg1Src2ShiftedInstruction(cg, TR::InstOpCode::addx, node, addrReg, valueReg, addrReg, TR::SH_LSL, elementShift);
+   generateTrg1Src1ImmInstruction(cg, TR::InstOpCode::addimmx, node, addrReg, addrReg, TR::Compiler->om.contiguousArrayHeaderSizeInBytes());
+   generateTrg1Src1ImmInstruction(cg, TR::InstOpCode::ubfmx, node, endReg, countReg, 31); // uxtw
+   generateTrg1Src2ShiftedInstruction(cg, TR::InstOpCode::addx, node, endReg, addrReg, endReg, TR::SH_LSL, elementShift);
+   generateTrg1Src1ImmInstruction(cg, TR::InstOpCode::subimmx, node, limitReg, endReg, 4 * elementSize);
+
+   generateLabelInstruction(cg, TR::InstOpCode::label, node, startLabel);
+   generateCompareInstruction(cg, node, addrReg, limitReg, true);
+   generateConditionalBranchInstruction(cg, TR::InstOpCode::b_cond, node, residueLabel, TR::CC_HI);
+
+   generateLabelInstruction(cg, TR::InstOpCode::label, node, unrolledLoopLabel);
+   for (int32_t i = 0; i < 4; i++)
+      generateTrg1MemInstruction(cg, loadOp, node, charRegs[i], new (cg->trHeapMemory()) TR::MemoryReference(addrReg, i * elementSize, cg));
+   generateTrg1Src1ImmInstruction(cg, TR::InstOpCode::addimmx, node, addrReg, addrReg, 4 * elementSize);
+   generateTrg1Src3Instruction(cg, TR::InstOpCode::maddw, node, charRegs[3], charRegs[0], mult3Reg, charRegs[3]);
+   generateTrg1Src3Instruction(cg, TR::InstOpCode::maddw, node, charRegs[3], charRegs[1], mult2Reg, charRegs[3]);
+   generateTrg1Src2ShiftedInstruction(cg, TR::InstOpCode::addw, node, charRegs[3], charRegs[3], charRegs[2], TR::SH_LSL, 5);
+   generateTrg1Src2Instruction(cg, TR::InstOpCode::subw, node, charRegs[3], charRegs[3], charRegs[2]);
+   generateTrg1Src3Instruction(cg, TR::InstOpCode::maddw, node, hashReg, hashReg, mult4Reg, charRegs[3]);
+   generateCompareInstruction(cg, node, addrReg, limitReg, true);
+   generateConditionalBranchInstruction(cg, TR::InstOpCode::b_cond, node, unrolledLoopLabel, TR::CC_LS);
+
+   generateLabelInstruction(cg, TR::InstOpCode::label, node, residueLabel);
+   generateCompareInstruction(cg, node, addrReg, endReg, true);
+   generateConditionalBranchInstruction(cg, TR::InstOpCode::b_cond, node, doneLabel, TR::CC_CS);
+
+   generateLabelInstruction(cg, TR::InstOpCode::label, node, residueLoopLabel);
+   generateTrg1MemInstruction(cg, loadOp, node, charRegs[0], new (cg->trHeapMemory()) TR::MemoryReference(addrReg, 0, cg));
+   generateTrg1Src1ImmInstruction(cg, TR::InstOpCode::addimmx, node, addrReg, addrReg, elementSize);
+   // hash * 31 + char == (char + (hash << 5)) - hash
+   generateTrg1Src2ShiftedInstruction(cg, TR::InstOpCode::addw, node, charRegs[0], charRegs[0], hashReg, TR::SH_LSL, 5);
+   generateTrg1Src2Instruction(cg, TR::InstOpCode::subw, node, hashReg, charRegs[0], hashReg);
+   generateCompareInstruction(cg, node, addrReg, endReg, true);
+   generateConditionalBranchInstruction(cg, TR::InstOpCode::b_cond, node, residueLoopLabel, TR::CC_CC);
+
+   TR::RegisterDependencyConditions *conditions = new (cg->trHeapMemory()) TR::RegisterDependencyConditions(14, 14, cg->trMemory());
+   TR::addDependency(conditions, valueReg, TR::RealRegister::NoReg, TR_GPR, cg);
+   TR::addDependency(conditions, offsetReg, TR::RealRegister::NoReg, TR_GPR, cg);
+   TR::addDependency(conditions, countReg, TR::RealRegister::NoReg, TR_GPR, cg);
+   TR::addDependency(conditions, hashReg, TR::RealRegister::NoReg, TR_GPR, cg);
+   TR::addDependency(conditions, addrReg, TR::RealRegister::NoReg, TR_GPR, cg);
+   TR::addDependency(conditions, endReg, TR::RealRegister::NoReg, TR_GPR, cg);
+   TR::addDependency(conditions, limitReg, TR::RealRegister::NoReg, TR_GPR, cg);
+   for (int32_t i = 0; i < 4; i++)
+      TR::addDependency(conditions, charRegs[i], TR::RealRegister::NoReg, TR_GPR, cg);
+   TR::addDependency(conditions, mult2Reg, TR::RealRegister::NoReg, TR_GPR, cg);
+   TR::addDependency(conditions, mult3Reg, TR::RealRegister::NoReg, TR_GPR, cg);
+   TR::addDependency(conditions, mult4Reg, TR::RealRegister::NoReg, TR_GPR, cg);
+   generateLabelInstruction(cg, TR::InstOpCode::label, node, doneLabel, conditions);
+
+   cg->stopUsingRegister(addrReg);
+   cg->stopUsingRegister(endReg);
+   cg->stopUsingRegister(limitReg);
+   for (int32_t i = 0; i < 4; i++)
+      cg->stopUsingRegister(charRegs[i]);
+   cg->stopUsingRegister(mult2Reg);
+   cg->stopUsingRegister(mult3Reg);
+   cg->stopUsingRegister(mult4Reg);
+
+   cg->decReferenceCount(valueNode);
+   cg->decReferenceCount(offsetNode);
+   cg->decReferenceCount(countNode);
+
+   node->setRegister(hashReg);
+   return hashReg;
+   }
+
 bool
 J9::ARM64::CodeGenerator::inlineDirectCall(TR::Node *node, TR::Register *&resultReg)
    {
@@ -3405,6 +3625,16 @@ J9::ARM64::CodeGenerator::inlineDirectCall(TR::Node *node, TR::Register *&result
                }
             break;
             }
+         case TR::java_lang_String_hashCodeImplCompressed:
+         case TR::java_lang_String_hashCodeImplDecompressed:
+            {
+            if (cg->getSupportsInlineStringHashCode())
+               {
+               resultReg = inlineStringHashCode(node, methodSymbol->getRecognizedMethod() == TR::java_lang_String_hashCodeImplCompressed, cg);
+               return true;
+               }
+            break;
+            }
 
          default:
             break;
@@ -122,6 +122,14 @@ class OMR_EXTENSIBLE TreeEvaluator: public J9::TreeEvaluator
 
    static TR::Register *arraylengthEvaluator(TR::Node *node, TR::CodeGenerator *cg);
 
+   /**
+    * @brief Handles l2a, folding the decompression of a compressed reference into a single instruction
+    * @param[in] node : node
+    * @param[in] cg : CodeGenerator
+    * @return register containing the decompressed reference
+    */
+   static TR::Register *l2aEvaluator(TR::Node *node, TR::CodeGenerator *cg);
+
    static TR::Register *multianewArrayEvaluator(TR::Node *node, TR::CodeGenerator *cg);
 
    static TR::Register *asynccheckEvaluator(TR::Node *node, TR::CodeGenerator *cg);
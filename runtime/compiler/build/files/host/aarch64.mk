@@ -28,3 +28,7 @@ JIT_PRODUCT_SOURCE_FILES+= \
     compiler/aarch64/runtime/PicBuilder.spp \
     compiler/aarch64/runtime/Recomp.cpp \
     compiler/aarch64/runtime/Recompilation.spp
+
+ifeq ($(OS),linux)
+    JIT_PRODUCT_SOURCE_FILES+=compiler/runtime/PerfEventHWProfiler.cpp
+endif
@@ -21,3 +21,7 @@
 JIT_PRODUCT_SOURCE_FILES+=\
     compiler/x/amd64/runtime/AMD64CompressString.nasm \
     compiler/x/amd64/runtime/AMD64Recompilation.nasm
+
+ifeq ($(OS),linux)
+    JIT_PRODUCT_SOURCE_FILES+=compiler/runtime/PerfEventHWProfiler.cpp
+endif
@@ -4606,6 +4606,18 @@ J9::CodeGenerator::setUpForInstructionSelection()
       if (!_refinedAliasWalkCollector.killsNonIntPrimitiveArrayShadows)  methodInfo->setDoesntKillNonIntPrimitiveArrayShadows(true);
       }
 
+   // Publish the parameters escape analysis found not to escape this method, unless the
+   // trees depend on assumptions that a class load or an OSR transition could undo
+   //
+   if (self()->comp()->hasEscapeSummary() &&
+       !self()->comp()->usesPreexistence() &&
+       !self()->comp()->supportsInduceOSR())
+      {
+      TR_PersistentMethodInfo *methodInfo = TR_PersistentMethodInfo::get(self()->comp());
+      if (methodInfo)
+         methodInfo->setNonEscapingParms(self()->comp()->getNonEscapingParms());
+      }
+
    if (self()->comp()->target().cpu.isX86() && self()->getInlinedGetCurrentThreadMethod())
       {
       TR::RealRegister *ebpReal = self()->getRealVMThreadRegister();
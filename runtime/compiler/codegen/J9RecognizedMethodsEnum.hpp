@@ -425,9 +425,15 @@
    sun_misc_Unsafe_ensureClassInitialized,
 
    jdk_internal_misc_Unsafe_copyMemory0,
+   jdk_internal_misc_Unsafe_setMemory0,
 
    jdk_internal_loader_NativeLibraries_load,
 
+   jdk_internal_vm_vector_VectorSupport_binaryOp,
+   jdk_internal_vm_vector_VectorSupport_load,
+   jdk_internal_vm_vector_VectorSupport_reductionCoerced,
+   jdk_internal_vm_vector_VectorSupport_store,
+
    java_lang_reflect_Array_getLength,
    java_util_Arrays_fill,
    java_util_Arrays_equals,
@@ -351,6 +351,12 @@ class OMR_EXTENSIBLE Compilation : public OMR::CompilationConnector
    void setOSRProhibitedOverRangeOfTrees() { _osrProhibitedOverRangeOfTrees = true; }
    bool isOSRProhibitedOverRangeOfTrees() { return _osrProhibitedOverRangeOfTrees; }
 
+   // Parameters of the method being compiled that escape analysis found to never escape it,
+   // published into the persistent method info by the code generator
+   void setNonEscapingParms(uint32_t parms) { _nonEscapingParms = parms; _hasEscapeSummary = true; }
+   uint32_t getNonEscapingParms() { return _nonEscapingParms; }
+   bool hasEscapeSummary() { return _hasEscapeSummary; }
+
 private:
    enum CachedClassPointerId
       {
@@ -459,6 +465,8 @@ private:
 
    TR::SymbolValidationManager *_symbolValidationManager;
    bool _osrProhibitedOverRangeOfTrees;
+   bool _hasEscapeSummary;
+   uint32_t _nonEscapingParms;
    };
 
 }
@@ -124,6 +124,9 @@ TR::DefaultCompilationStrategy::DefaultCompilationStrategy()
    // initialize the statistics
    for (int32_t i=0; i < TR_MethodEvent::NumEvents; i++)
       _statEventType[i] = 0;
+   _runtimeBudgetPlansCapped = 0;
+   _runtimeBudgetProfilingAvoided = 0;
+   _runtimeBudgetRecompilationsSuppressed = 0;
    }
 
 
@@ -136,6 +139,106 @@ void TR::DefaultCompilationStrategy::shutdown()
       for (int32_t i=0; i < TR_MethodEvent::NumEvents; i++)
          fprintf(stderr, "EventType:%d cases:%u\n", i, _statEventType[i]);
       }
+   if (TR::Options::_runtimeBudget > 0 && TR::Options::getVerboseOption(TR_VerbosePerformance))
+      {
+      TR_VerboseLog::writeLineLocked(TR_Vlog_PERF, "runtimeBudget=%u ms elapsed=%llu ms: plansCapped=%u profilingAvoided=%u recompilationsSuppressed=%u",
+         TR::Options::_runtimeBudget,
+         (unsigned long long)TR::CompilationController::getCompilationInfo()->getPersistentInfo()->getElapsedTime(),
+         _runtimeBudgetPlansCapped, _runtimeBudgetProfilingAvoided, _runtimeBudgetRecompilationsSuppressed);
+      }
+   }
+
+
+bool TR::DefaultCompilationStrategy::enableSwitchToProfiling()
+   {
+   if (TR::CodeCacheManager::instance()->almostOutOfCodeCache())
+      return false;
+   bool allowProfiling = true;
+   getRuntimeBudgetOptLevelCap(&allowProfiling);
+   return allowProfiling;
+   }
+
+
+//---------------------- getRuntimeBudgetOptLevelCap ------------------
+// When the user tells us how long the JVM is going to live, expensive
+// compilations started close to the end will not amortize their cost.
+// Shrink the highest opt level as the remaining time shrinks; AOT loads
+// and cold/warm compilations are never affected.
+//---------------------------------------------------------------------
+TR_Hotness TR::DefaultCompilationStrategy::getRuntimeBudgetOptLevelCap(bool *allowProfiling, bool *allowRecompilation)
+   {
+   if (allowProfiling)
+      *allowProfiling = true;
+   if (allowRecompilation)
+      *allowRecompilation = true;
+
+   uint64_t budget = TR::Options::_runtimeBudget;
+   if (budget == 0)
+      return scorching;
+
+   uint64_t elapsed = TR::CompilationController::getCompilationInfo()->getPersistentInfo()->getElapsedTime();
+   if (elapsed >= budget)
+      {
+      // The estimate was wrong; the JVM outlived it, so behave as usual from now on
+      static bool budgetExceededReported = false;
+      if (!budgetExceededReported)
+         {
+         budgetExceededReported = true;
+         if (TR::Options::getVerboseOption(TR_VerbosePerformance))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_PERF, "runtimeBudget=%u ms exceeded; no longer capping optimization levels", TR::Options::_runtimeBudget);
+         }
+      return scorching;
+      }
+
+   uint64_t remaining = budget - elapsed;
+   if (remaining >= 60000)
+      return scorching;
+   if (allowProfiling)
+      *allowProfiling = false;
+   if (remaining >= 15000)
+      return veryHot;
+   if (remaining < 3000 && allowRecompilation)
+      *allowRecompilation = false;
+   return warm;
+   }
+
+
+//------------------------- applyRuntimeBudget ------------------------
+// Lower the opt level (and drop profiling) of a plan that is about to be
+// created according to getRuntimeBudgetOptLevelCap. currentHotness is the
+// level of the existing body for recompilations and unknownHotness for
+// first time compilations. Returns false if a recompilation is no longer
+// worth doing; recompiling at the same level is only worth it when
+// replacing an AOT body.
+//---------------------------------------------------------------------
+bool TR::DefaultCompilationStrategy::applyRuntimeBudget(TR_Hotness &optLevel, bool &useProfiling, TR_Hotness currentHotness, bool isAotedBody)
+   {
+   if (TR::Options::_runtimeBudget == 0)
+      return true;
+
+   bool allowProfiling, allowRecompilation;
+   TR_Hotness cap = getRuntimeBudgetOptLevelCap(&allowProfiling, &allowRecompilation);
+   bool capped = false;
+   if (useProfiling && !allowProfiling)
+      {
+      useProfiling = false;
+      _runtimeBudgetProfilingAvoided++;
+      capped = true;
+      }
+   if (optLevel > cap)
+      {
+      optLevel = cap;
+      capped = true;
+      }
+   if (currentHotness != unknownHotness &&
+       (!allowRecompilation || optLevel < currentHotness || (optLevel == currentHotness && !isAotedBody)))
+      {
+      _runtimeBudgetRecompilationsSuppressed++;
+      return false;
+      }
+   if (capped)
+      _runtimeBudgetPlansCapped++;
+   return true;
    }
 
 
@@ -271,6 +374,31 @@ TR_OptimizationPlan *TR::DefaultCompilationStrategy::processEvent(TR_MethodEvent
          TR_ASSERT(0, "Bad event type %d", event->_eventType);
       }
 
+   // First time compilations are capped here; sampling driven recompilations
+   // are capped in processJittedSample and the counting ones through _nextLevel
+   if (plan && TR::Options::_runtimeBudget > 0)
+      {
+      switch (event->_eventType)
+         {
+         case TR_MethodEvent::InterpretedMethodSample:
+         case TR_MethodEvent::InterpreterCounterTripped:
+         case TR_MethodEvent::JitCompilationInducedByDLT:
+         case TR_MethodEvent::NewInstanceImpl:
+         case TR_MethodEvent::ShareableMethodHandleThunk:
+         case TR_MethodEvent::CustomMethodHandleThunk:
+            {
+            TR_Hotness optLevel = plan->getOptLevel();
+            bool useProfiling = plan->insertInstrumentation();
+            applyRuntimeBudget(optLevel, useProfiling, unknownHotness);
+            plan->setOptLevel(optLevel);
+            plan->setInsertInstrumentation(useProfiling);
+            }
+            break;
+         default:
+            break;
+         }
+      }
+
    _statEventType[event->_eventType]++;  // statistics
 
    if (TR::CompilationController::verbose() >= TR::CompilationController::LEVEL2)
@@ -937,6 +1065,13 @@ TR::DefaultCompilationStrategy::processJittedSample(TR_MethodEvent *event)
                bodyInfo->setHotStartCountDelta(hotStartCountDelta);
                }
 
+            if (recompile && !applyRuntimeBudget(nextOptLevel, useProfiling, bodyInfo->getHotness(), bodyInfo->getIsAotedBody()))
+               {
+               recompile = false;
+               if (logSampling)
+                  curMsg += sprintf(curMsg, " not recompiled, runtime budget");
+               }
+
             if (recompile)
                {
                // One more test
@@ -1059,6 +1194,14 @@ TR::DefaultCompilationStrategy::processJittedSample(TR_MethodEvent *event)
                   willUpgrade = true;
                   }
                }
+
+            if (recompile && !applyRuntimeBudget(nextOptLevel, useProfiling, bodyInfo->getHotness(), bodyInfo->getIsAotedBody()))
+               {
+               recompile = false;
+               willUpgrade = false;
+               if (logSampling)
+                  curMsg += sprintf(curMsg, " not upgraded, runtime budget");
+               }
             }
 
          // if we don't take any recompilation decision, let's see if we can
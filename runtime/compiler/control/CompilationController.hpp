@@ -81,10 +81,25 @@ class DefaultCompilationStrategy : public TR::CompilationStrategy
    void beforeCodeGen(TR_OptimizationPlan *plan, TR::Recompilation *recomp);
    void postCompilation(TR_OptimizationPlan *plan, TR::Recompilation *recomp);
    void shutdown();
-   virtual bool enableSwitchToProfiling() { return !TR::CodeCacheManager::instance()->almostOutOfCodeCache(); }
+   virtual bool enableSwitchToProfiling();
+
+   /**
+    * Highest opt level worth starting given the time left until -Xjit:runtimeBudget= expires.
+    * @param allowProfiling if not NULL, set to whether profiling compilations can still pay off
+    * @param allowRecompilation if not NULL, set to whether recompilations can still pay off
+    * @return the cap; scorching if no budget was given or the budget was exceeded
+    */
+   static TR_Hotness getRuntimeBudgetOptLevelCap(bool *allowProfiling = NULL, bool *allowRecompilation = NULL);
+
    private:
+   bool applyRuntimeBudget(TR_Hotness &optLevel, bool &useProfiling, TR_Hotness currentHotness, bool isAotedBody = false);
+
    // statistics regarding the events it receives
    unsigned _statEventType[TR_MethodEvent::NumEvents];
+   // statistics regarding -Xjit:runtimeBudget=
+   uint32_t _runtimeBudgetPlansCapped;
+   uint32_t _runtimeBudgetProfilingAvoided;
+   uint32_t _runtimeBudgetRecompilationsSuppressed;
    };
 } // namespace TR
 
@@ -49,6 +49,7 @@
 extern "C" {
 struct J9Method;
 struct J9JITConfig;
+struct J9JITMethodCompilationCost;
 struct J9VMThread;
 struct J9ROMMethod;
 struct J9ClassLoader;
@@ -78,6 +79,7 @@ typedef J9JITExceptionTable TR_MethodMetaData;
 #if defined(J9VM_OPT_JITSERVER)
 class ClientSessionHT;
 class JITServerAOTCacheMap;
+class JITServerSharedProfileCache;
 class JITServerSharedROMClassCache;
 #endif /* defined(J9VM_OPT_JITSERVER) */
 
@@ -329,6 +331,49 @@ class DLTTracking : public J9Method_HT
    void adjustStoredCounterForMethod(J9Method *j9method, int32_t countDiff);
    };
 
+// Per-method record of what the JIT spent on each method (-Xjit:compilationCostLedger).
+// It is fed at the end of every compilation or AOT load and read through
+// J9JITConfig.getCompilationCosts by the com.ibm.lang.management CompilationCost MXBean.
+class TR_CompilationCostLedger
+   {
+   public:
+      TR_PERSISTENT_ALLOC(TR_MemoryBase::CompilationInfo);
+      static const size_t LOG_HT_SIZE = 10;
+      static const size_t HT_SIZE = 1 << LOG_HT_SIZE;
+      static const size_t MASK = HT_SIZE - 1;
+      static const uint32_t MAX_TOP_ENTRIES = 256;
+      struct Entry
+         {
+         Entry *_next; // for linking entries together
+         J9Method *_j9method;
+         char *_signature;
+         uint64_t _cpuTime; // ns, summed over all compilations
+         uint64_t _peakScratchMemory; // bytes, max over all compilations
+         uint32_t _compilations;
+         uint32_t _recompilations;
+         uint32_t _failures;
+         uint32_t _codeSize; // bytes, latest body
+         };
+      static TR_CompilationCostLedger *allocate();
+      TR_CompilationCostLedger(TR::Monitor *monitor);
+      void recordCompilation(TR_J9VMBase *fe, J9Method *j9method, uint64_t cpuTime, uint64_t scratchMemory,
+                             bool isRecompilation, bool failed, uint32_t codeSize);
+      // Fills costs with the (at most count, at most MAX_TOP_ENTRIES) methods with the biggest compilation CPU, biggest first
+      uint32_t getTopEntries(J9JITMethodCompilationCost *costs, uint32_t count);
+      // Method used by various hooks that perform class unloading
+      void onClassUnloading();
+      size_t getNumEntries() const { return _numEntries; }
+
+   private:
+      size_t hash(J9Method *j9method) const
+         { return (size_t)(((uintptr_t)j9method >> 3) ^ ((uintptr_t)j9method >> (3 + LOG_HT_SIZE))) & MASK; }
+      Entry *find(J9Method *j9method) const;
+
+      Entry *_spine[HT_SIZE];
+      TR::Monitor *_monitor;
+      size_t _numEntries;
+   };
+
 
 
 //--------------------------------- TR::CompilationInfo -----------------------
@@ -449,6 +494,7 @@ public:
    static void freeCompilationInfo(J9JITConfig *jitConfig);
    static TR::CompilationInfo *get(J9JITConfig * = 0) { return _compilationRuntime; }
    static bool shouldRetryCompilation(TR_MethodToBeCompiled *entry, TR::Compilation *comp);
+   static void recordCompilationInterruption(TR_MethodToBeCompiled *entry, TR::Compilation *comp);
    static bool shouldAbortCompilation(TR_MethodToBeCompiled *entry, TR::PersistentInfo *persistentInfo);
    static bool canRelocateMethod(TR::Compilation * comp);
    static bool useSeparateCompilationThread();
@@ -689,6 +735,7 @@ public:
    TR_MethodToBeCompiled *addOutOfProcessMethodToBeCompiled(JITServer::ServerStream *stream);
 #endif /* defined(J9VM_OPT_JITSERVER) */
    void                   queueEntry(TR_MethodToBeCompiled *entry);
+   static uint32_t        estimateCompilationCost(TR_MethodToBeCompiled *entry);
    void                   recycleCompilationEntry(TR_MethodToBeCompiled *cur);
 #if defined(J9VM_OPT_JITSERVER)
    void                   requeueOutOfProcessEntry(TR_MethodToBeCompiled *entry);
@@ -896,6 +943,7 @@ public:
    bool isHypervisorPresent() { return _cpuEntitlement.isHypervisorPresent(); }
    double getGuestCpuEntitlement() const { return _cpuEntitlement.getGuestCpuEntitlement(); }
    void computeAndCacheCpuEntitlement() { _cpuEntitlement.computeAndCacheCpuEntitlement(); }
+   int32_t getCgroupCpuLimit() const { return _cpuEntitlement.getCgroupCpuLimit(); }
    double getJvmCpuEntitlement() const { return _cpuEntitlement.getJvmCpuEntitlement(); }
 
    bool importantMethodForStartup(J9Method *method);
@@ -904,6 +952,10 @@ public:
 
    int32_t computeDynamicDumbInlinerBytecodeSizeCutoff(TR::Options *options);
    TR_YesNoMaybe shouldActivateNewCompThread();
+   void autoscaleCompilationThreads();
+   // 0 means the autoscaler has not set a limit on the number of active compilation threads
+   int32_t getCompThreadAutoscaleLimit() const { return _compThreadAutoscaleLimit; }
+   bool exceedsCompThreadAutoscaleLimit() const { return _compThreadAutoscaleLimit > 0 && getNumCompThreadsActive() > _compThreadAutoscaleLimit; }
 #if DEBUG
    void debugPrint(char *debugString);
    void debugPrint(J9VMThread *, char *);
@@ -1016,6 +1068,8 @@ public:
 
    TR_JitSampleInfo &getJitSampleInfoRef() { return _jitSampleInfo; }
    TR_InterpreterSamplingTracking *getInterpSamplTrackingInfo() const { return _interpSamplTrackingInfo; }
+   TR_CompilationCostLedger *getCompilationCostLedger() const { return _compilationCostLedger; }
+   void setCompilationCostLedger(TR_CompilationCostLedger *ledger) { _compilationCostLedger = ledger; }
 
    int32_t getAppSleepNano() const { return _appSleepNano; }
    void setAppSleepNano(int32_t t) { _appSleepNano = t; }
@@ -1075,6 +1129,9 @@ public:
 
    JITServerAOTCacheMap *getJITServerAOTCacheMap() const { return _JITServerAOTCacheMap; }
    void setJITServerAOTCacheMap(JITServerAOTCacheMap *map) { _JITServerAOTCacheMap = map; }
+
+   JITServerSharedProfileCache *getJITServerSharedProfileCache() const { return _sharedProfileCache; }
+   void setJITServerSharedProfileCache(JITServerSharedProfileCache *cache) { _sharedProfileCache = cache; }
 #endif /* defined(J9VM_OPT_JITSERVER) */
 
    static void replenishInvocationCount(J9Method* method, TR::Compilation* comp);
@@ -1276,7 +1333,12 @@ private:
    // It is reset when a compilation thread is suspended, thus possibly
    // freeing scratch segments it holds to
    bool _suspendThreadDueToLowPhysicalMemory;
+   // Maximum number of active compilation threads decided by autoscaleCompilationThreads()
+   int32_t _compThreadAutoscaleLimit;
+   // Consecutive autoscaler decisions; positive to raise the limit, negative to lower it
+   int32_t _compThreadAutoscaleVotes;
    TR_InterpreterSamplingTracking *_interpSamplTrackingInfo;
+   TR_CompilationCostLedger *_compilationCostLedger; // NULL unless -Xjit:compilationCostLedger
 
 #if defined(J9VM_OPT_JITSERVER)
    ClientSessionHT               *_clientSessionHT; // JITServer hashtable that holds session information about JITClients
@@ -1296,6 +1358,7 @@ private:
    JITServer::CompThreadActivationPolicy _activationPolicy;
    JITServerSharedROMClassCache *_sharedROMClassCache;
    JITServerAOTCacheMap *_JITServerAOTCacheMap;
+   JITServerSharedProfileCache *_sharedProfileCache;
 #endif /* defined(J9VM_OPT_JITSERVER) */
    }; // CompilationInfo
 }
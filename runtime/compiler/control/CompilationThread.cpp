@@ -35,6 +35,7 @@
 
 #include "control/CompilationThread.hpp"
 
+#include <algorithm>
 #include <exception>
 #include <limits.h>
 #include <stdlib.h>
@@ -102,6 +103,7 @@
 #include "control/JITServerCompilationThread.hpp"
 #include "control/JITServerHelpers.hpp"
 #include "runtime/JITClientSession.hpp"
+#include "runtime/Listener.hpp"
 #include "net/ClientStream.hpp"
 #include "net/ServerStream.hpp"
 #include "omrformatconsts.h"
@@ -507,6 +509,9 @@ TR_YesNoMaybe TR::CompilationInfo::shouldActivateNewCompThread()
    // Do not activate new threads if we are ramping down
    if (getRampDownMCT())
       return TR_no;
+   // Do not go beyond the limit chosen by the autoscaler
+   if (_compThreadAutoscaleLimit > 0 && getNumCompThreadsActive() >= _compThreadAutoscaleLimit)
+      return TR_no;
 
 #ifdef J9VM_OPT_JITSERVER
    // Always activate in JITServer server mode
@@ -599,6 +604,96 @@ TR_YesNoMaybe TR::CompilationInfo::shouldActivateNewCompThread()
    return TR_maybe;
    }
 
+// Called periodically by the sampling thread when -Xjit:compThreadAutoscaling is used.
+// Raises or lowers the maximum number of active compilation threads depending on the
+// compilation backlog and on how much CPU is left for the application: the throttling
+// of the container's CFS quota when available, the machine idle time otherwise.
+// A change needs _compThreadAutoscalingHysteresis consecutive decisions in the same direction.
+// Threads above the limit suspend themselves after their current compilation.
+void TR::CompilationInfo::autoscaleCompilationThreads()
+   {
+#if defined(J9VM_OPT_JITSERVER)
+   // The server has no application to compete with
+   if (getPersistentInfo()->getRemoteCompilationMode() == JITServer::SERVER)
+      return;
+#endif /* defined(J9VM_OPT_JITSERVER) */
+
+   // Read cgroup stats outside the compilation monitor
+   int32_t throttledPercentage = _cpuEntitlement.computeCgroupCpuThrottling();
+   int32_t cgroupCpuLimit = getCgroupCpuLimit();
+   int32_t cpuIdle = (getCpuUtil() && getCpuUtil()->isFunctional()) ? getCpuUtil()->getCpuIdle() : -1;
+
+   OMR::CriticalSection compMonitor(getCompilationMonitor());
+   if (!_compThreadActivationThresholds)
+      return;
+   int32_t numUsable = getNumUsableCompilationThreads();
+   int32_t numActive = getNumCompThreadsActive();
+   int32_t oldLimit = _compThreadAutoscaleLimit > 0 ? _compThreadAutoscaleLimit : numUsable;
+   // With a CPU quota there is no point in having more compilation threads than CPUs;
+   // the (+ 50) implements rounding, so a quota of [150-250)% allows two threads
+   int32_t quotaLimit = cgroupCpuLimit > 0 ? std::max(1, (cgroupCpuLimit + 50) / 100) : numUsable;
+   int32_t upperLimit = std::min(numUsable, quotaLimit);
+
+   bool backlog = _queueWeight > _compThreadActivationThresholds[numActive];
+   bool appStarved = throttledPercentage >= 0 ?
+      throttledPercentage >= TR::Options::_compThreadAutoscalingThrottleHigh :
+      (cpuIdle >= 0 && cpuIdle < 5);
+   bool headroom = throttledPercentage >= 0 ?
+      throttledPercentage <= TR::Options::_compThreadAutoscalingThrottleLow :
+      (cpuIdle < 0 || cpuIdle >= 10);
+
+   int32_t vote = 0;
+   if (oldLimit > upperLimit || (appStarved && oldLimit > 1 && numActive >= oldLimit))
+      vote = -1;
+   else if (backlog && headroom && oldLimit < upperLimit)
+      vote = 1;
+
+   if (vote == 0 || (vote > 0) != (_compThreadAutoscaleVotes > 0))
+      _compThreadAutoscaleVotes = vote;
+   else
+      _compThreadAutoscaleVotes += vote;
+
+   if (abs(_compThreadAutoscaleVotes) < std::max(1, TR::Options::_compThreadAutoscalingHysteresis))
+      return;
+
+   int32_t newLimit = std::max(1, std::min(upperLimit, oldLimit + vote));
+   _compThreadAutoscaleVotes = 0;
+   _compThreadAutoscaleLimit = newLimit;
+   if (newLimit == oldLimit)
+      return;
+
+   if (TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerboseCompilationThreads))
+      {
+      TR_VerboseLog::writeLineLocked(TR_Vlog_INFO, "t=%6u Autoscaler changed comp thread limit %d -> %d Qweight=%d active=%d throttled=%d%% cpuIdle=%d%% cgroupCpuLimit=%d%%",
+         (uint32_t)getPersistentInfo()->getElapsedTime(),
+         oldLimit,
+         newLimit,
+         _queueWeight,
+         numActive,
+         throttledPercentage,
+         cpuIdle,
+         cgroupCpuLimit);
+      }
+
+   // Do not wait for the next compilation request to use the new capacity
+   if (newLimit > oldLimit && shouldActivateNewCompThread() == TR_yes)
+      {
+      TR::CompilationInfoPerThread *compInfoPT = getFirstSuspendedCompilationThread();
+      if (compInfoPT)
+         {
+         compInfoPT->resumeCompilationThread();
+         if (TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerboseCompilationThreads))
+            {
+            TR_VerboseLog::writeLineLocked(TR_Vlog_INFO, "t=%6u Activate compThread %d after autoscaling Qweight=%d active=%d",
+               (uint32_t)getPersistentInfo()->getElapsedTime(),
+               compInfoPT->getCompThreadId(),
+               _queueWeight,
+               getNumCompThreadsActive());
+            }
+         }
+      }
+   }
+
 bool TR::CompilationInfo::importantMethodForStartup(J9Method *method)
    {
    if (getMethodBytecodeSize(method) < TR::Options::_startupMethodDontDowngradeThreshold) // filter by size as well
@@ -1115,6 +1210,8 @@ TR::CompilationInfo::CompilationInfo(J9JITConfig *jitConfig) :
    OMRPORT_ACCESS_FROM_J9PORT(jitConfig->javaVM->portLibrary);
    _cgroupMemorySubsystemEnabled = (OMR_CGROUP_SUBSYSTEM_MEMORY == omrsysinfo_cgroup_are_subsystems_enabled(OMR_CGROUP_SUBSYSTEM_MEMORY));
    _suspendThreadDueToLowPhysicalMemory = false;
+   _compThreadAutoscaleLimit = 0;
+   _compThreadAutoscaleVotes = 0;
 
    // Initialize the compilation monitor
    //
@@ -1185,6 +1282,7 @@ TR::CompilationInfo::CompilationInfo(J9JITConfig *jitConfig) :
    _lowPriorityCompilationScheduler.setCompInfo(this);
    _JProfilingQueue.setCompInfo(this);
    _interpSamplTrackingInfo = new (PERSISTENT_NEW) TR_InterpreterSamplingTracking(this);
+   _compilationCostLedger = NULL; // allocated when options are processed
 #if defined(J9VM_OPT_JITSERVER)
    _clientSessionHT = NULL; // This will be set later when options are processed
    _unloadedClassesTempList = NULL;
@@ -1198,6 +1296,7 @@ TR::CompilationInfo::CompilationInfo(J9JITConfig *jitConfig) :
    _activationPolicy = JITServer::CompThreadActivationPolicy::AGGRESSIVE;
    _sharedROMClassCache = NULL;
    _JITServerAOTCacheMap = NULL;
+   _sharedProfileCache = NULL;
 #endif /* defined(J9VM_OPT_JITSERVER) */
    }
 
@@ -1772,7 +1871,13 @@ bool TR::CompilationInfo::canProcessLowPriorityRequest()
    // (2) some idle CPU
    // (3) current JVM not taking its entire share of CPU entitlement
    //
-   if (TR::Options::getCmdLineOptions()->getOption(TR_ConcurrentLPQ) &&
+   // While the application is idle, spare cores are also used to drain the LPQ
+   // concurrently, so that upgrades are done before the load comes back
+   //
+   static bool disableIdleConcurrentLPQ = feGetEnv("TR_DisableIdleConcurrentLPQ") != NULL;
+   bool concurrentLPQ = TR::Options::getCmdLineOptions()->getOption(TR_ConcurrentLPQ) ||
+                        (!disableIdleConcurrentLPQ && getPersistentInfo()->getJitState() == IDLE_STATE);
+   if (concurrentLPQ &&
        _jitConfig->javaVM->phase == J9VM_PHASE_NOT_STARTUP) // ConcurrentLPQ is too damaging to startup
       {
       if ((getCpuUtil() && getCpuUtil()->isFunctional() &&
@@ -2154,6 +2259,67 @@ bool TR::CompilationInfo::shouldAbortCompilation(TR_MethodToBeCompiled *entry, T
    return false;
    }
 
+// An interrupted compilation cannot be resumed: class unloading or HCR may have
+// invalidated any of the IL, so the retry starts over. Keep track of the work
+// lost so that long compilations are not penalized for being interrupted:
+// - an interruption after at least _interruptedCompFreeRetryThreshold ms does
+//   not use up one of the compilation attempts of the request;
+// - after _interruptionsBeforeDowngrade interruptions the retry is done at the
+//   next lower optimization level (above warm), which shortens the window
+//   during which the compilation can be interrupted again.
+// Executed with compilationMonitor in hand
+//
+void TR::CompilationInfo::recordCompilationInterruption(TR_MethodToBeCompiled *entry, TR::Compilation *comp)
+   {
+   if (entry->_numInterruptions < 0xff)
+      entry->_numInterruptions++;
+
+   uint32_t lostMs = 0;
+   if (entry->_compInfoPT)
+      {
+      PORT_ACCESS_FROM_JITCONFIG(comp->fej9()->getJ9JITConfig());
+      lostMs = (uint32_t)((j9time_usec_clock() - entry->_compInfoPT->getTimeWhenCompStarted()) / 1000);
+      entry->_timeLostToInterruptionsMs += lostMs;
+      }
+
+   // Bounded, so that a request cannot be retried forever
+   static const uint8_t MAX_FREE_RETRIES = 8;
+   bool freeRetry = lostMs >= (uint32_t)TR::Options::_interruptedCompFreeRetryThreshold &&
+                    entry->_numInterruptions <= MAX_FREE_RETRIES &&
+                    entry->_compilationAttemptsLeft < MAX_COMPILE_ATTEMPTS;
+   if (freeRetry)
+      entry->_compilationAttemptsLeft++; // compensates the decrement done when the entry is requeued
+
+   TR_OptimizationPlan *plan = entry->_optimizationPlan;
+   TR_Hotness oldHotness = plan ? plan->getOptLevel() : unknownHotness;
+   if (plan &&
+       TR::Options::_interruptionsBeforeDowngrade > 0 &&
+       entry->_numInterruptions >= TR::Options::_interruptionsBeforeDowngrade &&
+       oldHotness > warm && oldHotness <= scorching &&
+       comp->allowRecompilation())
+      {
+      plan->setOptLevel((TR_Hotness)(oldHotness - 1));
+      plan->setInsertInstrumentation(false); // prevent profiling
+      entry->_numInterruptions = 0; // give the lower level its own allowance
+      }
+
+   if (TR::Options::getVerboseOption(TR_VerboseCompilationDispatch))
+      {
+      bool downgraded = plan && plan->getOptLevel() != oldHotness;
+      TR_VerboseLog::writeLineLocked(
+         TR_Vlog_DISPATCH,
+         "Compilation of %s @ %s interrupted after %u ms (%u ms lost in total) will be retried%s%s%s",
+         comp->signature(),
+         comp->getHotnessName(),
+         lostMs,
+         entry->_timeLostToInterruptionsMs,
+         freeRetry ? " without using an attempt" : "",
+         downgraded ? " at " : "",
+         downgraded ? TR::Compilation::getHotnessName(plan->getOptLevel()) : ""
+         );
+      }
+   }
+
 // This method has side-effects, It modifies the optimization plan and persistentMethodInfo
 // This method is executed with compilationMonitor in hand
 //
@@ -2225,13 +2391,16 @@ bool TR::CompilationInfo::shouldRetryCompilation(TR_MethodToBeCompiled *entry, T
             case compilationStreamVersionIncompatible:
             case compilationStreamLostMessage:
 #endif
-            case compilationInterrupted:
             case compilationCodeReservationFailure:
             case compilationRecoverableTrampolineFailure:
             case compilationIllegalCodeCacheSwitch:
             case compilationRecoverableCodeCacheError:
                tryCompilingAgain = true;
                break;
+            case compilationInterrupted:
+               recordCompilationInterruption(entry, comp);
+               tryCompilingAgain = true;
+               break;
             case compilationExcessiveComplexity:
             case compilationHeapLimitExceeded:
             case compilationLowPhysicalMemory:
@@ -4461,6 +4630,7 @@ TR::CompilationInfoPerThread::processEntry(TR_MethodToBeCompiled &entry, J9::J9S
       && (
          compInfo->getRampDownMCT() // force to have only one thread active
          || compInfo->getSuspendThreadDueToLowPhysicalMemory()
+         || compInfo->exceedsCompThreadAutoscaleLimit()
          || (
             !tryCompilingAgain
             /*&& compInfoPT->getCompThreadId() != 0*/
@@ -4479,13 +4649,14 @@ TR::CompilationInfoPerThread::processEntry(TR_MethodToBeCompiled &entry, J9::J9S
       compInfo->decNumCompThreadsActive();
       if (TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerboseCompilationThreads))
          {
-         TR_VerboseLog::writeLineLocked(TR_Vlog_INFO, "t=%6u Suspend compThread %d Qweight=%d active=%d %s %s %s",
+         TR_VerboseLog::writeLineLocked(TR_Vlog_INFO, "t=%6u Suspend compThread %d Qweight=%d active=%d %s %s %s %s",
             (uint32_t)compInfo->getPersistentInfo()->getElapsedTime(),
             getCompThreadId(),
             compInfo->getQueueWeight(),
             compInfo->getNumCompThreadsActive(),
             compInfo->getRampDownMCT() ? "RampDownMCT" : "",
             compInfo->getSuspendThreadDueToLowPhysicalMemory() ? "LowPhysicalMem" : "",
+            (compInfo->getCompThreadAutoscaleLimit() > 0 && compInfo->getNumCompThreadsActive() >= compInfo->getCompThreadAutoscaleLimit()) ? "Autoscaled" : "",
 #if defined(J9VM_OPT_JITSERVER)
             compInfo->getCompThreadActivationPolicy() == JITServer::CompThreadActivationPolicy::SUSPEND ? "ServerLowPhysicalMem" :
 #endif
@@ -4834,7 +5005,14 @@ TR::CompilationInfo::addMethodToBeCompiled(TR::IlGeneratorMethodDetails & detail
       if (!details.isOrdinaryMethod() || details.isNewInstanceThunk() || isJNINativeMethodRequest)
          entryWeight = THUNKS_WEIGHT; // 1
       else if (methodIsInSharedCache == TR_yes && !pc) // first time compilations that are AOT loads
-         entryWeight = TR::Options::_weightOfAOTLoad;
+         {
+         // Eager AOT loads arrive in bulk during startup; give them more weight
+         // so that additional compilation threads are activated to relocate them in parallel
+         if (TR::Options::_eagerAOTLoadSCount >= 0 && TR::Compiler->vm.isVMInStartupPhase(_jitConfig))
+            entryWeight = TR::Options::_weightOfEagerAOTLoad;
+         else
+            entryWeight = TR::Options::_weightOfAOTLoad;
+         }
       else if (optimizationPlan->getOptLevel() == warm) // most common case first
          {
          // Compilation may be downgraded to cold during classLoadPhase
@@ -4948,9 +5126,45 @@ TR::CompilationInfo::addMethodToBeCompiled(TR::IlGeneratorMethodDetails & detail
    return cur;
    }
 
+//----------------------- estimateCompilationCost ------------------------
+// Relative cost of a compilation request, used to order requests of the
+// same priority. The bytecode size is a cheap proxy for the size of the
+// trees, scaled by how expensive the optimization level is.
+//------------------------------------------------------------------------
+uint32_t TR::CompilationInfo::estimateCompilationCost(TR_MethodToBeCompiled *entry)
+   {
+   TR::IlGeneratorMethodDetails &details = entry->getMethodDetails();
+   // Relocations and thunks are cheap regardless of the method
+   if (entry->_methodIsInSharedCache == TR_yes || !details.isOrdinaryMethod() || details.isNewInstanceThunk())
+      return 1;
+
+   J9Method *method = details.getMethod();
+   if (!method || (J9_ROM_METHOD_FROM_RAM_METHOD(method)->modifiers & J9AccNative))
+      return 1;
+
+   uint32_t cost = getMethodBytecodeSize(method) + 1;
+   TR_Hotness optLevel = entry->_optimizationPlan ? entry->_optimizationPlan->getOptLevel() : warm;
+   switch (optLevel)
+      {
+      case noOpt:     cost *= 1; break;
+      case cold:      cost *= 2; break;
+      case warm:      cost *= 4; break;
+      case hot:       cost *= 12; break;
+      case veryHot:   cost *= 24; break;
+      case scorching: cost *= 32; break;
+      default:        cost *= 4;
+      }
+   if (entry->_optimizationPlan && entry->_optimizationPlan->insertInstrumentation())
+      cost += cost >> 1;
+   return cost;
+   }
+
 //--------------------------- queueEntry ---------------------------------
 // Insert the compilation request in the queue at the appropriate place
 // based on its priority. Must have compilationQueueMonitor in hanb
+// With -Xjit:compQueueMaxTimesOvertaken=<n>, an async request also goes
+// ahead of more expensive requests of the same priority (shortest job
+// first), unless they have already been overtaken <n> times.
 //------------------------------------------------------------------------
 void TR::CompilationInfo::queueEntry(TR_MethodToBeCompiled *entry)
    {
@@ -4958,22 +5172,36 @@ void TR::CompilationInfo::queueEntry(TR_MethodToBeCompiled *entry)
 
    entry->_freeTag |= ENTRY_QUEUED;
 
-   if (!_methodQueue || _methodQueue->_priority < entry->_priority)
+   bool shortestJobFirst = TR::Options::_compQueueMaxTimesOvertaken > 0 && entry->_priority < CP_SYNC_MIN;
+   if (shortestJobFirst)
+      entry->_estimatedCost = estimateCompilationCost(entry);
+
+   TR_MethodToBeCompiled *prev = NULL;
+   TR_MethodToBeCompiled *next = _methodQueue;
+   while (next)
       {
-      entry->_next = _methodQueue;
-      _methodQueue = entry;
+      if (next->_priority < entry->_priority)
+         break;
+      if (shortestJobFirst &&
+          next->_priority == entry->_priority &&
+          next->_estimatedCost > entry->_estimatedCost &&
+          next->_numTimesOvertaken < TR::Options::_compQueueMaxTimesOvertaken)
+         break;
+      prev = next;
+      next = next->_next;
       }
+
+   entry->_next = next;
+   if (prev)
+      prev->_next = entry;
    else
+      _methodQueue = entry;
+
+   if (shortestJobFirst)
       {
-      for (TR_MethodToBeCompiled *prev = _methodQueue; ; prev = prev->_next)
-         {
-         if (!prev->_next || prev->_next->_priority < entry->_priority)
-            {
-            entry->_next = prev->_next;
-            prev->_next = entry;
-            break;
-            }
-         }
+      for (TR_MethodToBeCompiled *cur = next; cur && cur->_priority == entry->_priority; cur = cur->_next)
+         if (cur->_numTimesOvertaken < 0xff)
+            cur->_numTimesOvertaken++;
       }
    }
 
@@ -7140,7 +7368,11 @@ TR::CompilationInfoPerThreadBase::shouldPerformLocalComp(const TR_MethodToBeComp
    J9Method *method = entry->getMethodDetails().getMethod();
    uint32_t bcsz = TR::CompilationInfo::getMethodBytecodeSize(method);
   
-   return (isMemoryCheapCompilation(bcsz, optLevel) && isCPUCheapCompilation(bcsz, optLevel));
+   // Expensive compilations are always sent to the server. Among the ones we can afford locally,
+   // keep local those that have been completing faster locally than remotely, or all of them
+   // while the server is busy
+   return (isMemoryCheapCompilation(bcsz, optLevel) && isCPUCheapCompilation(bcsz, optLevel) &&
+           JITServerHelpers::shouldPreferLocalCompilation(optLevel, bcsz));
    }
 
 void
@@ -7919,6 +8151,17 @@ TR::CompilationInfoPerThreadBase::compile(J9VMThread * vmThread,
    vmThread->omrVMThread->vmState = J9VMSTATE_JIT | J9VMSTATE_MINOR;
    vmThread->jitMethodToBeCompiled = method;
 
+   TR_CompilationCostLedger *costLedger = _compInfo.getCompilationCostLedger();
+#if defined(J9VM_OPT_JITSERVER)
+   // Methods compiled at the server belong to the client
+   if (_compInfo.getPersistentInfo()->getRemoteCompilationMode() == JITServer::SERVER)
+      costLedger = NULL;
+#endif /* defined(J9VM_OPT_JITSERVER) */
+   if (entry->getMethodDetails().isJitDumpMethod())
+      costLedger = NULL;
+   int64_t cpuTimeWhenCompStarted = costLedger ? j9thread_get_self_cpu_time(j9thread_self()) : 0;
+   uint64_t scratchBytesAllocated = 0;
+
    try
       {
       TR::RawAllocator rawAllocator(vmThread->javaVM);
@@ -8021,6 +8264,7 @@ TR::CompilationInfoPerThreadBase::compile(J9VMThread * vmThread,
                                      aotCachedMethod, metaData,
                                      canDoRelocatableCompile, eligibleForRelocatableCompile,
                                      reloRuntime);
+      scratchBytesAllocated = defaultSegmentProvider.regionBytesAllocated();
       }
    catch (const std::exception &e)
       {
@@ -8061,6 +8305,19 @@ TR::CompilationInfoPerThreadBase::compile(J9VMThread * vmThread,
                                      reloRuntime);
       }
 
+   if (costLedger && !entry->_unloadedMethod)
+      {
+      int64_t cpuTime = j9thread_get_self_cpu_time(j9thread_self()) - cpuTimeWhenCompStarted;
+      uint32_t codeSize = 0;
+      if (startPC && metaData)
+         {
+         codeSize = (uint32_t)(metaData->endPC - metaData->startPC);
+         if (metaData->startColdPC)
+            codeSize = (uint32_t)((metaData->endWarmPC - metaData->startPC) + (metaData->endPC - metaData->startColdPC));
+         }
+      costLedger->recordCompilation(_vm, method, cpuTime > 0 ? (uint64_t)cpuTime : 0, scratchBytesAllocated,
+                                    entry->_oldStartPC != NULL, startPC == NULL, codeSize);
+      }
 
    vmThread->omrVMThread->vmState = oldState;
    vmThread->jitMethodToBeCompiled = NULL;
@@ -8205,10 +8462,19 @@ TR::CompilationInfoPerThreadBase::wrappedCompile(J9PortLibrary *portLib, void *
 #endif /* defined(J9VM_OPT_JITSERVER) */
 
             bool aotCompilationReUpgradedToWarm = false;
+            bool aotProfiledCompilation = false;
             if (that->_methodBeingCompiled->_useAotCompilation)
                {
+               // Profiled AOT compilations need the SVM to validate the profiled classes
+               // they guard on, and the IProfiler data persisted in the SCC to find them
+               aotProfiledCompilation = TR::Options::_aotProfiledCompilation &&
+                                        vm->canUseSymbolValidationManager() &&
+                                        TR::Options::getAOTCmdLineOptions()->getOption(TR_EnableSymbolValidationManager) &&
+                                        !TR::Options::getAOTCmdLineOptions()->getOption(TR_DisablePersistIProfile);
+
                // In some circumstances AOT compilations are performed at warm
                if ((TR::Options::getCmdLineOptions()->getAggressivityLevel() == TR::Options::AGGRESSIVE_AOT ||
+                  aotProfiledCompilation ||
                   that->getCompilationInfo()->importantMethodForStartup((J9Method*)method) ||
                   (!TR::Compiler->target.cpu.isPower() && // Temporary change until we figure out the AOT bug on PPC
                    !TR::Options::getAOTCmdLineOptions()->getOption(TR_DisableAotAtCheapWarm))) &&
@@ -8287,8 +8553,9 @@ TR::CompilationInfoPerThreadBase::wrappedCompile(J9PortLibrary *portLib, void *
                if (options->getInitialBCount() == 0 || options->getInitialCount() == 0)
                   options->setOption(TR_DisableDelayRelocationForAOTCompilations, true);
 
-               // Perform less inlining if we artificially upgraded this AOT compilation to warm
-               if (aotCompilationReUpgradedToWarm)
+               // Perform less inlining if we artificially upgraded this AOT compilation to warm,
+               // unless the upgrade was done to inline and devirtualize based on the profile
+               if (aotCompilationReUpgradedToWarm && !aotProfiledCompilation)
                   options->setInlinerOptionsForAggressiveAOT();
 
                TR_ASSERT(vm->isAOT_DEPRECATED_DO_NOT_USE(), "assertion failure");
@@ -8476,6 +8743,11 @@ TR::CompilationInfoPerThreadBase::wrappedCompile(J9PortLibrary *portLib, void *
                         methodInfo->incrementNumberOfInlinedMethodRedefinition();
                      if (methodInfo->getNumberOfInlinedMethodRedefinition() >= 2)
                         options->setOption(TR_DisableNextGenHCR);
+                     // A method whose bodies keep getting invalidated because of failed
+                     // preexistence assumptions should stop speculating on its arguments,
+                     // otherwise it cycles between compilation and invalidation
+                     if (methodInfo->getNumberOfInvalidations() >= 2)
+                        options->setDisabled(OMR::invariantArgumentPreexistence, true);
                      }
                   }
 
@@ -9029,6 +9301,14 @@ TR::CompilationInfoPerThreadBase::wrappedCompile(J9PortLibrary *portLib, void *
                }
             }
          }
+
+      // Remember the AOT bodies used during startup, so that subsequent runs can load them eagerly
+      if (metaData && sc && TR::Options::_eagerAOTLoadSCount >= 0 &&
+          (that->_methodBeingCompiled->isAotLoad() || that->_methodBeingCompiled->_useAotCompilation) &&
+          TR::Compiler->vm.isVMInStartupPhase(jitConfig))
+         {
+         sc->addHint(that->_methodBeingCompiled->getMethodDetails().getMethod(), TR_HintEagerAOTLoad);
+         }
       }
 #if defined(J9VM_OPT_JITSERVER)
    catch (const JITServer::StreamFailure &e)
@@ -10772,6 +11052,16 @@ void TR::CompilationInfoPerThreadBase::logCompilationSuccess(
          TR::CompilationInfoPerThread *cipt = (TR::CompilationInfoPerThread*)this;
          cipt->setLastCompilationDuration(translationTime / 1000);
          }
+#if defined(J9VM_OPT_JITSERVER)
+      // Feed the heuristic that decides which compilations are kept local at the client
+      if ((_compInfo.getPersistentInfo()->getRemoteCompilationMode() == JITServer::CLIENT) &&
+          !_methodBeingCompiled->_useAotCompilation)
+         {
+         J9Method *compiledMethod = _methodBeingCompiled->getMethodDetails().getMethod();
+         JITServerHelpers::recordCompilationTime(_methodBeingCompiled->isRemoteCompReq(), compiler->getMethodHotness(),
+                                                 TR::CompilationInfo::getMethodBytecodeSize(compiledMethod), translationTime);
+         }
+#endif /* defined(J9VM_OPT_JITSERVER) */
 
       UDATA gcDataBytes = _jitConfig->lastGCDataAllocSize;
       UDATA atlasBytes = _jitConfig->lastExceptionTableAllocSize;
@@ -12911,6 +13201,148 @@ void DLTTracking::adjustStoredCounterForMethod(J9Method *j9method, int32_t count
 
 
 
+TR_CompilationCostLedger *TR_CompilationCostLedger::allocate()
+   {
+   TR::Monitor *monitor = TR::Monitor::create("JIT-CompilationCostLedgerMonitor");
+   if (!monitor)
+      return NULL;
+   return new (PERSISTENT_NEW) TR_CompilationCostLedger(monitor);
+   }
+
+TR_CompilationCostLedger::TR_CompilationCostLedger(TR::Monitor *monitor)
+   {
+   memset(_spine, 0, HT_SIZE * sizeof(Entry*));
+   _monitor = monitor;
+   _numEntries = 0;
+   }
+
+// Must have the ledger monitor in hand
+TR_CompilationCostLedger::Entry *TR_CompilationCostLedger::find(J9Method *j9method) const
+   {
+   Entry *entry = _spine[hash(j9method)];
+   for (; entry; entry = entry->_next)
+      if (entry->_j9method == j9method)
+         break;
+   return entry;
+   }
+
+// Executed by the compilation thread at the end of every compilation; needs VM access
+// so that the method cannot be unloaded while its signature is printed
+void TR_CompilationCostLedger::recordCompilation(TR_J9VMBase *fe, J9Method *j9method, uint64_t cpuTime, uint64_t scratchMemory,
+                                                 bool isRecompilation, bool failed, uint32_t codeSize)
+   {
+   OMR::CriticalSection recordCost(_monitor);
+   Entry *entry = find(j9method);
+   if (!entry)
+      {
+      char sig[J9JIT_COMPILATION_COST_NAME_LENGTH];
+      int32_t sigLen = fe->printTruncatedSignature(sig, sizeof(sig), (TR_OpaqueMethodBlock *)j9method);
+      entry = (Entry *)jitPersistentAlloc(sizeof(Entry));
+      char *signature = (char *)jitPersistentAlloc(sigLen + 1);
+      if (!entry || !signature) // OOM
+         {
+         if (entry)
+            jitPersistentFree(entry);
+         if (signature)
+            jitPersistentFree(signature);
+         return;
+         }
+      memcpy(signature, sig, sigLen);
+      signature[sigLen] = 0;
+      memset(entry, 0, sizeof(Entry));
+      entry->_j9method = j9method;
+      entry->_signature = signature;
+      size_t bucketID = hash(j9method);
+      entry->_next = _spine[bucketID];
+      _spine[bucketID] = entry;
+      _numEntries++;
+      }
+   entry->_cpuTime += cpuTime;
+   if (scratchMemory > entry->_peakScratchMemory)
+      entry->_peakScratchMemory = scratchMemory;
+   entry->_compilations++;
+   if (isRecompilation)
+      entry->_recompilations++;
+   if (failed)
+      entry->_failures++;
+   else
+      entry->_codeSize = codeSize;
+   }
+
+uint32_t TR_CompilationCostLedger::getTopEntries(J9JITMethodCompilationCost *costs, uint32_t count)
+   {
+   if (count == 0)
+      return 0;
+
+   // Keep the output sorted by descending CPU time while scanning; count is
+   // expected to be small compared to the number of entries
+   OMR::CriticalSection readCosts(_monitor);
+   Entry *top[MAX_TOP_ENTRIES];
+   if (count > MAX_TOP_ENTRIES)
+      count = MAX_TOP_ENTRIES;
+   uint32_t numTop = 0;
+   for (size_t bucketID = 0; bucketID < HT_SIZE; bucketID++)
+      {
+      for (Entry *entry = _spine[bucketID]; entry; entry = entry->_next)
+         {
+         if (numTop == count && entry->_cpuTime <= top[numTop - 1]->_cpuTime)
+            continue;
+         uint32_t pos = (numTop < count) ? numTop++ : numTop - 1;
+         for (; pos > 0 && top[pos - 1]->_cpuTime < entry->_cpuTime; pos--)
+            top[pos] = top[pos - 1];
+         top[pos] = entry;
+         }
+      }
+
+   for (uint32_t i = 0; i < numTop; i++)
+      {
+      Entry *entry = top[i];
+      costs[i].cpuTime = entry->_cpuTime;
+      costs[i].peakScratchMemory = entry->_peakScratchMemory;
+      costs[i].compilations = entry->_compilations;
+      costs[i].recompilations = entry->_recompilations;
+      costs[i].failures = entry->_failures;
+      costs[i].codeSize = entry->_codeSize;
+      strncpy(costs[i].methodName, entry->_signature, J9JIT_COMPILATION_COST_NAME_LENGTH - 1);
+      costs[i].methodName[J9JIT_COMPILATION_COST_NAME_LENGTH - 1] = 0;
+      }
+   return numTop;
+   }
+
+// onClassUnloading is executed when all threads are stopped, but readers
+// of the ledger do not need VM access so the monitor is still needed
+void TR_CompilationCostLedger::onClassUnloading()
+   {
+   OMR::CriticalSection purgeCosts(_monitor);
+   for (size_t bucketID = 0; bucketID < HT_SIZE; bucketID++)
+      {
+      Entry *entry = _spine[bucketID];
+      Entry *prev = NULL;
+      while (entry)
+         {
+         J9Class *clazz = J9_CLASS_FROM_METHOD(entry->_j9method);
+         if (J9_ARE_ALL_BITS_SET(clazz->classLoader->gcFlags, J9_GC_CLASS_LOADER_DEAD)
+            || (J9CLASS_FLAGS(clazz) & J9AccClassDying))
+            {
+            Entry *removed = entry;
+            if (prev)
+               prev->_next = entry->_next;
+            else
+               _spine[bucketID] = entry->_next;
+            entry = entry->_next;
+            jitPersistentFree(removed->_signature);
+            jitPersistentFree(removed);
+            _numEntries--;
+            continue;
+            }
+         prev = entry;
+         entry = entry->_next;
+         }
+      }
+   }
+
+
+
 // Must have compMonitor in hand
 void TR_JProfilingQueue::enqueueCompReq(TR_MethodToBeCompiled *compReq)
    {
@@ -13171,7 +13603,16 @@ TR::CompilationInfo::requeueOutOfProcessEntry(TR_MethodToBeCompiled *entry)
    if (feGetEnv("TR_EnableJITServerPerCompConn"))
       return;
 
-   if (entry->_stream && addOutOfProcessMethodToBeCompiled(entry->_stream))
+   if (!entry->_stream)
+      return;
+
+   // Let the listener wait for the next request on this stream, so that
+   // compilation threads are not tied up by idle client connections
+   TR_Listener *listener = ((TR_JitPrivateConfig *)_jitConfig->privateConfig)->listener;
+   if (listener && listener->parkStream(entry->_stream))
+      return;
+
+   if (addOutOfProcessMethodToBeCompiled(entry->_stream))
       {
       // successfully queued the new entry, so notify a thread
       getCompilationMonitor()->notifyAll();
@@ -546,9 +546,9 @@ IDATA J9VMDllMain(J9JavaVM* vm, IDATA stage, void * reserved)
             // Also set name for interpreter profiler thread if it exists
 #if defined (J9VM_INTERP_PROFILING_BYTECODES)
             TR_IProfiler *iProfiler = fe->getIProfiler();
-            if (iProfiler)
+            for (int32_t i = 0; iProfiler && i < iProfiler->getNumIProfilerThreads(); i++)
                {
-               J9VMThread *iProfilerThread = iProfiler->getIProfilerThread();
+               J9VMThread *iProfilerThread = iProfiler->getIProfilerThread(i);
                if (iProfilerThread)
                   {
                   vm->internalVMFunctions->initializeAttachedThread
@@ -80,6 +80,7 @@
 #include "env/SystemSegmentProvider.hpp"
 #if defined(J9VM_OPT_JITSERVER)
 #include "control/JITServerHelpers.hpp"
+#include "runtime/JITServerAOTCache.hpp"
 #include "runtime/JITServerIProfiler.hpp"
 #include "runtime/JITServerStatisticsThread.hpp"
 #include "runtime/Listener.hpp"
@@ -481,6 +482,15 @@ static void jitHookInitializeSendTarget(J9HookInterface * * hook, UDATA eventNum
                         TR_VerboseLog::writeLineLocked(TR_Vlog_SCHINTS,"Found hint in sc, increase scount to: %d, wanted scount: %d", scount, newScount);
                      }
                   }
+               // Load eagerly the AOT bodies that were used during startup in previous runs
+               else if (TR::Options::_eagerAOTLoadSCount >= 0 &&
+                        jitConfig->javaVM->phase != J9VM_PHASE_NOT_STARTUP &&
+                        sc && sc->isHint(method, TR_HintEagerAOTLoad))
+                  {
+                  scount = std::min(scount, TR::Options::_eagerAOTLoadSCount);
+                  if (optionsAOT->getVerboseOption(TR_VerboseSCHints) || optionsJIT->getVerboseOption(TR_VerboseSCHints))
+                     TR_VerboseLog::writeLineLocked(TR_Vlog_SCHINTS,"Found startup hint in sc, lower scount to: %d", scount);
+                  }
                count = scount;
                compInfo->incrementNumMethodsFoundInSharedCache();
                }
@@ -1395,6 +1405,10 @@ static void jitMethodSampleInterrupt(J9VMThread* vmThread, IDATA handlerKey, voi
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
 static void jitHookClassesUnloadEnd(J9HookInterface * * hookInterface, UDATA eventNum, void * eventData, void * userData)
    {
+   // Metadata of unloaded methods has been returned to the data cache pool; merge it
+   // and give fully free segments back to the VM
+   if (TR_DataCacheManager::getManager())
+      TR_DataCacheManager::getManager()->coalesceFreeAllocations();
    }
 #endif
 
@@ -1699,7 +1713,7 @@ static void accumulateAndPrintDebugCounters(J9JITConfig *jitConfig)
 
 static void jitHookThreadStart(J9HookInterface * * hookInterface, UDATA eventNum, void * eventData, void * userData)
    {
-#if defined(TR_HOST_POWER)
+#if defined(TR_HOST_POWER) || defined(TR_PERF_EVENT_HW_PROFILER)
    J9VMThread *vmThread = ((J9VMThreadStartedEvent *)eventData)->currentThread;
 
    J9JITConfig * jitConfig = vmThread->javaVM->jitConfig;
@@ -1712,7 +1726,7 @@ static void jitHookThreadStart(J9HookInterface * * hookInterface, UDATA eventNum
          hwProfiler->initializeThread(vmThread);
          }
       }
-#endif //defined(TR_HOST_POWER)
+#endif //defined(TR_HOST_POWER) || defined(TR_PERF_EVENT_HW_PROFILER)
    }
 
 
@@ -1872,12 +1886,10 @@ static void jitHookClassesUnload(J9HookInterface * * hookInterface, UDATA eventN
       // The following is safe to execute even if there is no backing for the visitedSuperClasses array
       persistentInfo->clearVisitedSuperClasses();
 
-      PORT_ACCESS_FROM_JAVAVM(vmThread->javaVM);
-      J9ClassWalkState classWalkState;
-      J9Class * j9clazz;
       TR_OpaqueClassBlock *clazz;
-      j9clazz = vmThread->javaVM->internalVMFunctions->allClassesStartDo(&classWalkState, vmThread->javaVM, NULL);
-      while (j9clazz)
+      // The event carries every class dying in this cycle (anonymous classes included),
+      // so walk that list rather than every class loaded in the VM
+      for (J9Class *j9clazz = unloadedEvent->classesToUnload; j9clazz; j9clazz = j9clazz->gcLink)
          {
          // If the romableAotITable field is set to 0, that means this class was not caught
          // by the JIT load hook and has not been loaded.
@@ -1887,11 +1899,8 @@ static void jitHookClassesUnload(J9HookInterface * * hookInterface, UDATA eventN
             clazz = ((TR_J9VMBase *)fe)->convertClassPtrToClassOffset(j9clazz);
             table->classGotUnloadedPost(fe,clazz); // side-effect: builds the array of visited superclasses
             }
-         j9clazz = vmThread->javaVM->internalVMFunctions->allClassesNextDo(&classWalkState);
          }
 
-      vmThread->javaVM->internalVMFunctions->allClassesEndDo(&classWalkState);
-
 
       TR_OpaqueClassBlock **visitedSuperClasses = persistentInfo->getVisitedSuperClasses();
       if (visitedSuperClasses && !persistentInfo->tooManySuperClasses())
@@ -1991,6 +2000,8 @@ static void jitHookAnonClassesUnload(J9HookInterface * * hookInterface, UDATA ev
    if (compInfo->getDLT_HT())
       compInfo->getDLT_HT()->onClassUnloading();
 #endif
+   if (compInfo->getCompilationCostLedger())
+      compInfo->getCompilationCostLedger()->onClassUnloading();
 
    compInfo->getLowPriorityCompQueue().purgeEntriesOnClassLoaderUnloading(&dummyClassLoader);
 
@@ -2181,18 +2192,22 @@ static void jitHookClassLoaderUnload(J9HookInterface * * hookInterface, UDATA ev
 
 #endif /* defined (J9VM_GC_DYNAMIC_CLASS_UNLOADING)*/
 
-#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING) && defined(J9VM_JIT_DYNAMIC_LOOP_TRANSFER)
+#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
 static void jitHookClassLoadersUnload(J9HookInterface * * hookInterface, UDATA eventNum, void * eventData, void * userData)
    {
    J9VMClassUnloadEvent * unloadedEvent = (J9VMClassUnloadEvent *)eventData;
    J9VMThread * vmThread = unloadedEvent->currentThread;
    J9JITConfig * jitConfig = vmThread->javaVM->jitConfig;
    TR::CompilationInfo * compInfo = TR::CompilationInfo::get(jitConfig);
+#if defined(J9VM_JIT_DYNAMIC_LOOP_TRANSFER)
    compInfo->cleanDLTRecordOnUnload();
    if (compInfo->getDLT_HT())
       compInfo->getDLT_HT()->onClassUnloading();
+#endif /* defined (J9VM_JIT_DYNAMIC_LOOP_TRANSFER) */
+   if (compInfo->getCompilationCostLedger())
+      compInfo->getCompilationCostLedger()->onClassUnloading();
    }
-#endif /* defined (J9VM_GC_DYNAMIC_CLASS_UNLOADING) and defined (J9VM_JIT_DYNAMIC_LOOP_TRANSFER) */
+#endif /* defined (J9VM_GC_DYNAMIC_CLASS_UNLOADING) */
 
 void jitDiscardPendingCompilationsOfNatives(J9VMThread *vmThread, J9Class *clazz)
    {
@@ -3927,6 +3942,7 @@ static void jitHookBytecodeProfiling(J9HookInterface * * hook, UDATA eventNum, v
       if (TR::Options::getCmdLineOptions()->getOption(TR_VerboseInterpreterProfiling))
          {
          TR_VerboseLog::writeLineLocked(TR_Vlog_IPROFILER,"t=%6u IProfiler exceeded memory limit %d", (uint32_t)compInfo->getPersistentInfo()->getElapsedTime(), iProfiler->getProfilerMemoryFootprint());
+         TR_IProfiler::printProfilerMemoryFootprint();
          }
       turnOffInterpreterProfiling(jitConfig);
       // Generate a trace point
@@ -3996,6 +4012,8 @@ void printIprofilerStats(TR::Options *options, J9JITConfig * jitConfig, TR_IProf
    if (!options->getOption(TR_DisableInterpreterProfiling))
       {
       PORT_ACCESS_FROM_JITCONFIG(jitConfig);
+      if (TR::Options::getVerboseOption(TR_VerbosePerformance) || options->getOption(TR_VerboseInterpreterProfiling))
+         TR_IProfiler::printProfilerMemoryFootprint();
       if (TR::Options::getCmdLineOptions()->getOption(TR_VerboseInterpreterProfiling))
          {
          j9tty_printf(PORTLIB, "VM shutdown event received.\n");
@@ -4176,6 +4194,9 @@ void JitShutdown(J9JITConfig * jitConfig)
       {
       statsThreadObj->stopStatisticsThread(jitConfig);
       }
+
+   if (auto aotCacheMap = compInfo->getJITServerAOTCacheMap())
+      aotCacheMap->saveSnapshots();
 #endif
 
    TR_DebuggingCounters::report();
@@ -5669,6 +5690,7 @@ static int32_t J9THREAD_PROC samplerThreadProc(void * entryarg)
    J9JavaVM * vm           = jitConfig->javaVM;
    UDATA samplingPeriod    = std::max(static_cast<UDATA>(TR::Options::_minSamplingPeriod), jitConfig->samplingFrequency);
    uint64_t lastProcNumCheck = 0;
+   uint64_t lastCompThreadAutoscaleCheck = 0;
    bool idleMode = false;
    uint64_t lastMinuteCheck = 0; // for activities that need to be done rarely (every minute)
    // initialize the startTime and elapsedTime here
@@ -5874,6 +5896,13 @@ static int32_t J9THREAD_PROC samplerThreadProc(void * entryarg)
                if (compInfo->dynamicThreadPriority() &&
                    compInfo->getCompilationLagUnlocked() == TR::CompilationInfo::LARGE_LAG)
                   compInfo->changeCompThreadPriority(J9THREAD_PRIORITY_MAX, 12);
+
+               if (TR::Options::_compThreadAutoscaling &&
+                   crtTime - lastCompThreadAutoscaleCheck >= (uint64_t)TR::Options::_compThreadAutoscalingInterval)
+                  {
+                  lastCompThreadAutoscaleCheck = crtTime;
+                  compInfo->autoscaleCompilationThreads();
+                  }
                }
 
             int32_t heartbeatInterval = TR::Options::getSamplingHeartbeatInterval();
@@ -5996,6 +6025,11 @@ static int32_t J9THREAD_PROC samplerThreadProc(void * entryarg)
                TR_RuntimeAssumptionTable * rat = persistentInfo->getRuntimeAssumptionTable();
                for (int32_t i=0; i < LastAssumptionKind; i++)
                   TR_VerboseLog::writeLine(TR_Vlog_MEMORY,"\tAssumptionType=%d allocated=%d reclaimed=%d", i, rat->getAssumptionCount(i), rat->getReclaimedAssumptionCount(i));
+               TR_DataCacheManager *dcManager = TR_DataCacheManager::getManager();
+               if (dcManager)
+                  TR_VerboseLog::writeLine(TR_Vlog_MEMORY,"\tData cache: segments=%d segmentKB=%u coalescedAllocations=%u releasedSegments=%u releasedKB=%u",
+                     dcManager->getNumAllocatedCaches(), dcManager->getTotalSegmentMemoryAllocated() >> 10,
+                     dcManager->getNumCoalescedAllocations(), dcManager->getNumReleasedCaches(), (uint32_t)(dcManager->getReleasedSegmentMemory() >> 10));
                TR_VerboseLog::vlogRelease();
                }
 #if defined(WINDOWS) && defined(TR_TARGET_32BIT)
@@ -6612,9 +6646,7 @@ int32_t setUpHooks(J9JavaVM * javaVM, J9JITConfig * jitConfig, TR_FrontEnd * vm)
            (*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_VM_CLASSES_UNLOAD, jitHookClassesUnload, OMR_GET_CALLSITE(), NULL) ||
            (*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_VM_CLASS_LOADER_UNLOAD, jitHookClassLoaderUnload, OMR_GET_CALLSITE(), NULL) ||
            (*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_VM_ANON_CLASSES_UNLOAD, jitHookAnonClassesUnload, OMR_GET_CALLSITE(), NULL) ||
-#if defined(J9VM_JIT_DYNAMIC_LOOP_TRANSFER)
            (*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_VM_CLASS_LOADERS_UNLOAD, jitHookClassLoadersUnload, OMR_GET_CALLSITE(), NULL) ||
-#endif
            (*gcHooks)->J9HookRegisterWithCallSite(gcHooks, J9HOOK_MM_INTERRUPT_COMPILATION, jitHookInterruptCompilation, OMR_GET_CALLSITE(), NULL) ||
            (*gcHooks)->J9HookRegisterWithCallSite(gcHooks, J9HOOK_MM_CLASS_UNLOADING_END, jitHookClassesUnloadEnd, OMR_GET_CALLSITE(), NULL))
          {
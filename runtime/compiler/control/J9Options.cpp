@@ -81,6 +81,7 @@ static const size_t JITSERVER_LOG_FILENAME_MAX_SIZE = 1025;
 #endif /* defined(J9VM_OPT_JITSERVER) */
 int32_t J9::Options::_samplingFrequencyInDeepIdleMode = 100000; // ms
 int32_t J9::Options::_resetCountThreshold = 0; // Disable the feature
+uint32_t J9::Options::_runtimeBudget = 0; // ms; 0 means the lifetime of the JVM is unknown
 int32_t J9::Options::_scorchingSampleThreshold = 240;
 int32_t J9::Options::_conservativeScorchingSampleThreshold = 80; // used when many CPUs (> _upperBoundNumProc)
 int32_t J9::Options::_upperBoundNumProcForScaling = 64; // used for scaling _scorchingSampleThreshold based on numProc
@@ -127,7 +128,9 @@ int64_t J9::Options::_oldAge = 1000*60*1000; // 1000 minutes
 int64_t J9::Options::_oldAgeUnderLowMemory = 1000*60*5; // 5 minute
 int64_t J9::Options::_timeBetweenPurges = 1000*60*1; // 1 minute
 bool J9::Options::_shareROMClasses = false;
+bool J9::Options::_shareProfilingData = false;
 int32_t J9::Options::_sharedROMClassCacheNumPartitions = 16;
+int32_t J9::Options::_messageCompressionThreshold = 4096; // bytes
 #endif /* defined(J9VM_OPT_JITSERVER) */
 
 int32_t J9::Options::_interpreterSamplingThreshold = 300;
@@ -140,15 +143,26 @@ int32_t J9::Options::_compilationExpirationTime = -1;
 
 int32_t J9::Options::_minSamplingPeriod = 10; // ms
 int32_t J9::Options::_compilationBudget = 0;  // ms; 0 means disabled
+bool J9::Options::_compilationCostLedger = false;
+bool J9::Options::_inliningBudgetPlanner = false;
+bool J9::Options::_hotCodeCache = false;
+bool J9::Options::_hugePageCaches = false;
+int32_t J9::Options::_tleAbortThreshold = 1024; // 0 means lock elision sites never stop eliding
 
 int32_t J9::Options::_catchSamplingSizeThreshold = -1; // measured in nodes; -1 means not initialized
 int32_t J9::Options::_compilationThreadPriorityCode = 4; // these codes are converted into
                                                          // priorities in startCompilationThread
+bool J9::Options::_compThreadAutoscaling = false;
+int32_t J9::Options::_compThreadAutoscalingInterval = 1000; // ms
+int32_t J9::Options::_compThreadAutoscalingHysteresis = 3; // consecutive decisions in the same direction
+int32_t J9::Options::_compThreadAutoscalingThrottleLow = 5; // percentage of throttled CFS periods
+int32_t J9::Options::_compThreadAutoscalingThrottleHigh = 20; // percentage of throttled CFS periods
 int32_t J9::Options::_disableIProfilerClassUnloadThreshold = 20000;// The usefulness of IProfiling is questionable at this point
 int32_t J9::Options::_iprofilerReactivateThreshold=10;
 int32_t J9::Options::_iprofilerIntToTotalSampleRatio=2;
 int32_t J9::Options::_iprofilerSamplesBeforeTurningOff = 1000000; // samples
 int32_t J9::Options::_iprofilerNumOutstandingBuffers = 10;
+int32_t J9::Options::_iprofilerMaxNumThreads = 2;
 int32_t J9::Options::_iprofilerBufferMaxPercentageToDiscard = 0;
 int32_t J9::Options::_iProfilerBufferInterarrivalTimeToExitDeepIdle = 5000; // 5 seconds
 int32_t J9::Options::_iprofilerBufferSize = 1024;
@@ -206,6 +220,8 @@ int32_t J9::Options::_aotWarmSCCThreshold = 200;
 
 int32_t J9::Options::_largeTranslationTime = -1; // usec
 int32_t J9::Options::_weightOfAOTLoad = 1; // must be between 0 and 256
+int32_t J9::Options::_weightOfEagerAOTLoad = 6; // must be between 0 and 256
+int32_t J9::Options::_eagerAOTLoadSCount = -1; // -1 means feature disabled
 int32_t J9::Options::_weightOfJSR292 = 12; // must be between 0 and 256
 
 TR_YesNoMaybe J9::Options::_hwProfilerEnabled = TR_maybe;
@@ -231,6 +247,9 @@ int32_t J9::Options::_qszThresholdToTurnRION               = 100;
 int32_t J9::Options::_qszMaxThresholdToRIDowngrade         = 250;
 int32_t J9::Options::_qszMinThresholdToRIDowngrade         = 50; // should be smaller than _qszMaxThresholdToRIDowngrade
 uint32_t J9::Options::_hwprofilerPRISamplingRate            = 500000;
+bool J9::Options::_hwprofilerPerfEventDisableBranchStack    = false;
+uint32_t J9::Options::_hwprofilerPerfEventRingPages         = 8; // must be a power of 2
+uint32_t J9::Options::_hwprofilerPerfEventSamplingPeriod    = 1000000; // user instructions retired per sample
 
 int32_t J9::Options::_hwProfilerBufferMaxPercentageToDiscard = 5;
 uint32_t J9::Options::_hwProfilerExpirationTime             = 0; // ms;  0 means disabled
@@ -266,7 +285,12 @@ int32_t J9::Options::_numDLTBufferMatchesToEagerlyIssueCompReq = 8; //a value of
 int32_t J9::Options::_dltPostponeThreshold = 2;
 
 int32_t J9::Options::_expensiveCompWeight = TR::CompilationInfo::JSR292_WEIGHT;
+int32_t J9::Options::_compQueueMaxTimesOvertaken = 0; // 0 means priority-only ordering of the compilation queue
+int32_t J9::Options::_interruptedCompFreeRetryThreshold = 200; // ms
+int32_t J9::Options::_interruptionsBeforeDowngrade = 3;
 int32_t J9::Options::_jProfilingEnablementSampleThreshold = 10000;
+bool J9::Options::_persistJProfilingData = false;
+bool J9::Options::_aotProfiledCompilation = false;
 
 bool J9::Options::_aggressiveLockReservation = false;
 
@@ -678,6 +702,8 @@ TR::OptionTable OMR::Options::_feOptions[] = {
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_aotMethodCompilesThreshold, 0, " %d", NOT_IN_SUBSET},
    {"aotMethodThreshold=", "R<nnn>\tNumber of methods found in shared cache after which we stop AOTing",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_aotMethodThreshold, 0, " %d", NOT_IN_SUBSET},
+   {"aotProfiledCompilation", " \tcompile AOT bodies at warm with profiled inlining and guarded devirtualization based on the IProfiler data persisted in the shared class cache",
+        TR::Options::setStaticBool, (intptr_t)&TR::Options::_aotProfiledCompilation, 1, "F", NOT_IN_SUBSET},
    {"aotWarmSCCThreshold=", "R<nnn>\tNumber of methods found in shared cache at startup to declare SCC as warm",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_aotWarmSCCThreshold, 0, " %d", NOT_IN_SUBSET },
    {"availableCPUPercentage=", "M<nnn>\tUse it when java process has a fraction of a CPU. Number 1..99 ",
@@ -716,6 +742,9 @@ TR::OptionTable OMR::Options::_feOptions[] = {
    {"compilationBudget=",      "O<nnn>\tnumber of usec. Used to better interleave compilation"
                                "with computation. Use 80000 as a starting point",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_compilationBudget, 0, "P%d", NOT_IN_SUBSET},
+   {"compilationCostLedger", "M\tkeep per-method compilation CPU, scratch memory, recompilation count and "
+                             "code size for the CompilationCost MXBean",
+        TR::Options::setStaticBool, (intptr_t)&TR::Options::_compilationCostLedger, 1, "F", NOT_IN_SUBSET},
    {"compilationDelayTime=", "M<nnn>\tnumber of seconds after which we allow compiling",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_compilationDelayTime, 0, " %d", NOT_IN_SUBSET },
    {"compilationExpirationTime=", "R<nnn>\tnumber of seconds after which point we will stop compiling",
@@ -732,6 +761,23 @@ TR::OptionTable OMR::Options::_feOptions[] = {
    {"compilationYieldStatsThreshold=", "M<nnn>\tprint stats about compilation yield points if the "
                                        "threshold is exceeded. Default 1000 usec. ",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_compYieldStatsThreshold, 0, "F%d", NOT_IN_SUBSET},
+   {"compQueueMaxTimesOvertaken=", "M<nnn>\tlet cheaper async compilation requests go ahead of queued requests "
+                             "of the same priority, at most this many times per request. 0 (default) disables it",
+        TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_compQueueMaxTimesOvertaken, 0, "F%d", NOT_IN_SUBSET},
+   {"compThreadAutoscaling", "M\tadjust the number of active compilation threads based on the compilation "
+                             "backlog, CPU idle time and cgroup CPU throttling",
+        TR::Options::setStaticBool, (intptr_t)&TR::Options::_compThreadAutoscaling, 1, "F", NOT_IN_SUBSET},
+   {"compThreadAutoscalingHysteresis=", "M<nnn>\tnumber of consecutive autoscaling decisions in the same "
+                             "direction required before the compilation thread limit changes",
+        TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_compThreadAutoscalingHysteresis, 0, "F%d", NOT_IN_SUBSET},
+   {"compThreadAutoscalingInterval=", "M<nnn>\tperiod (ms) of the compilation thread autoscaling decisions",
+        TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_compThreadAutoscalingInterval, 0, "F%d", NOT_IN_SUBSET},
+   {"compThreadAutoscalingThrottleHigh=", "M<nnn>\tpercentage of throttled cgroup CPU periods above which "
+                             "the compilation thread limit is lowered",
+        TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_compThreadAutoscalingThrottleHigh, 0, "F%d", NOT_IN_SUBSET},
+   {"compThreadAutoscalingThrottleLow=", "M<nnn>\tpercentage of throttled cgroup CPU periods below which "
+                             "the compilation thread limit may be raised",
+        TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_compThreadAutoscalingThrottleLow, 0, "F%d", NOT_IN_SUBSET},
    {"compThreadPriority=",    "M<nnn>\tThe priority of the compilation thread. "
                               "Use an integer between 0 and 4. Default is 4 (highest priority)",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_compilationThreadPriorityCode, 0, "F%d", NOT_IN_SUBSET},
@@ -758,6 +804,9 @@ TR::OptionTable OMR::Options::_feOptions[] = {
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_disableIProfilerClassUnloadThreshold, 0, "F%d", NOT_IN_SUBSET},
    {"dltPostponeThreshold=",      "M<nnn>\tNumber of dlt attempts inv. count for a method is seen not advancing",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_dltPostponeThreshold, 0, "F%d", NOT_IN_SUBSET },
+   {"eagerAOTLoadSCount=", "M<nnn>\tscount for AOT bodies of methods used during startup in previous runs. "
+                           "-1 (default) disables eager AOT loads",
+        TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_eagerAOTLoadSCount, 0, "F%d", NOT_IN_SUBSET},
    {"exclude=",           "D<xxx>\tdo not compile methods beginning with xxx", TR::Options::limitOption, 1, 0, "P%s"},
    {"expensiveCompWeight=", "M<nnn>\tweight of a comp request to be considered expensive",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_expensiveCompWeight, 0, "F%d", NOT_IN_SUBSET },
@@ -772,6 +821,11 @@ TR::OptionTable OMR::Options::_feOptions[] = {
    {"gcTrace=",           "D<nnn>\ttrace gc stack walks after gc number nnn",
         TR::Options::setJitConfigNumericValue, offsetof(J9JITConfig, gcTraceThreshold), 0, "F%d"},
 #endif
+   {"hotCodeCache", "M\tallocate hot and scorching method bodies in a code cache of their own",
+        TR::Options::setStaticBool, (intptr_t)&TR::Options::_hotCodeCache, 1, "F", NOT_IN_SUBSET},
+   {"hugePageCaches", "M\tback data cache segments with the code cache large page size and ask Linux for "
+                      "transparent huge pages for code and data cache segments that only got default pages",
+        TR::Options::setStaticBool, (intptr_t)&TR::Options::_hugePageCaches, 1, "F", NOT_IN_SUBSET},
    {"HWProfilerAOTWarmOptLevelThreshold=", "O<nnn>\tAOT Warm Opt Level Threshold",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_hwprofilerAOTWarmOptLevelThreshold, 0, "F%d", NOT_IN_SUBSET},
    {"HWProfilerBufferMaxPercentageToDiscard=", "O<nnn>\tpercentage of HW profiling buffers "
@@ -792,6 +846,12 @@ TR::OptionTable OMR::Options::_feOptions[] = {
    {"HWProfilerNumOutstandingBuffers=", "O<nnn>\tnumber of outstanding hardware profiling buffers "
                                        "allowed in the system. Specify 0 to disable this optimization",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_hwprofilerNumOutstandingBuffers, 0, "F%d", NOT_IN_SUBSET},
+   {"HWProfilerPerfEventDisableBranchStack", "O\tdo not request LBR/BRBE branch records with perf_event samples",
+        TR::Options::setStaticBool, (intptr_t)&TR::Options::_hwprofilerPerfEventDisableBranchStack, 1, "F", NOT_IN_SUBSET},
+   {"HWProfilerPerfEventRingPages=",  "O<nnn>\tnumber of data pages (power of 2) in the per-thread perf_event ring buffer",
+        TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_hwprofilerPerfEventRingPages, 0, "F%d", NOT_IN_SUBSET},
+   {"HWProfilerPerfEventSamplingPeriod=", "O<nnn>\tnumber of user instructions retired between perf_event samples",
+        TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_hwprofilerPerfEventSamplingPeriod, 0, "F%d", NOT_IN_SUBSET},
    {"HWProfilerPRISamplingRate=",     "O<nnn>\tP RI Scaling Factor",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_hwprofilerPRISamplingRate, 0, "F%d", NOT_IN_SUBSET},
    {"HWProfilerQSZMaxThresholdToRIDowngrade=", "R<nnn>\t",
@@ -828,6 +888,9 @@ TR::OptionTable OMR::Options::_feOptions[] = {
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_hwprofilerZRISF, 0, "F%d", NOT_IN_SUBSET},
    {"inlinefile=",        "D<filename>\tinline filter defined in filename.  "
                           "Use inlinefile=filename", TR::Options::inlinefileOption, 0, 0, "F%s"},
+   {"inliningBudgetPlanner", "O\tchoose the call targets to inline by profiled frequency per unit of weight "
+                             "instead of by weight alone, skipping targets that do not fit the caller budget",
+        TR::Options::setStaticBool, (intptr_t)&TR::Options::_inliningBudgetPlanner, 1, "F", NOT_IN_SUBSET},
    {"interpreterSamplingDivisor=",    "R<nnn>\tThe divisor used to decrease the invocation count when an interpreted method is sampled",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_interpreterSamplingDivisor, 0, " %d", NOT_IN_SUBSET},
    {"interpreterSamplingThreshold=",    "R<nnn>\tThe maximum invocation count at which a sampling hit will result in the count being divided by the value of interpreterSamplingDivisor",
@@ -836,6 +899,12 @@ TR::OptionTable OMR::Options::_feOptions[] = {
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_interpreterSamplingThresholdInJSR292, 0, " %d", NOT_IN_SUBSET},
    {"interpreterSamplingThresholdInStartupMode=",    "R<nnn>\tThe maximum invocation count at which a sampling hit will result in the count being divided by the value of interpreterSamplingDivisor",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_interpreterSamplingThresholdInStartupMode, 0, " %d", NOT_IN_SUBSET},
+   {"interruptedCompFreeRetryThreshold=", "M<nnn>\tcompilations interrupted after running at least this many ms "
+                                "are retried without using up one of their compilation attempts",
+        TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_interruptedCompFreeRetryThreshold, 0, "F%d", NOT_IN_SUBSET},
+   {"interruptionsBeforeDowngrade=", "M<nnn>\tnumber of interruptions after which a compilation above warm "
+                                "is retried at the next lower optimization level. 0 disables it",
+        TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_interruptionsBeforeDowngrade, 0, "F%d", NOT_IN_SUBSET},
    {"invocationThresholdToTriggerLowPriComp=",    "M<nnn>\tNumber of times a loopy method must be invoked to be eligible for LPQ",
        TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_invocationThresholdToTriggerLowPriComp, 0, "F%d", NOT_IN_SUBSET },
    {"iprofilerBufferInterarrivalTimeToExitDeepIdle=", "M<nnn>\tIn ms. If 4 IP buffers arrive back-to-back more frequently than this value, JIT exits DEEP_IDLE",
@@ -855,6 +924,9 @@ TR::OptionTable OMR::Options::_feOptions[] = {
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_maxIprofilingCount, 0, "F%d", NOT_IN_SUBSET},
    {"iprofilerMaxCountInStartupMode=", "O<nnn>\tmax invocation count for IProfiler to be active in STARTUP phase",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_maxIprofilingCountInStartupMode, 0, "F%d", NOT_IN_SUBSET},
+   {"iprofilerMaxNumThreads=", "O<nnn>\tmax number of threads processing interpreter profiling buffers. "
+                               "Threads beyond the first are only used while buffers accumulate and CPU is idle",
+        TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_iprofilerMaxNumThreads, 0, "F%d", NOT_IN_SUBSET},
    {"iprofilerMemoryConsumptionLimit=",    "O<nnn>\tlimit on memory consumption for interpreter profiling data",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_iProfilerMemoryConsumptionLimit, 0, "P%d", NOT_IN_SUBSET},
    {"iprofilerNumOutstandingBuffers=", "O<nnn>\tnumber of outstanding interpreter profiling buffers "
@@ -903,6 +975,10 @@ TR::OptionTable OMR::Options::_feOptions[] = {
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_minSamplingPeriod, 0, "P%d", NOT_IN_SUBSET},
    {"minSuperclassArraySize=", "I<nnn>\t set the size of the minimum superclass array size",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_minimumSuperclassArraySize, 0, " %d", NOT_IN_SUBSET},
+#if defined(J9VM_OPT_JITSERVER)
+   {"messageCompressionThreshold=", " \tJITServer messages smaller than this size (in bytes) are never compressed",
+        TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_messageCompressionThreshold, 0, "F%d", NOT_IN_SUBSET},
+#endif /* defined(J9VM_OPT_JITSERVER) */
    {"noregmap",           0, RESET_JITCONFIG_RUNTIME_FLAG(J9JIT_CG_REGISTER_MAPS) },
    {"numCodeCachesOnStartup=",   "R<nnn>\tnumber of code caches to create at startup",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_numCodeCachesToCreateAtStartup, 0, "F%d", NOT_IN_SUBSET},
@@ -916,6 +992,8 @@ TR::OptionTable OMR::Options::_feOptions[] = {
    {"oldAgeUnderLowMemory=", " \tDefines what an old JITServer cache entry means when memory is low",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_oldAgeUnderLowMemory,  0, " %d" },
 #endif /* defined(J9VM_OPT_JITSERVER) */
+   {"persistJProfilingData", " \tstore JProfiling block frequencies in the shared class cache and use them to warm start later runs",
+        TR::Options::setStaticBool, (intptr_t)&TR::Options::_persistJProfilingData, 1, "F", NOT_IN_SUBSET},
    {"profileAllTheTime=",    "R<nnn>\tInterpreter profiling will be on all the time",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_profileAllTheTime, 0, " %d", NOT_IN_SUBSET},
    {"queuedInvReqThresholdToDowngradeOptLevel=", "M<nnn>\tDowngrade opt level if too many inv req",
@@ -934,6 +1012,9 @@ TR::OptionTable OMR::Options::_feOptions[] = {
    {"rtlog=",             "L<filename>\twrite verbose run-time output to filename",
         TR::Options::setStringForPrivateBase,  offsetof(TR_JitPrivateConfig,rtLogFileName), 0, "P%s"},
    {"rtResolve",          "D\ttreat all data references as unresolved", SET_JITCONFIG_RUNTIME_FLAG(J9JIT_RUNTIME_RESOLVE) },
+   {"runtimeBudget=",     "R<nnn>\texpected lifetime of the JVM in ms; caps optimization levels "
+                          "so that expensive compilations are not started when they cannot pay off",
+        TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_runtimeBudget, 0, "F%d", NOT_IN_SUBSET},
    {"safeReservePhysicalMemoryValue=",    "C<nnn>\tsafe buffer value before we risk running out of physical memory, in KB",
         TR::Options::setStaticNumericKBAdjusted, (intptr_t)&TR::Options::_safeReservePhysicalMemoryValue, 0, " %d (KB)"},
    {"sampleDontSwitchToProfilingThreshold=", "R<nnn>\tThe maximum number of global samples taken during a sample interval for which the method is denied swithing to profiling",
@@ -964,6 +1045,8 @@ TR::OptionTable OMR::Options::_feOptions[] = {
 #if defined(J9VM_OPT_JITSERVER)
    {"sharedROMClassCacheNumPartitions=", " \tnumber of JITServer ROMClass cache partitions (each has its own monitor)",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_sharedROMClassCacheNumPartitions, 0, "F%d", NOT_IN_SUBSET},
+   {"shareProfilingData", " \taggregate profiling data of compiled methods across all clients at JITServer (requires shareROMClasses)",
+        TR::Options::setStaticBool, (intptr_t)&TR::Options::_shareProfilingData, 1, "F", NOT_IN_SUBSET},
    {"shareROMClasses", " \tstore a single copy of each distinct ROMClass shared by all clients at JITServer",
         TR::Options::setStaticBool, (intptr_t)&TR::Options::_shareROMClasses, 1, "F", NOT_IN_SUBSET},
 #endif /* defined(J9VM_OPT_JITSERVER) */
@@ -985,6 +1068,9 @@ TR::OptionTable OMR::Options::_feOptions[] = {
    {"timeBetweenPurges=", " \tDefines how often we are willing to scan for old entries to be purged", 
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_timeBetweenPurges,  0, " %d"},
 #endif /* defined(J9VM_OPT_JITSERVER) */
+   {"tleAbortThreshold=", "O<nnn>\tnumber of transaction aborts after which a lock elision site always takes the monitor. "
+                          "0 means never stop eliding",
+        TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_tleAbortThreshold, 0, "F%d", NOT_IN_SUBSET},
 #if defined(TR_HOST_X86) || defined(TR_HOST_POWER) || defined(TR_HOST_ARM64)
    {"tlhPrefetchBoundaryLineCount=",    "O<nnn>\tallocation prefetch boundary line for allocation prefetch",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_TLHPrefetchBoundaryLineCount, 0, "P%d", NOT_IN_SUBSET},
@@ -1034,6 +1120,8 @@ TR::OptionTable OMR::Options::_feOptions[] = {
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_waitTimeToStartIProfiler, 0, "F%d", NOT_IN_SUBSET},
    {"weightOfAOTLoad=",              "M<nnn>\tWeight of an AOT load. 0 by default",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_weightOfAOTLoad, 0, "F%d", NOT_IN_SUBSET},
+   {"weightOfEagerAOTLoad=",         "M<nnn>\tWeight of an eager AOT load during startup. Number between 0 and 255",
+        TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_weightOfEagerAOTLoad, 0, "F%d", NOT_IN_SUBSET},
    {"weightOfJSR292=", "M<nnn>\tWeight of an JSR292 compilation. Number between 0 and 255",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_weightOfJSR292, 0, "F%d", NOT_IN_SUBSET },
    {0}
@@ -1113,6 +1201,13 @@ static bool JITServerParseCommonOptions(J9JavaVM *vm, TR::CompilationInfo *compI
    const char *xxJITServerSSLRootCertsOption = "-XX:JITServerSSLRootCerts=";
    const char *xxJITServerUseAOTCacheOption = "-XX:+JITServerUseAOTCache";
    const char *xxDisableJITServerUseAOTCacheOption = "-XX:-JITServerUseAOTCache";
+   const char *xxJITServerAOTCacheDirOption = "-XX:JITServerAOTCacheDir=";
+   const char *xxJITServerShareAOTCacheDirOption = "-XX:+JITServerShareAOTCacheDir";
+   const char *xxDisableJITServerShareAOTCacheDirOption = "-XX:-JITServerShareAOTCacheDir";
+   const char *xxJITServerUseCompressionOption = "-XX:+JITServerUseCompression";
+   const char *xxDisableJITServerUseCompressionOption = "-XX:-JITServerUseCompression";
+   const char *xxJITServerAOTCacheSnapshotIntervalOption = "-XX:JITServerAOTCacheSnapshotInterval=";
+   const char *xxJITServerClientSessionMemoryBudgetOption = "-XX:JITServerClientSessionMemoryBudget=";
 
    int32_t xxJITServerPortArgIndex = FIND_ARG_IN_VMARGS(STARTSWITH_MATCH, xxJITServerPortOption, 0);
    int32_t xxJITServerTimeoutArgIndex = FIND_ARG_IN_VMARGS(STARTSWITH_MATCH, xxJITServerTimeoutOption, 0);
@@ -1121,6 +1216,13 @@ static bool JITServerParseCommonOptions(J9JavaVM *vm, TR::CompilationInfo *compI
    int32_t xxJITServerSSLRootCertsArgIndex = FIND_ARG_IN_VMARGS(STARTSWITH_MATCH, xxJITServerSSLRootCertsOption, 0);
    int32_t xxJITServerUseAOTCacheArgIndex = FIND_ARG_IN_VMARGS(EXACT_MATCH, xxJITServerUseAOTCacheOption, 0);
    int32_t xxDisableJITServerUseAOTCacheArgIndex = FIND_ARG_IN_VMARGS(EXACT_MATCH, xxDisableJITServerUseAOTCacheOption, 0);
+   int32_t xxJITServerAOTCacheDirArgIndex = FIND_ARG_IN_VMARGS(STARTSWITH_MATCH, xxJITServerAOTCacheDirOption, 0);
+   int32_t xxJITServerShareAOTCacheDirArgIndex = FIND_ARG_IN_VMARGS(EXACT_MATCH, xxJITServerShareAOTCacheDirOption, 0);
+   int32_t xxDisableJITServerShareAOTCacheDirArgIndex = FIND_ARG_IN_VMARGS(EXACT_MATCH, xxDisableJITServerShareAOTCacheDirOption, 0);
+   int32_t xxJITServerUseCompressionArgIndex = FIND_ARG_IN_VMARGS(EXACT_MATCH, xxJITServerUseCompressionOption, 0);
+   int32_t xxDisableJITServerUseCompressionArgIndex = FIND_ARG_IN_VMARGS(EXACT_MATCH, xxDisableJITServerUseCompressionOption, 0);
+   int32_t xxJITServerAOTCacheSnapshotIntervalArgIndex = FIND_ARG_IN_VMARGS(STARTSWITH_MATCH, xxJITServerAOTCacheSnapshotIntervalOption, 0);
+   int32_t xxJITServerClientSessionMemoryBudgetArgIndex = FIND_ARG_IN_VMARGS(STARTSWITH_MATCH, xxJITServerClientSessionMemoryBudgetOption, 0);
 
    if (xxJITServerPortArgIndex >= 0)
       {
@@ -1173,6 +1275,44 @@ static bool JITServerParseCommonOptions(J9JavaVM *vm, TR::CompilationInfo *compI
    if (xxJITServerUseAOTCacheArgIndex > xxDisableJITServerUseAOTCacheArgIndex)
       compInfo->getPersistentInfo()->setJITServerUseAOTCache(true);
 
+   // Message compression is disabled by default at the client and enabled by default at the server.
+   // The server only compresses messages sent to clients that enabled compression.
+   if (xxJITServerUseCompressionArgIndex > xxDisableJITServerUseCompressionArgIndex)
+      compInfo->getPersistentInfo()->setJITServerUseCompression(true);
+   else if (xxDisableJITServerUseCompressionArgIndex > xxJITServerUseCompressionArgIndex)
+      compInfo->getPersistentInfo()->setJITServerUseCompression(false);
+   else
+      compInfo->getPersistentInfo()->setJITServerUseCompression(
+         J9::PersistentInfo::_remoteCompilationMode == JITServer::SERVER
+      );
+
+   if (xxJITServerAOTCacheDirArgIndex >= 0)
+      {
+      char *dir = NULL;
+      GET_OPTION_VALUE(xxJITServerAOTCacheDirArgIndex, '=', &dir);
+      compInfo->getPersistentInfo()->setJITServerAOTCacheDir(dir);
+      }
+
+   if (xxJITServerShareAOTCacheDirArgIndex > xxDisableJITServerShareAOTCacheDirArgIndex)
+      compInfo->getPersistentInfo()->setJITServerShareAOTCacheDir(true);
+
+   if (xxJITServerAOTCacheSnapshotIntervalArgIndex >= 0)
+      {
+      uint32_t intervalMs = 0;
+      IDATA ret = GET_INTEGER_VALUE(xxJITServerAOTCacheSnapshotIntervalArgIndex, xxJITServerAOTCacheSnapshotIntervalOption, intervalMs);
+      if (ret == OPTION_OK)
+         compInfo->getPersistentInfo()->setJITServerAOTCacheSnapshotInterval(intervalMs);
+      }
+
+   // Value is in MB; classes cached for a client session are evicted when their footprint exceeds it
+   if (xxJITServerClientSessionMemoryBudgetArgIndex >= 0)
+      {
+      uint32_t budgetMB = 0;
+      IDATA ret = GET_INTEGER_VALUE(xxJITServerClientSessionMemoryBudgetArgIndex, xxJITServerClientSessionMemoryBudgetOption, budgetMB);
+      if (ret == OPTION_OK)
+         compInfo->getPersistentInfo()->setJITServerClientSessionMemoryBudget((size_t)budgetMB << 20);
+      }
+
    return true;
    }
 #endif /* defined(J9VM_OPT_JITSERVER) */
@@ -1930,6 +2070,10 @@ J9::Options::fePreProcess(void * base)
       self()->setOption(TR_UseRIOnlyForLargeQSZ);
 #endif
       self()->setOption(TR_DisableHardwareProfilerDuringStartup);
+#elif defined(LINUX) && ((defined(TR_HOST_X86) && defined(TR_HOST_64BIT)) || defined(TR_HOST_ARM64))
+      // perf_event sampling costs a kernel interrupt per sample, keep it out of startup like on Power
+      self()->setOption(TR_UseRIOnlyForLargeQSZ);
+      self()->setOption(TR_DisableHardwareProfilerDuringStartup);
 #elif defined (TR_HOST_S390)
       self()->setOption(TR_DisableDynamicRIBufferProcessing);
 #endif
@@ -2632,6 +2776,8 @@ bool J9::Options::feLatePostProcess(void * base, TR::OptionSet * optionSet)
    if (!compInfo->getDLT_HT() && TR::Options::_numDLTBufferMatchesToEagerlyIssueCompReq > 1)
       compInfo->setDLT_HT(new (PERSISTENT_NEW) DLTTracking(compInfo->getPersistentInfo()));
 #endif
+   if (TR::Options::_compilationCostLedger && !compInfo->getCompilationCostLedger())
+      compInfo->setCompilationCostLedger(TR_CompilationCostLedger::allocate());
    // The exploitation of idle time is done by a tracking mechanism done
    // on the IProfiler thread. If this thread does not exist, then we
    // must turn this feature off to avoid allocating a useless hashtable
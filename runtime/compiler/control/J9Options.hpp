@@ -116,6 +116,8 @@ class OMR_EXTENSIBLE Options : public OMR::OptionsConnector
 
    static int32_t _resetCountThreshold;
 
+   static uint32_t _runtimeBudget; // ms; expected lifetime of the JVM, 0 means unknown
+
    static int32_t _scorchingSampleThreshold;
    static int32_t _conservativeScorchingSampleThreshold; // used when many CPUs
 
@@ -173,11 +175,22 @@ class OMR_EXTENSIBLE Options : public OMR::OptionsConnector
    static int32_t _compilationExpirationTime;
    static int32_t _catchSamplingSizeThreshold;
    static int32_t _compilationThreadPriorityCode; // a number between 0 and 4
+   static bool _compilationCostLedger;
+   static bool _inliningBudgetPlanner;
+   static int32_t _tleAbortThreshold;
+   static bool _hotCodeCache;
+   static bool _hugePageCaches;
+   static bool _compThreadAutoscaling;
+   static int32_t _compThreadAutoscalingInterval; // ms
+   static int32_t _compThreadAutoscalingHysteresis;
+   static int32_t _compThreadAutoscalingThrottleLow;
+   static int32_t _compThreadAutoscalingThrottleHigh;
    static int32_t _disableIProfilerClassUnloadThreshold;
    static int32_t _iprofilerReactivateThreshold;
    static int32_t _iprofilerIntToTotalSampleRatio;
    static int32_t _iprofilerSamplesBeforeTurningOff;
    static int32_t _iprofilerNumOutstandingBuffers;
+   static int32_t _iprofilerMaxNumThreads;
    static int32_t _iprofilerBufferMaxPercentageToDiscard;
    static int32_t _iProfilerBufferInterarrivalTimeToExitDeepIdle; // ms
    static int32_t _iprofilerBufferSize; //iprofilerbuffer size in kb
@@ -262,7 +275,9 @@ class OMR_EXTENSIBLE Options : public OMR::OptionsConnector
    static int64_t _oldAgeUnderLowMemory;
    static int64_t _timeBetweenPurges;
    static bool _shareROMClasses;
+   static bool _shareProfilingData;
    static int32_t _sharedROMClassCacheNumPartitions;
+   static int32_t _messageCompressionThreshold;
 #endif /* defined(J9VM_OPT_JITSERVER) */
 
    static int32_t _waitTimeToEnterIdleMode;
@@ -282,6 +297,8 @@ class OMR_EXTENSIBLE Options : public OMR::OptionsConnector
                                         // then we declare the SCC to be warm
    static int32_t _largeTranslationTime; // usec
    static int32_t _weightOfAOTLoad;
+   static int32_t _weightOfEagerAOTLoad;
+   static int32_t _eagerAOTLoadSCount; // scount for AOT bodies used during startup in previous runs; -1 disables
    static int32_t _weightOfJSR292;
 
    static int32_t _hwprofilerNumOutstandingBuffers;
@@ -305,6 +322,9 @@ class OMR_EXTENSIBLE Options : public OMR::OptionsConnector
    static int32_t  _hwProfilerBufferMaxPercentageToDiscard;
 
    static uint32_t _hwprofilerPRISamplingRate;
+   static bool     _hwprofilerPerfEventDisableBranchStack;
+   static uint32_t _hwprofilerPerfEventRingPages;
+   static uint32_t _hwprofilerPerfEventSamplingPeriod;
 
    static uint32_t _hwProfilerExpirationTime;
 
@@ -315,7 +335,12 @@ class OMR_EXTENSIBLE Options : public OMR::OptionsConnector
    static uint32_t _hwprofilerZRISF;
 
    static int32_t _expensiveCompWeight; // weight of a comp request to be considered expensive
+   static int32_t _compQueueMaxTimesOvertaken; // shortest-job-first ordering within a priority; 0 means disabled
+   static int32_t _interruptedCompFreeRetryThreshold; // ms
+   static int32_t _interruptionsBeforeDowngrade;
    static int32_t _jProfilingEnablementSampleThreshold;
+   static bool _persistJProfilingData; // store/load JProfiling block frequencies in the SCC
+   static bool _aotProfiledCompilation; // compile AOT bodies at warm using the IProfiler data persisted in the SCC
 
    static bool _aggressiveLockReservation;
 
@@ -22,6 +22,7 @@
 
 #include "AtomicSupport.hpp"
 #include "codegen/CodeGenerator.hpp"
+#include "control/CompilationController.hpp"
 #include "control/CompilationRuntime.hpp"
 #include "control/Recompilation.hpp"
 #include "control/RecompilationInfo.hpp"
@@ -105,6 +106,23 @@ J9::Recompilation::setupMethodInfo()
       _methodInfo->setNextCompileLevel(optimizationPlan->getOptLevel(),
                                        (optimizationPlan->insertInstrumentation() != 0));
       _methodInfo->setWasNeverInterpreted(!comp()->fej9()->methodMayHaveBeenInterpreted(comp()));
+
+      // Warm start from the block frequencies a previous JVM stored in the shared class cache;
+      // with those available there is no need to profile the method again
+      if (TR::Options::_persistJProfilingData && !optimizationPlan->insertInstrumentation())
+         {
+         TR_PersistentProfileInfo *profileInfo = TR_PersistentProfileInfo::loadFromSharedCache(_compilation);
+         if (profileInfo)
+            {
+            if (!TR::Options::getCmdLineOptions()->getOption(TR_DisableJProfilerThread))
+               {
+               TR::CompilationInfo::get(NULL)->getJProfilerThread()->addProfileInfo(profileInfo);
+               }
+            _methodInfo->setBestProfileInfo(profileInfo);
+            TR_PersistentProfileInfo::decRefCount(profileInfo);
+            _methodInfo->setDisableProfiling();
+            }
+         }
       }
    else // this is a recompilation
       {
@@ -320,6 +338,16 @@ J9::Recompilation::endOfCompilation()
          {
          _nextLevel = _compilation->getMethodHotness();
          }
+      else if (TR::Options::_runtimeBudget > 0 && !_compilation->isProfilingCompilation())
+         {
+         // Do not let counting recompilation start expensive compilations that
+         // will not pay off before the end of -Xjit:runtimeBudget=
+         TR_Hotness cap = TR::DefaultCompilationStrategy::getRuntimeBudgetOptLevelCap();
+         if (cap < _compilation->getMethodHotness())
+            cap = _compilation->getMethodHotness();
+         if (_nextLevel > cap)
+            _nextLevel = cap;
+         }
 
       _methodInfo->setNextCompileLevel(_nextLevel, false); // profiling can only be triggered from sampleMethod
 
@@ -589,7 +617,8 @@ TR_PersistentMethodInfo::TR_PersistentMethodInfo(TR::Compilation *comp) :
    _optimizationPlan(0),
    _numberOfInvalidations(0),
    _numberOfInlinedMethodRedefinition(0),
-   _numPrexAssumptions(0)
+   _numPrexAssumptions(0),
+   _nonEscapingParms(0)
    {
    if (comp->getOption(TR_EnableHCR) && !comp->fej9()->isAOT_DEPRECATED_DO_NOT_USE())
       {
@@ -627,7 +656,8 @@ TR_PersistentMethodInfo::TR_PersistentMethodInfo(TR_OpaqueMethodBlock *methodInf
    _optimizationPlan(0),
    _numberOfInvalidations(0),
    _numberOfInlinedMethodRedefinition(0),
-   _numPrexAssumptions(0)
+   _numPrexAssumptions(0),
+   _nonEscapingParms(0)
    {
    }
 
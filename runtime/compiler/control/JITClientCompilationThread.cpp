@@ -1192,6 +1192,42 @@ handleServerMessage(JITServer::ClientStream *client, TR_J9VM *fe, JITServer::Mes
          client->write(response, attrs);
          }
          break;
+      case MessageType::ResolvedMethod_getMultipleFieldAttributes:
+         {
+         auto recv = client->getRecvData<TR_ResolvedJ9Method *, std::vector<int32_t>, std::vector<uint8_t>, std::vector<uint8_t>>();
+         TR_ResolvedJ9Method *method = std::get<0>(recv);
+         auto &cpIndices = std::get<1>(recv);
+         auto &isStatic = std::get<2>(recv);
+         auto &isStore = std::get<3>(recv);
+         int32_t numFields = cpIndices.size();
+         std::vector<TR_J9MethodFieldAttributes> attributes;
+         attributes.reserve(numFields);
+         for (int32_t i = 0; i < numFields; ++i)
+            {
+            TR::DataType type = TR::NoType;
+            bool volatileP = true;
+            bool isFinal = false;
+            bool isPrivate = false;
+            bool unresolvedInCP;
+            bool result;
+            uintptr_t fieldOffsetOrAddress;
+            if (isStatic[i])
+               {
+               void *address;
+               result = method->staticAttributes(comp, cpIndices[i], &address, &type, &volatileP, &isFinal, &isPrivate, isStore[i], &unresolvedInCP, false);
+               fieldOffsetOrAddress = reinterpret_cast<uintptr_t>(address);
+               }
+            else
+               {
+               U_32 fieldOffset;
+               result = method->fieldAttributes(comp, cpIndices[i], &fieldOffset, &type, &volatileP, &isFinal, &isPrivate, isStore[i], &unresolvedInCP, false);
+               fieldOffsetOrAddress = static_cast<uintptr_t>(fieldOffset);
+               }
+            attributes.push_back(TR_J9MethodFieldAttributes(fieldOffsetOrAddress, type.getDataType(), volatileP, isFinal, isPrivate, unresolvedInCP, result));
+            }
+         client->write(response, attributes);
+         }
+         break;
       case MessageType::ResolvedMethod_getResolvedStaticMethodAndMirror:
          {
          auto recv = client->getRecvData<TR_ResolvedJ9Method *, I_32>();
@@ -2955,7 +2991,8 @@ remoteCompilationEnd(
    }
 
 void
-updateCompThreadActivationPolicy(TR::CompilationInfoPerThreadBase *compInfoPT, JITServer::ServerMemoryState nextMemoryState)
+updateCompThreadActivationPolicy(TR::CompilationInfoPerThreadBase *compInfoPT, JITServer::ServerMemoryState nextMemoryState,
+                                 JITServer::ServerQueueState nextQueueState)
    {
    // When the server starts running low on memory, clients need to reduce load on the server.
    // This is achieved by suspending compilation threads once low server memory is detected.
@@ -2973,17 +3010,24 @@ updateCompThreadActivationPolicy(TR::CompilationInfoPerThreadBase *compInfoPT, J
    // then clients using MAINTAIN policy will begin SUBDUE policy, which allows them to start/resume
    // compilation threads, but at a much higher activation threshold to avoid overwhelming the server again.
    //
+   // The backlog of compilation requests at the server is handled the same way: a BUSY server makes
+   // clients stop starting new compilation threads and an OVERLOADED one makes them suspend all but one.
+   // The remaining threads still pick the highest priority requests from the compilation queue first,
+   // so hot methods are not delayed behind the flood of first-time compilations sent at startup.
+   //
    auto *compInfo = compInfoPT->getCompilationInfo();
    JITServer::CompThreadActivationPolicy curPolicy = compInfo->getCompThreadActivationPolicy();
-   if (nextMemoryState == JITServer::ServerMemoryState::VERY_LOW)
+   if ((nextMemoryState == JITServer::ServerMemoryState::VERY_LOW) ||
+       (nextQueueState == JITServer::ServerQueueState::OVERLOADED))
       {
       compInfo->setCompThreadActivationPolicy(JITServer::CompThreadActivationPolicy::SUSPEND);
       }
-   else if (nextMemoryState == JITServer::ServerMemoryState::LOW)
+   else if ((nextMemoryState == JITServer::ServerMemoryState::LOW) ||
+            (nextQueueState == JITServer::ServerQueueState::BUSY))
       {
       compInfo->setCompThreadActivationPolicy(JITServer::CompThreadActivationPolicy::MAINTAIN);
       }
-   else // ServerMemoryState::NORMAL 
+   else // ServerMemoryState::NORMAL and ServerQueueState::AVAILABLE
       {
       if (curPolicy <= JITServer::CompThreadActivationPolicy::MAINTAIN)
          {
@@ -3030,6 +3074,24 @@ remoteCompile(
    bool useAotCompilation = compInfoPT->getMethodBeingCompiled()->_useAotCompilation;
 
    JITServer::ClientStream *client = enableJITServerPerCompConn ? NULL : compInfoPT->getClientStream();
+   if (client && client->shouldReconnectToPreferredServer())
+      {
+      // A more preferred server has come back; drop the fallback connection so that
+      // the stream created below goes to the server this client has affinity with
+      try
+         {
+         client->writeError(JITServer::MessageType::connectionTerminate, 0 /* placeholder */);
+         }
+      catch (const JITServer::StreamFailure &e)
+         {
+         if (TR::Options::isAnyVerboseOptionSet(TR_VerboseJITServer))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "JITServer StreamFailure when sending connectionTerminate: %s", e.what());
+         }
+      client->~ClientStream();
+      TR_Memory::jitPersistentFree(client);
+      compInfoPT->setClientStream(NULL);
+      client = NULL;
+      }
    if (!client)
       {
       try
@@ -3113,6 +3175,11 @@ remoteCompile(
    std::pair<std::string, std::string> chtableUpdates = table->serializeUpdates();
    // Update the sequence number for these updates
    uint32_t seqNo = compInfo->incCompReqSeqNo();
+   // After failing over or back to another server, make the first request depend on itself.
+   // The server recognizes this and resets the session it holds for this client right away,
+   // while later requests wait for this one instead of for requests sent to the other server.
+   if (client->startsNewSession())
+      compInfo->setLastCriticalSeqNo(seqNo);
    uint32_t lastCriticalSeqNo = compInfo->getLastCriticalSeqNo();
    // If needed, update the seqNo of the last request that carried information that needed to be processed in order
    if (!chtableUpdates.first.empty() || !chtableUpdates.second.empty() || !illegalModificationList.empty() || !unloadedClasses.empty())
@@ -3163,7 +3230,7 @@ remoteCompile(
          auto recv = client->getRecvData<std::string, std::string, CHTableCommitData, std::vector<TR_OpaqueClassBlock*>,
                                          std::string, std::string, std::vector<TR_ResolvedJ9Method*>,
                                          TR_OptimizationPlan, std::vector<SerializedRuntimeAssumption>, JITServer::ServerMemoryState,
-                                         std::vector<TR_OpaqueMethodBlock *>>();
+                                         std::vector<TR_OpaqueMethodBlock *>, JITServer::ServerQueueState>();
          statusCode = compilationOK;
          codeCacheStr = std::get<0>(recv);
          dataCacheStr = std::get<1>(recv);
@@ -3177,7 +3244,9 @@ remoteCompile(
          methodsRequiringTrampolines = std::get<10>(recv);
 
          JITServer::ServerMemoryState nextMemoryState = std::get<9>(recv);
-         updateCompThreadActivationPolicy(compInfoPT, nextMemoryState);
+         JITServer::ServerQueueState nextQueueState = std::get<11>(recv);
+         updateCompThreadActivationPolicy(compInfoPT, nextMemoryState, nextQueueState);
+         JITServerHelpers::setServerQueueState(nextQueueState);
          }
       else
          {
@@ -3188,7 +3257,7 @@ remoteCompile(
          statusCode = std::get<0>(recv);
          uint64_t otherData = std::get<1>(recv);
          if (statusCode == compilationLowPhysicalMemory && otherData != -1) // if failed due to low memory, should've received an updated memory state
-            updateCompThreadActivationPolicy(compInfoPT, (JITServer::ServerMemoryState) otherData); 
+            updateCompThreadActivationPolicy(compInfoPT, (JITServer::ServerMemoryState) otherData, JITServer::ServerQueueState::AVAILABLE);
          if (TR::Options::getVerboseOption(TR_VerboseJITServer))
             TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "remoteCompile: compilationFailure statusCode %u\n", statusCode);
 
@@ -3205,7 +3274,10 @@ remoteCompile(
       }
    catch (const JITServer::StreamFailure &e)
       {
-      JITServerHelpers::postStreamFailure(OMRPORT_FROM_J9PORT(compInfoPT->getJitConfig()->javaVM->portLibrary), compInfo);
+      // With several servers configured, a failure of one of them only puts that server
+      // in backoff; the retry is routed to the next server in this client's preference order
+      if (!client->postServerFailure())
+         JITServerHelpers::postStreamFailure(OMRPORT_FROM_J9PORT(compInfoPT->getJitConfig()->javaVM->portLibrary), compInfo);
 
       client->~ClientStream();
       TR_Memory::jitPersistentFree(client);
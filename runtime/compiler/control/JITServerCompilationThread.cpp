@@ -84,6 +84,24 @@ computeServerMemoryState(TR::CompilationInfo *compInfo)
    return JITServer::ServerMemoryState::NORMAL;
    }
 
+/**
+ * @brief Helper method executed at the end of a compilation to determine
+ * whether clients should reduce the rate of compilation requests because
+ * the server cannot keep up with them. The queue size is read without
+ * holding the compilation monitor since an approximate value is sufficient.
+ */
+JITServer::ServerQueueState
+computeServerQueueState(TR::CompilationInfo *compInfo)
+   {
+   int32_t numCompThreads = compInfo->getNumUsableCompilationThreads();
+   int32_t queueSize = compInfo->getMethodQueueSize();
+   if (queueSize > 8 * numCompThreads)
+      return JITServer::ServerQueueState::OVERLOADED;
+   if (queueSize > 2 * numCompThreads)
+      return JITServer::ServerQueueState::BUSY;
+   return JITServer::ServerQueueState::AVAILABLE;
+   }
+
 /**
  * @brief Method executed by JITServer to process the end of a compilation.
  */
@@ -148,6 +166,7 @@ outOfProcessCompilationEnd(
    auto resolvedMirrorMethodsPersistIPInfo = compInfoPT->getCachedResolvedMirrorMethodsPersistIPInfo();
 
    JITServer::ServerMemoryState memoryState = computeServerMemoryState(compInfoPT->getCompilationInfo());
+   JITServer::ServerQueueState queueState = computeServerQueueState(compInfoPT->getCompilationInfo());
 
    // Send methods requring resolved trampolines in this compilation to the client
    std::vector<TR_OpaqueMethodBlock *> methodsRequiringTrampolines;
@@ -167,7 +186,7 @@ outOfProcessCompilationEnd(
                                                          std::vector<TR_ResolvedJ9Method*>(resolvedMirrorMethodsPersistIPInfo->begin(), resolvedMirrorMethodsPersistIPInfo->end()) :
                                                          std::vector<TR_ResolvedJ9Method*>(),
                                      *entry->_optimizationPlan, serializedRuntimeAssumptions, memoryState,
-                                     methodsRequiringTrampolines
+                                     methodsRequiringTrampolines, queueState
                                      );
    compInfoPT->clearPerCompilationCaches();
 
@@ -472,6 +491,25 @@ TR::CompilationInfoPerThreadRemote::processEntry(TR_MethodToBeCompiled &entry, J
       //
       clientSession->getSequencingMonitor()->enter();
       clientSession->updateMaxReceivedSeqNo(seqNo); // TODO: why do I need this?
+      // A request that depends on itself is the first one the client sent to this server after it
+      // sent requests to another server (see ClientStream::startsNewSession()). The existing session
+      // missed the updates processed by the other server, so start over now rather than waiting for
+      // sequence numbers that will never arrive. If threads are still active for the stale session,
+      // fall back to the timed wait below, which clears the caches once they have drained.
+      if (criticalSeqNo == seqNo && !sessionDataWasEmpty &&
+          criticalSeqNo > clientSession->getLastProcessedCriticalSeqNo() &&
+          clientSession->getNumActiveThreads() <= 0)
+         {
+         clientSession->clearCaches();
+
+         if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
+               "compThreadID=%d has reset the session for clientUID=%llu which restarted with seqNo=%u (lastProcessedCriticalSeqNo=%u)",
+               getCompThreadId(), (unsigned long long)clientId, seqNo, clientSession->getLastProcessedCriticalSeqNo());
+
+         clientSession->setLastProcessedCriticalSeqNo(criticalSeqNo);
+         notifyAndDetachWaitingRequests(clientSession);
+         }
       // This request can go through as long as criticalSeqNo has been processed
       if (criticalSeqNo > clientSession->getLastProcessedCriticalSeqNo())
          {
@@ -513,6 +551,12 @@ TR::CompilationInfoPerThreadRemote::processEntry(TR_MethodToBeCompiled &entry, J
             }
          }
 
+      // Evict cold classes if the class caches of this client exceed their memory budget.
+      // This is only done when no other thread works on a compilation for this client,
+      // because such threads may have obtained pointers into the cached data.
+      if ((clientSession->getNumActiveThreads() == 0) && !clientSession->cachesAreCleared())
+         clientSession->evictClassesOverMemoryBudget();
+
       // Increment the number of active threads before issuing the read for ramClass
       clientSession->incNumActiveThreads();
       hasIncNumActiveThreads = true;
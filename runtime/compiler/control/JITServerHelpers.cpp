@@ -40,6 +40,8 @@ uint64_t     JITServerHelpers::_waitTimeMs = 1000;
 bool         JITServerHelpers::_serverAvailable = true;
 uint64_t     JITServerHelpers::_nextConnectionRetryTime = 0;
 TR::Monitor *JITServerHelpers::_clientStreamMonitor = NULL;
+JITServerHelpers::CompilationCost JITServerHelpers::_compilationCosts[numHotnessLevels][NUM_BYTECODE_SIZE_BUCKETS] = {};
+JITServer::ServerQueueState JITServerHelpers::_serverQueueState = JITServer::ServerQueueState::AVAILABLE;
 
 
 // To ensure that the length fields in UTF8 strings appended at the end of the
@@ -531,6 +533,9 @@ JITServerHelpers::cacheRemoteROMClass(ClientSessionData *clientSessionData, J9Cl
    classInfoStruct._classFlags = std::get<19>(classInfo);
    classInfoStruct._classChainOffsetOfIdentifyingLoaderForClazz = std::get<20>(classInfo);
    clientSessionData->getROMClassMap().insert({ clazz, classInfoStruct});
+   clientSessionData->addToClassCacheFootprint(romClass);
+   if (TR::CompilationInfo::get()->getJITServerSharedProfileCache())
+      clientSessionData->getClassByROMClassHashMap().insert({ JITServerSharedROMClassCache::getHash(romClass), clazz });
 
    auto &origROMMethods = std::get<21>(classInfo);
 
@@ -549,7 +554,10 @@ JITServerHelpers::getRemoteROMClassIfCached(ClientSessionData *clientSessionData
    {
    OMR::CriticalSection getRemoteROMClassIfCached(clientSessionData->getROMMapMonitor());
    auto it = clientSessionData->getROMClassMap().find(clazz);
-   return (it == clientSessionData->getROMClassMap().end()) ? NULL : it->second._romClass;
+   if (it == clientSessionData->getROMClassMap().end())
+      return NULL;
+   it->second._referenced = true;
+   return it->second._romClass;
    }
 
 JITServerHelpers::ClassInfoTuple
@@ -648,6 +656,7 @@ JITServerHelpers::getAndCacheRAMClassInfo(J9Class *clazz, ClientSessionData *cli
       auto it = clientSessionData->getROMClassMap().find((J9Class*)clazz);
       if (it != clientSessionData->getROMClassMap().end())
          {
+         it->second._referenced = true;
          JITServerHelpers::getROMClassData(it->second, dataType, data);
          return true;
          }
@@ -687,6 +696,7 @@ JITServerHelpers::getAndCacheRAMClassInfo(J9Class *clazz, ClientSessionData *cli
       auto it = clientSessionData->getROMClassMap().find((J9Class*)clazz);
       if (it != clientSessionData->getROMClassMap().end())
          {
+         it->second._referenced = true;
          JITServerHelpers::getROMClassData(it->second, dataType1, data1);
          JITServerHelpers::getROMClassData(it->second, dataType2, data2);
          return true;
@@ -901,6 +911,73 @@ JITServerHelpers::shouldRetryConnection(OMRPortLibrary *portLibrary)
    return omrtime_current_time_millis() > _nextConnectionRetryTime;
    }
 
+size_t
+JITServerHelpers::getBytecodeSizeBucket(uint32_t bcsz)
+   {
+   // Buckets for sizes up to 8, 32, 128, 512, 2048 and larger
+   size_t bucket = 0;
+   for (uint32_t limit = 8; (bcsz > limit) && (bucket < NUM_BYTECODE_SIZE_BUCKETS - 1); limit *= 4)
+      ++bucket;
+   return bucket;
+   }
+
+void
+JITServerHelpers::recordCompilationTime(bool isRemote, TR_Hotness optLevel, uint32_t bcsz, uint64_t timeUs)
+   {
+   if (optLevel >= numHotnessLevels)
+      return;
+   CompilationCost &cost = _compilationCosts[optLevel][getBytecodeSizeBucket(bcsz)];
+   // Exponential moving average with a weight of 1/8 for the new sample; the first sample is taken as is
+   uint64_t &avg = isRemote ? cost._avgRemoteTimeUs : cost._avgLocalTimeUs;
+   uint32_t &num = isRemote ? cost._numRemote : cost._numLocal;
+   avg = num ? (avg * 7 + timeUs) / 8 : timeUs;
+   ++num;
+   }
+
+bool
+JITServerHelpers::shouldPreferLocalCompilation(TR_Hotness optLevel, uint32_t bcsz)
+   {
+   if (optLevel >= numHotnessLevels)
+      return true;
+
+   CompilationCost &cost = _compilationCosts[optLevel][getBytecodeSizeBucket(bcsz)];
+   // Gather a few samples on each side before trusting the averages. Compilations
+   // in a bucket alternate between local and remote until both sides have enough samples.
+   static const uint32_t MIN_SAMPLES = 4;
+   if ((cost._numLocal < MIN_SAMPLES) || (cost._numRemote < MIN_SAMPLES))
+      return cost._numLocal <= cost._numRemote;
+
+   // Remote time includes the network round trips and the queuing delay at the server,
+   // so a local compilation is preferred when it completes faster than a remote one.
+   // Once a preference is established, it only flips when the other side is faster by
+   // more than 1/8, so that noise in the averages does not make the decision oscillate.
+   if (!cost._hasPreference)
+      {
+      cost._preferLocal = cost._avgLocalTimeUs <= cost._avgRemoteTimeUs;
+      cost._hasPreference = true;
+      }
+   else if (cost._preferLocal)
+      {
+      if (cost._avgRemoteTimeUs + cost._avgRemoteTimeUs / 8 < cost._avgLocalTimeUs)
+         cost._preferLocal = false;
+      }
+   else if (cost._avgLocalTimeUs + cost._avgLocalTimeUs / 8 < cost._avgRemoteTimeUs)
+      {
+      cost._preferLocal = true;
+      }
+
+   // A busy server would only add queuing delay to a compilation we can afford locally
+   bool preferLocal = cost._preferLocal || (_serverQueueState != JITServer::ServerQueueState::AVAILABLE);
+
+   // The average of the side that is not chosen (and the server queue state, which is only
+   // reported in responses to remote compilations) would otherwise never be refreshed, making
+   // the decision permanent. Send one in PROBE_INTERVAL compilations of a bucket the other way.
+   static const uint32_t PROBE_INTERVAL = 16;
+   if ((++cost._numDecisions % PROBE_INTERVAL) == 0)
+      return !preferLocal;
+   return preferLocal;
+   }
+
 bool
 JITServerHelpers::isAddressInROMClass(const void *address, const J9ROMClass *romClass)
    {
@@ -94,6 +94,14 @@ class JITServerHelpers
    static void postStreamConnectionSuccess();
    static bool isServerAvailable() { return _serverAvailable; }
 
+   // Functions used by the client to decide whether a compilation that is cheap enough to be
+   // performed locally should actually stay local, based on the measured cost of previous local
+   // and remote compilations of similar size and opt level, and on the load reported by the server.
+   // Should be used only on the client side.
+   static void recordCompilationTime(bool isRemote, TR_Hotness optLevel, uint32_t bcsz, uint64_t timeUs);
+   static void setServerQueueState(JITServer::ServerQueueState state) { _serverQueueState = state; }
+   static bool shouldPreferLocalCompilation(TR_Hotness optLevel, uint32_t bcsz);
+
    static void printJITServerMsgStats(J9JITConfig *, TR::CompilationInfo *);
    static void printJITServerCHTableStats(J9JITConfig *, TR::CompilationInfo *);
    static void printJITServerCacheStats(J9JITConfig *, TR::CompilationInfo *);
@@ -113,10 +121,29 @@ class JITServerHelpers
       return _clientStreamMonitor;
       }
 
+   // Running averages of the wall clock time of successful compilations, per opt level
+   // and bytecode size bucket, and the current preference derived from them. They are
+   // updated without synchronization, because an occasionally lost sample or decision
+   // does not matter for the heuristic.
+   struct CompilationCost
+      {
+      uint64_t _avgLocalTimeUs;
+      uint64_t _avgRemoteTimeUs;
+      uint32_t _numLocal;
+      uint32_t _numRemote;
+      uint32_t _numDecisions; // used to periodically probe the side that is not preferred
+      bool _hasPreference;
+      bool _preferLocal;
+      };
+   static const size_t NUM_BYTECODE_SIZE_BUCKETS = 6;
+   static size_t getBytecodeSizeBucket(uint32_t bcsz);
+
    static uint64_t _waitTimeMs;
    static uint64_t _nextConnectionRetryTime;
    static bool _serverAvailable;
    static TR::Monitor * _clientStreamMonitor;
+   static CompilationCost _compilationCosts[numHotnessLevels][NUM_BYTECODE_SIZE_BUCKETS];
+   static JITServer::ServerQueueState _serverQueueState;
    }; // class JITServerHelpers
 
 #endif // defined(JITSERVER_HELPERS_H)
@@ -79,6 +79,10 @@ void TR_MethodToBeCompiled::initialize(TR::IlGeneratorMethodDetails & details, v
    _entryShouldBeDeallocated = false;
    _hasIncrementedNumCompThreadsCompilingHotterMethods = false;
    _weight = 0;
+   _numTimesOvertaken = 0;
+   _estimatedCost = 0;
+   _numInterruptions = 0;
+   _timeLostToInterruptionsMs = 0;
    _jitStateWhenQueued = UNDEFINED_STATE;
    _entryIsCountedAsInvRequest = false;
    _GCRrequest = false;
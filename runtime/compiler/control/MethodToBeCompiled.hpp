@@ -130,6 +130,10 @@ struct TR_MethodToBeCompiled
    int16_t                _index;
    uint8_t                _freeTag; // temporary to catch a nasty bug
    uint8_t                _weight; // Up to 256 levels of weight
+   uint8_t                _numTimesOvertaken; // by cheaper requests of the same priority; bounds their delay
+   uint32_t               _estimatedCost; // relative cost of the compilation; see TR::CompilationInfo::queueEntry
+   uint8_t                _numInterruptions; // times a compilation of this request was interrupted (GC unloading, HCR, ...)
+   uint32_t               _timeLostToInterruptionsMs; // wall time of the interrupted compilations of this request
    bool                   _hasIncrementedNumCompThreadsCompilingHotterMethods;
    uint8_t                _jitStateWhenQueued;
 #if defined(J9VM_OPT_JITSERVER)
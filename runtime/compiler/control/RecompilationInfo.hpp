@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2019 IBM Corp. and others
+ * Copyright (c) 2000, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -160,6 +160,12 @@ class TR_PersistentMethodInfo
 
    bool doesntKillAnything() { return _flags.testAll(RefinedAliasesMask); }
 
+   // Parameters (by ordinal, receiver included) that a compiled body of this
+   // method was found never to let escape; consulted by escape analysis of callers
+   bool hasEscapeSummary() { return _flags.testAny(HasEscapeSummary); }
+   bool parmDoesntEscape(int32_t ordinal) { return hasEscapeSummary() && ordinal < 32 && (_nonEscapingParms & (1u << ordinal)); }
+   void setNonEscapingParms(uint32_t parms) { _nonEscapingParms = parms; _flags.set(HasEscapeSummary); }
+
    // Accessor methods for the "cpoCounter".  This does not really
    // need to be its own counter, as it is conceptually the same as
    // "_counter".  However, the original _counter is still during instrumentation, so
@@ -174,7 +180,7 @@ class TR_PersistentMethodInfo
    TR_OptimizationPlan * getOptimizationPlan() {return _optimizationPlan;}
    void setOptimizationPlan(TR_OptimizationPlan *optPlan) { _optimizationPlan = optPlan; }
    uint8_t getNumberOfInvalidations() {return _numberOfInvalidations;}
-   void incrementNumberOfInvalidations() {_numberOfInvalidations++;}
+   void incrementNumberOfInvalidations() { if (_numberOfInvalidations < 0xFF) _numberOfInvalidations++; }
    uint8_t getNumberOfInlinedMethodRedefinition() {return _numberOfInlinedMethodRedefinition;}
    void incrementNumberOfInlinedMethodRedefinition() {_numberOfInlinedMethodRedefinition++;}
    int16_t getNumPrexAssumptions() {return _numPrexAssumptions;}
@@ -248,6 +254,7 @@ class TR_PersistentMethodInfo
                                                        // Attention: this is not always accurate
       WasScannedForInlining                = 0x00400000, // New scanning for warm method inlining
       IsInDataCache                        = 0x00800000, // This TR_PersistentMethodInfo is stored in the datacache for AOT
+      HasEscapeSummary                     = 0x01000000, // _nonEscapingParms has been computed by a compilation of this method
       lastFlag                             = 0x80000000
       };
 
@@ -298,6 +305,7 @@ class TR_PersistentMethodInfo
    uint8_t                         _numberOfInvalidations; // how many times this method has been invalidated
    uint8_t                         _numberOfInlinedMethodRedefinition; // how many times this method triggers recompilation because of its inlined callees being redefined
    int16_t                         _numPrexAssumptions;
+   uint32_t                        _nonEscapingParms; // valid only if HasEscapeSummary is set
 
    TR_PersistentProfileInfo       *_bestProfileInfo;
    TR_PersistentProfileInfo       *_recentProfileInfo;
@@ -78,6 +78,8 @@
 #include "z/runtime/ZHWProfiler.hpp"
 #elif defined(TR_HOST_POWER)
 #include "p/runtime/PPCHWProfiler.hpp"
+#elif defined(TR_PERF_EVENT_HW_PROFILER)
+#include "runtime/PerfEventHWProfiler.hpp"
 #endif
 
 #include "control/rossa.h"
@@ -115,6 +117,7 @@
 #include "runtime/JITClientSession.hpp"
 #include "runtime/JITServerAOTCache.hpp"
 #include "runtime/JITServerIProfiler.hpp"
+#include "runtime/JITServerSharedProfileCache.hpp"
 #include "runtime/JITServerSharedROMClassCache.hpp"
 #include "runtime/JITServerStatisticsThread.hpp"
 #include "runtime/Listener.hpp"
@@ -1051,6 +1054,20 @@ compileClasses(J9VMThread * vmThread, const char * pattern)
    }
 
 
+// Returns the number of entries of the compilation cost ledger written into costs,
+// the most expensive methods first. Does not need VM access.
+extern "C" UDATA
+getCompilationCosts(J9JITConfig * jitConfig, J9JITMethodCompilationCost * costs, UDATA count)
+   {
+   TR::CompilationInfo * compInfo = TR::CompilationInfo::get(jitConfig);
+   if (!compInfo || !compInfo->getCompilationCostLedger())
+      return 0;
+   if (count > TR_CompilationCostLedger::MAX_TOP_ENTRIES)
+      count = TR_CompilationCostLedger::MAX_TOP_ENTRIES;
+   return compInfo->getCompilationCostLedger()->getTopEntries(costs, (uint32_t)count);
+   }
+
+
 // -----------------------------------------------------------------------------
 // JIT initialization
 // -----------------------------------------------------------------------------
@@ -1129,6 +1146,7 @@ onLoadInternal(
    jitConfig->enableJit = enableJit;
    jitConfig->compileClass = compileClass;
    jitConfig->compileClasses = compileClasses;
+   jitConfig->getCompilationCosts = getCompilationCosts;
 #ifdef ENABLE_GPU
    jitConfig->launchGPU = launchGPU;
 #endif
@@ -1635,6 +1653,8 @@ onLoadInternal(
 #else
       ((TR_JitPrivateConfig*)(jitConfig->privateConfig))->hwProfiler = NULL;
 #endif /* !defined(J9OS_I5) */
+#elif defined(TR_PERF_EVENT_HW_PROFILER)
+      ((TR_JitPrivateConfig*)(jitConfig->privateConfig))->hwProfiler = TR_PerfEventHWProfiler::allocate(jitConfig);
 #endif
 
       //Initialize VM support for RI.
@@ -1752,6 +1772,15 @@ onLoadInternal(
          if (!cache)
             return -1;
          compInfo->setJITServerSharedROMClassCache(cache);
+
+         // Shared profiles identify classes by the hashes computed by the shared ROMClass cache
+         if (TR::Options::_shareProfilingData)
+            {
+            auto profileCache = new (PERSISTENT_NEW) JITServerSharedProfileCache();
+            if (!profileCache)
+               return -1;
+            compInfo->setJITServerSharedProfileCache(profileCache);
+            }
          }
 
       //NOTE: This must be done only after the SSL library has been successfully loaded
@@ -23,6 +23,8 @@
 #include "control/CompilationRuntime.hpp"
 
 #include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
 #include "jni.h"
 #include "j9.h"
 #include "j9port.h"
@@ -403,3 +405,51 @@ void TR_CpuEntitlement::computeAndCacheCpuEntitlement()
       }
    }
 
+int32_t TR_CpuEntitlement::computeCgroupCpuThrottling()
+   {
+   int32_t throttledPercentage = -1;
+#if defined(LINUX)
+   OMRPORT_ACCESS_FROM_J9PORT(_jitConfig->javaVM->portLibrary);
+   if (!omrsysinfo_cgroup_is_system_available() ||
+       OMR_CGROUP_SUBSYSTEM_CPU != omrsysinfo_cgroup_are_subsystems_enabled(OMR_CGROUP_SUBSYSTEM_CPU))
+      return -1;
+
+   int64_t period = -1, quota = -1, numPeriods = -1, numThrottled = -1;
+   OMRCgroupMetricIteratorState cgroupState = {0};
+   if (0 != omrsysinfo_cgroup_subsystem_iterator_init(OMR_CGROUP_SUBSYSTEM_CPU, &cgroupState))
+      return -1;
+   while (0 != omrsysinfo_cgroup_subsystem_iterator_hasNext(&cgroupState))
+      {
+      const char *metricKey = NULL;
+      OMRCgroupMetricElement metricElement = {0};
+      if (0 != omrsysinfo_cgroup_subsystem_iterator_metricKey(&cgroupState, &metricKey) ||
+          0 != omrsysinfo_cgroup_subsystem_iterator_next(&cgroupState, &metricElement))
+         continue;
+      // Unlimited quotas are reported as "-1" or "max", both of which end up as a non-positive value
+      int64_t value = strtoll(metricElement.value, NULL, 10);
+      if (!strcmp(metricKey, "CPU Period"))
+         period = value;
+      else if (!strcmp(metricKey, "CPU Quota"))
+         quota = value;
+      else if (!strcmp(metricKey, "Period intervals elapsed count"))
+         numPeriods = value;
+      else if (!strcmp(metricKey, "Throttled count"))
+         numThrottled = value;
+      }
+   omrsysinfo_cgroup_subsystem_iterator_destroy(&cgroupState);
+
+   _cgroupCpuLimit = (period > 0 && quota > 0) ? (int32_t)(quota * 100 / period) : 0;
+
+   if (numPeriods >= 0 && numThrottled >= 0)
+      {
+      uint64_t deltaPeriods = (uint64_t)numPeriods - _cgroupNumPeriods;
+      uint64_t deltaThrottled = (uint64_t)numThrottled - _cgroupNumThrottled;
+      // The first reading, or a counter reset, has no usable delta
+      if (_cgroupNumPeriods != 0 && (uint64_t)numPeriods >= _cgroupNumPeriods && (uint64_t)numThrottled >= _cgroupNumThrottled)
+         throttledPercentage = deltaPeriods > 0 ? (int32_t)(deltaThrottled * 100 / deltaPeriods) : 0;
+      _cgroupNumPeriods = numPeriods;
+      _cgroupNumThrottled = numThrottled;
+      }
+#endif /* defined(LINUX) */
+   return throttledPercentage;
+   }
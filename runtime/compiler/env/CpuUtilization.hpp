@@ -209,6 +209,11 @@ public:
    double getGuestCpuEntitlement() const { return _guestCpuEntitlement; } // as given by the hypervisor; 0 if error or no hypervisor
    double getJvmCpuEntitlement()   const { return _jvmCpuEntitlement; } // smallest of _numTargetCpu and _guestCpuEntitlement
 
+   // Reads the CPU quota and throttling statistics of the cgroup the JVM runs in. Returns the
+   // percentage of CFS periods that were throttled since the previous call, or -1 if unavailable
+   int32_t computeCgroupCpuThrottling();
+   int32_t getCgroupCpuLimit()     const { return _cgroupCpuLimit; } // CPU quota as percentage (200 means two CPUs); 0 if no quota
+
 private:
    double computeGuestCpuEntitlement() const; // this does not check for isHypervisorPresent, so don't call it directly
 
@@ -217,6 +222,9 @@ private:
    double        _guestCpuEntitlement;
    double        _jvmCpuEntitlement;
    J9JITConfig * _jitConfig;
+   int32_t       _cgroupCpuLimit;
+   uint64_t      _cgroupNumPeriods;   // value of nr_periods at the last computeCgroupCpuThrottling()
+   uint64_t      _cgroupNumThrottled; // value of nr_throttled at the last computeCgroupCpuThrottling()
    };
 
 #endif // CPUUTILIZATION_HPP
@@ -79,6 +79,12 @@ public:
    
    const char *getProcessorVendorId();
    uint32_t getProcessorSignature();
+
+   /**
+    * @brief Returns the width of the widest vector registers the processor provides
+    * @return the width in bytes; 16 unless a platform knows better
+    */
+   uint32_t getMaxVectorLengthInBytes() { return 16; }
    };
 }
 
@@ -425,6 +425,13 @@ J9::ClassEnv::isAnonymousClass(TR::Compilation *comp, TR_OpaqueClassBlock *clazz
    return comp->fej9()->isAnonymousClass(clazz);
    }
 
+bool
+J9::ClassEnv::hasTrustedFinalInstanceFields(TR_OpaqueClassBlock *clazz)
+   {
+   J9ROMClass *romClass = TR::Compiler->cls.romClassOf(clazz);
+   return J9ROMCLASS_IS_RECORD(romClass) || J9ROMCLASS_IS_HIDDEN(romClass);
+   }
+
 /*
  * Merges the prefix with the field name to a new string.
  *
@@ -115,6 +115,21 @@ public:
    bool isEnumClass(TR::Compilation *comp, TR_OpaqueClassBlock *clazzPointer, TR_ResolvedMethod *method);
    bool isPrimitiveClass(TR::Compilation *comp, TR_OpaqueClassBlock *clazz);
    bool isAnonymousClass(TR::Compilation *comp, TR_OpaqueClassBlock *clazz);
+
+   /**
+    * \brief
+    *    Checks whether the final instance fields of the specified class can be trusted not to
+    *    change after construction. Core reflection refuses to write the final fields of records
+    *    and of hidden classes (e.g. lambda proxies), even after setAccessible(true). Writes through
+    *    Unsafe or JNI are not detected, and compiled code that folded such a field is not invalidated.
+    *
+    * \param clazz
+    *    The class that is to be checked
+    *
+    * \return
+    *    `true` if the class is a record or a hidden class; `false` otherwise
+    */
+   bool hasTrustedFinalInstanceFields(TR_OpaqueClassBlock *clazz);
    bool isPrimitiveArray(TR::Compilation *comp, TR_OpaqueClassBlock *);
    bool isReferenceArray(TR::Compilation *comp, TR_OpaqueClassBlock *);
    bool isClassArray(TR::Compilation *comp, TR_OpaqueClassBlock *);
@@ -78,6 +78,14 @@ enum ServerMemoryState
    NORMAL,
    };
 
+// Backlog of compilation requests at the server relative to its number of compilation threads
+enum ServerQueueState
+   {
+   OVERLOADED = 0,
+   BUSY,
+   AVAILABLE,
+   };
+
 enum CompThreadActivationPolicy
    {
    // Order is important, we use comparison operators
@@ -159,6 +167,10 @@ class PersistentInfo : public OMR::PersistentInfoConnector
          _socketTimeoutMs(2000),
          _clientUID(0),
          _JITServerUseAOTCache(false),
+         _JITServerAOTCacheSnapshotInterval(0),
+         _JITServerShareAOTCacheDir(false),
+         _JITServerUseCompression(false),
+         _JITServerClientSessionMemoryBudget(0),
 #endif /* defined(J9VM_OPT_JITSERVER) */
       OMR::PersistentInfoConnector(pm)
       {}
@@ -334,6 +346,16 @@ class PersistentInfo : public OMR::PersistentInfoConnector
    void setClientUID(uint64_t val) { _clientUID = val; }
    bool getJITServerUseAOTCache() const { return _JITServerUseAOTCache; }
    void setJITServerUseAOTCache(bool use) { _JITServerUseAOTCache = use; }
+   const std::string &getJITServerAOTCacheDir() const { return _JITServerAOTCacheDir; }
+   void setJITServerAOTCacheDir(const char *dir) { _JITServerAOTCacheDir = dir; }
+   uint32_t getJITServerAOTCacheSnapshotInterval() const { return _JITServerAOTCacheSnapshotInterval; }
+   void setJITServerAOTCacheSnapshotInterval(uint32_t t) { _JITServerAOTCacheSnapshotInterval = t; }
+   bool getJITServerShareAOTCacheDir() const { return _JITServerShareAOTCacheDir; }
+   void setJITServerShareAOTCacheDir(bool share) { _JITServerShareAOTCacheDir = share; }
+   bool getJITServerUseCompression() const { return _JITServerUseCompression; }
+   void setJITServerUseCompression(bool use) { _JITServerUseCompression = use; }
+   size_t getJITServerClientSessionMemoryBudget() const { return _JITServerClientSessionMemoryBudget; }
+   void setJITServerClientSessionMemoryBudget(size_t bytes) { _JITServerClientSessionMemoryBudget = bytes; }
 #endif /* defined(J9VM_OPT_JITSERVER) */
 
    private:
@@ -424,6 +446,11 @@ class PersistentInfo : public OMR::PersistentInfoConnector
    uint32_t    _socketTimeoutMs; // timeout for communication sockets used in out-of-process JIT compilation
    uint64_t    _clientUID;
    bool        _JITServerUseAOTCache;
+   std::string _JITServerAOTCacheDir; // directory for AOT cache snapshots; empty if snapshots are disabled
+   uint32_t    _JITServerAOTCacheSnapshotInterval; // ms; 0 means snapshots are only written at shutdown
+   bool        _JITServerShareAOTCacheDir; // snapshot directory is shared with other servers; merge snapshots before writing
+   bool        _JITServerUseCompression; // compress large messages sent to peers that accept compressed messages
+   size_t      _JITServerClientSessionMemoryBudget; // bytes of cached class data per client session; 0 means unlimited
 #endif /* defined(J9VM_OPT_JITSERVER) */
    };
 
@@ -171,7 +171,11 @@ TR_J9SharedCache::TR_J9SharedCache(TR_J9VMBase *fe)
 
       _hintsEnabledMask = 0;
       if (!TR::Options::getAOTCmdLineOptions()->getOption(TR_DisableSharedCacheHints))
+         {
          _hintsEnabledMask = TR::Options::getAOTCmdLineOptions()->getEnableSCHintFlags();
+         if (TR::Options::_eagerAOTLoadSCount >= 0)
+            _hintsEnabledMask |= TR_HintEagerAOTLoad;
+         }
 
       _initialHintSCount = std::min(TR::Options::getCmdLineOptions()->getInitialSCount(), TR::Options::getAOTCmdLineOptions()->getInitialSCount());
       if (_initialHintSCount == 0)
@@ -1353,6 +1357,23 @@ TR_J9SharedCache::storeSharedData(J9VMThread *vmThread, char *key, J9SharedDataD
 #endif
    }
 
+const void *
+TR_J9SharedCache::findSharedData(J9VMThread *vmThread, const char *key, UDATA dataType, J9SharedDataDescriptor *descriptor)
+   {
+   descriptor->address = NULL;
+#if defined(J9VM_OPT_SHARED_CLASSES) && (defined(TR_HOST_X86) || defined(TR_HOST_POWER) || defined(TR_HOST_S390) || defined(TR_HOST_ARM) || defined(TR_HOST_ARM64))
+   _sharedCacheConfig->findSharedData(
+         vmThread,
+         key,
+         strlen(key),
+         dataType,
+         FALSE,
+         descriptor,
+         NULL);
+#endif
+   return descriptor->address;
+   }
+
 #if defined(J9VM_OPT_JITSERVER)
 TR_J9JITServerSharedCache::TR_J9JITServerSharedCache(TR_J9VMBase *fe)
    : TR_J9SharedCache(fe)
@@ -44,6 +44,16 @@ struct J9SharedClassConfig;
 struct J9SharedClassCacheDescriptor;
 struct J9SharedDataDescriptor;
 
+// Recorded for AOT bodies that were loaded or compiled during startup when -Xjit:eagerAOTLoadSCount
+// is set. TR_HintMethodCompiledDuringStartup is not reused since it records JIT compilations during
+// startup, which drive other scount adjustments.
+static const TR_SharedCacheHint TR_HintEagerAOTLoad = (TR_SharedCacheHint)0x1000;
+static_assert((TR_HintEagerAOTLoad & (TR_HintUpgrade | TR_HintHot | TR_HintScorching | TR_HintEDO | TR_HintDLT |
+                                      TR_HintFailedValidation | TR_HintLargeMemoryMethodW | TR_HintLargeMemoryMethodC |
+                                      TR_HintLargeCompCPUW | TR_HintLargeCompCPUC | TR_HintMethodCompiledDuringStartup |
+                                      TR_HintFailedCHTable)) == 0,
+              "TR_HintEagerAOTLoad must not overlap other shared cache hints");
+
 /**
  * \brief An interface to the VM's shared class cache.
  *
@@ -308,6 +318,16 @@ public:
 
    virtual const void *storeSharedData(J9VMThread *vmThread, char *key, J9SharedDataDescriptor *descriptor);
 
+   /**
+    * \brief Looks up keyed data previously stored with storeSharedData().
+    * \param[in] vmThread the current thread
+    * \param[in] key null terminated key the data was stored under
+    * \param[in] dataType the J9SHR_DATA_TYPE_* the data was stored as
+    * \param[out] descriptor filled in with the address and length of the data
+    * \return Returns the address of the data in the SCC or NULL if not found
+    */
+   virtual const void *findSharedData(J9VMThread *vmThread, const char *key, UDATA dataType, J9SharedDataDescriptor *descriptor);
+
    enum TR_J9SharedCacheDisabledReason
       {
       UNINITIALIZED,
@@ -251,6 +251,9 @@ JITClientPersistentCHTable::serializeRemoves()
 std::string
 JITClientPersistentCHTable::serializeModifications()
    {
+   // Look up each dirty class once; the second pass reuses the infos found here
+   std::vector<TR_PersistentClassInfo*> classes;
+   classes.reserve(_dirty.size());
    size_t numBytes = 0;
    for (auto classId : _dirty)
       {
@@ -258,16 +261,15 @@ JITClientPersistentCHTable::serializeModifications()
       if (!clazz) continue;
       size_t size = FlatPersistentClassInfo::classSize(clazz);
       numBytes += size;
+      classes.push_back(clazz);
       }
 
    std::string data(numBytes, '\0');
 
    size_t bytesWritten = 0;
    size_t count = 0;
-   for (auto classId : _dirty)
+   for (auto clazz : classes)
       {
-      auto clazz = findClassInfo(classId);
-      if (!clazz) continue;
       FlatPersistentClassInfo* info = (FlatPersistentClassInfo*)&data[bytesWritten];
       bytesWritten += FlatPersistentClassInfo::serializeClass(clazz, info);
       count++;
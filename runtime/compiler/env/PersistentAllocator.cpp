@@ -186,12 +186,16 @@ PersistentAllocator::allocateInternal(size_t requestedSize)
    size_t const dataSize = mem_round(requestedSize);
    size_t const allocSize = sizeof(Block) + dataSize;
    void * allocation = NULL;
+   bool const meterAllocation = (TR::AllocatedMemoryMeter::_enabled & persistentAlloc) != 0;
 
-   if (TR::AllocatedMemoryMeter::_enabled & persistentAlloc)
+   // Use _smallBlockListsMonitor to protect TR::AllocatedMemoryMeter::update_allocated
+   // because accessing the variable-size-block list protected by ::memoryAllocMonitor
+   // takes longer and we may be penalizing access to fixed size block which should be very fast.
+   // Small blocks update the meter in the same critical section that pops the free list.
+   //
+   size_t const index = freeBlocksIndex(allocSize);
+   if (meterAllocation && index == LARGE_BLOCK_LIST_INDEX)
       {
-      // Use _smallBlockListsMonitor to protect TR::AllocatedMemoryMeter::update_allocated
-      // because accessing the variable-size-block list protected by ::memoryAllocMonitor
-      // takes longer and we may be penalizing access to fixed size block which should be very fast
       j9thread_monitor_enter(_smallBlockListsMonitor);
       TR::AllocatedMemoryMeter::update_allocated(allocSize, persistentAlloc);
       j9thread_monitor_exit(_smallBlockListsMonitor);
@@ -200,10 +204,11 @@ PersistentAllocator::allocateInternal(size_t requestedSize)
    // If this is a small block try to allocate it from the appropriate
    // fixed-size-block chain.
    //
-   size_t const index = freeBlocksIndex(allocSize);
    if (index != LARGE_BLOCK_LIST_INDEX) // fixed-size-block chain
       {
       j9thread_monitor_enter(_smallBlockListsMonitor);
+      if (meterAllocation)
+         TR::AllocatedMemoryMeter::update_allocated(allocSize, persistentAlloc);
       Block * block = _freeBlocks[index];
       if (block)
          {
@@ -572,8 +577,11 @@ PersistentAllocator::freeBlock(Block * block)
    TR_ASSERT(block->size() > 0, "Block size is non-positive");
 
    // Adjust the used persistent memory here and not in freePersistentmemory(block, size)
-   // because that call is also used to free memory that wasn't actually committed
-   if (TR::AllocatedMemoryMeter::_enabled & persistentAlloc)
+   // because that call is also used to free memory that wasn't actually committed.
+   // Small blocks update the meter in the same critical section that pushes the free list.
+   bool const meterFree = (TR::AllocatedMemoryMeter::_enabled & persistentAlloc) != 0;
+   size_t const index = freeBlocksIndex(block->size());
+   if (meterFree && index == LARGE_BLOCK_LIST_INDEX)
       {
       j9thread_monitor_enter(_smallBlockListsMonitor);
       TR::AllocatedMemoryMeter::update_freed(block->size(), persistentAlloc);
@@ -584,10 +592,11 @@ PersistentAllocator::freeBlock(Block * block)
    // chain. Otherwise add it to the variable-size-block chain which is in
    // ascending size order.
    //
-   size_t const index = freeBlocksIndex(block->size());
    if (index > LARGE_BLOCK_LIST_INDEX)
       {
       j9thread_monitor_enter(_smallBlockListsMonitor);
+      if (meterFree)
+         TR::AllocatedMemoryMeter::update_freed(block->size(), persistentAlloc);
       freeFixedSizeBlock(block);
       j9thread_monitor_exit(_smallBlockListsMonitor);
       }
@@ -132,7 +132,7 @@ class TR_RuntimeAssumptionTable
 
    // My table of hash tables; init() allocate memory and populate it
    TR_RatHT _tables[LastAssumptionKind];
-   bool     _detachPending[LastAssumptionKind]; // Marks tables that have assumptions waiting to be removed
+   uint32_t _detachPending[LastAssumptionKind]; // Counts, per table, the assumptions waiting to be removed
    uint32_t _marked;                            // Counts the number of assumptions waiting to be removed
    int32_t assumptionCount[LastAssumptionKind]; // this never gets decremented
    int32_t reclaimedAssumptionCount[LastAssumptionKind];
@@ -2928,7 +2928,7 @@ bool TR_J9VMBase::supressInliningRecognizedInitialCallee(TR_CallSite* callsite,
             break;
          case TR::java_lang_String_hashCodeImplDecompressed:
             /*
-             * X86 and z want to avoid inlining both java_lang_String_hashCodeImplDecompressed and java_lang_String_hashCodeImplCompressed
+             * X86, z and AArch64 want to avoid inlining both java_lang_String_hashCodeImplDecompressed and java_lang_String_hashCodeImplCompressed
              * so they can be recognized and replaced with a custom fast implementation.
              * Power currently only has the custom fast implementation for java_lang_String_hashCodeImplDecompressed.
              * As a result, Power only wants to prevent inlining of java_lang_String_hashCodeImplDecompressed.
@@ -4078,6 +4078,12 @@ TR_J9VMBase::canDereferenceAtCompileTimeWithFieldSymbol(TR::Symbol * fieldSymbol
             if (!fieldClass)
                return false;
 
+            // Records and hidden classes cannot have their final instance fields
+            // written by reflection
+            if (fieldSymbol->isShadow()
+                && TR::Compiler->cls.hasTrustedFinalInstanceFields(fieldClass))
+               return true;
+
             name = getClassNameChars((TR_OpaqueClassBlock*)fieldClass, len);
             }
 
@@ -5387,7 +5393,12 @@ TR_J9VMBase::getDesignatedCodeCache(TR::Compilation *comp) // MCT
    bool hadClassUnloadMonitor;
    bool hadVMAccess = releaseClassUnloadMonitorAndAcquireVMaccessIfNeeded(comp, &hadClassUnloadMonitor);
 
-   TR::CodeCache * result = TR::CodeCacheManager::instance()->reserveCodeCache(false, 0, compThreadID, &numReserved);
+   TR::CodeCache * result = NULL;
+   // Bodies of profiling compilations are short lived and stay out of the hot code cache
+   if (comp && comp->getMethodHotness() >= hot && !comp->isProfilingCompilation())
+      result = TR::CodeCacheManager::instance()->reserveHotCodeCache(compThreadID);
+   if (!result)
+      result = TR::CodeCacheManager::instance()->reserveCodeCache(false, 0, compThreadID, &numReserved);
 
    acquireClassUnloadMonitorAndReleaseVMAccessIfNeeded(comp, hadVMAccess, hadClassUnloadMonitor);
    if (!result)
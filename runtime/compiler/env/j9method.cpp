@@ -3393,6 +3393,7 @@ void TR_ResolvedJ9Method::construct()
 
       {x(TR::sun_misc_Unsafe_ensureClassInitialized,     "ensureClassInitialized", "(Ljava/lang/Class;)V")},
       {x(TR::jdk_internal_misc_Unsafe_copyMemory0,   "copyMemory0", "(Ljava/lang/Object;JLjava/lang/Object;JJ)V")},
+      {x(TR::jdk_internal_misc_Unsafe_setMemory0,    "setMemory0",  "(Ljava/lang/Object;JJB)V")},
       {  TR::unknownMethod}
       };
 
@@ -3402,6 +3403,15 @@ void TR_ResolvedJ9Method::construct()
       {  TR::unknownMethod}
       };
 
+   static X VectorSupportMethods[] =
+      {
+      {x(TR::jdk_internal_vm_vector_VectorSupport_binaryOp,         "binaryOp",         "(ILjava/lang/Class;Ljava/lang/Class;ILjava/lang/Object;Ljava/lang/Object;Ljava/util/function/BiFunction;)Ljava/lang/Object;")},
+      {x(TR::jdk_internal_vm_vector_VectorSupport_load,             "load",             "(Ljava/lang/Class;Ljava/lang/Class;ILjava/lang/Object;JLjava/lang/Object;ILjdk/internal/vm/vector/VectorSupport$VectorSpecies;Ljdk/internal/vm/vector/VectorSupport$LoadOperation;)Ljdk/internal/vm/vector/VectorSupport$Vector;")},
+      {x(TR::jdk_internal_vm_vector_VectorSupport_reductionCoerced, "reductionCoerced", "(ILjava/lang/Class;Ljava/lang/Class;ILjdk/internal/vm/vector/VectorSupport$Vector;Ljava/util/function/Function;)J")},
+      {x(TR::jdk_internal_vm_vector_VectorSupport_store,            "store",            "(Ljava/lang/Class;Ljava/lang/Class;ILjava/lang/Object;JLjdk/internal/vm/vector/VectorSupport$Vector;Ljava/lang/Object;ILjdk/internal/vm/vector/VectorSupport$StoreVectorOperation;)V")},
+      {  TR::unknownMethod}
+      };
+
    static X ArrayMethods[] =
       {
       {x(TR::java_lang_reflect_Array_getLength, "getLength", "(Ljava/lang/Object;)I")},
@@ -4474,6 +4484,7 @@ void TR_ResolvedJ9Method::construct()
       { "com/ibm/tenant/InternalTenantContext", MTTenantContext },
       { "java/lang/StringCoding$StringDecoder", StringCoding_StringDecoderMethods },
       { "java/lang/StringCoding$StringEncoder", StringCoding_StringEncoderMethods },
+      { "jdk/internal/vm/vector/VectorSupport", VectorSupportMethods },
       { 0 }
       };
 
@@ -40,6 +40,7 @@ getJ9ClassInfo(TR::CompilationInfoPerThread *threadCompInfo, J9Class *clazz)
    auto it = classMap.find(clazz);
    TR_ASSERT_FATAL(it != classMap.end(),"compThreadID %d, ClientData %p, clazz %p: ClassInfo is not in the class map %p!!\n",
       threadCompInfo->getCompThreadId(), threadCompInfo->getClientData(), clazz, &classMap);
+   it->second._referenced = true;
    return it->second;
    }
 
@@ -1894,6 +1895,79 @@ TR_ResolvedJ9JITServerMethod::cacheFields()
       }
    }
 
+void
+TR_ResolvedJ9JITServerMethod::cacheFieldAttributesForFields()
+   {
+   // Field and static attributes are queried once for every load/store
+   // during IL generation. Collect the ones that are not cached yet
+   // and fetch them from the client in one batch.
+   // AOT compilations use a separate cache and need validation records,
+   // so they keep using the individual queries.
+   auto compInfoPT = static_cast<TR::CompilationInfoPerThreadRemote *>(_fe->_compInfoPT);
+   TR::Compilation *comp = compInfoPT->getCompilation();
+   if (comp->compileRelocatableCode())
+      return;
+
+   TR_J9ByteCodeIterator bci(0, this, _fe, comp);
+   std::vector<int32_t> cpIndices;
+   std::vector<uint8_t> isStaticField;
+   std::vector<uint8_t> isStoreField;
+   for (TR_J9ByteCode bc = bci.first(); bc != J9BCunknown; bc = bci.next())
+      {
+      bool isStatic;
+      bool isStore;
+      switch (bc)
+         {
+         case J9BCgetfield:  isStatic = false; isStore = false; break;
+         case J9BCputfield:  isStatic = false; isStore = true;  break;
+         case J9BCgetstatic: isStatic = true;  isStore = false; break;
+         case J9BCputstatic: isStatic = true;  isStore = true;  break;
+         default: continue;
+         }
+
+      int32_t cpIndex = bci.next2Bytes();
+      TR_J9MethodFieldAttributes attributes;
+      if (getCachedFieldAttributes(cpIndex, attributes, isStatic))
+         continue;
+
+      // The same field may be accessed several times; resolving it once is enough,
+      // but a store must be resolved as a store.
+      bool duplicate = false;
+      for (size_t i = 0; i < cpIndices.size(); ++i)
+         {
+         if (cpIndices[i] == cpIndex && isStaticField[i] == isStatic)
+            {
+            isStoreField[i] |= isStore;
+            duplicate = true;
+            break;
+            }
+         }
+      if (!duplicate)
+         {
+         cpIndices.push_back(cpIndex);
+         isStaticField.push_back(isStatic);
+         isStoreField.push_back(isStore);
+         }
+      }
+
+   // A single field is cheaper to get through the regular query
+   int32_t numFields = cpIndices.size();
+   if (numFields < 2)
+      return;
+
+   _stream->write(JITServer::MessageType::ResolvedMethod_getMultipleFieldAttributes, _remoteMirror, cpIndices, isStaticField, isStoreField);
+   auto recv = _stream->read<std::vector<TR_J9MethodFieldAttributes>>();
+   auto &attributes = std::get<0>(recv);
+   TR_ASSERT(numFields == attributes.size(), "Number of received field attributes does not match the requested number");
+
+   for (int32_t i = 0; i < numFields; ++i)
+      {
+      TR_J9MethodFieldAttributes cachedAttributes;
+      if (!getCachedFieldAttributes(cpIndices[i], cachedAttributes, isStaticField[i]))
+         cacheFieldAttributes(cpIndices[i], attributes[i], isStaticField[i]);
+      }
+   }
+
 int32_t
 TR_ResolvedJ9JITServerMethod::collectImplementorsCapped(
    TR_OpaqueClassBlock *topClass,
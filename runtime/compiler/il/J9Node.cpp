@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2020 IBM Corp. and others
+ * Copyright (c) 2000, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -304,7 +304,8 @@ J9::Node::processJNICall(TR::TreeTop * callNodeTreeTop, TR::ResolvedMethodSymbol
       return self();
       }
    if (comp->canTransformUnsafeSetMemory() &&
-       (methodSymbol->getRecognizedMethod() == TR::sun_misc_Unsafe_setMemory))
+       ((methodSymbol->getRecognizedMethod() == TR::sun_misc_Unsafe_setMemory) ||
+        (methodSymbol->getRecognizedMethod() == TR::jdk_internal_misc_Unsafe_setMemory0)))
       {
       return self();
       }
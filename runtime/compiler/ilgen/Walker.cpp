@@ -237,6 +237,10 @@ TR::Block * TR_J9ByteCodeIlGenerator::walker(TR::Block * prevBlock)
       // Cache field info for every field/static loaded/stored in this method, which are later used by
       // jitFieldsAreSame/jitStaticAreSame when creating symbol references.
       static_cast<TR_ResolvedJ9JITServerMethod *>(_methodSymbol->getResolvedMethod())->cacheFields();
+
+      // Likewise, fetch the attributes of those fields and statics, which are queried when
+      // symbol references are created for them.
+      static_cast<TR_ResolvedJ9JITServerMethod *>(_methodSymbol->getResolvedMethod())->cacheFieldAttributesForFields();
       }
 #endif
 
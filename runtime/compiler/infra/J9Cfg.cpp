@@ -91,6 +91,50 @@ static bool hasBlockFrequencyInfo(TR::Compilation *comp, TR::CFG *cfg)
    return profileInfo && profileInfo->getBlockFrequencyInfo();
    }
 
+// Number of times the profiled body must have been entered for its blocks that
+// were never executed to be considered cold
+#define PROFILED_COLD_BLOCK_ENTRY_THRESHOLD 100
+
+/**
+ * Marks the blocks that the profiled body of the method never executed as cold so
+ * that cold block outlining moves them, along with the exception paths, asserts and
+ * logging they usually hold, out of the fall-through path of the hot blocks.
+ */
+static void markUnexecutedBlocksCold(TR::Compilation *comp, TR::CFG *cfg)
+   {
+   static char *disableProfiledColdBlocks = feGetEnv("TR_DisableProfiledColdBlocks");
+   if (disableProfiledColdBlocks || cfg != comp->getFlowGraph())
+      return;
+
+   TR_PersistentProfileInfo *profileInfo = getProfilingInfoForCFG(comp, cfg);
+   TR_BlockFrequencyInfo *blockFrequencyInfo = profileInfo ? profileInfo->getBlockFrequencyInfo() : NULL;
+   if (!blockFrequencyInfo)
+      return;
+
+   int32_t entryFrequency = blockFrequencyInfo->getFrequencyInfo(comp->getStartBlock(), comp);
+   if (entryFrequency < PROFILED_COLD_BLOCK_ENTRY_THRESHOLD)
+      return;
+
+   int32_t numMarked = 0;
+   for (TR::Block *block = comp->getStartBlock(); block; block = block->getNextBlock())
+      {
+      if (block->isCold() || !block->getEntry() || block == comp->getStartBlock())
+         continue;
+
+      // A frequency of -1 means the block has no profiling data
+      if (blockFrequencyInfo->getFrequencyInfo(block, comp) != 0)
+         continue;
+
+      block->setIsCold();
+      numMarked++;
+      if (comp->getOption(TR_TraceBFGeneration))
+         traceMsg(comp, "Marking block_%d cold as it was never executed by the profiled body\n", block->getNumber());
+      }
+
+   if (numMarked > 0 && comp->getOption(TR_TraceBFGeneration))
+      traceMsg(comp, "Marked %d unexecuted blocks cold, entry frequency %d\n", numMarked, entryFrequency);
+   }
+
 static bool hasJProfilingInfo(TR::Compilation *comp, TR::CFG *cfg)
    {
    static char *disableJProfilingForInner = feGetEnv("TR_disableJProfilingForInner");
@@ -140,6 +184,7 @@ J9::CFG::setFrequencies()
          _externalProfiler = comp()->fej9()->hasIProfilerBlockFrequencyInfo(*comp());
          TR_BitVector *nodesToBeNormalized = self()->setBlockAndEdgeFrequenciesBasedOnJITProfiler();
          self()->normalizeFrequencies(nodesToBeNormalized);
+         markUnexecutedBlocksCold(comp(), self());
          if (comp()->getOption(TR_TraceBFGeneration))
             {
             traceMsg(comp(), "CFG of %s after setting frequencies using JITProfiling\n", self()->getMethodSymbol()->signature(comp()->trMemory()));
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2018, 2020 IBM Corp. and others
+ * Copyright (c) 2018, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -23,7 +23,10 @@
 #include "ClientStream.hpp"
 #include "control/CompilationRuntime.hpp"
 #include "control/Options.hpp"
+#include "env/CompilerEnv.hpp"
 #include "env/VerboseLog.hpp"
+#include "infra/CriticalSection.hpp"
+#include "infra/Monitor.hpp"
 #include "net/LoadSSLLibs.hpp"
 #include <sys/types.h>
 #include <sys/socket.h>
@@ -33,6 +36,7 @@
 #include <netinet/tcp.h>	/* for TCP_NODELAY option */
 #include <fcntl.h>
 #include <arpa/inet.h>
+#include <algorithm>
 #include <stdio.h>
 #include <stdlib.h>
 #include <unistd.h> /// gethostname, read, write
@@ -49,10 +53,87 @@ uint64_t ClientStream::_incompatibleStartTime = 0;
 const uint64_t ClientStream::RETRY_COMPATIBILITY_INTERVAL_MS = 10000; //ms
 const int ClientStream::INCOMPATIBILITY_COUNT_LIMIT = 5;
 
+std::vector<ClientStream::Server> ClientStream::_servers;
+TR::Monitor *ClientStream::_serversMonitor = NULL;
+size_t ClientStream::_sessionServerIndex = 0;
+
+static const uint64_t SERVER_MIN_RETRY_WAIT_MS = 1000;
+static const uint64_t SERVER_MAX_RETRY_WAIT_MS = 64000;
+
+// Mix the bits of a 64-bit value (finalizer of the SplitMix64 generator)
+static uint64_t
+mixBits(uint64_t x)
+   {
+   x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+   x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+   return x ^ (x >> 31);
+   }
+
+// Parse the comma separated list of servers given with -XX:JITServerAddress=, each
+// in the form host[:port], and order it for rendezvous hashing of the client UID:
+// every client prefers the server with the highest weight computed from its UID and the
+// server name, and falls back to the other servers in order of decreasing weight. Adding
+// or removing a server only moves the clients that prefer that particular server.
+void ClientStream::initServerList(TR::PersistentInfo *info)
+   {
+   const std::string &list = info->getJITServerAddress();
+   size_t start = 0;
+   while (start <= list.size())
+      {
+      size_t end = list.find(',', start);
+      if (end == std::string::npos)
+         end = list.size();
+      std::string name = list.substr(start, end - start);
+      start = end + 1;
+      if (name.empty())
+         continue;
+
+      Server server = { name, info->getJITServerPort(), 0, 0, SERVER_MIN_RETRY_WAIT_MS, NULL };
+      // IPv6 addresses are not supported, so a colon can only separate the port
+      size_t colon = name.rfind(':');
+      if (colon != std::string::npos)
+         {
+         char *portEnd = NULL;
+         unsigned long port = strtoul(name.c_str() + colon + 1, &portEnd, 10);
+         if ((*portEnd == '\0') && (port > 0) && (port <= 65535))
+            {
+            server._address = name.substr(0, colon);
+            server._port = (uint32_t)port;
+            }
+         }
+
+      // FNV-1a hash of the server name and port
+      uint64_t hash = 0xcbf29ce484222325ULL;
+      for (char c : server._address)
+         hash = (hash ^ (uint8_t)c) * 0x100000001b3ULL;
+      hash = (hash ^ server._port) * 0x100000001b3ULL;
+      server._weight = mixBits(hash ^ mixBits(info->getClientUID()));
+      _servers.push_back(server);
+      }
+
+   if (_servers.empty())
+      _servers.push_back({ "localhost", info->getJITServerPort(), 0, 0, SERVER_MIN_RETRY_WAIT_MS, NULL });
+
+   std::stable_sort(_servers.begin(), _servers.end(),
+                    [](const Server &a, const Server &b) { return a._weight > b._weight; });
+
+   if (TR::Options::getVerboseOption(TR_VerboseJITServer) && (_servers.size() > 1))
+      {
+      for (size_t i = 0; i < _servers.size(); ++i)
+         TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Server %zu in order of preference: %s port: %u",
+            i, _servers[i]._address.c_str(), _servers[i]._port);
+      }
+   }
+
 // Create SSL context, load certs and keys. Only needs to be done once.
 // This is called during startup from rossa.cpp
 int ClientStream::static_init(TR::PersistentInfo *info)
    {
+   _serversMonitor = TR::Monitor::create("JITServer-ServerListMonitor");
+   if (!_serversMonitor)
+      return -1;
+   initServerList(info);
+
    if (!CommunicationStream::useSSL())
       return 0;
 
@@ -119,6 +200,13 @@ int ClientStream::static_init(TR::PersistentInfo *info)
    // verify server identity using standard method
    (*OSSL_CTX_set_verify)(ctx, SSL_VERIFY_PEER, NULL);
 
+   // Every compilation opens a new connection, so keep the last session handed out by
+   // each server and offer it on the next handshake with that server. This lets the server resume the
+   // session (session ID or ticket) instead of doing a full key exchange and certificate
+   // verification each time. The server already sets a session ID context in Listener.cpp.
+   (*OSSL_CTX_ctrl)(ctx, SSL_CTRL_SET_SESS_CACHE_MODE, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE, NULL);
+   (*OSSL_CTX_sess_set_new_cb)(ctx, &ClientStream::newSSLSessionCallback);
+
    _sslCtx = ctx;
 
    if (TR::Options::getVerboseOption(TR_VerboseJITServer))
@@ -128,6 +216,27 @@ int ClientStream::static_init(TR::PersistentInfo *info)
 
 SSL_CTX *ClientStream::_sslCtx = NULL;
 
+// Called by OpenSSL when the server issues a new session (with TLS 1.3 this happens
+// after the handshake, when the session ticket is received). Returning 1 means we
+// keep the reference to the session.
+int ClientStream::newSSLSessionCallback(SSL *ssl, SSL_SESSION *session)
+   {
+   // openSSLConnection() records which server the connection goes to
+   Server *server = (Server *)(*OSSL_get_ex_data)(ssl, 0);
+   if (!server)
+      return 0;
+
+   SSL_SESSION *oldSession;
+      {
+      OMR::CriticalSection sessionCache(_serversMonitor);
+      oldSession = server->_sslSession;
+      server->_sslSession = session;
+      }
+   if (oldSession)
+      (*OSSL_SESSION_free)(oldSession);
+   return 1;
+   }
+
 int openConnection(const std::string &address, uint32_t port, uint32_t timeoutMs)
    {
    // TODO consider support for IPv6
@@ -212,7 +321,7 @@ int openConnection(const std::string &address, uint32_t port, uint32_t timeoutMs
    return sockfd;
    }
 
-BIO *openSSLConnection(SSL_CTX *ctx, int connfd)
+BIO *ClientStream::openSSLConnection(SSL_CTX *ctx, int connfd, size_t serverIndex)
    {
    if (!ctx)
       return NULL;
@@ -226,6 +335,26 @@ BIO *openSSLConnection(SSL_CTX *ctx, int connfd)
 
    (*OSSL_set_connect_state)(ssl);
 
+   // Sessions are only valid with the server that issued them
+   Server *server = &_servers[serverIndex];
+   if ((*OSSL_set_ex_data)(ssl, 0, server) != 1)
+      {
+      (*OERR_print_errors_fp)(stderr);
+      (*OSSL_free)(ssl);
+      throw JITServer::StreamFailure("Cannot set application data for SSL");
+      }
+
+      {
+      // SSL_set_session() takes its own reference, so the cached session
+      // can be replaced by another thread once we leave the critical section
+      OMR::CriticalSection sessionCache(_serversMonitor);
+      if (server->_sslSession && ((*OSSL_set_session)(ssl, server->_sslSession) != 1))
+         {
+         // Not fatal: fall back to a full handshake
+         (*OERR_print_errors_fp)(stderr);
+         }
+      }
+
    if ((*OSSL_set_fd)(ssl, connfd) != 1)
       {
       (*OERR_print_errors_fp)(stderr);
@@ -277,12 +406,105 @@ BIO *openSSLConnection(SSL_CTX *ctx, int connfd)
    return bio;
    }
 
+int ClientStream::openConnectionToServer(TR::PersistentInfo *info, size_t &serverIndex)
+   {
+   serverIndex = 0;
+   // With a single server, stream failures are handled by the callers
+   // (see JITServerHelpers::postStreamFailure())
+   if (_servers.size() == 1)
+      return openConnection(_servers[0]._address, _servers[0]._port, info->getSocketTimeout());
+
+   PORT_ACCESS_FROM_PORT(TR::Compiler->portLib);
+   for (size_t i = 0; i < _servers.size(); ++i)
+      {
+      Server &server = _servers[i];
+         {
+         OMR::CriticalSection serverList(_serversMonitor);
+         if (j9time_current_time_millis() < server._nextRetryTime)
+            continue; // Server failed recently
+         }
+
+      try
+         {
+         int connfd = openConnection(server._address, server._port, info->getSocketTimeout());
+            {
+            OMR::CriticalSection serverList(_serversMonitor);
+            server._nextRetryTime = 0;
+            server._waitTimeMs = SERVER_MIN_RETRY_WAIT_MS;
+            }
+         if ((i > 0) && TR::Options::getVerboseOption(TR_VerboseJITServer))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Failed over to server %s port: %u",
+               server._address.c_str(), server._port);
+         serverIndex = i;
+         return connfd;
+         }
+      catch (const StreamFailure &e)
+         {
+         if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Cannot connect to server %s port: %u: %s",
+               server._address.c_str(), server._port, e.what());
+         OMR::CriticalSection serverList(_serversMonitor);
+         server._nextRetryTime = j9time_current_time_millis() + server._waitTimeMs;
+         server._waitTimeMs = std::min(server._waitTimeMs * 2, SERVER_MAX_RETRY_WAIT_MS);
+         }
+      }
+   throw StreamFailure("No JITServer is available");
+   }
+
 ClientStream::ClientStream(TR::PersistentInfo *info)
-   : CommunicationStream(), _versionCheckStatus(NOT_DONE)
+   : CommunicationStream(), _versionCheckStatus(NOT_DONE), _serverIndex(0)
    {
-   int connfd = openConnection(info->getJITServerAddress(), info->getJITServerPort(), info->getSocketTimeout());
-   BIO *ssl = openSSLConnection(_sslCtx, connfd);
+   int connfd = openConnectionToServer(info, _serverIndex);
+   BIO *ssl = openSSLConnection(_sslCtx, connfd, _serverIndex);
    initStream(connfd, ssl);
+   _useCompression = info->getJITServerUseCompression();
    _numConnectionsOpened++;
    }
+
+bool ClientStream::postServerFailure()
+   {
+   if (_servers.size() == 1)
+      return false;
+
+   PORT_ACCESS_FROM_PORT(TR::Compiler->portLib);
+   OMR::CriticalSection serverList(_serversMonitor);
+   uint64_t crtTime = j9time_current_time_millis();
+   Server &server = _servers[_serverIndex];
+   // Several streams to the same server can fail at the same time; only apply the backoff once
+   if (crtTime >= server._nextRetryTime)
+      {
+      server._nextRetryTime = crtTime + server._waitTimeMs;
+      server._waitTimeMs = std::min(server._waitTimeMs * 2, SERVER_MAX_RETRY_WAIT_MS);
+      }
+   for (const auto &s : _servers)
+      {
+      if (crtTime >= s._nextRetryTime)
+         return true;
+      }
+   return false;
+   }
+
+bool ClientStream::startsNewSession()
+   {
+   if (_serverIndex == _sessionServerIndex)
+      return false;
+   _sessionServerIndex = _serverIndex;
+   return true;
+   }
+
+bool ClientStream::shouldReconnectToPreferredServer()
+   {
+   if (_serverIndex == 0)
+      return false;
+
+   PORT_ACCESS_FROM_PORT(TR::Compiler->portLib);
+   OMR::CriticalSection serverList(_serversMonitor);
+   uint64_t crtTime = j9time_current_time_millis();
+   for (size_t i = 0; i < _serverIndex; ++i)
+      {
+      if (crtTime >= _servers[i]._nextRetryTime)
+         return true;
+      }
+   return false;
+   }
 };
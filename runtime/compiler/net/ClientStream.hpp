@@ -30,6 +30,7 @@
 
 class SSLOutputStream;
 class SSLInputStream;
+namespace TR { class Monitor; }
 
 namespace JITServer
 {
@@ -203,10 +204,67 @@ public:
    static int getNumConnectionsOpened() { return _numConnectionsOpened; }
    static int getNumConnectionsClosed() { return _numConnectionsClosed; }
 
+   /**
+      @brief Function called when this stream failed, to stop using its server for a while
+
+      When -XX:JITServerAddress= lists several servers, the one this stream is connected to
+      is not tried again until an exponentially increasing backoff interval expires.
+
+      @return true if other servers may still be available, in which case the client
+              should fail over to them instead of treating the JITServer as unavailable
+   */
+   bool postServerFailure();
+
+   /**
+      @brief Answers whether this stream should be closed and reopened because it is connected
+      to a fallback server while a server preferred for this client may be available again.
+      Reconnecting restores the affinity of the client to a single server and its caches.
+   */
+   bool shouldReconnectToPreferredServer();
+
+   /**
+      @brief Function called before a compilation request is sent on this stream
+      to find out whether it is the first request of this client to go to this server
+      since requests were sent to a different server.
+
+      In that case the session the server may still hold for this client is stale: it missed
+      the critical updates (unloaded classes, CHTable changes) sent to the other server and it
+      would wait for their sequence numbers. The request must then make the server start over.
+
+      Must be called with the sequencing monitor of the client in hand.
+   */
+   bool startsNewSession();
+
 private:
+   /**
+      @class Server
+      @brief A server from the -XX:JITServerAddress= list and its health status
+   */
+   struct Server
+      {
+      std::string _address;
+      uint32_t _port;
+      uint64_t _weight; // rendezvous hash of the client UID and the server; higher is preferred
+      uint64_t _nextRetryTime; // ms; the server is not tried before this time after a failure
+      uint64_t _waitTimeMs; // current backoff interval
+      SSL_SESSION *_sslSession; // last TLS session issued by this server, offered for resumption; protected by _serversMonitor
+      };
+
+   static void initServerList(TR::PersistentInfo *info);
+   static int openConnectionToServer(TR::PersistentInfo *info, size_t &serverIndex);
+   static BIO *openSSLConnection(SSL_CTX *ctx, int connfd, size_t serverIndex);
+   static int newSSLSessionCallback(SSL *ssl, SSL_SESSION *session);
+
    static int _numConnectionsOpened;
    static int _numConnectionsClosed;
    VersionCheckStatus _versionCheckStatus; // indicates whether a version checking has been performed
+   size_t _serverIndex; // index in _servers of the server this stream is connected to
+   // Servers ordered by preference for this client. Using the same order for all connections
+   // of a client (i.e. consistent hashing of the client UID) keeps all its compilations on
+   // the same server, which preserves the client session data cached by that server.
+   static std::vector<Server> _servers;
+   static TR::Monitor *_serversMonitor;
+   static size_t _sessionServerIndex; // server that received the last compilation request; guarded by the sequencing monitor
    static int _incompatibilityCount;
    static uint64_t _incompatibleStartTime; // Time when version incomptibility has been detected
    static const uint64_t RETRY_COMPATIBILITY_INTERVAL_MS; // (ms) When we should perform again a version compatibilty check
@@ -24,11 +24,13 @@
 #include "control/Options.hpp" // TR::Options::useCompressedPointers()
 #include "env/CompilerEnv.hpp" // for TR::Compiler->target.is64Bit()
 #include "net/CommunicationStream.hpp"
+#include "zlib.h"
 
 
 namespace JITServer
 {
 uint32_t CommunicationStream::CONFIGURATION_FLAGS = 0;
+CommunicationStream::CompressionStats CommunicationStream::_compressionStats[];
 #ifdef MESSAGE_SIZE_STATS
 TR_Stats JITServer::CommunicationStream::collectMsgStat[];
 #endif
@@ -66,22 +68,45 @@ CommunicationStream::readMessage2(Message &msg)
    msg.clearForRead();
 
    // read message size
-   uint32_t serializedSize;
-   readBlocking(serializedSize);
-
-   msg.expandBufferIfNeeded(serializedSize);
-   msg.setSerializedSize(serializedSize);
+   uint32_t sizeWord;
+   readBlocking(sizeWord);
+   uint32_t serializedSize = sizeWord & MESSAGE_SIZE_MASK;
+   if (serializedSize <= sizeof(uint32_t))
+      {
+      throw JITServer::StreamFailure("JITServer I/O error: invalid message size");
+      }
+   if (sizeWord & ACCEPTS_COMPRESSION_FLAG)
+      _peerAcceptsCompression = true;
 
-   // read the rest of the message
    uint32_t messageSize = serializedSize - sizeof(uint32_t);
-   readBlocking(msg.getBufferStartForRead() + sizeof(uint32_t), messageSize);
+   uint32_t uncompressedSize = serializedSize;
+   if (sizeWord & COMPRESSED_MESSAGE_FLAG)
+      {
+      // read the rest of the compressed message into the scratch buffer and inflate it
+      char *buffer = getCompressionBuffer(serializedSize);
+      ((uint32_t *)buffer)[0] = sizeWord;
+      readBlocking(buffer + sizeof(uint32_t), messageSize);
+      decompressMessage(msg, serializedSize);
+      uncompressedSize = ((uint32_t *)buffer)[1];
+      }
+   else
+      {
+      msg.expandBufferIfNeeded(serializedSize);
+      msg.setSerializedSize(serializedSize);
+
+      // read the rest of the message
+      readBlocking(msg.getBufferStartForRead() + sizeof(uint32_t), messageSize);
+      }
 
    // rebuild the message
    msg.deserialize();
 
+   if (_useCompression)
+      updateCompressionStats(msg.type(), uncompressedSize, serializedSize);
+
    // collect message size
 #ifdef MESSAGE_SIZE_STATS
-   collectMsgStat[int(msg.type())].update(serializedSize);
+   collectMsgStat[int(msg.type())].update(uncompressedSize);
 #endif
    }
 
@@ -105,7 +130,8 @@ CommunicationStream::readMessage(Message &msg)
       }
 
    // bytesRead >= sizeof(uint32_t)
-   uint32_t serializedSize = ((uint32_t *)buffer)[0];
+   uint32_t sizeWord = ((uint32_t *)buffer)[0];
+   uint32_t serializedSize = sizeWord & MESSAGE_SIZE_MASK;
    if (bytesRead > serializedSize)
       {
       throw JITServer::StreamFailure("JITServer I/O error: read more than the message size");
@@ -128,13 +154,30 @@ CommunicationStream::readMessage(Message &msg)
       readBlocking(buffer + bytesRead, bytesLeftToRead);
       }
 
-   msg.setSerializedSize(serializedSize);
+   if (sizeWord & ACCEPTS_COMPRESSION_FLAG)
+      _peerAcceptsCompression = true;
+
+   uint32_t uncompressedSize = serializedSize;
+   if (sizeWord & COMPRESSED_MESSAGE_FLAG)
+      {
+      // Move the compressed message into the scratch buffer and inflate it back into the message buffer
+      memcpy(getCompressionBuffer(serializedSize), buffer, serializedSize);
+      decompressMessage(msg, serializedSize);
+      uncompressedSize = ((uint32_t *)_compressionBuffer)[1];
+      }
+   else
+      {
+      msg.setSerializedSize(serializedSize);
+      }
 
    // rebuild the message
    msg.deserialize();
 
+   if (_useCompression)
+      updateCompressionStats(msg.type(), uncompressedSize, serializedSize);
+
 #ifdef MESSAGE_SIZE_STATS
-   collectMsgStat[int(msg.type())].update(serializedSize);
+   collectMsgStat[int(msg.type())].update(uncompressedSize);
 #endif
    }
 
@@ -142,8 +185,123 @@ void
 CommunicationStream::writeMessage(Message &msg)
    {
    char *serialMsg = msg.serialize();
-   // write serialized message to the socket
-   writeBlocking(serialMsg, msg.serializedSize());
+   uint32_t serializedSize = msg.serializedSize();
+
+   if (_useCompression)
+      {
+      TR_ASSERT_FATAL(serializedSize <= MESSAGE_SIZE_MASK, "Message size %u is too large", serializedSize);
+
+      uint32_t compressedSize = 0;
+      if (_peerAcceptsCompression && (serializedSize >= (uint32_t)TR::Options::_messageCompressionThreshold))
+         compressedSize = compressMessage(serialMsg, serializedSize);
+
+      if (compressedSize)
+         {
+         writeBlocking(_compressionBuffer, compressedSize);
+         }
+      else
+         {
+         *(uint32_t *)serialMsg |= ACCEPTS_COMPRESSION_FLAG;
+         writeBlocking(serialMsg, serializedSize);
+         }
+      updateCompressionStats(msg.type(), serializedSize, compressedSize ? compressedSize : serializedSize);
+      }
+   else
+      {
+      // write serialized message to the socket
+      writeBlocking(serialMsg, serializedSize);
+      }
    msg.clearForWrite();
    }
+
+char *
+CommunicationStream::getCompressionBuffer(uint32_t requiredSize)
+   {
+   if (requiredSize > _compressionBufferCapacity)
+      {
+      // Allocate a new buffer first, so that the stream stays consistent if allocation fails
+      char *newBuffer = static_cast<char *>(TR::Compiler->persistentGlobalAllocator().allocate(requiredSize));
+      if (!newBuffer)
+         throw std::bad_alloc();
+      if (_compressionBuffer)
+         TR::Compiler->persistentGlobalAllocator().deallocate(_compressionBuffer);
+      _compressionBuffer = newBuffer;
+      _compressionBufferCapacity = requiredSize;
+      }
+   return _compressionBuffer;
+   }
+
+uint32_t
+CommunicationStream::compressMessage(const char *serialMsg, uint32_t serializedSize)
+   {
+   static const uint32_t headerSize = 2 * sizeof(uint32_t);
+   if (serializedSize <= headerSize)
+      return 0;
+
+   char *buffer = getCompressionBuffer(serializedSize);
+   // Only send the compressed version if it is smaller than the original message.
+   // Otherwise compress2() returns Z_BUF_ERROR since the deflated data does not fit.
+   uLongf compressedDataSize = serializedSize - headerSize;
+   int rc = compress2((Bytef *)(buffer + headerSize), &compressedDataSize,
+                      (const Bytef *)serialMsg, serializedSize, Z_BEST_SPEED);
+   if (rc != Z_OK)
+      return 0;
+
+   uint32_t compressedSize = headerSize + compressedDataSize;
+   ((uint32_t *)buffer)[0] = compressedSize | COMPRESSED_MESSAGE_FLAG | ACCEPTS_COMPRESSION_FLAG;
+   ((uint32_t *)buffer)[1] = serializedSize;
+   return compressedSize;
+   }
+
+void
+CommunicationStream::decompressMessage(Message &msg, uint32_t compressedSize)
+   {
+   static const uint32_t headerSize = 2 * sizeof(uint32_t);
+   if (compressedSize <= headerSize)
+      throw JITServer::StreamFailure("JITServer I/O error: invalid compressed message size");
+
+   uint32_t uncompressedSize = ((uint32_t *)_compressionBuffer)[1];
+   msg.clearForRead();
+   msg.expandBufferIfNeeded(uncompressedSize);
+   char *buffer = msg.getBufferStartForRead();
+
+   uLongf size = uncompressedSize;
+   int rc = uncompress((Bytef *)buffer, &size, (const Bytef *)(_compressionBuffer + headerSize),
+                       compressedSize - headerSize);
+   if ((rc != Z_OK) || (size != uncompressedSize) ||
+       (size < sizeof(uint32_t)) || ((((uint32_t *)buffer)[0] & MESSAGE_SIZE_MASK) != uncompressedSize))
+      throw JITServer::StreamFailure("JITServer I/O error: failed to decompress message");
+
+   msg.setSerializedSize(uncompressedSize);
+   }
+
+void
+CommunicationStream::updateCompressionStats(MessageType type, uint32_t uncompressedSize, uint32_t wireSize)
+   {
+   if (type >= MessageType_MAXTYPE)
+      return;
+   // Updated without synchronization by multiple threads; occasional lost updates are acceptable
+   CompressionStats &stats = _compressionStats[type];
+   stats._numMessages++;
+   if (wireSize < uncompressedSize)
+      stats._numCompressedMessages++;
+   stats._uncompressedBytes += uncompressedSize;
+   stats._wireBytes += wireSize;
+   }
+
+void
+CommunicationStream::printCompressionStats()
+   {
+   TR_VerboseLog::writeLine(TR_Vlog_JITServer, "Message compression statistics (type: messages compressed/total, bytes on wire/uncompressed, ratio)");
+   for (int i = 0; i < MessageType_MAXTYPE; ++i)
+      {
+      const CompressionStats &stats = _compressionStats[i];
+      if (!stats._numMessages)
+         continue;
+      TR_VerboseLog::writeLine(TR_Vlog_JITServer, "   %s: %llu/%llu, %llu/%llu, %.2f",
+         messageNames[i], (unsigned long long)stats._numCompressedMessages, (unsigned long long)stats._numMessages,
+         (unsigned long long)stats._wireBytes, (unsigned long long)stats._uncompressedBytes,
+         (double)stats._wireBytes / stats._uncompressedBytes);
+      }
+   }
 }
@@ -49,6 +49,28 @@ public:
 
    static void initConfigurationFlags();
 
+   /**
+      @brief Per-message-type counters for message compression
+
+      Collected for all messages sent or received on streams with compression enabled,
+      including the messages that were below the size threshold and sent uncompressed.
+   */
+   struct CompressionStats
+      {
+      uint64_t _numMessages;
+      uint64_t _numCompressedMessages;
+      uint64_t _uncompressedBytes; // total size of serialized messages
+      uint64_t _wireBytes; // total number of bytes actually sent over the network
+      };
+   static CompressionStats _compressionStats[JITServer::MessageType_MAXTYPE];
+
+   /**
+      @brief Print compression ratios for all message types seen so far to vlog.
+
+      The caller must hold the vlog lock.
+   */
+   static void printCompressionStats();
+
    static uint32_t getJITServerVersion()
       {
       return (MAJOR_NUMBER << 24) | (MINOR_NUMBER << 8); // PATCH_NUMBER is ignored
@@ -66,7 +88,10 @@ public:
       }
 
 protected:
-   CommunicationStream() : _ssl(NULL), _connfd(-1) { }
+   CommunicationStream() :
+      _ssl(NULL), _connfd(-1), _useCompression(false), _peerAcceptsCompression(false),
+      _compressionBuffer(NULL), _compressionBufferCapacity(0)
+      { }
 
    virtual ~CommunicationStream()
       {
@@ -75,6 +100,9 @@ protected:
 
       if (_ssl)
          (*OBIO_free_all)(_ssl);
+
+      if (_compressionBuffer)
+         TR::Compiler->persistentGlobalAllocator().deallocate(_compressionBuffer);
       }
 
    void initStream(int connfd, BIO *ssl)
@@ -98,12 +126,37 @@ protected:
    ServerMessage _sMsg;
    ClientMessage _cMsg;
 
+   // Whether this end of the stream compresses large messages and advertises that it accepts compressed messages
+   bool _useCompression;
+   // Set when a message received from the other end advertises that it accepts compressed messages
+   bool _peerAcceptsCompression;
+
    static const uint8_t MAJOR_NUMBER = 1;
-   static const uint16_t MINOR_NUMBER = 24;
+   static const uint16_t MINOR_NUMBER = 27;
    static const uint8_t PATCH_NUMBER = 0;
    static uint32_t CONFIGURATION_FLAGS;
 
 private:
+   // The two most significant bits of the message size word that starts
+   // every message sent over the network are used as compression flags.
+   // A compressed message is sent as the size word, followed by the size of the
+   // uncompressed serialized message (uint32_t), followed by the deflated data.
+   static const uint32_t COMPRESSED_MESSAGE_FLAG = 0x80000000;
+   static const uint32_t ACCEPTS_COMPRESSION_FLAG = 0x40000000;
+   static const uint32_t MESSAGE_SIZE_MASK = ~(COMPRESSED_MESSAGE_FLAG | ACCEPTS_COMPRESSION_FLAG);
+
+   // Returns the size of the message sent over the network, or 0 if compression failed
+   // or did not reduce the message size (in which case msg must be sent uncompressed)
+   uint32_t compressMessage(const char *serialMsg, uint32_t serializedSize);
+   // Inflate a compressed message stored in the compression buffer into msg
+   void decompressMessage(Message &msg, uint32_t compressedSize);
+   char *getCompressionBuffer(uint32_t requiredSize);
+   void updateCompressionStats(MessageType type, uint32_t uncompressedSize, uint32_t wireSize);
+
+   // Scratch buffer used for message compression and decompression; allocated on first use
+   char *_compressionBuffer;
+   uint32_t _compressionBufferCapacity;
+
    // readBlocking and writeBlocking are functions that directly read/write
    // passed object from/to the socket. For the object to be correctly written,
    // it needs to be contiguous.
@@ -81,6 +81,7 @@ enum MessageType : uint16_t
    ResolvedMethod_stringConstant,
    ResolvedMethod_getResolvedVirtualMethod,
    ResolvedMethod_getMultipleResolvedMethods,
+   ResolvedMethod_getMultipleFieldAttributes,
    ResolvedMethod_varHandleMethodTypeTableEntryAddress,
    ResolvedMethod_isUnresolvedVarHandleMethodTypeTableEntry,
    ResolvedMethod_getConstantDynamicTypeFromCP,
@@ -327,6 +328,7 @@ static const char *messageNames[] =
    "ResolvedMethod_stringConstant",
    "ResolvedMethod_getResolvedVirtualMethod",
    "ResolvedMethod_getMultipleResolvedMethods",
+   "ResolvedMethod_getMultipleFieldAttributes",
    "ResolvedMethod_varHandleMethodTypeTableEntryAddress",
    "ResolvedMethod_isUnresolvedVarHandleMethodTypeTableEntry",
    "ResolvedMethod_getConstantDynamicTypeFromCP",
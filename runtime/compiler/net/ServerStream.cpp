@@ -21,6 +21,7 @@
  *******************************************************************************/
 
 #include "ServerStream.hpp"
+#include "control/CompilationRuntime.hpp"
 
 namespace JITServer
 {
@@ -31,6 +32,7 @@ ServerStream::ServerStream(int connfd, BIO *ssl)
    : CommunicationStream()
    {
    initStream(connfd, ssl);
+   _useCompression = TR::CompilationInfo::get()->getPersistentInfo()->getJITServerUseCompression();
    _numConnectionsOpened++;
    _pClientSessionData = NULL;
    }
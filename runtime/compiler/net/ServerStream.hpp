@@ -256,6 +256,11 @@ public:
       return (_pClientSessionData) ? _pClientSessionData->isClassUnloadingAttempted() : false;
       }
 
+   // Used by the listener to wait for the next request on an idle connection
+   int getConnFD() const { return CommunicationStream::getConnFD(); }
+   // SSL may have already buffered the next request, in which case polling the socket would not report it
+   bool hasBufferedInput() const { return _ssl && ((*OBIO_ctrl)(_ssl, BIO_CTRL_PENDING, 0, NULL) > 0); }
+
    // Statistics
    static int getNumConnectionsOpened() { return _numConnectionsOpened; }
    static int getNumConnectionsClosed() { return _numConnectionsClosed; }
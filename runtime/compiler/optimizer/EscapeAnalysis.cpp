@@ -98,6 +98,7 @@
 #define MAX_SIZE_FOR_ONE_CONTIGUOUS_OBJECT   2416 // Increased from 72
 #define MAX_SIZE_FOR_ALL_OBJECTS             3000 // Increased from 500
 #define MAX_SNIFF_BYTECODE_SIZE              1600
+#define RARE_PATH_FREQUENCY_RATIO            10   // Allocation block frequency over escape block frequency
 
 #define LOCAL_OBJECTS_COLLECTABLE 1
 
@@ -114,6 +115,15 @@ static bool blockIsInLoop(TR::Block *block)
    return false;
    }
 
+static bool blockEndsInThrow(TR::Block *block)
+   {
+   TR::Node *lastNode = block->getLastRealTreeTop()->getNode();
+   if (lastNode->getOpCodeValue() == TR::treetop ||
+       lastNode->getOpCode().isNullCheck())
+      lastNode = lastNode->getFirstChild();
+   return lastNode->getOpCodeValue() == TR::athrow;
+   }
+
 TR_EscapeAnalysis::TR_EscapeAnalysis(TR::OptimizationManager *manager)
    : TR::Optimization(manager),
      _newObjectNoZeroInitSymRef(NULL),
@@ -279,6 +289,8 @@ int32_t TR_EscapeAnalysis::perform()
    //
    if (manager()->numPassesCompleted() == 0)
       {
+      computeEscapeSummary();
+
       //
       void *data = manager()->getOptData();
       TR_BitVector *peekableCalls = NULL;
@@ -1878,14 +1890,28 @@ Candidate *TR_EscapeAnalysis::createCandidateIfValid(TR::Node *node, TR_OpaqueCl
 bool TR_EscapeAnalysis::isEscapePointCold(Candidate *candidate, TR::Node *node)
    {
    static const char *disableColdEsc = feGetEnv("TR_DisableColdEscape");
-   if (!disableColdEsc &&
-       (_inColdBlock ||
-        (candidate->isInsideALoop() &&
-         (candidate->_block->getFrequency() > 4*_curBlock->getFrequency()))) &&
-       (candidate->_origKind == TR::New))
+   if (disableColdEsc || candidate->_origKind != TR::New)
+      return false;
+
+   if (_inColdBlock ||
+       (candidate->isInsideALoop() &&
+        (candidate->_block->getFrequency() > 4*_curBlock->getFrequency())))
       return true;
 
-   return false;
+   // Outside of loops, an escape on a path that is rarely taken relative to the
+   // allocation, or on a path that ends up throwing (e.g. building an exception
+   // message), is still worth heapifying for rather than giving up on the
+   // candidate altogether
+   //
+   static const char *disableRarePathColdEsc = feGetEnv("TR_DisableRarePathColdEscape");
+   if (disableRarePathColdEsc || _parms || _curBlock == candidate->_block)
+      return false;
+
+   if (_curBlock->getFrequency() >= 0 &&
+       candidate->_block->getFrequency() > RARE_PATH_FREQUENCY_RATIO*_curBlock->getFrequency())
+      return true;
+
+   return blockEndsInThrow(_curBlock);
    }
 
 
@@ -5034,6 +5060,20 @@ void TR_EscapeAnalysis::checkEscapeViaCall(TR::Node *node, TR::NodeChecklist& vi
                if (checkIfEscapePointIsCold(candidate, node))
                   continue;
 
+               // A callee that has been compiled already may have recorded
+               // that the arguments the candidate is passed as never escape it.
+               // The candidate can then be passed to the callee by address.
+               //
+               if (calleeSummaryCoversCandidate(candidate, node))
+                  {
+                  candidate->setArgToCall(_sniffDepth, false);
+                  candidate->setNonThisArgToCall(_sniffDepth, false);
+                  candidate->setMustBeContiguousAllocation();
+                  if (trace())
+                     traceMsg(comp(), "   Make [%p] contiguous because the escape summary of the callee of call node [%p] covers it\n", candidate->_node, node);
+                  continue;
+                  }
+
                // Force
                if(candidate->forceLocalAllocation())
                   {
@@ -5273,6 +5313,194 @@ int32_t TR_EscapeAnalysis::sniffCall(TR::Node *callNode, TR::ResolvedMethodSymbo
    return bytecodeSize;
    }
 
+bool TR_EscapeAnalysis::calleeSummaryCoversCandidate(Candidate *candidate, TR::Node *callNode)
+   {
+   static const char *disableEscapeSummaries = feGetEnv("TR_DisableEscapeSummaries");
+   if (disableEscapeSummaries ||
+       comp()->compileRelocatableCode() ||
+       comp()->getOption(TR_EnableHCR))
+      return false;
+
+   // The summary belongs to one particular callee, so only direct calls can use it
+   //
+   if (!callNode->getOpCode().isCallDirect() || callNode->getSymbolReference()->isUnresolved())
+      return false;
+
+   TR::ResolvedMethodSymbol *calleeSymbol = callNode->getSymbol()->getResolvedMethodSymbol();
+   TR_PersistentMethodInfo *calleeInfo = calleeSymbol ? TR_PersistentMethodInfo::get(calleeSymbol->getResolvedMethod()) : NULL;
+   if (!calleeInfo || !calleeInfo->hasEscapeSummary())
+      return false;
+
+   int32_t firstArgIndex = callNode->getFirstArgumentIndex();
+   for (int32_t arg = firstArgIndex; arg < callNode->getNumChildren(); arg++)
+      {
+      TR::Node *value = resolveSniffedNode(callNode->getChild(arg));
+      if (value &&
+          usesValueNumber(candidate, _valueNumberInfo->getValueNumber(value)) &&
+          !calleeInfo->parmDoesntEscape(arg - firstArgIndex))
+         return false;
+      }
+
+   return true;
+   }
+
+// Parameters of the method being compiled whose values can be held by the given symbol.
+// A parameter always holds its own value; anything else flows in through stores.
+//
+static uint32_t parmsFlowingInto(TR::SymbolReference *symRef, uint32_t *flowsFrom)
+   {
+   uint32_t parms = flowsFrom[symRef->getReferenceNumber()];
+   TR::Symbol *sym = symRef->getSymbol();
+   if (sym->isParm() && sym->getParmSymbol()->getOrdinal() < 32)
+      parms |= 1u << sym->getParmSymbol()->getOrdinal();
+   return parms;
+   }
+
+// Parameters whose value, or an address derived from it, is produced by the given node
+//
+static uint32_t escapeSummaryFlowsFrom(TR::Node *node, uint32_t *flowsFrom)
+   {
+   while (node->getOpCode().isArrayRef() || node->getOpCodeValue() == TR::PassThrough)
+      node = node->getFirstChild();
+
+   if (!node->getOpCode().isLoadVarDirect() ||
+       node->getDataType() != TR::Address ||
+       !node->getSymbol()->isAutoOrParm())
+      return 0;
+
+   return parmsFlowingInto(node->getSymbolReference(), flowsFrom);
+   }
+
+bool TR_EscapeAnalysis::isNonEscapingUseForSummary(TR::Node *parent, int32_t childIndex)
+   {
+   TR::ILOpCode &opCode = parent->getOpCode();
+
+   // Derived addresses are followed to their own uses
+   //
+   if (opCode.isArrayRef())
+      return childIndex == 0;
+
+   if (parent->getOpCodeValue() == TR::PassThrough ||
+       parent->getOpCodeValue() == TR::treetop ||
+       opCode.isAnchor() ||
+       opCode.isCheck() ||
+       opCode.isArrayLength() ||
+       opCode.isBooleanCompare())
+      return true;
+
+   if (opCode.isCheckCast() || parent->getOpCodeValue() == TR::instanceof)
+      return childIndex == 0;
+
+   // Stores to locals are followed by computeEscapeSummary
+   //
+   if (opCode.isStoreDirect())
+      return parent->getSymbol()->isAutoOrParm();
+
+   // A reference loaded from the parameter could be another object of the caller, which
+   // is not covered by the summary, so only allow primitive fields and the class
+   //
+   if (opCode.isLoadIndirect())
+      return parent->getDataType() != TR::Address || parent->getSymbolReference() == getSymRefTab()->findVftSymbolRef();
+
+   if (opCode.isStoreIndirect())
+      return childIndex == 0 || (opCode.isWrtBar() && childIndex == 2);
+
+   if (opCode.isCallDirect() &&
+       !parent->getSymbolReference()->isUnresolved() &&
+       childIndex >= parent->getFirstArgumentIndex())
+      {
+      TR::ResolvedMethodSymbol *calleeSymbol = parent->getSymbol()->getResolvedMethodSymbol();
+      TR_PersistentMethodInfo *calleeInfo = calleeSymbol ? TR_PersistentMethodInfo::get(calleeSymbol->getResolvedMethod()) : NULL;
+      return calleeInfo && calleeInfo->parmDoesntEscape(childIndex - parent->getFirstArgumentIndex());
+      }
+
+   return false;
+   }
+
+uint32_t TR_EscapeAnalysis::escapingParmsForSummary(TR::Node *node, uint32_t *flowsFrom, TR::NodeChecklist& visited)
+   {
+   if (visited.contains(node))
+      return 0;
+   visited.add(node);
+
+   uint32_t escaped = 0;
+   if (node->getOpCodeValue() == TR::loadaddr && node->getSymbol()->isAutoOrParm())
+      escaped |= parmsFlowingInto(node->getSymbolReference(), flowsFrom);
+
+   for (int32_t i = 0; i < node->getNumChildren(); i++)
+      {
+      TR::Node *child = node->getChild(i);
+      uint32_t parms = escapeSummaryFlowsFrom(child, flowsFrom);
+      if (parms && !isNonEscapingUseForSummary(node, i))
+         escaped |= parms;
+      escaped |= escapingParmsForSummary(child, flowsFrom, visited);
+      }
+
+   return escaped;
+   }
+
+void TR_EscapeAnalysis::computeEscapeSummary()
+   {
+   static const char *disableEscapeSummaries = feGetEnv("TR_DisableEscapeSummaries");
+   if (disableEscapeSummaries ||
+       comp()->compileRelocatableCode() ||
+       comp()->getOption(TR_EnableHCR) ||
+       comp()->isDLT() ||
+       !TR_PersistentMethodInfo::get(comp()))
+      return;
+
+   // Hooks can inspect the arguments of any method
+   //
+   if (TR::Compiler->vm.canMethodEnterEventBeHooked(comp()) || TR::Compiler->vm.canMethodExitEventBeHooked(comp()))
+      return;
+
+   TR::StackMemoryRegion stackMemoryRegion(*trMemory());
+   int32_t numSymRefs = comp()->getSymRefTab()->getNumSymRefs();
+   uint32_t *flowsFrom = (uint32_t *) trMemory()->allocateStackMemory(numSymRefs * sizeof(uint32_t));
+   memset(flowsFrom, 0, numSymRefs * sizeof(uint32_t));
+
+   // Propagate the parameters through stores to locals until nothing changes
+   //
+   bool changed = true;
+   while (changed)
+      {
+      changed = false;
+      for (TR::TreeTop *tt = comp()->getStartTree(); tt; tt = tt->getNextTreeTop())
+         {
+         TR::Node *node = tt->getNode();
+         if (!node->getOpCode().isStoreDirect() ||
+             node->getDataType() != TR::Address ||
+             !node->getSymbol()->isAutoOrParm())
+            continue;
+
+         int32_t refNum = node->getSymbolReference()->getReferenceNumber();
+         uint32_t parms = flowsFrom[refNum] | escapeSummaryFlowsFrom(node->getFirstChild(), flowsFrom);
+         if (parms != flowsFrom[refNum])
+            {
+            flowsFrom[refNum] = parms;
+            changed = true;
+            }
+         }
+      }
+
+   uint32_t escaped = 0;
+   TR::NodeChecklist visited(comp());
+   for (TR::TreeTop *tt = comp()->getStartTree(); tt; tt = tt->getNextTreeTop())
+      escaped |= escapingParmsForSummary(tt->getNode(), flowsFrom, visited);
+
+   uint32_t nonEscapingParms = 0;
+   ListIterator<TR::ParameterSymbol> parms(&comp()->getMethodSymbol()->getParameterList());
+   for (TR::ParameterSymbol *p = parms.getFirst(); p; p = parms.getNext())
+      {
+      if (p->getDataType() == TR::Address && p->getOrdinal() < 32 && !(escaped & (1u << p->getOrdinal())))
+         nonEscapingParms |= 1u << p->getOrdinal();
+      }
+
+   comp()->setNonEscapingParms(nonEscapingParms);
+   if (trace())
+      traceMsg(comp(), "Escape summary for %s: non-escaping parameters 0x%x\n", comp()->signature(), nonEscapingParms);
+   }
+
 // Check for size limits, both on individual object sizes and on total
 // object allocation size.
 // FIXME: need to modify this method to give priority to non-array objects
@@ -565,6 +565,22 @@ class TR_EscapeAnalysis : public TR::Optimization
    void     checkEscapeViaNonCall(TR::Node *node, TR::NodeChecklist& visited);
    void     checkEscapeViaCall(TR::Node *node, TR::NodeChecklist& visited, bool & ignoreRecursion);
    int32_t  sniffCall(TR::Node *callNode, TR::ResolvedMethodSymbol *methodSymbol, bool ignoreOpCode, bool isCold, bool & ignoreRecursion);
+
+   /**
+    * \brief
+    *    Checks whether the persistent escape summary of the callee of a direct call
+    *    shows that none of the arguments the candidate is passed as can escape the callee.
+    */
+   bool     calleeSummaryCoversCandidate(Candidate *candidate, TR::Node *callNode);
+
+   /**
+    * \brief
+    *    Finds the address parameters of the method being compiled that never escape it
+    *    and records them on the compilation, to be published for callers by the code generator.
+    */
+   void     computeEscapeSummary();
+   uint32_t escapingParmsForSummary(TR::Node *node, uint32_t *flowsFrom, TR::NodeChecklist& visited);
+   bool     isNonEscapingUseForSummary(TR::Node *parent, int32_t childIndex);
    void     checkObjectSizes();
    void     fixupTrees();
    void     anchorCandidateReference(Candidate *candidate, TR::Node *reference);
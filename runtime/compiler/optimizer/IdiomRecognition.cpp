@@ -82,7 +82,7 @@
 #define SHOW_CANDIDATES 0
 
 #define IDIOM_SIZE_FACTOR 15
-#define MAX_PREPARED_GRAPH (36+STRESS_TEST*5)
+#define MAX_PREPARED_GRAPH (37+STRESS_TEST*5)
 static TR_CISCGraph *preparedCISCGraphs[MAX_PREPARED_GRAPH];
 static int32_t numPreparedCISCGraphs;
 static TR_Hotness minimumHotnessPrepared;
@@ -1053,6 +1053,7 @@ TR_CISCGraph::makePreparedCISCGraphs(TR::Compilation *c)
       bool genTROTNoBreak = c->cg()->getSupportsArrayTranslateTROTNoBreak();
       bool genTROT = c->cg()->getSupportsArrayTranslateTROT();
       bool genTRT =  c->cg()->getSupportsArrayTranslateAndTest();
+      bool genByteIndexOf = !genTRT && c->cg()->getSupportsInlineStringIndexOf();
       bool genMemcpy = c->cg()->getSupportsReferenceArrayCopy() || c->cg()->getSupportsPrimitiveArrayCopy();
       bool genMemset = c->cg()->getSupportsArraySet();
       bool genMemcmp = c->cg()->getSupportsArrayCmp();
@@ -1094,6 +1095,11 @@ TR_CISCGraph::makePreparedCISCGraphs(TR::Compilation *c)
          setEssentialNodes(preparedCISCGraphs[num++]);
          //preparedCISCGraphs[num] =  makeTRT4NestedArrayIfGraph(c, ctrl); setEssentialNodes(preparedCISCGraphs[num]); num++;
          }
+      else if (genByteIndexOf)
+         {
+         preparedCISCGraphs[num] =  makeByteIndexOfGraph(c, ctrl);
+         setEssentialNodes(preparedCISCGraphs[num++]);
+         }
       if (genMemset)
          {
          preparedCISCGraphs[num] =  makeMemSetGraph(c, ctrl);
@@ -55,6 +55,7 @@ TR_PCISCGraph *makeMixedMemSetGraph(TR::Compilation *c, int32_t ctrl);
 
 TR_PCISCGraph *makeTRTGraph(TR::Compilation *c, int32_t ctrl);
 TR_PCISCGraph *makeTRTGraph2(TR::Compilation *c, int32_t ctrl);
+TR_PCISCGraph *makeByteIndexOfGraph(TR::Compilation *c, int32_t ctrl);
 TR_PCISCGraph *makeTRT4NestedArrayGraph(TR::Compilation *c, int32_t ctrl);
 TR_PCISCGraph *makeTRT4NestedArrayIfGraph(TR::Compilation *c, int32_t ctrl);
 
@@ -33,6 +33,7 @@
 #include "cs2/bitvectr.h"
 #include "env/CompilerEnv.hpp"
 #include "env/TRMemory.hpp"
+#include "env/VMJ9.h"
 #include "env/jittypes.h"
 #include "il/AutomaticSymbol.hpp"
 #include "il/Block.hpp"
@@ -40,6 +41,7 @@
 #include "il/ILOpCodes.hpp"
 #include "il/ILOps.hpp"
 #include "il/ILProps.hpp"
+#include "il/MethodSymbol.hpp"
 #include "il/Node.hpp"
 #include "il/Node_inlines.hpp"
 #include "il/Symbol.hpp"
@@ -1930,6 +1932,308 @@ makeTRTGraph2(TR::Compilation *c, int32_t ctrl)
    }
 
 
+/*************************************************************************************
+Corresponding Java-like pseudocode
+int i, end, key;
+byte byteArray[ ];
+while(true){
+   if (byteArray[i] == key) break;
+   i++;
+   if (i >= end) break;
+}
+
+Note 1: "key" can be a loop-invariant variable or a constant.
+Note 2: The loop is reduced to JITHelpers.intrinsicIndexOfLatin1, which is inlined as
+        a vector search by the code generators that support inline String.indexOf.
+        It is only used where TRT/SRST (TR::arraytranslateAndTest) is not available.
+*************************************************************************************/
+
+// Find the symbol references of JITHelpers.jitHelpers() and JITHelpers.intrinsicIndexOfLatin1
+static bool
+getByteIndexOfSymRefs(TR::Compilation *comp, TR::SymbolReference **getHelpersSymRef, TR::SymbolReference **indexOfSymRef)
+   {
+   TR_OpaqueClassBlock *jitHelpersClass = comp->getJITHelpersClassPointer();
+   if (!jitHelpersClass || !TR::Compiler->cls.isClassInitialized(comp, jitHelpersClass))
+      return false;
+
+   *getHelpersSymRef = NULL;
+   *indexOfSymRef = NULL;
+
+   TR_ScratchList<TR_ResolvedMethod> helperMethods(comp->trMemory());
+   comp->fej9()->getResolvedMethods(comp->trMemory(), jitHelpersClass, &helperMethods);
+   ListIterator<TR_ResolvedMethod> it(&helperMethods);
+   for (TR_ResolvedMethod *m = it.getFirst(); m; m = it.getNext())
+      {
+      if (m->getRecognizedMethod() == TR::com_ibm_jit_JITHelpers_intrinsicIndexOfLatin1)
+         *indexOfSymRef = comp->getSymRefTab()->findOrCreateMethodSymbol(JITTED_METHOD_INDEX, -1, m, TR::MethodSymbol::Special);
+      else if (m->nameLength() == 10 && !strncmp(m->nameChars(), "jitHelpers", 10))
+         *getHelpersSymRef = comp->getSymRefTab()->findOrCreateMethodSymbol(JITTED_METHOD_INDEX, -1, m, TR::MethodSymbol::Static);
+      }
+
+   return *getHelpersSymRef && *indexOfSymRef;
+   }
+
+//*****************************************************************************************
+// IL code generation for searching a byte array for a single byte
+// Input: ImportantNode(0) - ificmpeq
+//        ImportantNode(1) - loop test
+//        ImportantNode(2) - NULLCHK
+//        ImportantNode(3) - array load
+//        ImportantNode(4) - BNDCHK
+//*****************************************************************************************
+bool
+CISCTransform2ByteIndexOf(TR_CISCTransformer *trans)
+   {
+   TR_ASSERT(trans->getOffsetOperand1() == 0 && trans->getOffsetOperand2() == 0, "Not implemented yet");
+   const bool disptrace = DISPTRACE(trans);
+   TR::Node *trNode;
+   TR::TreeTop *trTreeTop;
+   TR::Block *block;
+   TR_CISCGraph *P = trans->getP();
+   List<TR_CISCNode> *P2T = trans->getP2T();
+   TR::Compilation *comp = trans->comp();
+
+   if (comp->compileRelocatableCode())
+      {
+      if (disptrace) traceMsg(comp, "CISCTransform2ByteIndexOf is not supported for relocatable compilations.\n");
+      return false;
+      }
+
+   trans->findFirstNode(&trTreeTop, &trNode, &block);
+   if (!block) return false;    // cannot find
+
+   if (isLoopPreheaderLastBlockInMethod(comp, block))
+      {
+      traceMsg(comp, "Bailing CISCTransform2ByteIndexOf due to null TT - might be a preheader in last block of method\n");
+      return false;
+      }
+
+   // Both the delimiter check and the loop test have to leave the loop for the same block.
+   TR::Block *target = trans->analyzeSuccessorBlock();
+   if (!target)
+      {
+      if (disptrace) traceMsg(comp, "CISCTransform2ByteIndexOf allows only a single successor.\n");
+      return false;
+      }
+
+   if (!trans->isEmptyAfterInsertionIdiomList(0) || !trans->isEmptyAfterInsertionIdiomList(1))
+      {
+      if (disptrace) traceMsg(comp, "CISCTransform2ByteIndexOf does not support compensation code.\n");
+      return false;
+      }
+
+   TR_CISCNode *cmpRep = trans->getP2TInLoopIfSingle(P->getImportantNode(0));
+   if (!cmpRep || cmpRep->getOpcode() != TR::ificmpeq)
+      {
+      if (disptrace) traceMsg(comp, "Give up because the delimiter check is not a single ificmpeq.\n");
+      return false;
+      }
+
+   TR_CISCNode *exitIfRep = trans->getP2TInLoopIfSingle(P->getImportantNode(1));
+   if (!exitIfRep)
+      {
+      if (disptrace) traceMsg(comp, "Give up because of multiple candidates of the loop test.\n");
+      return false;
+      }
+   bool isDecrement;
+   int32_t modLength = 0;
+   if (!testExitIF(exitIfRep->getOpcode(), &isDecrement, &modLength)) return false;
+   if (isDecrement) return false;
+
+   TR_CISCNode *loadRep = trans->getP2TRepInLoop(P->getImportantNode(3));
+   if (!loadRep || !loadRep->getIlOpCode().isByte())
+      {
+      if (disptrace) traceMsg(comp, "CISCTransform2ByteIndexOf supports only byte arrays.\n");
+      return false;
+      }
+
+   TR_CISCNode *convRep = trans->getP2TRepInLoop(P->getImportantNode(0)->getChild(0));
+   if (!convRep || (convRep->getOpcode() != TR::b2i && convRep->getOpcode() != TR::bu2i))
+      {
+      if (disptrace) traceMsg(comp, "Give up because the loaded byte is not widened by b2i or bu2i.\n");
+      return false;
+      }
+   TR::ILOpCodes convOp = (TR::ILOpCodes)convRep->getOpcode();
+
+   TR::Node *baseRepNode, *indexRepNode, *keyRepNode;
+   getP2TTrRepNodes(trans, &baseRepNode, &indexRepNode, &keyRepNode);
+   TR::SymbolReference *indexVarSymRef = indexRepNode->getSymbolReference();
+
+   if (keyRepNode->getOpCode().isLoadConst())
+      {
+      int32_t key = keyRepNode->getInt();
+      if (convOp == TR::b2i ? (key < -128 || key > 127) : (key < 0 || key > 255))
+         {
+         if (disptrace) traceMsg(comp, "Give up because the key %d can never match.\n", key);
+         return false;
+         }
+      }
+
+   // The array header constant must be the contiguous header size, i.e. the index is not adjusted.
+   TR_CISCNode *ahConstCISCNode = trans->getP2TRepInLoop(P->getImportantNode(3)->getChild(0)->getChild(1));
+   if (ahConstCISCNode)
+      {
+      TR::Node *ahConstNode = ahConstCISCNode->getHeadOfTrNodeInfo()->_node;
+      if (ahConstNode->getOpCode().isAdd() || ahConstNode->getOpCode().isSub())
+         {
+         ahConstNode = ahConstNode->getSecondChild();
+         if (ahConstNode->getOpCode().isLoadConst())
+            {
+            int32_t ahValue = ahConstNode->getType().isInt64() ? (int32_t)ahConstNode->getLongInt() : ahConstNode->getInt();
+            if (ahValue < 0)
+               ahValue = -ahValue;
+            if (ahValue != TR::Compiler->om.contiguousArrayHeaderSizeInBytes())
+               {
+               traceMsg(comp, "headerConst node value doesn't equal contiguous array header size %p. Abandoning reduction.\n", ahConstNode);
+               return false;
+               }
+            }
+         }
+      }
+
+   TR::Node *endRepNode = exitIfRep->getChild(1)->getHeadOfTrNodeInfo()->_node;
+   bool hasNullChk = !(P2T + P->getImportantNode(2)->getID())->isEmpty();
+   bool hasBndChk = !(P2T + P->getImportantNode(4)->getID())->isEmpty();
+
+   // The inlined search does not check bounds. When the loop checks them, only an end which is
+   // the length of the array being searched is known not to run past the array.
+   if (hasBndChk)
+      {
+      if (modLength != 0 ||
+          endRepNode->getOpCodeValue() != TR::arraylength ||
+          !endRepNode->getFirstChild()->getOpCode().isLoadVarDirect() ||
+          !baseRepNode->getOpCode().isLoadVarDirect() ||
+          endRepNode->getFirstChild()->getSymbolReference() != baseRepNode->getSymbolReference())
+         {
+         if (disptrace) traceMsg(comp, "CISCTransform2ByteIndexOf needs the array length as the end of a bound checked loop.\n");
+         return false;
+         }
+      }
+
+   if (avoidTransformingStringLoops(comp))
+      {
+      traceMsg(comp, "Abandoning reduction because of functional problems when String compression is enabled in Java 8 SR5\n");
+      return false;
+      }
+
+   TR::SymbolReference *getHelpersSymRef, *indexOfSymRef;
+   if (!getByteIndexOfSymRefs(comp, &getHelpersSymRef, &indexOfSymRef))
+      {
+      if (disptrace) traceMsg(comp, "Cannot find JITHelpers.intrinsicIndexOfLatin1.\n");
+      return false;
+      }
+
+   // The first iteration always examines byteArray[i], so the search length is at least i + 1:
+   //
+   //    len = max(end, i + 1)
+   //    r = jitHelpers().intrinsicIndexOfLatin1(byteArray, key, i, len)
+   //    i = r < 0 ? len : r
+   //
+   TR::Node *baseNode = createLoad(baseRepNode);
+   TR::Node *indexNode = TR::Node::createWithSymRef(indexRepNode, TR::iload, 0, indexVarSymRef);
+   TR::Node *keyNode = createLoad(keyRepNode);
+   TR::Node *endNode = createLoad(endRepNode);
+   if (modLength) endNode = createOP2(comp, TR::isub, endNode, TR::Node::create(baseRepNode, TR::iconst, 0, -modLength));
+   TR::Node *lenNode = TR::Node::create(TR::imax, 2, endNode,
+                                        TR::Node::create(TR::iadd, 2, indexNode, TR::Node::create(baseRepNode, TR::iconst, 0, 1)));
+
+   TR::Node *helpersNode = TR::Node::createWithSymRef(baseRepNode, TR::acall, 0, getHelpersSymRef);
+   TR::Node *indexOfNode = TR::Node::createWithSymRef(baseRepNode, TR::icall, 5, indexOfSymRef);
+   indexOfNode->setAndIncChild(0, helpersNode);
+   indexOfNode->setAndIncChild(1, baseNode);
+   indexOfNode->setAndIncChild(2, keyNode);
+   indexOfNode->setAndIncChild(3, indexNode);
+   indexOfNode->setAndIncChild(4, lenNode);
+
+   TR::Node *notFoundNode = TR::Node::create(TR::icmplt, 2, indexOfNode, TR::Node::create(baseRepNode, TR::iconst, 0, 0));
+   if (!keyNode->getOpCode().isLoadConst())
+      {
+      // A key outside the range of the widened bytes never matches, but its low byte might
+      TR::Node *keyByteNode = TR::Node::create(convOp, 1, TR::Node::create(TR::i2b, 1, keyNode));
+      notFoundNode = TR::Node::create(TR::ior, 2, notFoundNode, TR::Node::create(TR::icmpne, 2, keyByteNode, keyNode));
+      }
+   TR::Node *resultNode = TR::Node::create(TR::iselect, 3, notFoundNode, lenNode, indexOfNode);
+
+   // Insert (nullchk), (bndchk), the search, and the result store
+   TR::TreeTop *last = trans->removeAllNodes(trTreeTop, block->getExit());
+   last->join(block->getExit());
+   block = trans->insertBeforeNodes(block);
+   if (hasNullChk)
+      {
+      TR::Node *nullChkNode = TR::Node::create(TR::PassThrough, 1, baseNode);
+      nullChkNode = TR::Node::createWithSymRef(TR::NULLCHK, 1, 1, nullChkNode, comp->getSymRefTab()->findOrCreateNullCheckSymbolRef(comp->getMethodSymbol()));
+      block->append(TR::TreeTop::create(comp, nullChkNode));
+      }
+   if (hasBndChk)
+      {
+      TR::Node *alenNode = TR::Node::create(TR::arraylength, 1, baseNode);
+      TR::Node *bndChkNode = TR::Node::createWithSymRef(TR::BNDCHK, 2, 2, alenNode, indexNode,
+                                                        comp->getSymRefTab()->findOrCreateArrayBoundsCheckSymbolRef(comp->getMethodSymbol()));
+      block->append(TR::TreeTop::create(comp, bndChkNode));
+      }
+   block->append(TR::TreeTop::create(comp, TR::Node::create(TR::treetop, 1, helpersNode)));
+   block->append(TR::TreeTop::create(comp, TR::Node::create(TR::treetop, 1, indexOfNode)));
+   block->append(TR::TreeTop::create(comp, TR::Node::createStore(indexVarSymRef, resultNode)));
+
+   // insert compensation code generated by non-idiom-specific transformation
+   block = trans->insertAfterNodes(block);
+
+   // set successor edge to the original block
+   trans->setSuccessorEdge(block, target);
+   return true;
+   }
+
+TR_PCISCGraph *
+makeByteIndexOfGraph(TR::Compilation *c, int32_t ctrl)
+   {
+   TR_PCISCGraph *tgt = new (PERSISTENT_NEW) TR_PCISCGraph(c->trMemory(), "ByteIndexOf", 0, 16);
+   /************************************    opc               id        dagId #cfg #child other/pred/children */
+   TR_PCISCNode *byteArray = new (PERSISTENT_NEW) TR_PCISCNode(c->trMemory(), TR_arraybase, TR::NoType,  tgt->incNumNodes(), 10, 0, 0, 0);  tgt->addNode(byteArray); // array base
+   TR_PCISCNode *iv =        new (PERSISTENT_NEW) TR_PCISCNode(c->trMemory(), TR_variable, TR::NoType,  tgt->incNumNodes(), 9, 0, 0, 0);  tgt->addNode(iv); // array index
+   TR_PCISCNode *key =       new (PERSISTENT_NEW) TR_PCISCNode(c->trMemory(), TR_quasiConst2, TR::NoType,  tgt->incNumNodes(), 8, 0, 0);  tgt->addNode(key); // byte to search for
+   TR_PCISCNode *end =       new (PERSISTENT_NEW) TR_PCISCNode(c->trMemory(), TR_quasiConst2, TR::NoType,  tgt->incNumNodes(), 7, 0, 0);  tgt->addNode(end); // length
+   TR_PCISCNode *arrayLen =  new (PERSISTENT_NEW) TR_PCISCNode(c->trMemory(), TR_quasiConst2, TR::NoType,  tgt->incNumNodes(), 6, 0, 0);  tgt->addNode(arrayLen); // arraylength (optional)
+   TR_PCISCNode *aHeader =   new (PERSISTENT_NEW) TR_PCISCNode(c->trMemory(), TR_ahconst, TR::NoType,  tgt->incNumNodes(), 5, 0, 0, 0);  tgt->addNode(aHeader);     // array header
+   TR_PCISCNode *increment = new (PERSISTENT_NEW) TR_PCISCNode(c->trMemory(), TR::iconst, TR::Int32,  tgt->incNumNodes(), 4, 0, 0, -1);  tgt->addNode(increment);
+   TR_PCISCNode *mulFactor = new (PERSISTENT_NEW) TR_PCISCNode(c->trMemory(), TR_allconst, TR::NoType,  tgt->incNumNodes(),  3,   0,   0);        tgt->addNode(mulFactor);        // Multiply Factor
+   TR_PCISCNode *entry =     new (PERSISTENT_NEW) TR_PCISCNode(c->trMemory(), TR_entrynode, TR::NoType,  tgt->incNumNodes(), 2, 1, 0);        tgt->addNode(entry);
+   TR_PCISCNode *nullChk =   new (PERSISTENT_NEW) TR_PCISCNode(c->trMemory(), TR::NULLCHK, TR::NoType,  tgt->incNumNodes(), 1, 1, 1, entry, byteArray);
+   tgt->addNode(nullChk); // optional
+   TR_PCISCNode *bndChk =    new (PERSISTENT_NEW) TR_PCISCNode(c->trMemory(), TR::BNDCHK, TR::NoType,  tgt->incNumNodes(), 1, 1, 2, nullChk, arrayLen, iv);
+   tgt->addNode(bndChk); // optional
+   TR_PCISCNode *arrayLoad = createIdiomArrayLoadInLoop(tgt, ctrl, 1, bndChk, TR_ibcload, TR::NoType,  byteArray, iv, aHeader, mulFactor);
+   TR_PCISCNode *b2iNode =   new (PERSISTENT_NEW) TR_PCISCNode(c->trMemory(), TR_conversion, TR::NoType,  tgt->incNumNodes(), 1, 1, 1, arrayLoad, arrayLoad);  tgt->addNode(b2iNode);
+   TR_PCISCNode *exitTest =  new (PERSISTENT_NEW) TR_PCISCNode(c->trMemory(), TR::ificmpeq, TR::NoType,  tgt->incNumNodes(), 1, 2, 2, b2iNode, b2iNode, key);  tgt->addNode(exitTest);
+   TR_PCISCNode *ivStore =   createIdiomDecVarInLoop(tgt, ctrl, 1, exitTest, iv, increment);
+   TR_PCISCNode *loopTest =  new (PERSISTENT_NEW) TR_PCISCNode(c->trMemory(), TR_ifcmpall, TR::NoType,  tgt->incNumNodes(), 1, 2, 2, ivStore, iv, end);  tgt->addNode(loopTest);
+   TR_PCISCNode *exit  =     new (PERSISTENT_NEW) TR_PCISCNode(c->trMemory(), TR_exitnode, TR::NoType,  tgt->incNumNodes(), 0,  0, 0);        tgt->addNode(exit);
+
+   exitTest->setSucc(1, exit);
+   loopTest->setSuccs(entry->getSucc(0), exit);
+
+   arrayLen->setIsOptionalNode();
+   nullChk->setIsOptionalNode();
+   bndChk->setIsOptionalNode();
+
+   b2iNode->setIsChildDirectlyConnected();
+   loopTest->setIsChildDirectlyConnected();
+
+   tgt->setEntryNode(entry);
+   tgt->setExitNode(exit);
+   tgt->setImportantNodes(exitTest, loopTest, nullChk, arrayLoad, bndChk);
+   tgt->setNumDagIds(11);
+   tgt->createInternalData(1);
+
+   tgt->setTransformer(CISCTransform2ByteIndexOf);
+   tgt->setInhibitBeforeVersioning();
+   tgt->setAspects(isub, existAccess, 0);
+   tgt->setNoAspects(call|bitop1, 0, existAccess);
+   tgt->setMinCounts(2, 1, 0);  // minimum ifCount, indirectLoadCount, indirectStoreCount
+   tgt->setHotness(warm, true);
+   return tgt;
+   }
+
+
 /****************************************************************************************
 Corresponding Java-like pseudocode
 int i, end;
@@ -45,6 +45,7 @@
 #include "optimizer/CallInfo.hpp"
 #include "optimizer/J9CallGraph.hpp"
 #include "optimizer/PreExistence.hpp"
+#include "optimizer/RecognizedCallTransformer.hpp"
 #include "optimizer/Structure.hpp"
 #include "codegen/CodeGenerator.hpp"
 #include "codegen/CodeGenerator_inlines.hpp"
@@ -3320,6 +3321,9 @@ bool TR_MultipleCallTargetInliner::inlineCallTargets(TR::ResolvedMethodSymbol *c
          }
 
       TR_CallTarget* callTargetToChop = NULL;
+      if (TR::Options::_inliningBudgetPlanner)
+         callTargetToChop = planInliningBudget(limit, trivialWeightForLimit);
+      else
       {
       bool doneInlining = false;
       int32_t totalWeight = 0;
@@ -4047,6 +4051,88 @@ void TR_MultipleCallTargetInliner::processChoppedOffCallTargets(TR_CallTarget *l
    else _callTargets.setFirst(NULL);
    }
 
+TR_CallTarget *TR_MultipleCallTargetInliner::planInliningBudget(int32_t limit, int32_t trivialWeightForLimit)
+   {
+   TR_InlinerDelimiter delimiter(tracer(), "planInliningBudget");
+
+   int32_t numTargets = 0;
+   for (TR_CallTarget *calltarget = _callTargets.getFirst(); calltarget; calltarget = calltarget->getNext())
+      numTargets++;
+
+   if (numTargets == 0)
+      return NULL;
+
+   TR_CallTarget **targets = (TR_CallTarget **)trMemory()->allocateStackMemory(numTargets * sizeof(TR_CallTarget *));
+   double *scores = (double *)trMemory()->allocateStackMemory(numTargets * sizeof(double));
+
+   // The weight already folds in the benefits found while weighing the call site, so the
+   // frequency of the call site per unit of weight ranks the targets by benefit per byte.
+   // Insertion sort keeps targets of equal score in their weight order.
+   int32_t i = 0;
+   for (TR_CallTarget *calltarget = _callTargets.getFirst(); calltarget; calltarget = calltarget->getNext(), i++)
+      {
+      TR::Block *block = calltarget->_originatingBlock;
+      int32_t frequency = block ? std::max(block->getFrequency(), 0) : 0;
+      double score = (double)(frequency + 1) / (double)std::max(calltarget->_weight, 1);
+
+      int32_t j = i;
+      for (; j > 0 && scores[j-1] < score; j--)
+         {
+         targets[j] = targets[j-1];
+         scores[j] = scores[j-1];
+         }
+      targets[j] = calltarget;
+      scores[j] = score;
+      }
+
+   // Accepted targets are chained in rank order and followed by the rejected ones, so that the
+   // rejected targets go through processChoppedOffCallTargets like targets chopped off by weight
+   int32_t totalWeight = 0;
+   TR_CallTarget *lastTargetToInline = NULL;
+   TR_CallTarget *firstRejectedTarget = NULL;
+   TR_CallTarget *lastRejectedTarget = NULL;
+   for (i = 0; i < numTargets; i++)
+      {
+      TR_CallTarget *calltarget = targets[i];
+      if (calltarget->_weight <= trivialWeightForLimit || totalWeight + calltarget->_weight <= limit)
+         {
+         totalWeight += calltarget->_weight;
+         heuristicTrace(tracer(), "planInliningBudget: accepting target %p node %p %s with weight %d score %f, budget used %d of %d",
+                                  calltarget, calltarget->_myCallSite->_callNode, tracer()->traceSignature(calltarget),
+                                  calltarget->_weight, scores[i], totalWeight, limit);
+
+         if (lastTargetToInline)
+            lastTargetToInline->setNext(calltarget);
+         else
+            _callTargets.setFirst(calltarget);
+         lastTargetToInline = calltarget;
+         }
+      else
+         {
+         heuristicTrace(tracer(), "planInliningBudget: rejecting target %p node %p %s: weight %d does not fit in the remaining budget %d (score %f, rank %d of %d)",
+                                  calltarget, calltarget->_myCallSite->_callNode, tracer()->traceSignature(calltarget),
+                                  calltarget->_weight, limit - totalWeight, scores[i], i + 1, numTargets);
+         tracer()->insertCounter(Exceeded_Caller_Budget, calltarget->_myCallSite->_callNodeTreeTop);
+
+         if (lastRejectedTarget)
+            lastRejectedTarget->setNext(calltarget);
+         else
+            firstRejectedTarget = calltarget;
+         lastRejectedTarget = calltarget;
+         }
+      }
+
+   if (lastRejectedTarget)
+      lastRejectedTarget->setNext(NULL);
+
+   if (lastTargetToInline)
+      lastTargetToInline->setNext(firstRejectedTarget);
+   else
+      _callTargets.setFirst(firstRejectedTarget);
+
+   return firstRejectedTarget;
+   }
+
 //Note, this function is shared by all FE's.  If you are changing the heuristic for your FE only, you need to push this method into the various FE's FEInliner.cpp file.
 int32_t TR_MultipleCallTargetInliner::scaleSizeBasedOnBlockFrequency(int32_t bytecodeSize, int32_t frequency, int32_t borderFrequency, TR_ResolvedMethod * calleeResolvedMethod, TR::Node *callNode, int32_t coldBorderFrequency)
    {
@@ -4927,6 +5013,21 @@ TR_InlinerFailureReason
          break;
    }
 
+   // Leave the VectorSupport intrinsics that RecognizedCallTransformer can lower to vector IL;
+   // inlining them would only expose the boxed Java fallback
+   switch (rm)
+      {
+      case TR::jdk_internal_vm_vector_VectorSupport_binaryOp:
+      case TR::jdk_internal_vm_vector_VectorSupport_load:
+      case TR::jdk_internal_vm_vector_VectorSupport_store:
+      case TR::jdk_internal_vm_vector_VectorSupport_reductionCoerced:
+         if (callsite->_callNode && TR::RecognizedCallTransformer::isVectorSupportCallInlineable(comp, callsite->_callNode))
+            return DontInline_Callee;
+         break;
+      default:
+         break;
+      }
+
    if (comp->getOptions()->getEnableGPU(TR_EnableGPU))
       {
       switch (rm)
@@ -123,6 +123,27 @@ class TR_MultipleCallTargetInliner : public TR_InlinerBase
        */
       void processChoppedOffCallTargets(TR_CallTarget* lastTargetToInline, TR_CallTarget *firstChoppedOffcalltarget, int estimateAndRefineBytecodeSize);
 
+      /* \brief
+       *    Reorders \ref _callTargets by the profiled frequency of each call site per unit of weight and
+       *    moves the targets that no longer fit in the caller weight budget to the end of the list, instead
+       *    of chopping the weight ordered list at the first target that exceeds it.
+       *
+       * \parm limit
+       *    the total weight budget of the caller
+       *
+       * \parm trivialWeightForLimit
+       *    targets with at most this weight are always kept
+       *
+       * \return
+       *    the first rejected target, to be passed to \ref processChoppedOffCallTargets, or NULL if all targets fit
+       *
+       * \notes
+       *    Like targets chopped off by weight, rejected targets are still kept by \ref processChoppedOffCallTargets
+       *    if \ref inlineSubCallGraph says they must be inlined, subject to its node estimate check.
+       *    The reason for each rejection is reported in the inliner heuristic trace.
+       */
+      TR_CallTarget *planInliningBudget(int32_t limit, int32_t trivialWeightForLimit);
+
       /*
        * \brief
        *    Recursively walk through the sub call graph of a given calltarget and clean up all targets
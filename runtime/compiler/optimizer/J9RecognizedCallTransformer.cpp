@@ -43,6 +43,7 @@
 #include "optimizer/TransformUtil.hpp"
 #include "env/j9method.h"
 #include "optimizer/Optimization_inlines.hpp"
+#include "env/TypeLayout.hpp"
 
 void J9::RecognizedCallTransformer::processIntrinsicFunction(TR::TreeTop* treetop, TR::Node* node, TR::ILOpCodes opcode)
    {
@@ -356,6 +357,348 @@ void J9::RecognizedCallTransformer::processUnsafeAtomicCall(TR::TreeTop* treetop
    unsafeCall->setSymbolReference(comp()->getSymRefTab()->findOrCreateCodeGenInlinedHelper(helper));
    }
 
+/*
+ * Operation ids passed to the VectorSupport intrinsics. These mirror the VECTOR_OP_* constants
+ * of jdk/internal/vm/vector/VectorSupport.
+ */
+enum VectorSupportOperation
+   {
+   VECTOR_OP_ADD = 4,
+   VECTOR_OP_SUB = 5,
+   VECTOR_OP_MUL = 6,
+   VECTOR_OP_DIV = 7,
+   VECTOR_OP_AND = 10,
+   VECTOR_OP_OR  = 11,
+   VECTOR_OP_XOR = 12
+   };
+
+static TR::ILOpCodes selectOpCodeForElementType(TR::DataType elementType, TR::ILOpCodes byteOp, TR::ILOpCodes shortOp, TR::ILOpCodes intOp, TR::ILOpCodes longOp, TR::ILOpCodes floatOp, TR::ILOpCodes doubleOp)
+   {
+   switch (elementType.getDataType())
+      {
+      case TR::Int8:   return byteOp;
+      case TR::Int16:  return shortOp;
+      case TR::Int32:  return intOp;
+      case TR::Int64:  return longOp;
+      case TR::Float:  return floatOp;
+      case TR::Double: return doubleOp;
+      default:         return TR::BadILOp;
+      }
+   }
+
+/*
+ * Scalar opcode applied lane-wise by a VectorSupport operation. Integer division is not handled
+ * since the Java fallback has to throw on a zero divisor.
+ */
+static TR::ILOpCodes scalarOpCodeForVectorSupportOperation(int32_t oprId, TR::DataType elementType)
+   {
+   switch (oprId)
+      {
+      case VECTOR_OP_ADD:
+         return selectOpCodeForElementType(elementType, TR::badd, TR::sadd, TR::iadd, TR::ladd, TR::fadd, TR::dadd);
+      case VECTOR_OP_SUB:
+         return selectOpCodeForElementType(elementType, TR::bsub, TR::ssub, TR::isub, TR::lsub, TR::fsub, TR::dsub);
+      case VECTOR_OP_MUL:
+         return selectOpCodeForElementType(elementType, TR::bmul, TR::smul, TR::imul, TR::lmul, TR::fmul, TR::dmul);
+      case VECTOR_OP_DIV:
+         return selectOpCodeForElementType(elementType, TR::BadILOp, TR::BadILOp, TR::BadILOp, TR::BadILOp, TR::fdiv, TR::ddiv);
+      case VECTOR_OP_AND:
+         return selectOpCodeForElementType(elementType, TR::band, TR::sand, TR::iand, TR::land, TR::BadILOp, TR::BadILOp);
+      case VECTOR_OP_OR:
+         return selectOpCodeForElementType(elementType, TR::bor, TR::sor, TR::ior, TR::lor, TR::BadILOp, TR::BadILOp);
+      case VECTOR_OP_XOR:
+         return selectOpCodeForElementType(elementType, TR::bxor, TR::sxor, TR::ixor, TR::lxor, TR::BadILOp, TR::BadILOp);
+      default:
+         return TR::BadILOp;
+      }
+   }
+
+static TR_arrayTypeCode arrayTypeCodeForElementType(TR::DataType elementType)
+   {
+   switch (elementType.getDataType())
+      {
+      case TR::Int8:   return atype_byte;
+      case TR::Int16:  return atype_short;
+      case TR::Int32:  return atype_int;
+      case TR::Int64:  return atype_long;
+      case TR::Float:  return atype_float;
+      default:         return atype_double;
+      }
+   }
+
+TR_OpaqueClassBlock* J9::RecognizedCallTransformer::getVectorBoxClass(TR::Compilation* comp, TR::Node* classNode, TR::DataType& elementType, TR::SymbolReference*& payloadSymRef)
+   {
+   static const struct
+      {
+      const char *name;
+      TR::DataTypes elementType;
+      } vectorBoxClasses[] =
+      {
+      { "jdk/incubator/vector/Byte128Vector",   TR::Int8   },
+      { "jdk/incubator/vector/Short128Vector",  TR::Int16  },
+      { "jdk/incubator/vector/Int128Vector",    TR::Int32  },
+      { "jdk/incubator/vector/Long128Vector",   TR::Int64  },
+      { "jdk/incubator/vector/Float128Vector",  TR::Float  },
+      { "jdk/incubator/vector/Double128Vector", TR::Double },
+      };
+
+   // The vector class is passed as a constant class object, i.e. <javaLangClassFromClass> of a resolved loadaddr
+   if (!classNode->getOpCode().hasSymbolReference() ||
+       classNode->getSymbolReference() != comp->getSymRefTab()->findJavaLangClassFromClassSymbolRef())
+      return NULL;
+
+   TR::Node* classPointerNode = classNode->getFirstChild();
+   if (classPointerNode->getOpCodeValue() != TR::loadaddr ||
+       classPointerNode->getSymbolReference()->isUnresolved() ||
+       !classPointerNode->getSymbol()->isClassObject())
+      return NULL;
+
+   TR_OpaqueClassBlock* boxClass = (TR_OpaqueClassBlock*)classPointerNode->getSymbol()->castToStaticSymbol()->getStaticAddress();
+   if (!boxClass || !comp->fej9()->isClassInitialized(boxClass))
+      return NULL;
+
+   int32_t classNameLength = 0;
+   const char* className = comp->fej9()->getClassNameChars(boxClass, classNameLength);
+   elementType = TR::NoType;
+   for (size_t i = 0; i < sizeof(vectorBoxClasses) / sizeof(vectorBoxClasses[0]); i++)
+      {
+      if (strlen(vectorBoxClasses[i].name) == (size_t)classNameLength &&
+          !strncmp(vectorBoxClasses[i].name, className, classNameLength))
+         {
+         elementType = vectorBoxClasses[i].elementType;
+         break;
+         }
+      }
+   if (elementType == TR::NoType)
+      return NULL;
+
+   // The box is allocated here without running its constructor, which is only sound while
+   // the payload array is the one and only instance field of the box
+   const TR::TypeLayout* layout = comp->typeLayout(boxClass);
+   if (layout->count() != 1)
+      return NULL;
+
+   const TR::TypeLayoutEntry& payloadEntry = layout->entry(0);
+   if (payloadEntry._datatype != TR::Address || strcmp(payloadEntry._fieldname, "payload"))
+      return NULL;
+
+   payloadSymRef = comp->getSymRefTab()->findOrFabricateShadowSymbol(boxClass,
+                                                                     payloadEntry._datatype,
+                                                                     payloadEntry._offset,
+                                                                     payloadEntry._isVolatile,
+                                                                     payloadEntry._isPrivate,
+                                                                     payloadEntry._isFinal,
+                                                                     payloadEntry._fieldname,
+                                                                     payloadEntry._typeSignature);
+   return boxClass;
+   }
+
+bool J9::RecognizedCallTransformer::isVectorSupportCallInlineable(TR::Compilation* comp, TR::Node* node)
+   {
+   static char *disableVectorSupportIntrinsics = feGetEnv("TR_DisableVectorSupportIntrinsics");
+   if (disableVectorSupportIntrinsics ||
+       comp->getOption(TR_DisableAutoSIMD) ||
+       !comp->cg()->getSupportsAutoSIMD() ||
+       comp->compileRelocatableCode() ||
+       TR::Compiler->om.canGenerateArraylets() ||
+       !comp->target().is64Bit())
+      return false;
+
+   TR::RecognizedMethod rm = node->getSymbol()->castToMethodSymbol()->getMandatoryRecognizedMethod();
+   bool hasOperation = rm == TR::jdk_internal_vm_vector_VectorSupport_binaryOp ||
+                       rm == TR::jdk_internal_vm_vector_VectorSupport_reductionCoerced;
+   TR::Node* classNode = node->getChild(hasOperation ? 1 : 0);
+
+   TR::DataType elementType = TR::NoType;
+   TR::SymbolReference* payloadSymRef = NULL;
+   if (!getVectorBoxClass(comp, classNode, elementType, payloadSymRef))
+      return false;
+
+   TR::DataType vectorType = elementType.scalarToVector();
+   if (!comp->cg()->getSupportsOpCodeForAutoSIMD(comp->il.opCodeForIndirectLoad(vectorType), elementType))
+      return false;
+
+   int32_t oprId = -1;
+   if (hasOperation)
+      {
+      if (!node->getFirstChild()->getOpCode().isLoadConst())
+         return false;
+      oprId = node->getFirstChild()->getInt();
+      }
+
+   switch (rm)
+      {
+      case TR::jdk_internal_vm_vector_VectorSupport_binaryOp:
+         {
+         TR::ILOpCodes vectorOpCode = TR::ILOpCode::convertScalarToVector(scalarOpCodeForVectorSupportOperation(oprId, elementType));
+         return vectorOpCode != TR::BadILOp &&
+            comp->cg()->getSupportsOpCodeForAutoSIMD(vectorOpCode, elementType) &&
+            comp->cg()->getSupportsOpCodeForAutoSIMD(comp->il.opCodeForIndirectStore(vectorType), elementType);
+         }
+      case TR::jdk_internal_vm_vector_VectorSupport_load:
+         return comp->cg()->getSupportsOpCodeForAutoSIMD(comp->il.opCodeForIndirectStore(vectorType), elementType);
+      case TR::jdk_internal_vm_vector_VectorSupport_store:
+         return comp->cg()->getSupportsOpCodeForAutoSIMD(comp->il.opCodeForIndirectStore(vectorType), elementType);
+      case TR::jdk_internal_vm_vector_VectorSupport_reductionCoerced:
+         // Floating point lanes are not reduced here: the fallback canonicalizes NaNs when coercing them to long
+         return elementType.isIntegral() &&
+            (oprId == VECTOR_OP_ADD || oprId == VECTOR_OP_MUL || oprId == VECTOR_OP_AND || oprId == VECTOR_OP_OR || oprId == VECTOR_OP_XOR) &&
+            comp->cg()->getSupportsOpCodeForAutoSIMD(TR::getvelem, elementType);
+      default:
+         return false;
+      }
+   }
+
+TR::Node* J9::RecognizedCallTransformer::loadVectorPayload(TR::TreeTop* treetop, TR::Node* box, TR::SymbolReference* payloadSymRef, TR::DataType elementType)
+   {
+   auto nullchk = comp()->getSymRefTab()->findOrCreateNullCheckSymbolRef(comp()->getMethodSymbol());
+   treetop->insertBefore(TR::TreeTop::create(comp(), TR::Node::createWithSymRef(TR::NULLCHK, 1, 1, TR::Node::create(box, TR::PassThrough, 1, box), nullchk)));
+
+   TR::Node* payload = TR::Node::createWithSymRef(TR::aloadi, 1, 1, box, payloadSymRef);
+   if (comp()->useCompressedPointers())
+      treetop->insertBefore(TR::TreeTop::create(comp(), TR::Node::createCompressedRefsAnchor(payload)));
+
+   TR::DataType vectorType = elementType.scalarToVector();
+   return TR::Node::createWithSymRef(comp()->il.opCodeForIndirectLoad(vectorType), 1, 1,
+                                     TR::TransformUtil::calculateElementAddress(comp(), payload, TR::Node::iconst(box, 0), elementType),
+                                     comp()->getSymRefTab()->findOrCreateArrayShadowSymbolRef(vectorType, NULL));
+   }
+
+void J9::RecognizedCallTransformer::replaceWithVectorBox(TR::TreeTop* treetop, TR::Node* node, TR::Node* value, TR_OpaqueClassBlock* boxClass, TR::SymbolReference* payloadSymRef, TR::DataType elementType)
+   {
+   TR::DataType vectorType = elementType.scalarToVector();
+   TR::ResolvedMethodSymbol* owningMethodSymbol = node->getSymbolReference()->getOwningMethodSymbol(comp());
+   int32_t laneCount = TR::Symbol::convertTypeToSize(vectorType) / TR::Symbol::convertTypeToSize(elementType);
+
+   // Allocate the payload array and fill all of its lanes with a single vector store
+   TR::Node* payload = TR::Node::createWithSymRef(TR::newarray, 2, 2,
+                                                  TR::Node::iconst(node, laneCount),
+                                                  TR::Node::iconst(node, arrayTypeCodeForElementType(elementType)),
+                                                  getSymRefTab()->findOrCreateNewArraySymbolRef(owningMethodSymbol));
+   payload->setCanSkipZeroInitialization(true);
+   payload->setIsNonNull(true);
+   treetop->insertBefore(TR::TreeTop::create(comp(), TR::Node::create(node, TR::treetop, 1, payload)));
+
+   TR::Node* vectorStore = TR::Node::createWithSymRef(comp()->il.opCodeForIndirectStore(vectorType), 2, 2,
+                                                      TR::TransformUtil::calculateElementAddress(comp(), payload, TR::Node::iconst(node, 0), elementType),
+                                                      value,
+                                                      comp()->getSymRefTab()->findOrCreateArrayShadowSymbolRef(vectorType, NULL));
+   treetop->insertBefore(TR::TreeTop::create(comp(), vectorStore));
+
+   // Replace the call with the allocation of the box and store the payload into it
+   prepareToReplaceNode(node);
+
+   TR::Node::recreateWithoutProperties(node, TR::New, 1,
+      TR::Node::createWithSymRef(node, TR::loadaddr, 0, getSymRefTab()->findOrCreateClassSymbol(owningMethodSymbol, -1, boxClass)),
+      getSymRefTab()->findOrCreateNewObjectSymbolRef(owningMethodSymbol));
+   node->setIsNonNull(true);
+
+   TR::Node* payloadStore = TR::Compiler->om.writeBarrierType() != gc_modron_wrtbar_none
+      ? TR::Node::createWithSymRef(TR::awrtbari, 3, 3, node, payload, node, payloadSymRef)
+      : TR::Node::createWithSymRef(TR::astorei, 2, 2, node, payload, payloadSymRef);
+   if (comp()->useCompressedPointers())
+      payloadStore = TR::Node::createCompressedRefsAnchor(payloadStore);
+   treetop->insertAfter(TR::TreeTop::create(comp(), payloadStore));
+   }
+
+void J9::RecognizedCallTransformer::process_jdk_internal_vm_vector_VectorSupport_binaryOp(TR::TreeTop* treetop, TR::Node* node)
+   {
+   TR::DataType elementType = TR::NoType;
+   TR::SymbolReference* payloadSymRef = NULL;
+   TR_OpaqueClassBlock* boxClass = getVectorBoxClass(comp(), node->getChild(1), elementType, payloadSymRef);
+   TR::ILOpCodes vectorOpCode = TR::ILOpCode::convertScalarToVector(scalarOpCodeForVectorSupportOperation(node->getFirstChild()->getInt(), elementType));
+
+   anchorAllChildren(node, treetop);
+
+   TR::Node* result = TR::Node::create(node, vectorOpCode, 2);
+   result->setAndIncChild(0, loadVectorPayload(treetop, node->getChild(4), payloadSymRef, elementType));
+   result->setAndIncChild(1, loadVectorPayload(treetop, node->getChild(5), payloadSymRef, elementType));
+
+   replaceWithVectorBox(treetop, node, result, boxClass, payloadSymRef, elementType);
+   }
+
+void J9::RecognizedCallTransformer::process_jdk_internal_vm_vector_VectorSupport_load(TR::TreeTop* treetop, TR::Node* node)
+   {
+   TR::DataType elementType = TR::NoType;
+   TR::SymbolReference* payloadSymRef = NULL;
+   TR_OpaqueClassBlock* boxClass = getVectorBoxClass(comp(), node->getFirstChild(), elementType, payloadSymRef);
+   TR::DataType vectorType = elementType.scalarToVector();
+
+   anchorAllChildren(node, treetop);
+
+   // Same addressing as Unsafe: the base is either an array or null with offset holding an absolute address
+   TR::Node* address = TR::Node::create(TR::aladd, 2, node->getChild(3), node->getChild(4));
+   TR::Node* value = TR::Node::createWithSymRef(comp()->il.opCodeForIndirectLoad(vectorType), 1, 1, address,
+                                                comp()->getSymRefTab()->findOrCreateUnsafeSymbolRef(vectorType, true, false));
+
+   replaceWithVectorBox(treetop, node, value, boxClass, payloadSymRef, elementType);
+   }
+
+void J9::RecognizedCallTransformer::process_jdk_internal_vm_vector_VectorSupport_store(TR::TreeTop* treetop, TR::Node* node)
+   {
+   TR::DataType elementType = TR::NoType;
+   TR::SymbolReference* payloadSymRef = NULL;
+   getVectorBoxClass(comp(), node->getFirstChild(), elementType, payloadSymRef);
+   TR::DataType vectorType = elementType.scalarToVector();
+
+   anchorAllChildren(node, treetop);
+
+   TR::Node* address = TR::Node::create(TR::aladd, 2, node->getChild(3), node->getChild(4));
+   TR::Node* value = loadVectorPayload(treetop, node->getChild(5), payloadSymRef, elementType);
+   treetop->insertBefore(TR::TreeTop::create(comp(),
+      TR::Node::createWithSymRef(comp()->il.opCodeForIndirectStore(vectorType), 2, 2, address, value,
+                                 comp()->getSymRefTab()->findOrCreateUnsafeSymbolRef(vectorType, true, false))));
+
+   TR::TransformUtil::removeTree(comp(), treetop);
+   }
+
+void J9::RecognizedCallTransformer::process_jdk_internal_vm_vector_VectorSupport_reductionCoerced(TR::TreeTop* treetop, TR::Node* node)
+   {
+   TR::DataType elementType = TR::NoType;
+   TR::SymbolReference* payloadSymRef = NULL;
+   getVectorBoxClass(comp(), node->getChild(1), elementType, payloadSymRef);
+   TR::DataType vectorType = elementType.scalarToVector();
+   TR::ILOpCodes scalarOpCode = scalarOpCodeForVectorSupportOperation(node->getFirstChild()->getInt(), elementType);
+   int32_t laneCount = TR::Symbol::convertTypeToSize(vectorType) / TR::Symbol::convertTypeToSize(elementType);
+
+   anchorAllChildren(node, treetop);
+
+   TR::Node* vector = loadVectorPayload(treetop, node->getChild(4), payloadSymRef, elementType);
+   treetop->insertBefore(TR::TreeTop::create(comp(), TR::Node::create(node, TR::treetop, 1, vector)));
+
+   prepareToReplaceNode(node);
+
+   // Combine the lanes in order, as the Java fallback does, reusing the call node for the last
+   // operation unless the result still has to be widened to long
+   TR::ILOpCodes conversionOpCode = TR::ILOpCode::getProperConversion(elementType, TR::Int64, false /* !wantZeroExtension */);
+   TR::Node* result = TR::Node::create(node, TR::getvelem, 2, vector, TR::Node::iconst(node, 0));
+   for (int32_t i = 1; i < laneCount; i++)
+      {
+      TR::Node* lane = TR::Node::create(node, TR::getvelem, 2, vector, TR::Node::iconst(node, i));
+      TR::Node* combined = NULL;
+      if (i == laneCount - 1 && conversionOpCode == TR::BadILOp)
+         {
+         TR::Node::recreate(node, scalarOpCode);
+         node->setNumChildren(2);
+         combined = node;
+         }
+      else
+         {
+         combined = TR::Node::create(node, scalarOpCode, 2);
+         }
+      combined->setAndIncChild(0, result);
+      combined->setAndIncChild(1, lane);
+      result = combined;
+      }
+
+   if (conversionOpCode != TR::BadILOp)
+      {
+      TR::Node::recreate(node, conversionOpCode);
+      node->setNumChildren(1);
+      node->setAndIncChild(0, result);
+      }
+   }
+
 bool J9::RecognizedCallTransformer::isInlineable(TR::TreeTop* treetop)
    {
    auto node = treetop->getNode()->getFirstChild();
@@ -401,6 +744,11 @@ bool J9::RecognizedCallTransformer::isInlineable(TR::TreeTop* treetop)
       case TR::java_lang_Integer_reverseBytes:
       case TR::java_lang_Long_reverseBytes:
          return comp()->cg()->supportsByteswap();
+      case TR::jdk_internal_vm_vector_VectorSupport_binaryOp:
+      case TR::jdk_internal_vm_vector_VectorSupport_load:
+      case TR::jdk_internal_vm_vector_VectorSupport_store:
+      case TR::jdk_internal_vm_vector_VectorSupport_reductionCoerced:
+         return isVectorSupportCallInlineable(comp(), node);
       default:
          return false;
       }
@@ -490,6 +838,18 @@ void J9::RecognizedCallTransformer::transform(TR::TreeTop* treetop)
       case TR::java_lang_Long_reverseBytes:
          processIntrinsicFunction(treetop, node, TR::lbyteswap);
          break;
+      case TR::jdk_internal_vm_vector_VectorSupport_binaryOp:
+         process_jdk_internal_vm_vector_VectorSupport_binaryOp(treetop, node);
+         break;
+      case TR::jdk_internal_vm_vector_VectorSupport_load:
+         process_jdk_internal_vm_vector_VectorSupport_load(treetop, node);
+         break;
+      case TR::jdk_internal_vm_vector_VectorSupport_store:
+         process_jdk_internal_vm_vector_VectorSupport_store(treetop, node);
+         break;
+      case TR::jdk_internal_vm_vector_VectorSupport_reductionCoerced:
+         process_jdk_internal_vm_vector_VectorSupport_reductionCoerced(treetop, node);
+         break;
       default:
          break;
       }
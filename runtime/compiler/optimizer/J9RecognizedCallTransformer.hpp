@@ -36,6 +36,23 @@ class RecognizedCallTransformer : public OMR::RecognizedCallTransformer
       : OMR::RecognizedCallTransformer(manager)
       {}
 
+   /** \brief
+    *     Checks whether a call to one of the jdk/internal/vm/vector/VectorSupport intrinsics can be lowered to vector IL.
+    *
+    *     The inliner uses the same check to leave such calls to this transformation.
+    *
+    *  \param comp
+    *     The current compilation.
+    *
+    *  \param node
+    *     The call node representing a call to a recognized VectorSupport intrinsic.
+    *
+    *  \return
+    *     true if the vector class argument is a constant 128-bit jdk/incubator/vector species whose operation is
+    *     supported by the code generator; false if the call must be left to its Java fallback.
+    */
+   static bool isVectorSupportCallInlineable(TR::Compilation* comp, TR::Node* node);
+
    protected:
    virtual bool isInlineable(TR::TreeTop* treetop);
    virtual void transform(TR::TreeTop* treetop);
@@ -108,6 +125,157 @@ class RecognizedCallTransformer : public OMR::RecognizedCallTransformer
     *     Flag indicating if null check is needed on the first argument of the unsafe call
     */
    void processUnsafeAtomicCall(TR::TreeTop* treetop, TR::SymbolReferenceTable::CommonNonhelperSymbol helper, bool needsNullCheck = false);
+   /** \brief
+    *     Finds the box class of a 128-bit jdk/incubator/vector species, such as jdk/incubator/vector/Int128Vector,
+    *     from the class object passed to a VectorSupport intrinsic.
+    *
+    *  \param comp
+    *     The current compilation.
+    *
+    *  \param classNode
+    *     The node for the vector class argument of the VectorSupport call.
+    *
+    *  \param elementType
+    *     Set to the data type of a single lane of the species.
+    *
+    *  \param payloadSymRef
+    *     Set to the shadow of the payload field holding the lanes of a box of the species.
+    *
+    *  \return
+    *     The box class, or NULL if the class object is not known or is not a 128-bit species.
+    */
+   static TR_OpaqueClassBlock* getVectorBoxClass(TR::Compilation* comp, TR::Node* classNode, TR::DataType& elementType, TR::SymbolReference*& payloadSymRef);
+   /** \brief
+    *     Generates a vector load of the lanes held by a vector box, null checking the box before the treetop.
+    *
+    *  \param treetop
+    *     The treetop before which the null check is inserted.
+    *
+    *  \param box
+    *     The node for the vector box.
+    *
+    *  \param payloadSymRef
+    *     The shadow of the payload field of the box.
+    *
+    *  \param elementType
+    *     The data type of a single lane of the box.
+    *
+    *  \return
+    *     The vector load node.
+    */
+   TR::Node* loadVectorPayload(TR::TreeTop* treetop, TR::Node* box, TR::SymbolReference* payloadSymRef, TR::DataType elementType);
+   /** \brief
+    *     Replaces a VectorSupport call which returns a vector with the allocation of a new box holding the given lanes.
+    *     The allocations are left for escape analysis to remove when the box does not escape.
+    *
+    *  \param treetop
+    *     The treetop which anchors the call node.
+    *
+    *  \param node
+    *     The call node to be replaced.
+    *
+    *  \param value
+    *     The vector node holding the lanes for the new box.
+    *
+    *  \param boxClass
+    *     The box class to allocate.
+    *
+    *  \param payloadSymRef
+    *     The shadow of the payload field of the box.
+    *
+    *  \param elementType
+    *     The data type of a single lane of the box.
+    */
+   void replaceWithVectorBox(TR::TreeTop* treetop, TR::Node* node, TR::Node* value, TR_OpaqueClassBlock* boxClass, TR::SymbolReference* payloadSymRef, TR::DataType elementType);
+   /** \brief
+    *     Transforms jdk/internal/vm/vector/VectorSupport.binaryOp into a vector arithmetic or logical operation on
+    *     the lanes of the two operands.
+    *
+    *  \param treetop
+    *     The treetop which anchors the call node.
+    *
+    *  \param node
+    *     The call node representing a call to VectorSupport.binaryOp which has the following shape:
+    *
+    *     \code
+    *     acall <jdk/internal/vm/vector/VectorSupport.binaryOp>
+    *       <oprId>
+    *       <vmClass>
+    *       <elementType>
+    *       <length>
+    *       <v1>
+    *       <v2>
+    *       <defaultImpl>
+    *     \endcode
+    */
+   void process_jdk_internal_vm_vector_VectorSupport_binaryOp(TR::TreeTop* treetop, TR::Node* node);
+   /** \brief
+    *     Transforms jdk/internal/vm/vector/VectorSupport.load into a vector load from base + offset.
+    *
+    *  \param treetop
+    *     The treetop which anchors the call node.
+    *
+    *  \param node
+    *     The call node representing a call to VectorSupport.load which has the following shape:
+    *
+    *     \code
+    *     acall <jdk/internal/vm/vector/VectorSupport.load>
+    *       <vmClass>
+    *       <elementType>
+    *       <length>
+    *       <base>
+    *       <offset>
+    *       <container>
+    *       <index>
+    *       <species>
+    *       <defaultImpl>
+    *     \endcode
+    */
+   void process_jdk_internal_vm_vector_VectorSupport_load(TR::TreeTop* treetop, TR::Node* node);
+   /** \brief
+    *     Transforms jdk/internal/vm/vector/VectorSupport.store into a vector store to base + offset.
+    *
+    *  \param treetop
+    *     The treetop which anchors the call node.
+    *
+    *  \param node
+    *     The call node representing a call to VectorSupport.store which has the following shape:
+    *
+    *     \code
+    *     call <jdk/internal/vm/vector/VectorSupport.store>
+    *       <vectorClass>
+    *       <elementType>
+    *       <length>
+    *       <base>
+    *       <offset>
+    *       <v>
+    *       <container>
+    *       <index>
+    *       <defaultImpl>
+    *     \endcode
+    */
+   void process_jdk_internal_vm_vector_VectorSupport_store(TR::TreeTop* treetop, TR::Node* node);
+   /** \brief
+    *     Transforms jdk/internal/vm/vector/VectorSupport.reductionCoerced into a sequence of lane extractions combined
+    *     with the scalar operation, widened to long.
+    *
+    *  \param treetop
+    *     The treetop which anchors the call node.
+    *
+    *  \param node
+    *     The call node representing a call to VectorSupport.reductionCoerced which has the following shape:
+    *
+    *     \code
+    *     lcall <jdk/internal/vm/vector/VectorSupport.reductionCoerced>
+    *       <oprId>
+    *       <vectorClass>
+    *       <elementType>
+    *       <length>
+    *       <v>
+    *       <defaultImpl>
+    *     \endcode
+    */
+   void process_jdk_internal_vm_vector_VectorSupport_reductionCoerced(TR::TreeTop* treetop, TR::Node* node);
    };
 
 }
@@ -454,6 +454,10 @@ bool J9::TransformUtil::foldFinalFieldsIn(TR_OpaqueClassBlock *clazz, const char
    if (classNameLength == 16 && !strncmp(className, "java/lang/System", 16))
       return false;
 
+   // Final instance fields of records and hidden classes cannot be written by reflection
+   if (!isStatic && TR::Compiler->cls.hasTrustedFinalInstanceFields(clazz))
+      return true;
+
    static char *enableJCLFolding = feGetEnv("TR_EnableJCLStaticFinalFieldFolding");
    if ((enableJCLFolding || comp->getOption(TR_AggressiveOpts))
        && isStatic
@@ -22,6 +22,7 @@
 
 #include "optimizer/LoopAliasRefiner.hpp"
 
+#include <algorithm>
 #include <stddef.h>
 #include <stdint.h>
 #include "compile/Compilation.hpp"
@@ -43,6 +44,7 @@
 #include "optimizer/Optimizations.hpp"
 #include "optimizer/SPMDPreCheck.hpp"
 #include "optimizer/Structure.hpp"
+#include "ras/DebugCounter.hpp"
 
 namespace TR { class TreeTop; }
 
@@ -154,9 +156,82 @@ bool TR_LoopAliasRefiner::hasMulShadowTypes(TR_ScratchList<TR_NodeParentBlockTup
    return false;
    }
 
+/*
+ * Express node as iv*scale + offset for the given induction variable, where scale and offset are constants.
+ * Both are kept small so that the range arithmetic done on them later cannot overflow.
+ */
+bool TR_LoopAliasRefiner::getLinearOffset(TR::Node *node, TR::SymbolReference *ivSymRef, int64_t &scale, int64_t &offset)
+   {
+   static const int64_t limit = 0x40000000;
+
+   switch (node->getOpCodeValue())
+      {
+      case TR::iconst:
+      case TR::lconst:
+         scale = 0;
+         offset = node->get64bitIntegralValue();
+         break;
+      case TR::iload:
+         if (node->getSymbolReference() != ivSymRef)
+            return false;
+         scale = 1;
+         offset = 0;
+         break;
+      case TR::i2l:
+         return getLinearOffset(node->getFirstChild(), ivSymRef, scale, offset);
+      case TR::iadd:
+      case TR::ladd:
+      case TR::isub:
+      case TR::lsub:
+         {
+         int64_t secondScale, secondOffset;
+         if (!getLinearOffset(node->getFirstChild(), ivSymRef, scale, offset) ||
+             !getLinearOffset(node->getSecondChild(), ivSymRef, secondScale, secondOffset))
+            return false;
+         if (node->getOpCode().isSub())
+            {
+            scale -= secondScale;
+            offset -= secondOffset;
+            }
+         else
+            {
+            scale += secondScale;
+            offset += secondOffset;
+            }
+         break;
+         }
+      case TR::imul:
+      case TR::lmul:
+      case TR::ishl:
+      case TR::lshl:
+         {
+         if (!node->getSecondChild()->getOpCode().isLoadConst() ||
+             !getLinearOffset(node->getFirstChild(), ivSymRef, scale, offset))
+            return false;
+         int64_t factor = node->getSecondChild()->get64bitIntegralValue();
+         if (node->getOpCode().isLeftShift())
+            {
+            if (factor < 0 || factor > 4)
+               return false;
+            factor = (int64_t)1 << factor;
+            }
+         if (factor > limit || factor < -limit)
+            return false;
+         scale *= factor;
+         offset *= factor;
+         break;
+         }
+      default:
+         return false;
+      }
+
+   return scale <= limit && scale >= -limit && offset <= limit && offset >= -limit;
+   }
+
 bool TR_LoopAliasRefiner::processArrayAliasCandidates()
    {
    _arrayRanges = NULL;
+   _rangeTestIV = NULL;
    bool haveGoodMemberCandidates = false;
    bool foundSecondArray = false; // no point improving aliasing if there is only one array
    bool haveNonMemberCandidates = false;
@@ -189,6 +264,27 @@ bool TR_LoopAliasRefiner::processArrayAliasCandidates()
 
    TR_ScratchList<IVValueRange> ivList(trMemory()); // list of all ivs possibly referenced in this loop
 
+   // Arrays that may be the same object can still be versioned on the ranges they access
+   // when the loop runs a primary induction variable up to a bound known before the loop
+   static bool disableRangeTests = feGetEnv("TR_DisableLoopAliasRefinerRangeTests") != NULL;
+   TR_PrimaryInductionVariable *piv = _currentNaturalLoop->getPrimaryInductionVariable();
+   if (!disableRangeTests &&
+       piv &&
+       piv->getDeltaOnBackEdge() > 0 &&
+       piv->getSymRef()->getSymbol()->getDataType() == TR::Int32 &&
+       piv->getEntryValue() &&
+       piv->getEntryValue()->getOpCodeValue() == TR::iconst &&
+       piv->getExitBound() &&
+       piv->getExitBound()->getDataType() == TR::Int32 &&
+       (piv->getExitBound()->getOpCode().isLoadConst() ||
+        (piv->getExitBound()->getOpCode().isLoadVarDirect() &&
+         piv->getExitBound()->getSymbol()->isAutoOrParm() &&
+         piv->getExitBound()->getSymbolReference() != piv->getSymRef())) &&
+       _currentNaturalLoop->isExprInvariant(piv->getExitBound()))
+      {
+      _rangeTestIV = piv;
+      }
+
    ListIterator<TR_NodeParentBlockTuple> useCand(_arrayLoadCandidates);
    TR_NodeParentBlockTuple *curTuple;
  
@@ -298,6 +394,42 @@ bool TR_LoopAliasRefiner::processArrayAliasCandidates()
          ArrayRangeLimits *arl = new(comp()->trStackMemory())
                                  ArrayRangeLimits(copyOfCandidateRefs, currentBaseSymRef, currentMemberSymRef, arrayAccessSymRef);
          _arrayRanges->add(arl);
+
+         if (_rangeTestIV)
+            {
+            ListIterator<TR_NodeParentBlockTuple> refIterator(copyOfCandidateRefs);
+            bool isLinear = true;
+            int64_t ivScale = 0, minOffset = 0, maxEnd = 0;
+            for (TR_NodeParentBlockTuple *ref = refIterator.getFirst(); ref && isLinear; ref = refIterator.getNext())
+               {
+               int64_t scale, offset;
+               isLinear = getLinearOffset(ref->_node->getSecondChild(), _rangeTestIV->getSymRef(), scale, offset) &&
+                          scale > 0 &&
+                          (ref == refIterator.getFirst() || scale == ivScale);
+               if (isLinear)
+                  {
+                  int64_t end = offset + ref->_parent->getSize();
+                  if (ref == refIterator.getFirst())
+                     {
+                     ivScale = scale;
+                     minOffset = offset;
+                     maxEnd = end;
+                     }
+                  minOffset = std::min(minOffset, offset);
+                  maxEnd = std::max(maxEnd, end);
+                  }
+               }
+
+            if (isLinear)
+               {
+               if (trace())
+                  traceMsg(comp(), "\tAccesses of base #%d are at iv #%d * %lld + [%lld, %lld)\n",
+                                   currentBaseSymRef->getReferenceNumber(),
+                                   _rangeTestIV->getSymRef()->getReferenceNumber(),
+                                   ivScale, minOffset, maxEnd);
+               arl->setLinearRange(ivScale, minOffset, maxEnd);
+               }
+            }
          }
       }
 
@@ -348,12 +480,15 @@ void TR_LoopAliasRefiner::buildAliasRefinementComparisonTrees(List<TR::TreeTop>
       ArrayRangeLimits *arlBPtr;
       for (arlBPtr = arIterator.getFirst(); arlBPtr; arlBPtr = arIterator.getNext())
          {
-         TR::Node *testExpr  =  arlAPtr->createRangeTestExpr(comp(), arlBPtr, exitGotoBlock, trace());
+         TR::Node *testExpr  =  arlAPtr->createRangeTestExpr(comp(), arlBPtr, exitGotoBlock, _rangeTestIV, trace());
          if (testExpr && performTransformation(comp(), "%sAdding test [%p] to refine aliases for loop %d\n", 
                                            optDetailString(),
                                            testExpr, _currentNaturalLoop->getNumber()))
             {
             comparisonTrees->add(testExpr);
+            TR::DebugCounter::incStaticDebugCounter(comp(), TR::DebugCounter::debugCounterName(comp(), "loopAliasRefiner/versioned/%s/(%s)",
+                                                                                               testExpr->getFirstChild()->getOpCodeValue() == TR::acmpeq ? "identity" : "overlap",
+                                                                                               comp()->signature()));
             }
          }
       }
@@ -371,6 +506,11 @@ TR_LoopAliasRefiner::refineArrayAliases(TR_RegionStructure *whileLoop)
    ListIterator<ArrayRangeLimits> arIterator(_arrayRanges);
    TR_ScratchList<TR::SymbolReference> newShadowList(trMemory());
 
+   if (_arrayRanges)
+      TR::DebugCounter::prependDebugCounter(comp(),
+                                           TR::DebugCounter::debugCounterName(comp(), "loopAliasRefiner/fastIterations/(%s)", comp()->signature()),
+                                           whileLoop->getEntryBlock()->getFirstRealTreeTop());
+
    for (ArrayRangeLimits *arlPtr = arIterator.getFirst(); arlPtr; arlPtr = arIterator.getNext())
       {
       TR_ScratchList<TR_NodeParentBlockTuple> *list = arlPtr->getCandidateList();
@@ -431,10 +571,13 @@ TR_LoopAliasRefiner::refineArrayAliases(TR_RegionStructure *whileLoop)
  * Create a conditional branch based on the limits of current range vs other range.  The test should look like
  * if (a == b && (other.low <= this.high && this.low <= other.high)) goto unrefined loop
  *
- * Since ranges are not implemented we just do: if (a == b)
+ * When both arrays are only accessed at iv*scale + c for the primary induction variable iv, the ranges are
+ * [entry*scale + min, (limit + delta)*scale + end) bytes, since the body can see the iv one step past the
+ * exit bound.  They are disjoint whenever (limit - entry) <= k for a constant k, which gives the test
+ * if (a == b && (limit - entry) > k).  Otherwise we just do: if (a == b)
  */
 TR::Node *
-TR_LoopAliasRefiner::ArrayRangeLimits::createRangeTestExpr(TR::Compilation *comp, ArrayRangeLimits *other, TR::Block * targetBlock, bool trace)
+TR_LoopAliasRefiner::ArrayRangeLimits::createRangeTestExpr(TR::Compilation *comp, ArrayRangeLimits *other, TR::Block * targetBlock, TR_PrimaryInductionVariable *piv, bool trace)
    {
    TR::Node *nodeInfo  = getCandidateList()->getListHead()->getData()->_node;
    TR::Node *arrayA = NULL, *arrayB = NULL;
@@ -484,6 +627,28 @@ TR_LoopAliasRefiner::ArrayRangeLimits::createRangeTestExpr(TR::Compilation *comp
    if (isAliased)
       {
       addressTest = TR::Node::create(TR::acmpeq, 2, arrayA, arrayB);
+
+      int64_t maxDisjointTripCount = -1;
+      if (piv && hasLinearRange() && other->hasLinearRange() && _ivScale == other->_ivScale)
+         {
+         int64_t gap = std::max(other->_minOffset - _maxEnd, _minOffset - other->_maxEnd) - piv->getDeltaOnBackEdge() * _ivScale;
+         if (gap >= 0)
+            maxDisjointTripCount = gap / _ivScale;
+         }
+
+      if (maxDisjointTripCount >= 0)
+         {
+         TR::Node *distance = TR::Node::create(TR::lsub, 2,
+                                               TR::Node::create(TR::i2l, 1, piv->getExitBound()->duplicateTree()),
+                                               TR::Node::lconst(nodeInfo, piv->getEntryValue()->getInt()));
+         TR::Node *overlapTest = TR::Node::create(TR::lcmpgt, 2, distance, TR::Node::lconst(nodeInfo, maxDisjointTripCount));
+         addressTest = TR::Node::create(TR::iand, 2, addressTest, overlapTest);
+
+         if (trace)
+            traceMsg(comp, "ranges of #%d and #%d are disjoint for up to %lld iterations, overlap test %p\n",
+                     getBaseSymRef()->getReferenceNumber(), other->getBaseSymRef()->getReferenceNumber(),
+                     maxDisjointTripCount, overlapTest);
+         }
       ifNode = TR::Node::createif (TR::ificmpne, addressTest, TR::Node::iconst(nodeInfo, 0), targetBlock->getEntry());
       }
    return ifNode;
@@ -35,6 +35,7 @@
 #include "optimizer/OptimizationManager.hpp"
 
 class TR_InductionVariable;
+class TR_PrimaryInductionVariable;
 class TR_RegionStructure;
 namespace TR { class Block; }
 namespace TR { class Compilation; }
@@ -73,6 +74,16 @@ namespace TR { class TreeTop; }
  * is left unchanged (and therefore has the original conservative aliasing 
  * by virtue of all array accesses using the original array shadow symbol).
  * 
+ * When the arrays may be the same object, e.g. a loop copying between two array
+ * parameters, the accesses of each array are also matched against the primary
+ * induction variable of the loop.  If every access is of the form iv*scale + c,
+ * the byte range touched by each array over the whole loop is known up to the
+ * trip count and the test becomes if (a == b && (limit - entry) > k), where entry
+ * is the value of the induction variable on loop entry and k is the largest trip
+ * count for which the two ranges cannot overlap.  This lets loops
+ * such as a[i + d] = a[i] with a far enough apart still run the fast version.
+ * Debug counters under loopAliasRefiner/ record how often the fast version runs.
+ *
  * Thus, loop alias refiner acts as an enabler for later optimizations to 
  * take advantage of the transformations it does to refine the aliasing 
  * on array accesses inside loops.
@@ -95,6 +106,7 @@ class TR_LoopAliasRefiner: public TR_LoopVersioner
    void initAdditionalDataStructures();
    void refineArrayAliases(TR_RegionStructure *);
    bool hasMulShadowTypes(TR_ScratchList<TR_NodeParentBlockTuple> *candList);
+   bool getLinearOffset(TR::Node *node, TR::SymbolReference *ivSymRef, int64_t &scale, int64_t &offset);
 
    /* 
     * Used to represent expression trees in terms of IVs.
@@ -167,7 +179,8 @@ class TR_LoopAliasRefiner: public TR_LoopVersioner
 
       ArrayRangeLimits( TR_ScratchList<TR_NodeParentBlockTuple> *candList, TR::SymbolReference *baseSymRef, 
                         TR::SymbolReference *memberSymRef, TR::SymbolReference *arrayAccessSymRef):
-                        _arrayAddrRef(baseSymRef), _arrayDerefSym(memberSymRef), _candidateList(candList), _arrayAccessSymRef(arrayAccessSymRef) {}
+                        _arrayAddrRef(baseSymRef), _arrayDerefSym(memberSymRef), _candidateList(candList), _arrayAccessSymRef(arrayAccessSymRef),
+                        _hasLinearRange(false), _ivScale(0), _minOffset(0), _maxEnd(0) {}
 
       TR_ScratchList<TR_NodeParentBlockTuple> *getCandidateList() { return _candidateList;}
       TR::SymbolReference * getBaseSymRef() { return _arrayAddrRef; }
@@ -175,7 +188,20 @@ class TR_LoopAliasRefiner: public TR_LoopVersioner
       TR::SymbolReference * getArrayAccessSymRef() { return _arrayAccessSymRef; }
       TR::Node * getMinValueExpr() { return _minValue; }
       TR::Node *getMaxValueExpr() { return _maxValue;}
-      TR::Node *createRangeTestExpr(TR::Compilation *, ArrayRangeLimits *other, TR::Block *, bool trace);
+      TR::Node *createRangeTestExpr(TR::Compilation *, ArrayRangeLimits *other, TR::Block *, TR_PrimaryInductionVariable *, bool trace);
+
+      /*
+       * Record that every access of this array is at iv*scale + [minOffset, maxEnd)
+       * bytes from the array base, where iv is the primary induction variable of the loop.
+       */
+      void setLinearRange(int64_t scale, int64_t minOffset, int64_t maxEnd)
+         {
+         _hasLinearRange = true;
+         _ivScale = scale;
+         _minOffset = minOffset;
+         _maxEnd = maxEnd;
+         }
+      bool hasLinearRange() { return _hasLinearRange; }
 
       private:
       TR::SymbolReference * _arrayAddrRef;
@@ -187,6 +213,10 @@ class TR_LoopAliasRefiner: public TR_LoopVersioner
       TR::Node *_maxValue; 
       TR_ScratchList<TR_NodeParentBlockTuple> *_candidateList;
       TR::SymbolReference * _arrayAccessSymRef;
+      bool                  _hasLinearRange;
+      int64_t               _ivScale;
+      int64_t               _minOffset;
+      int64_t               _maxEnd;
       };
 
    class CanonicalDimension 
@@ -235,6 +265,7 @@ class TR_LoopAliasRefiner: public TR_LoopVersioner
    TR_ScratchList<ArrayRangeLimits>   *_arrayRanges;
    TR_ScratchList<TR::SymbolReference> *_independentArrays;
    TR_BitVector                       *_processedLoops;
+   TR_PrimaryInductionVariable        *_rangeTestIV;
    bool                                _supportArrayMembers;
 
    };
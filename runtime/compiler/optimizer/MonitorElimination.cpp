@@ -1156,7 +1156,42 @@ TR::SymbolReference* TR::MonitorElimination::createAndInsertTMRetryCounter(TR_Ac
    return tempSymRef;
    }
 
-TR_Array<TR::Block *>* TR::MonitorElimination::createFailHandlerBlocks(TR_ActiveMonitor *monitor, TR::SymbolReference *tempSymRef, TR::Block *monitorblock, TR::Block *tstartblock)
+// Creates a counter, shared by every execution of one elided monitor, of the transactions that aborted.
+// Once the counter reaches tleAbortThreshold the site stops starting transactions and always takes the
+// monitor. Only aborts are counted: counting the attempts as well would add a store to shared memory
+// on the path that is meant to avoid touching the lock word.
+//
+// Returns NULL when the site should elide unconditionally.
+TR::SymbolReference* TR::MonitorElimination::createTMAbortCounter()
+   {
+   // the counter lives in this JVM's persistent memory, so its address cannot be baked into
+   // relocatable code or into code compiled by a remote server
+   if (TR::Options::_tleAbortThreshold <= 0 ||
+       comp()->compileRelocatableCode() ||
+       comp()->isOutOfProcessCompilation())
+      return NULL;
+
+   int32_t *abortCounter = (int32_t *)comp()->jitPersistentAlloc(sizeof(int32_t));
+   if (!abortCounter)
+      return NULL;
+   *abortCounter = 0;
+
+   TR::SymbolReference *abortCounterSymRef = comp()->getSymRefTab()->createKnownStaticDataSymbolRef(abortCounter, TR::Int32);
+   traceMsg(comp(),"Created abortCounterSymRef (%p) for abort counter at %p\n",abortCounterSymRef,abortCounter);
+   return abortCounterSymRef;
+   }
+
+static TR::TreeTop *createIncrementTree(TR::Compilation *comp, TR::Node *node, TR::SymbolReference *symRef)
+   {
+   TR::Node *incNode = TR::Node::createWithSymRef(TR::istore, 1, 1,
+                        TR::Node::create(TR::iadd, 2,
+                           TR::Node::createWithSymRef(node, TR::iload, 0, symRef),
+                           TR::Node::create(node, TR::iconst, 0, 1))
+                      , symRef);
+   return TR::TreeTop::create(comp, incNode, NULL, NULL);
+   }
+
+TR_Array<TR::Block *>* TR::MonitorElimination::createFailHandlerBlocks(TR_ActiveMonitor *monitor, TR::SymbolReference *tempSymRef, TR::SymbolReference *abortCounterSymRef, TR::Block *monitorblock, TR::Block *tstartblock)
    {
 
    //This array is used to store the first block and the last block of the fail handler. (In order)  THe rest of the handler should be self contained
@@ -1170,6 +1205,8 @@ TR_Array<TR::Block *>* TR::MonitorElimination::createFailHandlerBlocks(TR_Active
 
    TR::Block *persistfhBlock = TR::Block::createEmptyBlock(monitor->getMonitorNode(), comp(), 6);
    persistfhBlock->append(TR::TreeTop::create(comp(), resetTempNode, NULL, NULL));
+   if (abortCounterSymRef)
+      persistfhBlock->append(createIncrementTree(comp(), monitor->getMonitorNode(), abortCounterSymRef));
 
 
    // New logic. I'm adding a goto at the end of the persistent fail block to point directly to the monitor block.  This should allow induction variable analysis to exclude the setting of the temp=0 from the loop, and make it a counted loop.
@@ -1197,6 +1234,8 @@ TR_Array<TR::Block *>* TR::MonitorElimination::createFailHandlerBlocks(TR_Active
                       , tempSymRef);
 
    check1->append(TR::TreeTop::create(comp(), subtree, NULL, NULL));
+   if (abortCounterSymRef)
+      check1->append(createIncrementTree(comp(), monitor->getMonitorNode(), abortCounterSymRef));
 
    //join the first block to the second
 
@@ -1483,6 +1522,7 @@ void TR::MonitorElimination::transformMonitorsIntoTMRegions()
 
       //Part 1: Create Temporary
       TR::SymbolReference *tempSymRef = createAndInsertTMRetryCounter(monitor);
+      TR::SymbolReference *abortCounterSymRef = createTMAbortCounter();
 
 
       //Part 2: split the monitor block at the spot of the monitor. in the first half of the block, append a goto to the second half of the block.  insert the fail handler block in between these two.
@@ -1525,7 +1565,37 @@ void TR::MonitorElimination::transformMonitorsIntoTMRegions()
       debugTrace(tracer(),"tpohalfmonitorblock = %d(%p)\n",tophalfmonitorblock->getNumber(),tophalfmonitorblock);
 
       //Part 3: Create FH Block
-      TR_Array<TR::Block *> *fhBlocks = createFailHandlerBlocks(monitor,tempSymRef,monitorblock,tstartblock);
+      TR_Array<TR::Block *> *fhBlocks = createFailHandlerBlocks(monitor,tempSymRef,abortCounterSymRef,monitorblock,tstartblock);
+
+      //Part 3b: Create the abort threshold check.  Once the site has aborted too often, skip the transaction, clear the
+      //temporary so that the exits release the monitor, and fall through to the monitor block
+      TR::Block *abortCheckBlock = NULL;
+      TR::Block *bypassBlock = NULL;
+      if (abortCounterSymRef)
+         {
+         TR::Node *abortCheckNode = TR::Node::createif(TR::ificmplt,
+                                       TR::Node::createWithSymRef(monitor->getMonitorNode(), TR::iload, 0, abortCounterSymRef),
+                                       TR::Node::create(monitor->getMonitorNode(), TR::iconst, 0, TR::Options::_tleAbortThreshold),
+                                       tstartblock->getEntry());
+         abortCheckNode->setByteCodeInfo(monitor->getMonitorNode()->getByteCodeInfo());
+
+         abortCheckBlock = TR::Block::createEmptyBlock(monitor->getMonitorNode(), comp(), tophalfmonitorblock->getFrequency());
+         abortCheckBlock->append(TR::TreeTop::create(comp(), abortCheckNode, NULL, NULL));
+
+         TR::Node *clearTempNode = TR::Node::createWithSymRef(TR::istore, 1, 1, TR::Node::create(monitor->getMonitorNode(), TR::iconst, 0, 0), tempSymRef);
+         bypassBlock = TR::Block::createEmptyBlock(monitor->getMonitorNode(), comp(), 6);
+         bypassBlock->append(TR::TreeTop::create(comp(), clearTempNode, NULL, NULL));
+         abortCheckBlock->getExit()->join(bypassBlock->getEntry());
+
+         cfg->addNode(abortCheckBlock);
+         cfg->addNode(bypassBlock);
+         cfg->addEdge(abortCheckBlock,tstartblock);
+         cfg->addEdge(abortCheckBlock,bypassBlock);
+         cfg->addEdge(bypassBlock,monitorblock);
+
+         debugTrace(tracer(),"abortCheckBlock = %d(%p) bypassBlock = %d(%p)\n",abortCheckBlock->getNumber(),abortCheckBlock,bypassBlock->getNumber(),bypassBlock);
+         }
+      TR::Block *transactionEntryBlock = abortCheckBlock ? abortCheckBlock : tstartblock;
 
       monitorblock->getEntry()->getPrevTreeTop()->join(tstartblock->getEntry());
       tstartblock->getExit()->join(monitorblock->getExit()->getNextTreeTop());
@@ -1535,7 +1605,7 @@ void TR::MonitorElimination::transformMonitorsIntoTMRegions()
       TR::TreeTop *test1 = comp()->getMethodSymbol()->getLastTreeTop();  //seeing if we get past this point
       traceMsg(comp(),"test1 =%p\n",test1);
 
-      tophalfmonitorblock->append(TR::TreeTop::create(comp(),TR::Node::create(monitor->getMonitorNode(),TR::Goto,0,tstartblock->getEntry())));
+      tophalfmonitorblock->append(TR::TreeTop::create(comp(),TR::Node::create(monitor->getMonitorNode(),TR::Goto,0,transactionEntryBlock->getEntry())));
       //Insert the fail handler
       tstartblock->getEntry()->getPrevTreeTop()->join((*fhBlocks)[0]->getEntry());
       (*fhBlocks)[2]->getExit()->join(tstartblock->getEntry());
@@ -1554,7 +1624,15 @@ void TR::MonitorElimination::transformMonitorsIntoTMRegions()
       test1 = comp()->getMethodSymbol()->getLastTreeTop();  //seeing if we get past this point
       debugTrace(tracer(),"test1 =%p\n",test1);
 
-      comp()->getMethodSymbol()->getLastTreeTop()->join(monitorblock->getEntry());
+      if (abortCheckBlock)
+         {
+         comp()->getMethodSymbol()->getLastTreeTop()->join(abortCheckBlock->getEntry());
+         bypassBlock->getExit()->join(monitorblock->getEntry());
+         }
+      else
+         {
+         comp()->getMethodSymbol()->getLastTreeTop()->join(monitorblock->getEntry());
+         }
       //swap the duplicate monitor node for a tstart. set the branch destination of hte tstart to the fail handler
 
 
@@ -1580,7 +1658,7 @@ void TR::MonitorElimination::transformMonitorsIntoTMRegions()
 
       //CFG Modifications -- recall that removeEdge hides complex code under its seemingly simple name, and must be done last
 
-      cfg->addEdge(tophalfmonitorblock,tstartblock);
+      cfg->addEdge(tophalfmonitorblock,transactionEntryBlock);
       cfg->addEdge(tstartblock,critSectStart);
       cfg->removeEdge(tophalfmonitorblock,monitorblock);
 
@@ -176,8 +176,9 @@ class MonitorElimination : public TR::Optimization
    TR_ActiveMonitor * findActiveMonitor(TR::TreeTop *tt);
    bool hasMultipleEntriesWithSameExit(TR_ActiveMonitor *monitor);
 
-   TR_Array<TR::Block *>* createFailHandlerBlocks(TR_ActiveMonitor *monitor, TR::SymbolReference *tempSymRef, TR::Block *monitorBlock, TR::Block *tstartblock);
+   TR_Array<TR::Block *>* createFailHandlerBlocks(TR_ActiveMonitor *monitor, TR::SymbolReference *tempSymRef, TR::SymbolReference *abortCounterSymRef, TR::Block *monitorBlock, TR::Block *tstartblock);
    TR::SymbolReference *createAndInsertTMRetryCounter(TR_ActiveMonitor *monitor);
+   TR::SymbolReference *createTMAbortCounter();
 
    void resetReadMonitors(int32_t);
    bool tagReadMonitors();
@@ -1202,10 +1202,12 @@ void TR_NewInitialization::escapeToUserCode(Candidate *c, TR::Node *cause)
       }
    }
 
-void TR_NewInitialization::escapeToUserCodeAllCandidates(TR::Node *cause, bool onlyArrays)
+void TR_NewInitialization::escapeToUserCodeAllCandidates(TR::Node *cause, bool onlyArrays, Candidate *exclude)
    {
    for (Candidate *c = _firstActiveCandidate; c; c = c->getNext())
       {
+      if (c == exclude)
+         continue;
       if (!onlyArrays ||
           (c->node->getOpCodeValue() == TR::newarray ||
            c->node->getOpCodeValue() == TR::anewarray))
@@ -1287,14 +1289,86 @@ void TR_NewInitialization::escapeViaCall(TR::Node *callNode)
    escapeToGC(callNode);
    }
 
+TR_NewInitialization::Candidate *TR_NewInitialization::initializeViaArrayCopy(TR::Node *arrayCopyNode)
+   {
+   // Recognize an arraycopy of a constant length into a constant offset of a
+   // primitive array candidate, e.g. the copy following the allocation in
+   // Arrays.copyOf, and treat the bytes it covers as explicitly initialized
+   // so that only the rest of the array has to be zeroed.
+   // Children are either (srcAddr, dstAddr, copyLen) or
+   // (srcObj, dstObj, srcAddr, dstAddr, copyLen).
+   //
+   int32_t numChildren = arrayCopyNode->getNumChildren();
+   if (numChildren != 3 && numChildren != 5)
+      return NULL;
+
+   TR::Node *dstAddr = arrayCopyNode->getChild(numChildren == 5 ? 3 : 1);
+   TR::Node *lengthNode = arrayCopyNode->getLastChild();
+   if (!dstAddr->getOpCode().isArrayRef() ||
+       !dstAddr->getSecondChild()->getOpCode().isLoadConst() ||
+       !lengthNode->getOpCode().isLoadConst())
+      return NULL;
+
+   Candidate *c = findCandidateReference(dstAddr->getFirstChild());
+   if (!c ||
+       c->node->getOpCodeValue() != TR::newarray ||
+       c->canBeMerged ||
+       c->numInitializedBytes + c->numUninitializedBytes >= c->size)
+      return NULL;
+   if (numChildren == 5 && !isNewObject(arrayCopyNode->getSecondChild(), c))
+      return NULL;
+
+   // The source must provably not be this candidate, since the copy would
+   // then read the bytes it is about to initialize. A candidate that is not
+   // merged and not yet completely initialized has never been stored to the
+   // heap, so a source loaded from a field or a static cannot be it.
+   //
+   TR::Node *srcObj = arrayCopyNode->getFirstChild();
+   if (numChildren == 3 && srcObj->getOpCode().isArrayRef())
+      srcObj = srcObj->getFirstChild();
+   if (srcObj->getDataType() != TR::Address ||
+       !(srcObj->getOpCode().isLoadIndirect() ||
+         (srcObj->getOpCode().isLoadDirect() && srcObj->getSymbol()->isStatic())))
+      return NULL;
+   TR_ScratchList<TR::Node> seenNodes(trMemory());
+   if (findCandidateReferenceInSubTree(arrayCopyNode->getFirstChild(), &seenNodes))
+      return NULL;
+
+   int64_t offset = dstAddr->getSecondChild()->get64bitIntegralValue() - c->startOffset;
+   int64_t length = lengthNode->get64bitIntegralValue();
+   if (offset < 0 || length <= 0 || offset + length > c->size)
+      return NULL;
+
+   if (!performTransformation(comp(), "%s arraycopy [%p] initializes bytes %d-%d of candidate [%p]\n", OPT_DETAILS, arrayCopyNode, (int32_t)offset, (int32_t)(offset+length-1), c->node))
+      return NULL;
+
+   for (int32_t i = (int32_t)offset; i < (int32_t)(offset+length); ++i)
+      {
+      if (c->initializedBytes->get(i) || c->uninitializedBytes->get(i))
+         continue;
+      c->initializedBytes->set(i);
+      c->numInitializedBytes++;
+      }
+
+   if (trace())
+      traceMsg(comp(), "Node [%p]: Uninitialized %d Initialized %d\n", arrayCopyNode, c->numUninitializedBytes, c->numInitializedBytes);
+
+   setAffectedCandidate(c);
+   return c;
+   }
+
 void TR_NewInitialization::escapeViaArrayCopyOrArraySet(TR::Node *arrayCopyNode)
    {
    // array copies cause complete or incomplete initialization of candidates
    // determine which, parameters to array copy are:
    // (scrObj + hdrSize), dstObj + hdrSize), copyLen, [arrayType]
    //
-   // optimization would be to filter only the incomplete elements, for now
-   // treat as completely initialized
+   // A copy into a known part of a primitive array candidate initializes just
+   // that part; otherwise treat the candidates as completely initialized.
+   //
+   Candidate *copyTarget = NULL;
+   if (arrayCopyNode->getOpCodeValue() == TR::arraycopy)
+      copyTarget = initializeViaArrayCopy(arrayCopyNode);
 
    // For each candidate that can escape to the called method via argument,
    // completely initialize it.
@@ -1304,16 +1378,19 @@ void TR_NewInitialization::escapeViaArrayCopyOrArraySet(TR::Node *arrayCopyNode)
    if (c)
       escapeToUserCode(c, arrayCopyNode);
    else
-      escapeToUserCodeAllCandidates(arrayCopyNode, true);
+      escapeToUserCodeAllCandidates(arrayCopyNode, true, copyTarget);
 
    if (arrayCopyNode->getOpCodeValue() == TR::arraycopy)
       {
       seenNodes.deleteAll();
       c = findCandidateReferenceInSubTree(arrayCopyNode->getSecondChild(), &seenNodes);
       if (c)
-         escapeToUserCode(c, arrayCopyNode);
+         {
+         if (c != copyTarget)
+            escapeToUserCode(c, arrayCopyNode);
+         }
       else
-         escapeToUserCodeAllCandidates(arrayCopyNode, true);
+         escapeToUserCodeAllCandidates(arrayCopyNode, true, copyTarget);
       }
 
    // For all of the other active candidates, their reference fields must be
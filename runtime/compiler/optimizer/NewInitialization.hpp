@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2019 IBM Corp. and others
+ * Copyright (c) 2000, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -116,10 +116,11 @@ class TR_NewInitialization : public TR::Optimization
    bool     visitNode(TR::Node *node);
    void     setAffectedCandidate(Candidate *c);
    void     escapeToUserCode(Candidate *c, TR::Node *cause);
-   void     escapeToUserCodeAllCandidates(TR::Node *cause, bool onlyArrays = false);
+   void     escapeToUserCodeAllCandidates(TR::Node *cause, bool onlyArrays = false, Candidate *exclude = NULL);
    void     escapeToGC(Candidate *c, TR::Node *cause);
    void     escapeToGC(TR::Node *cause);
    void     escapeViaCall(TR::Node *callNode);
+   Candidate *initializeViaArrayCopy(TR::Node *arrayCopyNode);
    void     escapeViaArrayCopyOrArraySet(TR::Node *arrayCopyNode);
    void     findUninitializedWords();
 
@@ -125,6 +125,26 @@ int32_t TR_SPMDKernelParallelizer::getUnrollCount(TR::DataType dt)
    return unrollCount;
    }
 
+// The vector IL types are VECTOR_SIZE bytes wide. On hosts with wider vector units (e.g. AVX-512)
+// process more vectors per iteration of the simdized loop so that the independent vector
+// operations can keep the wider unit busy, unless the loop is too short for the residue left
+// to the scalar spill loop to be amortized.
+int32_t TR_SPMDKernelParallelizer::getVectorInterleaveCount(TR::Compilation *comp, int32_t vectorSize, int32_t iterationCount)
+   {
+   const int32_t defaultInterleaveCount = 4;
+   const int32_t maxInterleaveCount = 8;
+
+   int32_t interleaveCount = 2 * (comp->target().cpu.getMaxVectorLengthInBytes() / VECTOR_SIZE);
+   if (interleaveCount > maxInterleaveCount)
+      interleaveCount = maxInterleaveCount;
+
+   if (interleaveCount <= defaultInterleaveCount ||
+       (iterationCount > 0 && iterationCount < defaultInterleaveCount * interleaveCount * vectorSize))
+      return defaultInterleaveCount;
+
+   return interleaveCount;
+   }
+
 TR::Node * TR_SPMDKernelParallelizer::findLoopDataType(TR::Node* node, TR::Compilation *comp)
    {
    if(!node)
@@ -1428,7 +1448,7 @@ bool TR_SPMDKernelParallelizer::processSPMDKernelLoopForSIMDize(TR::Compilation
    else
       vectorSize = 8;
 
-   unrollCount = vectorSize * 4;
+   unrollCount = vectorSize * getVectorInterleaveCount(comp, vectorSize, piv->getIterationCount());
 
    TR_LoopUnroller unroller(comp, optimizer, loop, piv, TR_LoopUnroller::SPMDKernel, unrollCount-1, peelCount, invariantBlock, vectorSize);
 
@@ -243,6 +243,7 @@ class TR_SPMDKernelParallelizer : public TR_LoopTransformer
    int symbolicEvaluateTree(TR::Node *node);
 
    int32_t getUnrollCount(TR::DataType);
+   int32_t getVectorInterleaveCount(TR::Compilation *comp, int32_t vectorSize, int32_t iterationCount);
    TR::Node * findLoopDataType(TR::Node*, TR::Compilation *comp);
    void setLoopDataType(TR_RegionStructure *loop,TR::Compilation *comp);
    void genVectorAccessForScalar(TR::Node *parent, int32_t childIndex, TR::Node *node);
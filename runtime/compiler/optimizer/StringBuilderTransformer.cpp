@@ -141,7 +141,9 @@ int32_t TR_StringBuilderTransformer::performOnBlock(TR::Block* block)
                {
                List<TR_Pair<TR::Node*, TR::RecognizedMethod> > appendArguments (trMemory());
 
-               if (findStringBuilderChainedAppendArguments(iter, currentNode, appendArguments) != NULL)
+               TR::Node* toStringNode = findStringBuilderChainedAppendArguments(iter, currentNode, appendArguments);
+
+               if (toStringNode != NULL)
                   {
                   int32_t capacity = computeHeuristicStringBuilderInitCapacity(appendArguments);
 
@@ -174,13 +176,24 @@ int32_t TR_StringBuilderTransformer::performOnBlock(TR::Block* block)
                         }
                      else
                         {
+                        TR::Node* capacityNode = generateExactStringBuilderInitCapacity(iter, initNode, toStringNode, appendArguments);
+
+                        if (capacityNode != NULL)
+                           {
+                           TR::DebugCounter::incStaticDebugCounter(comp(), TR::DebugCounter::debugCounterName(comp(), "StringBuilderTransformer/Succeeded/Exact/%s", comp()->signature()));
+                           }
+                        else
+                           {
+                           capacityNode = TR::Node::iconst(capacity);
+                           }
+
                         TR::SymbolReference* newInitSymRef = getSymRefTab()->methodSymRefFromName(comp()->getMethodSymbol(), "java/lang/StringBuilder", "<init>", "(I)V", TR::MethodSymbol::Static);
 
                         TR::Node::recreateWithoutProperties(initNode, TR::call, 2, newInitSymRef);
 
                         initNode->setChild(0, currentNode);
 
-                        initNode->setAndIncChild(1, TR::Node::iconst(capacity));
+                        initNode->setAndIncChild(1, capacityNode);
                         }
 
                      TR::DebugCounter::incStaticDebugCounter(comp(), TR::DebugCounter::debugCounterName(comp(), "StringBuilderTransformer/Succeeded/%d/%s", capacity, comp()->signature()));
@@ -650,3 +663,203 @@ int32_t TR_StringBuilderTransformer::computeHeuristicStringBuilderInitCapacity(L
 
    return capacity;
    }
+
+/** \details
+ *     Exact char length of the decimal representation of \p value, as appended by StringBuilder.append(I) and
+ *     StringBuilder.append(J).
+ */
+static int32_t decimalLength(int64_t value)
+   {
+   int32_t length = value < 0 ? 2 : 1;
+
+   while ((value /= 10) != 0)
+      {
+      ++length;
+      }
+
+   return length;
+   }
+
+/** \details
+ *     The length is only computed when every append argument has a size that is either constant or is the length of
+ *     a String that can be loaded ahead of the chain, and at least one of them is not a compile time constant. A
+ *     String argument must be a constant String or a load of a local which is not redefined along the chain. The
+ *     following trees are generated before the StringBuilder.<init>() call for every such argument:
+ *
+ *     \code
+ *     n1n       treetop
+ *     n2n         acall  java/lang/String.valueOf(Ljava/lang/Object;)Ljava/lang/String;
+ *     n3n           aload  <argument>
+ *     n4n       treetop
+ *     n5n         icall  java/lang/String.lengthInternal()I
+ *     n2n           ==>acall
+ *     \endcode
+ *
+ *     String.valueOf(Ljava/lang/Object;) maps a null argument to "null" exactly as StringBuilder.append does. The
+ *     lengths are summed together with the constant lengths of the other arguments and the sum is clamped at zero so
+ *     that an overflow falls back to the StringBuilder growing its buffer as it does without this transformation.
+ */
+TR::Node* TR_StringBuilderTransformer::generateExactStringBuilderInitCapacity(TR::TreeTopIterator iter, TR::Node* initNode, TR::Node* toStringNode, List<TR_Pair<TR::Node*, TR::RecognizedMethod> >& appendArguments)
+   {
+   static const bool disableExactCapacity = feGetEnv("TR_StringBuilderTransformerDisableExactCapacity") != NULL;
+
+   // Skip the trees generated for postExecution OSR as the trees added ahead of the constructor call would need
+   // bookkeeping of their own
+   if (disableExactCapacity || comp()->isOSRTransitionTarget(TR::postExecutionOSR))
+      {
+      return NULL;
+      }
+
+   int32_t constantCapacity = 0;
+   int32_t numVariableStrings = 0;
+
+   ListIterator<TR_Pair<TR::Node*, TR::RecognizedMethod> > argumentIter(&appendArguments);
+
+   for (TR_Pair<TR::Node*, TR::RecognizedMethod>* pair = argumentIter.getFirst(); pair != NULL; pair = argumentIter.getNext())
+      {
+      TR::Node* argument = pair->getKey();
+
+      switch (pair->getValue())
+         {
+         case TR::java_lang_StringBuilder_append_bool:
+            {
+            if (argument->getOpCodeValue() != TR::iconst)
+               {
+               return NULL;
+               }
+
+            constantCapacity += argument->getInt() == 1 ? 4 : 5;
+            }
+            break;
+
+         case TR::java_lang_StringBuilder_append_char:
+            {
+            ++constantCapacity;
+            }
+            break;
+
+         case TR::java_lang_StringBuilder_append_int:
+            {
+            if (argument->getOpCodeValue() != TR::iconst)
+               {
+               return NULL;
+               }
+
+            constantCapacity += decimalLength(argument->getInt());
+            }
+            break;
+
+         case TR::java_lang_StringBuilder_append_long:
+            {
+            if (argument->getOpCodeValue() != TR::lconst)
+               {
+               return NULL;
+               }
+
+            constantCapacity += decimalLength(argument->getLongInt());
+            }
+            break;
+
+         case TR::java_lang_StringBuilder_append_String:
+            {
+            if (argument->getOpCodeValue() != TR::aload ||
+                argument->getSymbolReference()->isUnresolved() ||
+                !(argument->getSymbol()->isAutoOrParm() || argument->getSymbol()->isConstString()))
+               {
+               return NULL;
+               }
+
+            ++numVariableStrings;
+            }
+            break;
+
+         default:
+            {
+            // The length of the String representation of floating point values and arbitrary objects is not known
+            // ahead of the append
+            return NULL;
+            }
+         }
+      }
+
+   // The heuristic capacity is already exact
+   if (numVariableStrings == 0)
+      {
+      return NULL;
+      }
+
+   // Find the tree of the constructor call and make sure the locals we load ahead of the chain are not redefined
+   // before the chain terminates
+   while (iter != NULL && (iter.currentNode()->getNumChildren() == 0 || iter.currentNode()->getFirstChild() != initNode))
+      {
+      ++iter;
+      }
+
+   if (iter == NULL)
+      {
+      return NULL;
+      }
+
+   TR::TreeTop* initTreeTop = iter.currentTree();
+
+   for (; iter != NULL && (iter.currentNode()->getNumChildren() == 0 || iter.currentNode()->getFirstChild() != toStringNode); ++iter)
+      {
+      TR::Node* node = iter.currentNode();
+
+      if (node->getOpCode().isStoreDirect() && node->getSymbol()->isAutoOrParm())
+         {
+         for (TR_Pair<TR::Node*, TR::RecognizedMethod>* pair = argumentIter.getFirst(); pair != NULL; pair = argumentIter.getNext())
+            {
+            if (pair->getValue() == TR::java_lang_StringBuilder_append_String && pair->getKey()->getSymbol() == node->getSymbol())
+               {
+               if (trace())
+                  {
+                  traceMsg(comp(), "[0x%p] Append argument is redefined along the chain.\n", node);
+                  }
+
+               TR::DebugCounter::incStaticDebugCounter(comp(), TR::DebugCounter::debugCounterName(comp(), "StringBuilderTransformer/Failed/Exact/ArgumentRedefined/%s", comp()->signature()));
+
+               return NULL;
+               }
+            }
+         }
+      }
+
+   TR::SymbolReference* valueOfSymRef = getSymRefTab()->methodSymRefFromName(comp()->getMethodSymbol(), "java/lang/String", "valueOf", "(Ljava/lang/Object;)Ljava/lang/String;", TR::MethodSymbol::Static);
+   TR::SymbolReference* lengthInternalSymRef = getSymRefTab()->methodSymRefFromName(comp()->getMethodSymbol(), "java/lang/String", "lengthInternal", "()I", TR::MethodSymbol::Special);
+
+   if (valueOfSymRef == NULL || lengthInternalSymRef == NULL)
+      {
+      return NULL;
+      }
+
+   TR::Node* capacityNode = TR::Node::iconst(initNode, constantCapacity);
+
+   for (TR_Pair<TR::Node*, TR::RecognizedMethod>* pair = argumentIter.getFirst(); pair != NULL; pair = argumentIter.getNext())
+      {
+      if (pair->getValue() != TR::java_lang_StringBuilder_append_String)
+         {
+         continue;
+         }
+
+      TR::Node* argument = pair->getKey();
+
+      TR::Node* loadNode = TR::Node::createWithSymRef(initNode, TR::aload, 0, argument->getSymbolReference());
+      TR::Node* valueOfNode = TR::Node::createWithSymRef(initNode, TR::acall, 1, loadNode, valueOfSymRef);
+      TR::Node* lengthNode = TR::Node::createWithSymRef(initNode, TR::icall, 1, valueOfNode, lengthInternalSymRef);
+
+      initTreeTop->insertBefore(TR::TreeTop::create(comp(), TR::Node::create(initNode, TR::treetop, 1, valueOfNode)));
+      initTreeTop->insertBefore(TR::TreeTop::create(comp(), TR::Node::create(initNode, TR::treetop, 1, lengthNode)));
+
+      capacityNode = TR::Node::create(initNode, TR::iadd, 2, capacityNode, lengthNode);
+      }
+
+   capacityNode = TR::Node::create(initNode, TR::imax, 2, capacityNode, TR::Node::iconst(initNode, 0));
+
+   if (trace())
+      {
+      traceMsg(comp(), "[0x%p] Computing exact capacity of %d constant chars and %d Strings.\n", capacityNode, constantCapacity, numVariableStrings);
+      }
+
+   return capacityNode;
+   }
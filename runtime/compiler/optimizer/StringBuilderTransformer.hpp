@@ -68,6 +68,11 @@ namespace TR { class Block; }
  *     constructor call to an overloaded constructor call accepting an initial capacity which we computed at compile
  *     time. The end result is an overall reduction in the number of reallocations that the StringBuilder will perform.
  *
+ *     When the chain only appends Strings held in locals or constants alongside chars and constants, the size of the
+ *     final String is computed at runtime just ahead of the constructor call instead. The buffer of the StringBuilder
+ *     is then allocated once with the exact capacity and the appends copy directly into it. Because the buffer has no
+ *     unused capacity StringBuilder.toString() shares it with the resulting String rather than copying it.
+ *
  *     This optimization searches for these StringBuilder chained append calls followed by a toString and it
  *     heuristically tries to estimate the sizes of the append arguments. If it can the optimization will precisely
  *     determine the sizes of all constant append arguments.
@@ -227,6 +232,29 @@ class TR_StringBuilderTransformer : public TR::Optimization
     *     Heuristically calculated char length of the String that is the result of a call to StringBuilder.toString().
     */
    int32_t computeHeuristicStringBuilderInitCapacity(List<TR_Pair<TR::Node*, TR::RecognizedMethod> >& appendArguments);
+
+   /** \brief
+    *     Given a list of arguments of a sequence of chained StringBuilder.append(...) calls generates the computation
+    *     of the exact char length of the String that is the result of a call to StringBuilder.toString(), if that
+    *     length can be computed ahead of the chain.
+    *
+    *  \param iter
+    *     The iterator to begin searching for the tree of \p initNode from.
+    *
+    *  \param initNode
+    *     The call to StringBuilder.<init>() before which the length is to be computed.
+    *
+    *  \param toStringNode
+    *     The call to StringBuilder.toString() terminating the chain.
+    *
+    *  \param appendArguments
+    *     A list of arguments of a sequence of chained StringBuilder.append(...) calls.
+    *
+    *  \return
+    *     The node computing the exact char length, anchored before the tree of \p initNode, or NULL if the length
+    *     cannot be computed or is already known at compile time.
+    */
+   TR::Node* generateExactStringBuilderInitCapacity(TR::TreeTopIterator iter, TR::Node* initNode, TR::Node* toStringNode, List<TR_Pair<TR::Node*, TR::RecognizedMethod> >& appendArguments);
    };
 
 #endif
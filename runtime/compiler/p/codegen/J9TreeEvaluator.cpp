@@ -11279,6 +11279,7 @@ J9::Power::CodeGenerator::inlineDirectCall(TR::Node *node, TR::Register *&result
             }
          break;
 
+      case TR::jdk_internal_misc_Unsafe_setMemory0:
       case TR::sun_misc_Unsafe_setMemory:
          if (comp->canTransformUnsafeSetMemory())
             {
@@ -189,7 +189,7 @@ TR_PersistentClassInfo::removeUnloadedSubClasses()
        memset(_tables[i]._markedforDetachCount, 0, sizeof(uint32_t)*_tables[i]._spineArraySize);
        }
     _marked=0;
-    memset(_detachPending, 0, sizeof(bool)*LastAssumptionKind);
+    memset(_detachPending, 0, sizeof(uint32_t)*LastAssumptionKind);
     return true;
     }
 
@@ -390,7 +390,7 @@ void TR_RuntimeAssumptionTable::addAssumption(OMR::RuntimeAssumption *a, TR_Runt
 void TR_RuntimeAssumptionTable::markForDetachFromRAT(OMR::RuntimeAssumption *assumption)
    {
    TR_RatHT *hashTable = findAssumptionHashTable(assumption->getAssumptionKind());
-   _detachPending[assumption->getAssumptionKind()] = true;
+   _detachPending[assumption->getAssumptionKind()]++;
    hashTable->_markedforDetachCount[(assumption->hashCode() % hashTable->_spineArraySize)]++;
    assumption->markForDetach();
    _marked++;
@@ -401,7 +401,9 @@ void TR_RuntimeAssumptionTable::markForDetachFromRAT(OMR::RuntimeAssumption *ass
  * This assumes that the assumptions have already been detached from the 
  * metadata's linked list. Only RAT 'kinds' that have any marked assumptions
  * will be traversed, and only the hashtable linked-lists that have a non-zero 
- * marked for detach count will be traversed.
+ * marked for detach count will be traversed. The walk of a table stops as
+ * soon as its last marked assumption has been reclaimed so the
+ * assumptionTableMutex is not held while scanning the remaining buckets.
  */
 void TR_RuntimeAssumptionTable::reclaimMarkedAssumptionsFromRAT(int32_t cleanupCount)
    {
@@ -411,11 +413,10 @@ void TR_RuntimeAssumptionTable::reclaimMarkedAssumptionsFromRAT(int32_t cleanupC
    assumptionTableMutex->enter();
    for (int kind=0; _marked > 0 && cleanupCount != 0 && kind < LastAssumptionKind; kind++) // for each table
       {
-      if (_detachPending[kind] == true)  // Is there anything to remove from this table?
+      if (_detachPending[kind] > 0)  // Is there anything to remove from this table?
          {
          TR_RatHT *hashTable = _tables + kind;
-         bool fullyCleaned = true;
-         for (size_t i = 0; cleanupCount != 0 && i < hashTable->_spineArraySize; ++i) // for each bucket in the table
+         for (size_t i = 0; cleanupCount != 0 && _detachPending[kind] > 0 && i < hashTable->_spineArraySize; ++i) // for each bucket in the table
             {
             OMR::RuntimeAssumption *cursor, *next, *prev;
             // Look for linked list nodes to remove until all marked nodes have been deleted
@@ -439,6 +440,7 @@ void TR_RuntimeAssumptionTable::reclaimMarkedAssumptionsFromRAT(int32_t cleanupC
 
                   // Now release the assumption
                   hashTable->_markedforDetachCount[i]--;
+                  _detachPending[kind]--;
                   _marked--;
                   incReclaimedAssumptionCount(kind);
                   cursor->reclaim();
@@ -451,11 +453,7 @@ void TR_RuntimeAssumptionTable::reclaimMarkedAssumptionsFromRAT(int32_t cleanupC
                   prev = cursor;
                   }
                }
-            if (hashTable->_markedforDetachCount[i] != 0)
-               fullyCleaned = false;
             }
-         if (fullyCleaned)
-            _detachPending[kind] = false;
          }
       }
    assumptionTableMutex->exit();
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2020 IBM Corp. and others
+ * Copyright (c) 2000, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -28,6 +28,7 @@
 #include "control/Options_inlines.hpp"
 #include "env/VMJ9.h"
 #include "env/VerboseLog.hpp"
+#include "runtime/CodeCacheManager.hpp"
 
 //--------------------- DataCacheManager ----------------
 
@@ -145,6 +146,9 @@ TR_DataCacheManager::TR_DataCacheManager(J9JITConfig *jitConfig, TR::Monitor *mo
    ),
    _newImplementation(newImplementation),
    _worstFit(worstFit),
+   _numCoalescedAllocations(0),
+   _numReleasedCaches(0),
+   _releasedSegmentMemory(0),
    _sizeList(),
    _mutex(monitor)
    {
@@ -215,6 +219,49 @@ void TR_DataCacheManager::copyDataCacheAllocation(J9JITDataCacheHeader *dest, J9
    }
 
 
+//-------------------------- allocateHugePageSegment -------------------------
+// Allocate a data cache segment backed by the large page size chosen for the
+// code cache, or by transparent huge pages when that is the default page size
+// Parameters:
+//      segSize - size of the segment to allocate
+// Return value:
+//      Pointer to the allocated segment or NULL if the port library could not
+//      provide one; the caller falls back to a regular segment
+// Side effects:
+//      Must be called with the dataCacheManager mutex held
+//----------------------------------------------------------------------------
+J9MemorySegment *TR_DataCacheManager::allocateHugePageSegment(uint32_t segSize)
+   {
+   PORT_ACCESS_FROM_JITCONFIG(_jitConfig);
+   J9PortVmemParams vmemParams;
+   j9vmem_vmem_params_init(&vmemParams);
+
+   if (_jitConfig->largeCodePageSize > 0)
+      {
+      vmemParams.pageSize = _jitConfig->largeCodePageSize;
+      vmemParams.pageFlags = _jitConfig->largeCodePageFlags;
+      }
+   vmemParams.byteAmount = roundToMultiple<uintptr_t>(segSize, vmemParams.pageSize);
+   vmemParams.mode = J9PORT_VMEM_MEMORY_MODE_READ | J9PORT_VMEM_MEMORY_MODE_WRITE | J9PORT_VMEM_MEMORY_MODE_VIRTUAL | J9PORT_VMEM_MEMORY_MODE_COMMIT;
+   vmemParams.category = J9MEM_CATEGORY_JIT_DATA_CACHE;
+
+   J9MemorySegment *dataCacheSeg = _jitConfig->javaVM->internalVMFunctions->allocateVirtualMemorySegmentInList(
+      _jitConfig->javaVM, _jitConfig->dataCacheList, vmemParams.byteAmount, MEMORY_TYPE_RAM | MEMORY_TYPE_VIRTUAL, &vmemParams);
+   if (!dataCacheSeg)
+      return NULL;
+
+   uintptr_t pageSize = dataCacheSeg->vmemIdentifier.pageSize;
+   bool advisedHugePages = false;
+   if (pageSize == j9vmem_supported_page_sizes()[0])
+      advisedHugePages = TR::CodeCacheManager::adviseHugePages(dataCacheSeg->heapBase, dataCacheSeg->heapTop - dataCacheSeg->heapBase);
+   if (TR::Options::getVerboseOption(TR_VerboseCodeCache))
+      TR_VerboseLog::writeLineLocked(TR_Vlog_CODECACHE, "data cache segment %p-%p uses %u byte pages%s",
+                                     dataCacheSeg->heapBase, dataCacheSeg->heapTop, (uint32_t)pageSize,
+                                     advisedHugePages ? ", transparent huge pages requested" : "");
+   return dataCacheSeg;
+   }
+
+
 //-------------------------- allocateNewDataCache ----------------------------
 // If allowed, allocate a new dataCache segment and register it with the VM
 // Should not be called directly by code outside TR_DataCache class
@@ -251,7 +298,10 @@ TR_DataCache* TR_DataCacheManager::allocateNewDataCache(uint32_t minimumSize)
             J9MemorySegment *dataCacheSeg = NULL;
                {
                OMR::CriticalSection criticalSection(_mutex);
-               dataCacheSeg = _jitConfig->javaVM->internalVMFunctions->allocateMemorySegmentInList(_jitConfig->javaVM, _jitConfig->dataCacheList, segSize, MEMORY_TYPE_RAM, J9MEM_CATEGORY_JIT_DATA_CACHE);
+               if (TR::Options::_hugePageCaches)
+                  dataCacheSeg = allocateHugePageSegment(segSize);
+               if (!dataCacheSeg)
+                  dataCacheSeg = _jitConfig->javaVM->internalVMFunctions->allocateMemorySegmentInList(_jitConfig->javaVM, _jitConfig->dataCacheList, segSize, MEMORY_TYPE_RAM, J9MEM_CATEGORY_JIT_DATA_CACHE);
                if (dataCacheSeg)
                   _jitConfig->dataCache = dataCacheSeg; // for maximum compatibility with the old implementation
                }
@@ -779,6 +829,169 @@ TR_DataCacheManager::getFromPool(uint32_t size)
    return ret;
    }
 
+// Unlink the given allocation from its size bucket. The bucket is left in the
+// size list even if it becomes empty; releaseEmptySizeBuckets() frees it later.
+void
+TR_DataCacheManager::removeFromPool(TR_DataCacheManager::Allocation *alloc)
+   {
+   alloc->getListElement()->remove();
+   removeHook(alloc->size());
+   }
+
+
+// Free the size buckets that no longer hold any allocation.
+void
+TR_DataCacheManager::releaseEmptySizeBuckets()
+   {
+   InPlaceList<SizeBucket>::Iterator it = _sizeList.begin();
+   while (it != _sizeList.end())
+      {
+      if (it->isEmpty())
+         {
+         SizeBucket *sb = &(*it);
+         it = _sizeList.remove(it);
+         freeMemoryToVM(sb);
+         }
+      else
+         {
+         ++it;
+         }
+      }
+   }
+
+
+//----------------------------- coalesceFreeAllocations ----------------------
+// Walk the segments that were handed over to the pool and merge runs of
+// adjacent free allocations into a single allocation. A segment that becomes
+// entirely free is given back to the VM.
+// Segments are walkable because every record starts with a J9JITDataCacheHeader
+// holding its size. Only caches in _cachesInPool are visited; those are never
+// reserved by a compilation thread, so their heapAlloc does not move.
+// Free allocations are first collected into an array sorted by address, so that
+// membership in the pool is checked by binary search, and only allocations with
+// a free neighbour (or spanning a whole segment) are taken out of their buckets.
+// Side effects:
+//       Acquires/releases dataCache mutex internally
+//----------------------------------------------------------------------------
+void
+TR_DataCacheManager::coalesceFreeAllocations()
+   {
+   if (!_newImplementation || TR::Options::getCmdLineOptions()->getOption(TR_DisableDataCacheReclamation))
+      return;
+
+   OMR::CriticalSection criticalSection(_mutex);
+   if (!_cachesInPool)
+      return;
+
+   size_t numFree = 0;
+   for (InPlaceList<SizeBucket>::Iterator sb = _sizeList.begin(); sb != _sizeList.end(); ++sb)
+      for (InPlaceList<Allocation>::Iterator it = sb->_allocations.begin(); it != sb->_allocations.end(); ++it)
+         numFree++;
+   if (numFree == 0)
+      return;
+
+   Allocation **freeAllocations = static_cast<Allocation **>(allocateMemoryFromVM(numFree * sizeof(Allocation *)));
+   if (!freeAllocations)
+      return;
+   Allocation **freeEnd = freeAllocations;
+   for (InPlaceList<SizeBucket>::Iterator sb = _sizeList.begin(); sb != _sizeList.end(); ++sb)
+      for (InPlaceList<Allocation>::Iterator it = sb->_allocations.begin(); it != sb->_allocations.end(); ++it)
+         *freeEnd++ = &(*it);
+   std::sort(freeAllocations, freeEnd);
+
+   TR_DataCache *prev = NULL;
+   TR_DataCache *dataCache = _cachesInPool;
+   while (dataCache)
+      {
+      TR_DataCache *next = dataCache->_next;
+      uint8_t *start = dataCache->_segment->heapBase;
+      uint8_t *end = dataCache->_segment->heapAlloc;
+      uint8_t *current = start;
+      bool segmentIsFree = false;
+      while (current < end)
+         {
+         Allocation *alloc = static_cast<Allocation *>(static_cast<void *>(current));
+         TR_ASSERT_FATAL(alloc->size() != 0, "Data cache record at %p has a size of 0", current);
+         uint8_t *following = current + alloc->size();
+         if (std::binary_search(freeAllocations, freeEnd, alloc))
+            {
+            Allocation *neighbour = static_cast<Allocation *>(static_cast<void *>(following));
+            if (current == start && following == end)
+               {
+               removeFromPool(alloc);
+               segmentIsFree = true;
+               break;
+               }
+            if (following < end && std::binary_search(freeAllocations, freeEnd, neighbour))
+               {
+               removeFromPool(alloc);
+               do
+                  {
+                  removeFromPool(neighbour);
+                  alloc->merge(neighbour);
+                  following += neighbour->size();
+                  neighbour = static_cast<Allocation *>(static_cast<void *>(following));
+                  _numCoalescedAllocations++;
+                  }
+               while (following < end && std::binary_search(freeAllocations, freeEnd, neighbour));
+
+               if (current == start && following == end)
+                  {
+                  segmentIsFree = true;
+                  break;
+                  }
+               addToPool(alloc);
+               }
+            }
+         current = following;
+         }
+
+      if (segmentIsFree)
+         {
+         if (prev)
+            prev->_next = next;
+         else
+            _cachesInPool = next;
+         releaseDataCache(dataCache);
+         }
+      else
+         {
+         prev = dataCache;
+         }
+      dataCache = next;
+      }
+
+   freeMemoryToVM(freeAllocations);
+   releaseEmptySizeBuckets();
+   }
+
+
+// Give the segment of a data cache that no longer holds any live record back
+// to the VM. Must be called with the dataCache mutex held, after the cache was
+// unlinked from its list and its space taken out of the pool.
+void
+TR_DataCacheManager::releaseDataCache(TR_DataCache *dataCache)
+   {
+   PORT_ACCESS_FROM_JITCONFIG(_jitConfig);
+   J9MemorySegment *segment = dataCache->_segment;
+   UDATA segmentSize = segment->heapTop - segment->heapBase;
+   shrinkHook(segment->heapAlloc - segment->heapBase);
+   _numAllocatedCaches--;
+   _totalSegmentMemoryAllocated -= segmentSize;
+   _numReleasedCaches++;
+   _releasedSegmentMemory += segmentSize;
+   if (TR::Options::getVerboseOption(TR_VerboseReclamation))
+      {
+      TR_VerboseLog::writeLineLocked(TR_Vlog_RECLAMATION, "Releasing free data cache segment %p-%p", segment->heapBase, segment->heapTop);
+      }
+   dataCache->~TR_DataCache();
+   j9mem_free_memory(dataCache);
+   _jitConfig->javaVM->internalVMFunctions->freeMemorySegment(_jitConfig->javaVM, segment, true);
+   if (_jitConfig->dataCache == segment)
+      _jitConfig->dataCache = _jitConfig->dataCacheList->nextSegment;
+   }
+
+
 void
 TR_DataCacheManager::convertDataCachesToAllocations()
    {
@@ -878,6 +1091,10 @@ void TR_DataCacheManager::removeHook( UDATA allocationSize )
    {
    }
 
+void TR_DataCacheManager::shrinkHook( UDATA allocationSize )
+   {
+   }
+
 void
 TR_DataCacheManager::printStatistics()
    {
@@ -1001,6 +1218,13 @@ TR_InstrumentedDataCacheManager::removeHook(UDATA allocationSize)
    _bytesInPool -= allocationSize;
    }
 
+void
+TR_InstrumentedDataCacheManager::shrinkHook(UDATA bytesRemoved)
+   {
+   _jitSpace -= bytesRemoved;
+   _freeSpace -= bytesRemoved;
+   }
+
 void
 TR_InstrumentedDataCacheManager::printStatistics()
    {
@@ -1021,6 +1245,8 @@ TR_InstrumentedDataCacheManager::printStatistics()
    fprintf(stderr, "Loss Error = %zu\n", _bytesInPool - calculatePoolSize());
    fprintf(stderr, "Free Space = %zu\n",  _freeSpace);
    fprintf(stderr, "Bytes in pool = %zu\n", _bytesInPool);
+   fprintf(stderr, "Coalesced allocations = %u\n", getNumCoalescedAllocations());
+   fprintf(stderr, "Released segments = %u (%zu bytes)\n", getNumReleasedCaches(), getReleasedSegmentMemory());
    _allocationStatistics.report(stderr);
    _wasteStatistics.report(stderr);
    printPoolContents();
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2019 IBM Corp. and others
+ * Copyright (c) 2000, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -274,6 +274,7 @@ protected:
             }
          uint32_t size() { return _header.size; }
          Allocation *split ( uint32_t size );
+         void merge(Allocation *next) { _header.size += next->size(); }
          InPlaceList<Allocation>::ListElement *getListElement() { return &_listElement; }
          void *getBuffer() { return static_cast<void *>(&_listElement); }
          void prepareForUse() { _header.type = J9_JIT_DCE_IN_USE; }
@@ -289,6 +290,7 @@ protected:
       InPlaceList<Allocation> _allocations;
    public:
       friend class TR_DebugExt;
+      friend class TR_DataCacheManager;
       void *operator new (size_t size, void *ptr) { return ptr; }
       SizeBucket():
       _listElement(this),
@@ -338,13 +340,22 @@ private:
    const bool _newImplementation;
    const bool _worstFit;
 
+   // Reclamation of free space after class unloading
+   uint32_t _numCoalescedAllocations;
+   uint32_t _numReleasedCaches;
+   UDATA _releasedSegmentMemory;
+
    TR_DataCache *allocateNewDataCache(uint32_t minimumSize);
+   J9MemorySegment *allocateHugePageSegment(uint32_t segSize);
    uint8_t *allocateDataCacheSpace(uint32_t size); // Made private for data cache reclamation.
    void freeDataCacheList(TR_DataCache *& head);
 
    // Added as part of data cache reclamation
    void addToPool(Allocation *);
    Allocation *getFromPool(uint32_t size);
+   void removeFromPool(Allocation *alloc);
+   void releaseEmptySizeBuckets();
+   void releaseDataCache(TR_DataCache *dataCache);
    Allocation *convertDataCacheToAllocation(TR_DataCache *dataCache);
    void *allocateMemoryFromVM(size_t size);
    void freeMemoryToVM(void *ptr);
@@ -368,6 +379,7 @@ protected:
    virtual void freeHook( UDATA allocationSize );
    virtual void insertHook( UDATA allocationSize );
    virtual void removeHook( UDATA allocationSize );
+   virtual void shrinkHook( UDATA allocationSize );
 
    InPlaceList<SizeBucket> _sizeList;
    TR::Monitor       *_mutex;     // to add/remove from activeDataCacheList
@@ -395,6 +407,11 @@ public:
       {
       convertDataCachesToAllocations();
       }
+   void coalesceFreeAllocations();
+   uint32_t getNumCoalescedAllocations() const { return _numCoalescedAllocations; }
+   uint32_t getNumReleasedCaches() const { return _numReleasedCaches; }
+   UDATA getReleasedSegmentMemory() const { return _releasedSegmentMemory; }
+   int32_t getNumAllocatedCaches() const { return _numAllocatedCaches; }
 
    virtual void printStatistics();
 
@@ -432,6 +449,7 @@ protected:
    virtual void freeHook( UDATA allocationSize );
    virtual void insertHook( UDATA allocationSize );
    virtual void removeHook( UDATA allocationSize );
+   virtual void shrinkHook( UDATA allocationSize );
    virtual ~TR_InstrumentedDataCacheManager();
 
 private:
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2020 IBM Corp. and others
+ * Copyright (c) 2000, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -1587,6 +1587,9 @@ estimateGPU(CudaInfo *cudaInfo, int ptxSourceID, uint8_t *startPC, int lambdaCos
    int trace = cudaInfo->tracing;
    int dataCost = (cudaInfo->regionType == TR::CodeGenerator::naturalLoopScope) ? 0 : dataSize;
 
+   static int gpuMinRange = feGetEnv("TR_GPUMinRange") ? atoi(feGetEnv("TR_GPUMinRange")) : 1024;
+   static int gpuMaxDataCostRatio = feGetEnv("TR_GPUMaxDataCostRatio") ? atoi(feGetEnv("TR_GPUMaxDataCostRatio")) : 80;
+
    if (trace > 0)
       {
       GpuMetaData* gpuMetaData = getGPUMetaData(startPC);
@@ -1599,11 +1602,11 @@ estimateGPU(CudaInfo *cudaInfo, int ptxSourceID, uint8_t *startPC, int lambdaCos
 
    if (trace > 1)
       {
-      TR_VerboseLog::writeLine(TR_Vlog_GPU, "\tforEach in %s at line %d has lambdaCost %d dataCost %d range %lld ratio %d", methodSignature, lineNumber, lambdaCost, dataCost, range, dataCost/range);
+      TR_VerboseLog::writeLine(TR_Vlog_GPU, "\tforEach in %s at line %d has lambdaCost %d dataCost %d range %lld ratio %d", methodSignature, lineNumber, lambdaCost, dataCost, range, (range > 0) ? (int)(dataCost/range) : 0);
       }
 
-
-   bool directToCPU = ((cudaInfo->availableMemory < (unsigned long long)dataSize) || lambdaCost == 0 || dataCost/range > 80 || range < 1024);
+   // check the range first, an empty or tiny range is never worth a transfer and must not be divided by
+   bool directToCPU = (range < gpuMinRange || range <= 0 || (cudaInfo->availableMemory < (unsigned long long)dataSize) || lambdaCost == 0 || dataCost/range > gpuMaxDataCostRatio);
 
    if (directToCPU)
       {
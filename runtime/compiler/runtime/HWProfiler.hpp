@@ -56,6 +56,11 @@
 #define IS_THREAD_RI_ENABLED(vmThread) false
 #endif
 
+/* Linux x86-64 and AArch64 drive HW profiling through perf_event sampling */
+#if defined(J9VM_JIT_RUNTIME_INSTRUMENTATION) && defined(LINUX) && ((defined(TR_HOST_X86) && defined(TR_HOST_64BIT)) || defined(TR_HOST_ARM64))
+#define TR_PERF_EVENT_HW_PROFILER
+#endif
+
 class TR_OpaqueMethodBlock;
 namespace TR { class Monitor; }
 
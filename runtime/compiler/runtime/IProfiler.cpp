@@ -38,6 +38,7 @@
 #include "rommeth.h"
 #include "vmaccess.h"
 #include "VMHelpers.hpp"
+#include "AtomicSupport.hpp"
 #include "control/Options.hpp"
 #include "control/Options_inlines.hpp"
 #include "compile/Compilation.hpp"
@@ -107,6 +108,11 @@ extern "C" int32_t getCount(J9ROMMethod *romMethod, TR::Options *optionsJIT, TR:
 
 static J9PortLibrary *staticPortLib = NULL;
 static uint32_t memoryConsumed = 0;
+// Breakdown of the bytecode hash table entries; info stats only
+static uint32_t numFourBytesEntries = 0;
+static uint32_t numEightWordsEntries = 0;
+static uint32_t numCallGraphEntries = 0;
+static uint32_t numMethodEntries = 0;
 
 
 
@@ -552,6 +558,21 @@ TR_IProfiler::getProfilerMemoryFootprint()
    return memoryConsumed;
    }
 
+void
+TR_IProfiler::printProfilerMemoryFootprint()
+   {
+   TR_VerboseLog::vlogAcquire();
+   TR_VerboseLog::writeLine(TR_Vlog_IPROFILER, "IProfiler memory footprint: %u KB", memoryConsumed >> 10);
+   TR_VerboseLog::writeLine(TR_Vlog_IPROFILER, "\tbytecode entries: %u four bytes (%u B), %u eight words (%u B), %u call graph (%u B)",
+      numFourBytesEntries, (uint32_t)sizeof(TR_IPBCDataFourBytes),
+      numEightWordsEntries, (uint32_t)sizeof(TR_IPBCDataEightWords),
+      numCallGraphEntries, (uint32_t)sizeof(TR_IPBCDataCallGraph));
+   TR_VerboseLog::writeLine(TR_Vlog_IPROFILER, "\tmethod entries: %u (%u B); bytecode hash table: %u KB",
+      numMethodEntries, (uint32_t)sizeof(TR_IPMethodHashTableEntry),
+      (uint32_t)((BC_HASH_TABLE_SIZE * sizeof(TR_IPBytecodeHashTableEntry *)) >> 10));
+   TR_VerboseLog::vlogRelease();
+   }
+
 void *
 TR_IProfiler::operator new (size_t size) throw()
    {
@@ -570,13 +591,21 @@ TR_IProfiler::allocate(J9JITConfig *jitConfig)
 TR_IProfiler::TR_IProfiler(J9JITConfig *jitConfig)
    : _isIProfilingEnabled(true),
      _valueProfileMethod(NULL), _lightHashTableMonitor(0), _allowedToGiveInlinedInformation(true),
-     _globalAllocationCount (0), _maxCallFrequency(0), _iprofilerThread(0), _iprofilerOSThread(NULL),
+     _globalAllocationCount (0), _maxCallFrequency(0), _numIProfilerThreads(0), _numActiveIProfilerThreads(1), _numIProfilerThreadsExited(0),
      _workingBufferTail(NULL), _numOutstandingBuffers(0), _numRequests(1), _numRequestsSkipped(0),
      _numRequestsHandedToIProfilerThread(0), _iprofilerThreadExitFlag(0), _iprofilerMonitor(NULL),
-     _crtProfilingBuffer(NULL), _iprofilerThreadAttachAttempted(false), _iprofilerNumRecords(0)
+     _numIProfilerThreadActivations(0), _iprofilerThreadStopRequested(false), _iprofilerThreadAttachAttempted(false),
+     _iprofilerNumRecords(0)
    {
    PORT_ACCESS_FROM_JITCONFIG(jitConfig);
 
+   memset(_workers, 0, sizeof(_workers));
+   for (int32_t i = 0; i < MAX_IPROFILER_THREADS; i++)
+      {
+      _workers[i]._iProfiler = this;
+      _workers[i]._id = i;
+      }
+
    _iprofilerBufferSize = (uint32_t)jitConfig->iprofilerBufferSize; //J9_PROFILING_BUFFER_SIZE;
    _portLib = jitConfig->javaVM->portLibrary;
    _vm = TR_J9VMBase::get(jitConfig, 0);
@@ -1066,21 +1095,53 @@ TR_IProfiler::findOrCreateEntry(int32_t bucket, uintptr_t pc, bool addIt)
    // Create a new hash table entry
    U_8 byteCode = *(U_8*) pc;
    if (isCompact(byteCode))
+      {
       entry = new TR_IPBCDataFourBytes(pc);
+      if (entry)
+         numFourBytesEntries++;
+      }
    else
       {
       if (isSwitch(byteCode))
+         {
          entry = new TR_IPBCDataEightWords(pc);
+         if (entry)
+            numEightWordsEntries++;
+         }
       else
+         {
          entry = new TR_IPBCDataCallGraph(pc);
+         if (entry)
+            numCallGraphEntries++;
+         }
       }
 
    if (!entry)
       return NULL;
 
-   entry->setNext(_bcHashTable[bucket]);
-   FLUSH_MEMORY(TR::Compiler->target.isSMP());
-   _bcHashTable[bucket] = entry;
+   // Readers walk the chains without taking any lock, so the new entry is published
+   // with a compare-and-swap on the bucket head. If another thread (IProfiler thread or
+   // compilation thread) chained entries in the meantime, only those need to be checked
+   // for a duplicate because entries are never unchained.
+   TR_IPBytecodeHashTableEntry *head = _bcHashTable[bucket];
+   while (true)
+      {
+      entry->setNext(head);
+      uintptr_t oldHead = VM_AtomicSupport::lockCompareExchange((volatile uintptr_t *)&_bcHashTable[bucket],
+                                                                (uintptr_t)head, (uintptr_t)entry);
+      if (oldHead == (uintptr_t)head)
+         break;
+
+      TR_IPBytecodeHashTableEntry *newHead = (TR_IPBytecodeHashTableEntry *)oldHead;
+      for (TR_IPBytecodeHashTableEntry *e = newHead; e != head; e = e->getNext())
+         {
+         // Lost the race for this pc; the unused entry cannot be returned to the
+         // aligned persistent allocation, but this only happens on concurrent inserts
+         if (e->getPC() == pc)
+            return e;
+         }
+      head = newHead;
+      }
 
    return entry;
    }
@@ -1144,16 +1205,42 @@ TR_IProfiler::findOrCreateMethodEntry(J9Method *callerMethod, J9Method *calleeMe
       entry = (TR_IPMethodHashTableEntry *)jitPersistentAlloc(sizeof(TR_IPMethodHashTableEntry));
       if (entry)
          {
+         numMethodEntries++;
          memset(entry, 0, sizeof(TR_IPMethodHashTableEntry));
-         entry->_next = _methodHashTable[bucket];
          entry->_method = (TR_OpaqueMethodBlock *)calleeMethod;
          // Set-up the first caller which is embedded in the entry
          entry->_caller.setMethod((TR_OpaqueMethodBlock*)callerMethod);
          entry->_caller.setPCIndex(pcIndex);
          entry->_caller.incWeight();
 
-         FLUSH_MEMORY(TR::Compiler->target.isSMP());
-         _methodHashTable[bucket] = entry; // chain it
+         // Several IProfiler threads may process buffers concurrently, so the entry is
+         // chained with a compare-and-swap on the bucket head, as in findOrCreateEntry.
+         // Entries are never unchained, so on failure only the entries prepended in the
+         // meantime need to be checked for the same callee.
+         TR_IPMethodHashTableEntry *head = _methodHashTable[bucket];
+         while (true)
+            {
+            entry->_next = head;
+            uintptr_t oldHead = VM_AtomicSupport::lockCompareExchange((volatile uintptr_t *)&_methodHashTable[bucket],
+                                                                      (uintptr_t)head, (uintptr_t)entry);
+            if (oldHead == (uintptr_t)head)
+               break;
+
+            TR_IPMethodHashTableEntry *newHead = (TR_IPMethodHashTableEntry *)oldHead;
+            for (TR_IPMethodHashTableEntry *e = newHead; e != head; e = e->_next)
+               {
+               if (e->_method == (TR_OpaqueMethodBlock *)calleeMethod)
+                  {
+                  // Lost the race for this callee; record the caller in the winning entry
+                  numMethodEntries--;
+                  memoryConsumed -= (int32_t)sizeof(TR_IPMethodHashTableEntry);
+                  jitPersistentFree(entry);
+                  e->add((TR_OpaqueMethodBlock *)callerMethod, (TR_OpaqueMethodBlock *)calleeMethod, pcIndex);
+                  return e;
+                  }
+               }
+            head = newHead;
+            }
          }
       }
    return entry;
@@ -1199,10 +1286,32 @@ TR_IPMethodHashTableEntry::add(TR_OpaqueMethodBlock *caller, TR_OpaqueMethodBloc
             newCaller->setMethod(caller);
             newCaller->setPCIndex(pcIndex);
             newCaller->incWeight();
-            newCaller->next = _caller.next; // add the existing list of callers (except the embedded one) to this new caller
-            FLUSH_MEMORY(TR::Compiler->target.isSMP());
-            // Add the newCaller after the embedded caller
-            _caller.next = newCaller;
+            // Add the newCaller after the embedded caller. Another IProfiler thread may be
+            // adding to the same list, so publish it with a compare-and-swap and, if that
+            // fails, check the callers that were added in the meantime for a match
+            TR_IPMethodData *head = _caller.next;
+            while (true)
+               {
+               newCaller->next = head; // add the existing list of callers (except the embedded one) to this new caller
+               uintptr_t oldHead = VM_AtomicSupport::lockCompareExchange((volatile uintptr_t *)&_caller.next,
+                                                                         (uintptr_t)head, (uintptr_t)newCaller);
+               if (oldHead == (uintptr_t)head)
+                  break;
+
+               TR_IPMethodData *newHead = (TR_IPMethodData *)oldHead;
+               for (it = newHead; it != head; it = it->next)
+                  {
+                  if (it->getMethod() == caller && (!useTuples || it->getPCIndex() == pcIndex))
+                     break;
+                  }
+               if (it != head)
+                  {
+                  jitPersistentFree(newCaller);
+                  it->incWeight();
+                  return;
+                  }
+               head = newHead;
+               }
             }
          }
       }
@@ -2561,6 +2670,7 @@ TR_IProfiler::outputStats()
       fprintf(stderr, "IProfiler: Number of buffers to be processed           =%" OMR_PRIu64 "\n", _numRequests);
       fprintf(stderr, "IProfiler: Number of buffers discarded                 =%" OMR_PRIu64 "\n", _numRequestsSkipped);
       fprintf(stderr, "IProfiler: Number of buffers handed to iprofiler thread=%" OMR_PRIu64 "\n", _numRequestsHandedToIProfilerThread);
+      fprintf(stderr, "IProfiler: Number of iprofiler thread activations      =%" OMR_PRIu64 " (%d threads)\n", _numIProfilerThreadActivations, _numIProfilerThreads);
       }
    fprintf(stderr, "IProfiler: Number of records processed=%" OMR_PRIu64 "\n", _iprofilerNumRecords);
    fprintf(stderr, "IProfiler: Number of hashtable entries=%u\n", countEntries());
@@ -3636,23 +3746,18 @@ bool TR_IProfiler::getCallerWeight(TR_OpaqueMethodBlock *calleeMethod,TR_OpaqueM
 
 static int32_t J9THREAD_PROC iprofilerThreadProc(void * entryarg)
    {
-   J9JITConfig * jitConfig = (J9JITConfig *) entryarg;
+   TR_IProfiler::IProfilerWorker *worker = (TR_IProfiler::IProfilerWorker *)entryarg;
+   TR_IProfiler *iProfiler = worker->_iProfiler;
+   J9JITConfig * jitConfig = iProfiler->getCompInfo()->getJITConfig();
    J9JavaVM * vm           = jitConfig->javaVM;
-   TR_J9VMBase *fe = TR_J9VM::get(jitConfig, 0);
-   TR_IProfiler *iProfiler = fe->getIProfiler();
    J9VMThread *iprofilerThread = NULL;
    PORT_ACCESS_FROM_JITCONFIG(jitConfig);
    // If I created this thread, iprofiler exists; don't need to check against NULL
    int rc = vm->internalVMFunctions->internalAttachCurrentThread(vm, &iprofilerThread, NULL,
                                   J9_PRIVATE_FLAGS_DAEMON_THREAD | J9_PRIVATE_FLAGS_NO_OBJECT |
                                   J9_PRIVATE_FLAGS_SYSTEM_THREAD | J9_PRIVATE_FLAGS_ATTACHED_THREAD,
-                                  iProfiler->getIProfilerOSThread());
-   iProfiler->getIProfilerMonitor()->enter();
-   iProfiler->setAttachAttempted(true);
-   if (rc == JNI_OK)
-      iProfiler->setIProfilerThread(iprofilerThread);
-   iProfiler->getIProfilerMonitor()->notifyAll();
-   iProfiler->getIProfilerMonitor()->exit();
+                                  worker->_osThread);
+   iProfiler->setAttachAttempted(worker, (rc == JNI_OK) ? iprofilerThread : NULL);
    if (rc != JNI_OK)
       return JNI_ERR; // attaching the IProfiler thread failed
 
@@ -3661,21 +3766,12 @@ static int32_t J9THREAD_PROC iprofilerThreadProc(void * entryarg)
       (*vm->javaOffloadSwitchOnWithReasonFunc)(iprofilerThread, J9_JNI_OFFLOAD_SWITCH_JIT_IPROFILER_THREAD);
 #endif
 
-   j9thread_set_name(j9thread_self(), "JIT IProfiler");
+   j9thread_set_name(j9thread_self(), (worker->_id == 0) ? "JIT IProfiler" : "JIT IProfiler Worker");
 
-   iProfiler->processWorkingQueue();
+   iProfiler->processWorkingQueue(worker);
 
    vm->internalVMFunctions->DetachCurrentThread((JavaVM *) vm);
-   iProfiler->setIProfilerThread(NULL);
-   iProfiler->getIProfilerMonitor()->enter();
-   // free the special buffer because we don't need it anymore
-   if (iProfiler->getCrtProfilingBuffer())
-      {
-      j9mem_free_memory(iProfiler->getCrtProfilingBuffer());
-      iProfiler->setCrtProfilingBuffer(NULL);
-      }
-   iProfiler->setIProfilerThreadExitFlag();
-   iProfiler->getIProfilerMonitor()->notifyAll();
+   iProfiler->setIProfilerThreadExited(worker);
    j9thread_exit((J9ThreadMonitor*)iProfiler->getIProfilerMonitor()->getVMMonitor());
 
 #ifdef J9VM_OPT_JAVA_OFFLOAD_SUPPORT
@@ -3687,6 +3783,36 @@ static int32_t J9THREAD_PROC iprofilerThreadProc(void * entryarg)
    return 0;
    }
 
+void TR_IProfiler::setAttachAttempted(IProfilerWorker *worker, J9VMThread *vmThread)
+   {
+   _iprofilerMonitor->enter();
+   worker->_vmThread = vmThread;
+   if (vmThread)
+      _numIProfilerThreads++;
+   _iprofilerThreadAttachAttempted = true;
+   _iprofilerMonitor->notifyAll();
+   _iprofilerMonitor->exit();
+   }
+
+// Called by an IProfiler thread after it detached from the VM.
+// Returns with the iprofiler monitor in hand; j9thread_exit() releases it.
+void TR_IProfiler::setIProfilerThreadExited(IProfilerWorker *worker)
+   {
+   PORT_ACCESS_FROM_PORT(_portLib);
+   worker->_vmThread = NULL;
+   _iprofilerMonitor->enter();
+   // free the special buffer because we don't need it anymore
+   if (worker->_crtProfilingBuffer)
+      {
+      j9mem_free_memory(worker->_crtProfilingBuffer);
+      worker->_crtProfilingBuffer = NULL;
+      }
+   if (worker->_id == 0)
+      _iprofilerThreadExitFlag = 1;
+   _numIProfilerThreadsExited++;
+   _iprofilerMonitor->notifyAll();
+   }
+
 
 void TR_IProfiler::startIProfilerThread(J9JavaVM *javaVM)
    {
@@ -3698,26 +3824,37 @@ void TR_IProfiler::startIProfilerThread(J9JavaVM *javaVM)
    _iprofilerMonitor = TR::Monitor::create("JIT-iprofilerMonitor");
    if (_iprofilerMonitor)
       {
-      // create the thread for interpreter profiling
-      if(javaVM->internalVMFunctions->createThreadWithCategory(&_iprofilerOSThread,
-                                      TR::Options::_profilerStackSize << 10,
-                                      priority,
-                                      0,
-                                      &iprofilerThreadProc,
-                                      javaVM->jitConfig,
-                                      J9THREAD_CATEGORY_SYSTEM_JIT_THREAD))
+      int32_t numThreads = std::min(std::max(TR::Options::_iprofilerMaxNumThreads, 1), (int32_t)MAX_IPROFILER_THREADS);
+      for (int32_t i = 0; i < numThreads; i++)
          {
-         j9tty_printf(PORTLIB, "Error: Unable to create iprofiler thread\n");
-         TR::Options::getCmdLineOptions()->setOption(TR_DisableIProfilerThread);
-         // TODO:destroy the monitor that was created (_iprofilerMonitor)
-         _iprofilerMonitor = NULL;
-         }
-      else // Must wait here until the thread gets created; otherwise an early shutdown
-         { // does not know whether or not to destroy the thread
-         _iprofilerMonitor->enter();
-         while (!getAttachAttempted())
-            _iprofilerMonitor->wait();
-         _iprofilerMonitor->exit();
+         // create the thread for interpreter profiling
+         _iprofilerThreadAttachAttempted = false;
+         if(javaVM->internalVMFunctions->createThreadWithCategory(&_workers[i]._osThread,
+                                         TR::Options::_profilerStackSize << 10,
+                                         priority,
+                                         0,
+                                         &iprofilerThreadProc,
+                                         &_workers[i],
+                                         J9THREAD_CATEGORY_SYSTEM_JIT_THREAD))
+            {
+            if (i > 0)
+               break; // Continue with the workers created so far
+            j9tty_printf(PORTLIB, "Error: Unable to create iprofiler thread\n");
+            TR::Options::getCmdLineOptions()->setOption(TR_DisableIProfilerThread);
+            // TODO:destroy the monitor that was created (_iprofilerMonitor)
+            _iprofilerMonitor = NULL;
+            break;
+            }
+         else // Must wait here until the thread gets created; otherwise an early shutdown
+            { // does not know whether or not to destroy the thread
+            _iprofilerMonitor->enter();
+            while (!_iprofilerThreadAttachAttempted)
+               _iprofilerMonitor->wait();
+            bool attached = _workers[i]._vmThread != NULL;
+            _iprofilerMonitor->exit();
+            if (!attached)
+               break;
+            }
          }
       }
    else
@@ -3768,6 +3905,9 @@ void TR_IProfiler::stopIProfilerThread()
       return;
       }
 
+   // Workers other than the first exit as soon as they see this flag
+   _iprofilerThreadStopRequested = true;
+
    // get a special buffer which will be used as a signal to stop iprofilerThread
    //
    IProfilerBuffer *specialProfilingBuffer = NULL;
@@ -3807,8 +3947,8 @@ void TR_IProfiler::stopIProfilerThread()
       specialProfilingBuffer->setSize(0);
       _workingBufferList.add(specialProfilingBuffer);
       _workingBufferTail = specialProfilingBuffer;
-      // wait for the iprofilerThread to stop
-      while (!_iprofilerThreadExitFlag)
+      // wait for all the IProfiler threads to stop
+      while (_numIProfilerThreadsExited < _numIProfilerThreads)
          {
          _iprofilerMonitor->notifyAll();
          _iprofilerMonitor->wait();
@@ -3867,6 +4007,19 @@ TR_IProfiler::postIprofilingBufferToWorkingQueue(J9VMThread * vmThread, const U_
    _numRequestsHandedToIProfilerThread++;
    _numOutstandingBuffers++;
 
+   // Activate another IProfiler thread if buffers accumulate faster than the active
+   // threads can drain them and the machine has idle cycles to do more processing
+   if (_numActiveIProfilerThreads < _numIProfilerThreads &&
+       _numOutstandingBuffers > TR::Options::_iprofilerNumOutstandingBuffers * _numActiveIProfilerThreads / 2)
+      {
+      CpuUtilization *cpuUtil = _compInfo->getCpuUtil();
+      if (cpuUtil && cpuUtil->isFunctional() && cpuUtil->getAvgCpuIdle() > 25)
+         {
+         _numActiveIProfilerThreads++;
+         _numIProfilerThreadActivations++;
+         }
+      }
+
    //--- signal the processing thread
    _iprofilerMonitor->notifyAll();
    _iprofilerMonitor->exit();
@@ -3876,7 +4029,7 @@ TR_IProfiler::postIprofilingBufferToWorkingQueue(J9VMThread * vmThread, const U_
 // Method executed by the java thread when jitHookBytecodeProfiling() is called
 bool TR_IProfiler::processProfilingBuffer(J9VMThread *vmThread, const U_8* dataStart, UDATA size)
    {
-   if (_numOutstandingBuffers >= TR::Options::_iprofilerNumOutstandingBuffers ||
+   if (_numOutstandingBuffers >= TR::Options::_iprofilerNumOutstandingBuffers * _numActiveIProfilerThreads ||
        _compInfo->getPersistentInfo()->getLoadFactor() >= 1) // More active threads than CPUs
       {
       if (100*_numRequestsSkipped >= (uint64_t)TR::Options::_iprofilerBufferMaxPercentageToDiscard * _numRequests)
@@ -3906,39 +4059,53 @@ bool TR_IProfiler::processProfilingBuffer(J9VMThread *vmThread, const U_8* dataS
    }
 
 
-// This method is executed by the iprofiling thread
-void TR_IProfiler::processWorkingQueue()
+// This method is executed by the iprofiling threads
+void TR_IProfiler::processWorkingQueue(IProfilerWorker *worker)
    {
    PORT_ACCESS_FROM_PORT(_portLib);
+   // Only the first worker consumes the special buffer that signals the end of processing;
+   // the other workers exit as soon as a stop is requested
+   bool isFirstWorker = (worker->_id == 0);
    // wait for something to do
    _iprofilerMonitor->enter();
    do {
-      while (_workingBufferList.isEmpty())
+      while (_workingBufferList.isEmpty() || worker->_id >= _numActiveIProfilerThreads)
          {
+         if (!isFirstWorker && _iprofilerThreadStopRequested)
+            break;
+         // The most recently activated worker becomes inactive once the queue is drained
+         if (!isFirstWorker && _workingBufferList.isEmpty() && worker->_id == _numActiveIProfilerThreads - 1)
+            _numActiveIProfilerThreads--;
          //fprintf(stderr, "IProfiler thread will wait for data outstanding=%d\n", numOutstandingBuffers);
          _iprofilerMonitor->wait();
          }
+      if (!isFirstWorker && _iprofilerThreadStopRequested)
+         {
+         _iprofilerMonitor->exit();
+         break;
+         }
       // We have some buffer to process
       // Dequeue the buffer to be processed
       //
-      _crtProfilingBuffer = _workingBufferList.pop();
+      IProfilerBuffer *profilingBuffer = _workingBufferList.pop();
+      worker->_crtProfilingBuffer = profilingBuffer;
       if (_workingBufferList.isEmpty())
          _workingBufferTail = NULL;
 
       // We don't need the iprofiler monitor now
       _iprofilerMonitor->exit();
-      if (_crtProfilingBuffer->getSize() > 0)
+      if (profilingBuffer->getSize() > 0)
          {
          // process the buffer after acquiring VM access
-         acquireVMAccessNoSuspend(_iprofilerThread);   // blocking. Will wait for the entire GC
+         acquireVMAccessNoSuspend(worker->_vmThread);   // blocking. Will wait for the entire GC
          // Check to see if GC has invalidated this buffer
-         if (_crtProfilingBuffer->isValid())
+         if (profilingBuffer->isValid())
             {
          //fprintf(stderr, "IProfiler thread will process buffer %p of size %u\n", profilingBuffer->getBuffer(), profilingBuffer->getSize());
-            parseBuffer(_iprofilerThread, _crtProfilingBuffer->getBuffer(), _crtProfilingBuffer->getSize());
+            parseBuffer(worker->_vmThread, profilingBuffer->getBuffer(), profilingBuffer->getSize());
          //fprintf(stderr, "IProfiler thread finished processing\n");
             }
-         releaseVMAccess(_iprofilerThread);
+         releaseVMAccess(worker->_vmThread);
          }
       else // Special
          {
@@ -3946,8 +4113,8 @@ void TR_IProfiler::processWorkingQueue()
          }
       // attach the buffer to the buffer pool
       _iprofilerMonitor->enter();
-      _freeBufferList.add(_crtProfilingBuffer);
-      _crtProfilingBuffer = NULL;
+      _freeBufferList.add(profilingBuffer);
+      worker->_crtProfilingBuffer = NULL;
       _numOutstandingBuffers--;
       }while(1);
    }
@@ -4144,7 +4311,7 @@ UDATA TR_IProfiler::parseBuffer(J9VMThread * vmThread, const U_8* dataStart, UDA
             uint32_t offset = (uint32_t) (pc - caller->bytecodes);
             findOrCreateMethodEntry(caller, callee , true ,offset);
             if (_compInfo->getLowPriorityCompQueue().isTrackingEnabled() &&  // is feature enabled?
-                vmThread == _iprofilerThread) // only IProfiler thread is allowed to execute this
+                vmThread == getIProfilerThread()) // only IProfiler thread is allowed to execute this
                {
                _compInfo->getLowPriorityCompQueue().tryToScheduleCompilation(vmThread, caller);
                }
@@ -4170,7 +4337,7 @@ UDATA TR_IProfiler::parseBuffer(J9VMThread * vmThread, const U_8* dataStart, UDA
                uint32_t offset = (uint32_t) (pc - caller->bytecodes);
                findOrCreateMethodEntry(caller, callee , true , offset);
                if (_compInfo->getLowPriorityCompQueue().isTrackingEnabled() &&  // is feature enabled?
-                  vmThread == _iprofilerThread)  // only IProfiler thread is allowed to execute this
+                  vmThread == getIProfilerThread())  // only IProfiler thread is allowed to execute this
                   {
                   _compInfo->getLowPriorityCompQueue().tryToScheduleCompilation(vmThread, caller);
                   }
@@ -4313,10 +4480,14 @@ void TR_IProfiler::invalidateProfilingBuffers() // called for class unloading
       return;
       }
    IProfilerBuffer *specialProfilingBuffer = NULL;
-   if (_crtProfilingBuffer && _crtProfilingBuffer->getSize() > 0)
+   for (int32_t i = 0; i < _numIProfilerThreads; i++)
       {
-      // mark this buffer as invalid
-      _crtProfilingBuffer->setIsInvalidated(true); // set with exclusive VM access
+      IProfilerBuffer *crtProfilingBuffer = _workers[i]._crtProfilingBuffer;
+      if (crtProfilingBuffer && crtProfilingBuffer->getSize() > 0)
+         {
+         // mark this buffer as invalid
+         crtProfilingBuffer->setIsInvalidated(true); // set with exclusive VM access
+         }
       }
    while (!_workingBufferList.isEmpty())
       {
@@ -4378,7 +4549,6 @@ TR_IPHashedCallSite::operator new (size_t size) throw()
    return alloc;
    }
 
-inline
 uintptr_t CallSiteProfileInfo::getClazz(int index)
    {
    if (TR::Compiler->om.compressObjectReferences())
@@ -4388,7 +4558,6 @@ uintptr_t CallSiteProfileInfo::getClazz(int index)
       return (uintptr_t)_clazz[index]; //things are just stored as regular pointers otherwise
    }
 
-inline
 void CallSiteProfileInfo::setClazz(int index, uintptr_t clazzPointer)
    {
    if (TR::Compiler->om.compressObjectReferences())
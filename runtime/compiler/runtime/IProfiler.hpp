@@ -141,7 +141,13 @@ public:
    uintptr_t getDominantClass(int32_t &sumW, int32_t &maxW);
 
 private:
+#if defined(OMR_GC_COMPRESSED_POINTERS) && !defined(OMR_GC_FULL_POINTERS)
+   // Class pointers always fit in 32 bits in builds that only support compressed references.
+   // This makes call graph entries, the most numerous IProfiler entries, 12 bytes smaller.
+   uint32_t _clazz[NUM_CS_SLOTS];
+#else
    uintptr_t _clazz[NUM_CS_SLOTS]; // store them in either 64 or 32 bits
+#endif
    };
 
 #define TR_IPBCD_FOUR_BYTES  1
@@ -500,6 +506,7 @@ public:
    TR_PERSISTENT_ALLOC(TR_Memory::IProfiler);
    static TR_IProfiler *allocate (J9JITConfig *);
    static uint32_t getProfilerMemoryFootprint();
+   static void printProfilerMemoryFootprint(); // to the verbose log, with a breakdown by entry kind
 
    uintptr_t getReceiverClassFromCGProfilingData(TR_ByteCodeInfo &bcInfo, TR::Compilation *comp);
 
@@ -568,17 +575,29 @@ public:
 
 
 public:
-   J9VMThread* getIProfilerThread() { return _iprofilerThread; }
-   void setIProfilerThread(J9VMThread* thread) { _iprofilerThread = thread; }
-   j9thread_t getIProfilerOSThread() { return _iprofilerOSThread; }
+   static const int32_t MAX_IPROFILER_THREADS = 8;
+
+   /**
+    * @brief An IProfiler thread that drains the working queue of profiling buffers.
+    *        Worker 0 is always active. The other workers (-Xjit:iprofilerMaxNumThreads=)
+    *        are only activated while buffers accumulate and the machine has idle CPU.
+    */
+   struct IProfilerWorker
+      {
+      TR_IProfiler    *_iProfiler;
+      int32_t          _id;
+      j9thread_t       _osThread;
+      J9VMThread      *_vmThread;
+      IProfilerBuffer *_crtProfilingBuffer; // profiling buffer being processed by this thread
+      };
+
+   J9VMThread* getIProfilerThread(int32_t workerId = 0) { return _workers[workerId]._vmThread; }
+   int32_t getNumIProfilerThreads() const { return _numIProfilerThreads; }
    TR::Monitor* getIProfilerMonitor() { return _iprofilerMonitor; }
    bool processProfilingBuffer(J9VMThread *vmThread, const U_8* dataStart, UDATA size);
-   void setAttachAttempted(bool b) { _iprofilerThreadAttachAttempted = b; }
-   void processWorkingQueue();
-   bool getAttachAttempted() const { return _iprofilerThreadAttachAttempted; }
-   IProfilerBuffer *getCrtProfilingBuffer() const { return _crtProfilingBuffer; }
-   void setCrtProfilingBuffer(IProfilerBuffer *b) { _crtProfilingBuffer = b; }
-   void setIProfilerThreadExitFlag() { _iprofilerThreadExitFlag = 1; }
+   void processWorkingQueue(IProfilerWorker *worker);
+   void setAttachAttempted(IProfilerWorker *worker, J9VMThread *vmThread);
+   void setIProfilerThreadExited(IProfilerWorker *worker);
    void jitProfileParseBuffer(J9VMThread *vmThread);
    uint32_t getIProfilerThreadExitFlag() { return _iprofilerThreadExitFlag; }
    bool postIprofilingBufferToWorkingQueue(J9VMThread * vmThread, const U_8* dataStart, UDATA size);
@@ -701,18 +720,21 @@ private:
    bool                            _enableCGProfiling;
    uint32_t                        _globalAllocationCount;
    int32_t                         _maxCallFrequency;
-   j9thread_t                      _iprofilerOSThread;
-   J9VMThread                     *_iprofilerThread;
+   IProfilerWorker                 _workers[MAX_IPROFILER_THREADS];
+   int32_t                         _numIProfilerThreads; // workers attached to the VM
+   volatile int32_t                _numActiveIProfilerThreads; // workers allowed to process buffers; protected by _iprofilerMonitor
+   int32_t                         _numIProfilerThreadsExited;
    TR_LinkHead0<IProfilerBuffer>   _freeBufferList;
    TR_LinkHead0<IProfilerBuffer>   _workingBufferList;
    IProfilerBuffer                *_workingBufferTail;
-   IProfilerBuffer                *_crtProfilingBuffer; // profiling buffer being processes by iprofiling thread
    TR::Monitor                    *_iprofilerMonitor;
    volatile int32_t                _numOutstandingBuffers;
    uint64_t                        _numRequests;
    uint64_t                        _numRequestsSkipped;
    uint64_t                        _numRequestsHandedToIProfilerThread;
+   uint64_t                        _numIProfilerThreadActivations; // info stats only
    volatile uint32_t               _iprofilerThreadExitFlag;
+   volatile bool                   _iprofilerThreadStopRequested;
    volatile bool                   _iprofilerThreadAttachAttempted;
    uint64_t                        _iprofilerNumRecords; // info stats only
 
@@ -142,6 +142,16 @@ J9::CodeCache::initialize(TR::CodeCacheManager *manager,
    }
 
 
+void
+J9::CodeCache::unreserve()
+   {
+   if (self()->isHot())
+      _manager->releaseHotCodeCache(self());
+   else
+      self()->OMR::CodeCache::unreserve();
+   }
+
+
 // Deal with class unloading
 void
 J9::CodeCache::onClassUnloading(J9ClassLoader *loaderPtr)
@@ -53,7 +53,7 @@ class OMR_EXTENSIBLE CodeCache : public OMR::CodeCacheConnector
    TR::CodeCache *self();
 
 public:
-   CodeCache() { }
+   CodeCache() : _hot(false) { }
 
    /**
     * @brief Initialize an allocated CodeCache object
@@ -105,6 +105,18 @@ public:
    */
    void resetCodeCache();
 
+   /**
+    * @brief Cancel the reservation of this code cache. The hot code cache is handed back to
+    *        the code cache manager instead, which keeps it away from general reservations.
+    */
+   void                       unreserve();
+
+   /**
+    * @brief Answers whether this code cache is dedicated to hot and scorching method bodies
+    */
+   bool                       isHot() { return _hot; }
+   void                       setHot() { _hot = true; }
+
    private:
    /**
     * @brief Restore trampoline pointers to their initial positions
@@ -119,6 +131,7 @@ public:
    */
    void resetAllocationPointers();
 
+   bool      _hot;               // only hot and scorching bodies are allocated here
    uint8_t * _warmCodeAllocBase; // used to reset the allocation pointers to initial values
    uint8_t * _coldCodeAllocBase;
    };
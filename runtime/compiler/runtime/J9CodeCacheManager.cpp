@@ -23,6 +23,9 @@
 #include <algorithm>
 #include <stdlib.h>
 #include <string.h>
+#if defined(LINUX)
+#include <sys/mman.h>
+#endif
 #include "j9.h"
 #include "j9protos.h"
 #include "j9thread.h"
@@ -73,7 +76,62 @@ J9::CodeCacheManager::initialize(bool useConsolidatedCache, uint32_t numberOfCod
    _jitConfig = self()->fej9()->getJ9JITConfig();
    _javaVM = _jitConfig->javaVM;
 
-   return self()->OMR::CodeCacheManager::initialize(useConsolidatedCache, numberOfCodeCachesToCreateAtStartup);
+   TR::CodeCache *codeCache = self()->OMR::CodeCacheManager::initialize(useConsolidatedCache, numberOfCodeCachesToCreateAtStartup);
+   if (codeCache && TR::Options::_hotCodeCache)
+      self()->initializeHotCodeCache();
+
+   return codeCache;
+   }
+
+// Hot and scorching bodies are a small fraction of the compiled code but account for most of
+// the time spent in it. Giving them a code cache of their own packs them into a few (large)
+// pages instead of scattering them among the warm bodies allocated since startup.
+//
+void
+J9::CodeCacheManager::initializeHotCodeCache()
+   {
+   TR::CodeCacheConfig &config = self()->codeCacheConfig();
+   TR::CodeCache *hotCodeCache = TR::CodeCache::allocate(self(), config.codeCacheKB() << 10, HOT_CODE_CACHE_IDLE_COMP_THREAD_ID);
+   if (!hotCodeCache)
+      {
+      if (config.verboseCodeCache())
+         TR_VerboseLog::writeLineLocked(TR_Vlog_CODECACHE, "Could not allocate the hot code cache");
+      return;
+      }
+
+   // While no compilation holds the hot code cache it stays reserved, which keeps
+   // the general code cache reservation from handing it out
+   hotCodeCache->reserve(HOT_CODE_CACHE_IDLE_COMP_THREAD_ID);
+   hotCodeCache->setHot();
+   _hotCodeCache = hotCodeCache;
+
+   if (config.verboseCodeCache())
+      TR_VerboseLog::writeLineLocked(TR_Vlog_CODECACHE, "CC=%p reserved for hot method bodies [%p, %p)",
+                                     hotCodeCache, hotCodeCache->getCodeBase(), hotCodeCache->getCodeTop());
+   }
+
+TR::CodeCache *
+J9::CodeCacheManager::reserveHotCodeCache(int32_t compThreadID)
+   {
+   TR::CodeCache *hotCodeCache = _hotCodeCache;
+   if (!hotCodeCache)
+      return NULL;
+
+   CacheListCriticalSection reserveHotCache(self());
+   if (_hotCodeCacheInUse || hotCodeCache->almostFull() == TR_yes)
+      return NULL;
+
+   _hotCodeCacheInUse = true;
+   hotCodeCache->reserve(compThreadID);
+   return hotCodeCache;
+   }
+
+void
+J9::CodeCacheManager::releaseHotCodeCache(TR::CodeCache *hotCodeCache)
+   {
+   CacheListCriticalSection releaseHotCache(self());
+   hotCodeCache->reserve(HOT_CODE_CACHE_IDLE_COMP_THREAD_ID);
+   _hotCodeCacheInUse = false;
    }
 
 void
@@ -460,6 +518,15 @@ J9::CodeCacheManager::allocateCodeCacheSegment(size_t segmentSize,
       }
 #endif
 
+   size_t pageSize = codeCacheSegment->vmemIdentifier.pageSize;
+   bool advisedHugePages = false;
+   if (TR::Options::_hugePageCaches && pageSize == j9vmem_supported_page_sizes()[0])
+      advisedHugePages = self()->adviseHugePages(codeCacheSegment->heapBase, codeCacheSegment->heapTop - codeCacheSegment->heapBase);
+   if (config.verboseCodeCache())
+      TR_VerboseLog::writeLineLocked(TR_Vlog_CODECACHE, "code cache segment %p-%p uses %u byte pages%s",
+                                     codeCacheSegment->heapBase, codeCacheSegment->heapTop, (uint32_t)pageSize,
+                                     advisedHugePages ? ", transparent huge pages requested" : "");
+
    mcc_printf("TR::CodeCache::allocate : codeCacheSegment in %p\n",codeCacheSegment);
    mcc_printf("TR::CodeCache::allocate : requested segment size = %d\n", codeCacheSizeToAllocate);
    mcc_printf("TR::CodeCache::allocate : real heap base = %p\n", codeCacheSegment->heapBase);
@@ -503,6 +570,24 @@ J9::CodeCacheManager::freeMemorySegment(TR::CodeCacheMemorySegment *segment)
    segment->free(self());
    }
 
+bool
+J9::CodeCacheManager::adviseHugePages(void *start, size_t size)
+   {
+#if defined(LINUX) && defined(MADV_HUGEPAGE)
+   // The advice only applies to whole pages; segments from the port library are page aligned
+   // at both ends, but a heapBase from the memory segment may not be
+   PORT_ACCESS_FROM_JITCONFIG(_jitConfig);
+   uintptr_t defaultPageSize = j9vmem_supported_page_sizes()[0];
+   uintptr_t alignedStart = OMR::align((size_t)start, defaultPageSize);
+   uintptr_t end = ((uintptr_t)start + size) & ~(defaultPageSize - 1);
+   if (end <= alignedStart)
+      return false;
+   return 0 == madvise((void *)alignedStart, end - alignedStart, MADV_HUGEPAGE);
+#else
+   return false;
+#endif
+   }
+
 void *
 J9::CodeCacheManager::chooseCacheStartAddress(size_t repositorySize)
    {
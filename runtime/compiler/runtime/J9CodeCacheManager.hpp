@@ -53,7 +53,9 @@ class OMR_EXTENSIBLE CodeCacheManager : public OMR::CodeCacheManagerConnector
 public:
    CodeCacheManager(TR_FrontEnd *fe, TR::RawAllocator rawAllocator) :
       OMR::CodeCacheManagerConnector(rawAllocator),
-      _fe(fe)
+      _fe(fe),
+      _hotCodeCache(NULL),
+      _hotCodeCacheInUse(false)
       {
       _codeCacheManager = reinterpret_cast<TR::CodeCacheManager *>(this);
       }
@@ -76,6 +78,17 @@ public:
                                                         void *preferredStartAddress);
    void *chooseCacheStartAddress(size_t repositorySize);
 
+   /**
+    * @brief Ask the OS to back a region allocated with the default page size with
+    *        transparent huge pages. Only Linux supports this.
+    *
+    * @param[in] start : start of the region
+    * @param[in] size : size of the region in bytes
+    *
+    * @return true if the OS took the advice; false otherwise.
+    */
+   static bool adviseHugePages(void *start, size_t size);
+
    void addFaintCacheBlock(OMR::MethodExceptionData *metaData, uint8_t bytesToSaveAtStart);
    void freeFaintCacheBlock(OMR::FaintCacheBlock *block, uint8_t *startPC);
 
@@ -89,6 +102,27 @@ public:
                                     int32_t compThreadID,
                                     int32_t *numReserved);
 
+   /**
+    * @brief Reserve the code cache dedicated to hot and scorching method bodies.
+    *
+    * @param[in] compThreadID : ID of the compilation thread making the reservation
+    *
+    * @return the hot code cache; NULL if there is none, if another compilation holds it
+    *         or if it is almost full, in which case a general code cache should be reserved.
+    */
+   TR::CodeCache *reserveHotCodeCache(int32_t compThreadID);
+
+   /**
+    * @brief Take back the hot code cache from the compilation that reserved it. The cache
+    *        stays reserved by HOT_CODE_CACHE_IDLE_COMP_THREAD_ID so that general reservations
+    *        never hand it out.
+    *
+    * @param[in] hotCodeCache : the hot code cache
+    */
+   void releaseHotCodeCache(TR::CodeCache *hotCodeCache);
+
+   TR::CodeCache *getHotCodeCache() { return _hotCodeCache; }
+
    TR::CodeCacheMemorySegment *setupMemorySegmentFromRepository(uint8_t *start,
                                                                 uint8_t *end,
                                                                 size_t & codeCacheSizeToAllocate);
@@ -98,6 +132,7 @@ public:
 
    static const uint32_t SAFE_DISTANCE_REPOSITORY_JITLIBRARY = 64 * 1024 * 1024;  // 64MB to account for some safe JIT library size
    static const uintptr_t MAX_DISTANCE_NEAR_JITLIBRARY_TO_AVOID_TRAMPOLINE = 0x80000000 - 64 * 1024 * 1024; // 2GB - 64MB
+   static const int32_t HOT_CODE_CACHE_IDLE_COMP_THREAD_ID = -3; // owner of the hot code cache while no compilation holds it
 
    void setCodeCacheFull();
 
@@ -152,7 +187,14 @@ public:
    void printOccupancyStats();
 
 private :
+   /**
+    * @brief Carve out the code cache dedicated to hot and scorching method bodies.
+    */
+   void initializeHotCodeCache();
+
    TR_FrontEnd *_fe;
+   TR::CodeCache *_hotCodeCache;
+   bool _hotCodeCacheInUse;
    static TR::CodeCacheManager *_codeCacheManager;
    static J9JITConfig *_jitConfig;
    static J9JavaVM *_javaVM;
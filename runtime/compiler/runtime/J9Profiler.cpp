@@ -36,6 +36,7 @@
 #include "control/Recompilation.hpp"
 #include "control/RecompilationInfo.hpp"
 #include "env/IO.hpp"
+#include "env/J9SharedCache.hpp"
 #include "env/PersistentCHTable.hpp"
 #include "env/PersistentInfo.hpp"
 #include "env/StackMemoryRegion.hpp"
@@ -2293,6 +2294,7 @@ void TR_BlockFrequencyInfo::serialize(uint8_t * &buffer) const
    {
    SerializedBFI *serializedData = reinterpret_cast<SerializedBFI *>(buffer);
    serializedData->numBlocks = _numBlocks;
+   serializedData->entryBlockNumber = _entryBlockNumber;
    buffer += sizeof(SerializedBFI);
    if (_numBlocks > 0)
       {
@@ -2340,7 +2342,7 @@ TR_BlockFrequencyInfo::TR_BlockFrequencyInfo(const SerializedBFI *serializedData
       _numBlocks ?
       (TR_BitVector**) new (PERSISTENT_NEW) void**[_numBlocks*2]() :
       NULL),
-   _entryBlockNumber(-1),
+   _entryBlockNumber(serializedData->entryBlockNumber),
    _isQueuedForRecompilation(0)
    {
    if (_numBlocks > 0)
@@ -2736,7 +2738,7 @@ uint32_t TR_CallSiteInfo::getSizeForSerialization() const
    return size;
    }
 
-void TR_CallSiteInfo::serialize(uint8_t * &buffer) const
+void TR_CallSiteInfo::serialize(uint8_t * &buffer, bool portable) const
    {
    SerializedCSI *serializedData = reinterpret_cast<SerializedCSI *>(buffer);
    serializedData->numCallSites = _numCallSites;
@@ -2745,6 +2747,14 @@ void TR_CallSiteInfo::serialize(uint8_t * &buffer) const
       {
       size_t callSitesSize = _numCallSites * sizeof(TR_InlinedCallSite);
       memcpy(buffer, _callSites, callSitesSize);
+      if (portable)
+         {
+         // J9Methods differ from one JVM to the next; a NULL method never matches an inlined
+         // call site, so only the counts of the outermost method remain usable
+         TR_InlinedCallSite *callSites = reinterpret_cast<TR_InlinedCallSite *>(buffer);
+         for (size_t i = 0; i < _numCallSites; i++)
+            callSites[i]._methodInfo = NULL;
+         }
       buffer += callSitesSize;
       }
    }
@@ -2760,7 +2770,7 @@ TR_CallSiteInfo::TR_CallSiteInfo(const SerializedCSI *data, uint8_t * &buffer) :
    {
    if (_numCallSites > 0)
       {
-      memcpy(buffer, _callSites, _numCallSites * sizeof(TR_InlinedCallSite));
+      memcpy(_callSites, buffer, _numCallSites * sizeof(TR_InlinedCallSite));
       buffer += (_numCallSites * sizeof(TR_InlinedCallSite));
       }
    }
@@ -2801,7 +2811,7 @@ uint32_t TR_PersistentProfileInfo::getSizeForSerialization() const
    return size;
    }
 
-void TR_PersistentProfileInfo::serialize(uint8_t * &buffer) const
+void TR_PersistentProfileInfo::serialize(uint8_t * &buffer, bool portable) const
    {
    SerializedPPI *serializedData = reinterpret_cast<SerializedPPI *>(buffer);
    serializedData->hasCallSiteInfo = (_callSiteInfo != NULL);
@@ -2810,7 +2820,7 @@ void TR_PersistentProfileInfo::serialize(uint8_t * &buffer) const
    buffer += sizeof(SerializedPPI);
    if (_callSiteInfo)
       {
-      _callSiteInfo->serialize(buffer);
+      _callSiteInfo->serialize(buffer, portable);
       }
    if (_blockFrequencyInfo)
       {
@@ -2820,7 +2830,9 @@ void TR_PersistentProfileInfo::serialize(uint8_t * &buffer) const
 
 TR_PersistentProfileInfo::TR_PersistentProfileInfo(uint8_t * &buffer) :
    _next(NULL),
+   _catchBlockProfileInfo(NULL),
    _active(true),
+   _storedInSharedCache(false),
    _refCount(1)
    {
    SerializedPPI *serializedData = reinterpret_cast<SerializedPPI *>(buffer);
@@ -2833,6 +2845,99 @@ TR_PersistentProfileInfo::TR_PersistentProfileInfo(uint8_t * &buffer) :
    // these two are not required
    memset(_profilingFrequency, 0, sizeof(_profilingFrequency));
    memset(_profilingCount, 0, sizeof(_profilingCount));
+   _maxCount = 0;
+   }
+
+/**
+ * Build the key under which the profile info of the method being compiled is kept
+ * in the shared class cache. Returns false if the info cannot be shared.
+ */
+static bool
+getSharedCacheKey(TR::Compilation *comp, char *key, size_t keySize)
+   {
+   if (!TR::Options::_persistJProfilingData || !TR::Options::sharedClassCache())
+      return false;
+#if defined(J9VM_OPT_JITSERVER)
+   // Profiling is not supported with JITServer
+   if (comp->getPersistentInfo()->getRemoteCompilationMode() != JITServer::NONE)
+      return false;
+#endif /* defined(J9VM_OPT_JITSERVER) */
+   TR_J9SharedCache *sharedCache = comp->fej9()->sharedCache();
+   if (!sharedCache)
+      return false;
+
+   J9ROMMethod *romMethod = comp->fej9()->getROMMethodFromRAMMethod((J9Method *)comp->getCurrentMethod()->getPersistentIdentifier());
+   uintptr_t offset = 0;
+   if (!sharedCache->isROMMethodInSharedCache(romMethod, &offset))
+      return false;
+
+   snprintf(key, keySize, "JProfile:%" OMR_PRIxPTR, offset);
+   return true;
+   }
+
+void TR_PersistentProfileInfo::storeInSharedCache(TR::Compilation *comp)
+   {
+   if (_storedInSharedCache || !_blockFrequencyInfo)
+      return;
+
+   char key[64];
+   if (!getSharedCacheKey(comp, key, sizeof(key)))
+      return;
+
+   // One attempt per info; the SCC keeps a single entry per key anyway
+   _storedInSharedCache = true;
+
+   TR::StackMemoryRegion stackMemoryRegion(*comp->trMemory());
+   uint32_t size = sizeof(SharedCacheHeader) + getSizeForSerialization();
+   uint8_t *data = (uint8_t *)comp->trMemory()->allocateStackMemory(size);
+   SharedCacheHeader *header = reinterpret_cast<SharedCacheHeader *>(data);
+   header->version = SHARED_CACHE_DATA_VERSION;
+   header->size = size;
+   uint8_t *cursor = data + sizeof(SharedCacheHeader);
+   serialize(cursor, true);
+
+   J9SharedDataDescriptor descriptor;
+   descriptor.address = data;
+   descriptor.length = size;
+   descriptor.type = J9SHR_DATA_TYPE_JITHINT;
+   descriptor.flags = J9SHRDATA_SINGLE_STORE_FOR_KEY_TYPE;
+   const void *stored = comp->fej9()->sharedCache()->storeSharedData(comp->j9VMThread(), key, &descriptor);
+
+   if (TR::Options::getVerboseOption(TR_VerboseProfiling))
+      TR_VerboseLog::writeLineLocked(TR_Vlog_PROFILING, "%s storing %u bytes of profile info 0x%p for %s under %s",
+         stored ? "Succeeded" : "Failed", size, this, comp->signature(), key);
+   }
+
+TR_PersistentProfileInfo *
+TR_PersistentProfileInfo::loadFromSharedCache(TR::Compilation *comp)
+   {
+   char key[64];
+   if (!getSharedCacheKey(comp, key, sizeof(key)))
+      return NULL;
+
+   J9SharedDataDescriptor descriptor;
+   uint8_t *data = (uint8_t *)comp->fej9()->sharedCache()->findSharedData(comp->j9VMThread(), key, J9SHR_DATA_TYPE_JITHINT, &descriptor);
+   if (!data)
+      return NULL;
+
+   SharedCacheHeader *header = reinterpret_cast<SharedCacheHeader *>(data);
+   if (descriptor.length < sizeof(SharedCacheHeader) ||
+       header->version != SHARED_CACHE_DATA_VERSION ||
+       header->size != descriptor.length)
+      {
+      if (TR::Options::getVerboseOption(TR_VerboseProfiling))
+         TR_VerboseLog::writeLineLocked(TR_Vlog_PROFILING, "Ignoring incompatible profile info stored for %s under %s", comp->signature(), key);
+      return NULL;
+      }
+
+   uint8_t *cursor = data + sizeof(SharedCacheHeader);
+   TR_PersistentProfileInfo *info = deserialize(cursor);
+   info->setActive(false);
+   info->_storedInSharedCache = true;
+
+   if (TR::Options::getVerboseOption(TR_VerboseProfiling))
+      TR_VerboseLog::writeLineLocked(TR_Vlog_PROFILING, "Loaded profile info 0x%p for %s from %s", info, comp->signature(), key);
+   return info;
    }
 
 
@@ -2911,6 +3016,10 @@ TR_PersistentProfileInfo *TR_AccessedProfileInfo::get(TR::Compilation *comp)
          TR_PersistentProfileInfo::decRefCount(_current);
          _current = NULL;
          }
+
+      // The profile is complete once a later compilation consumes it
+      if (_current)
+         _current->storeInSharedCache(comp);
       }
    _searched = true;
    return _current;
@@ -120,6 +120,7 @@ class TR_PersistentProfileInfo
         _callSiteInfo(NULL),
         _next(NULL),
         _active(false),
+        _storedInSharedCache(false),
         _refCount(1)
       {
       for (int i=0; i < PROFILING_INVOCATION_COUNT; i++)
@@ -188,8 +189,10 @@ class TR_PersistentProfileInfo
     * @note The caller should ensure buffer is large enough to accommodate the serialized data.
     * On return the buffer gets updated to point to the location past the serialized data.
     * Also see getSizeForSerialization(), deserialize(uint8_t * &).
+    *
+    * @param portable If true, do not write pointers that are only valid in the current JVM
     */
-   void serialize(uint8_t * &buffer) const;
+   void serialize(uint8_t * &buffer, bool portable = false) const;
 
    /**
     * @brief Method for creating TR_PersistentProfileInfo from serialized data
@@ -208,7 +211,39 @@ class TR_PersistentProfileInfo
       return new (PERSISTENT_NEW) TR_PersistentProfileInfo(buffer);
       }
 
+   /**
+    * @brief Store the block frequencies of this info in the shared class cache, keyed on the
+    * ROM method being compiled, so that the first compilation of the method in a later JVM can
+    * use them. Only attempted once per info and only under -Xjit:persistJProfilingData.
+    *
+    * @param comp The compilation consuming this info
+    */
+   void storeInSharedCache(TR::Compilation *comp);
+
+   /**
+    * @brief Create an inactive info from the data stored in the shared class cache for the
+    * method being compiled, if any. See storeInSharedCache().
+    *
+    * @param comp The first compilation of the method
+    *
+    * @return The new info with a reference count of 1, or NULL if nothing usable was found.
+    * The caller is responsible for handing it to the JProfiler thread.
+    */
+   static TR_PersistentProfileInfo * loadFromSharedCache(TR::Compilation *comp);
+
    private:
+   /**
+    * Header of the data stored in the shared class cache by storeInSharedCache().
+    * The size covers the header and is used to reject truncated or stale data.
+    */
+   struct SharedCacheHeader
+      {
+      uint32_t version;
+      uint32_t size;
+      };
+
+   static const uint32_t SHARED_CACHE_DATA_VERSION = 1;
+
    /**
     * This data structure contains all the fields required for serializing an object of TR_PersistentProfileInfo.
     * Members of primitive type are represented as it is, and the pointer types which can have NULL value are 
@@ -250,6 +285,9 @@ class TR_PersistentProfileInfo
 
    // Flag to determine whether the information is being actively updated
    bool _active;
+
+   // Set once this info has been stored in, or loaded from, the shared class cache
+   bool _storedInSharedCache;
    };
 
 
@@ -756,6 +794,7 @@ class TR_BlockFrequencyInfo
    struct SerializedBFI
       {
       int32_t numBlocks;
+      int32_t entryBlockNumber;
       };
 
    /**
@@ -891,8 +930,10 @@ class TR_CallSiteInfo
     * @note The caller should ensure buffer is large enough to accommodate the serialized data.
     * On return the buffer gets updated to point to the location past the serialized data.
     * Also see getSizeForSerialization(), deserialize(uint8_t * &).
+    *
+    * @param portable If true, do not write the inlined method pointers, which are only valid in the current JVM
     */
-   void serialize(uint8_t * &buffer) const;
+   void serialize(uint8_t * &buffer, bool portable = false) const;
 
    /**
     * @brief Method for creating TR_CallSiteInfo from serialized data
@@ -41,6 +41,8 @@ ClientSessionData::ClientSessionData(uint64_t clientUID, uint32_t seqNo, TR_Pers
    _OOSequenceEntryList(NULL), _chTable(NULL),
    _romClassMap(decltype(_romClassMap)::allocator_type(persistentMemory->_persistentAllocator.get())),
    _J9MethodMap(decltype(_J9MethodMap)::allocator_type(persistentMemory->_persistentAllocator.get())),
+   _classCacheFootprint(0), _evictionClockHand(NULL), _numEvictedClasses(0),
+   _classByROMClassHashMap(decltype(_classByROMClassHashMap)::allocator_type(persistentMemory->_persistentAllocator.get())),
    _classBySignatureMap(decltype(_classBySignatureMap)::allocator_type(persistentMemory->_persistentAllocator.get())),
    _classChainDataMap(decltype(_classChainDataMap)::allocator_type(persistentMemory->_persistentAllocator.get())),
    _constantPoolToClassMap(decltype(_constantPoolToClassMap)::allocator_type(persistentMemory->_persistentAllocator.get())),
@@ -222,6 +224,15 @@ ClientSessionData::processUnloadedClasses(const std::vector<TR_OpaqueClassBlock*
                _J9MethodMap.erase(j9method);
                }
             }
+         if (!_classByROMClassHashMap.empty())
+            {
+            auto hashIt = _classByROMClassHashMap.find(JITServerSharedROMClassCache::getHash(romClass));
+            if ((hashIt != _classByROMClassHashMap.end()) && (hashIt->second == (J9Class *)clazz))
+               _classByROMClassHashMap.erase(hashIt);
+            }
+         if (_evictionClockHand == (J9Class *)clazz)
+            _evictionClockHand = NULL;
+         _classCacheFootprint -= classInfoFootprint(romClass);
          it->second.freeClassInfo(_persistentMemory);
          _romClassMap.erase(it);
          }
@@ -362,6 +373,68 @@ ClientSessionData::printStats()
       total += it.second._romClass->romSize;
 
    j9tty_printf(PORTLIB, "\tTotal size of cached ROM classes + methods: %d bytes\n", total);
+   size_t budget = TR::CompilationInfo::get()->getPersistentInfo()->getJITServerClientSessionMemoryBudget();
+   if (budget)
+      {
+      j9tty_printf(PORTLIB, "\tEstimated class cache footprint: %zu bytes (budget %zu bytes)\n", _classCacheFootprint, budget);
+      j9tty_printf(PORTLIB, "\tNum classes evicted to stay within budget: %llu\n", (unsigned long long)_numEvictedClasses);
+      }
+   }
+
+size_t
+ClientSessionData::classInfoFootprint(const J9ROMClass *romClass)
+   {
+   // The ROMClass copy dominates; the map nodes are approximated by the size of their values
+   return romClass->romSize + sizeof(ClassInfo) + romClass->romMethodCount * sizeof(J9MethodInfo);
+   }
+
+void
+ClientSessionData::evictClassesOverMemoryBudget()
+   {
+   size_t budget = TR::CompilationInfo::get()->getPersistentInfo()->getJITServerClientSessionMemoryBudget();
+   std::vector<TR_OpaqueClassBlock *> victims;
+      {
+      OMR::CriticalSection evictClasses(getROMMapMonitor());
+      if (!budget || (_classCacheFootprint <= budget) || _romClassMap.empty())
+         return;
+
+      // Evict down to a low watermark so that we do not sweep again at the next compilation
+      size_t target = budget - budget / 8;
+      size_t footprint = _classCacheFootprint;
+      auto it = _evictionClockHand ? _romClassMap.find(_evictionClockHand) : _romClassMap.begin();
+      // Two revolutions of the clock hand are enough: the first one clears all referenced bits
+      size_t maxVisits = 2 * _romClassMap.size();
+      for (size_t visits = 0; (visits < maxVisits) && (footprint > target); ++visits, ++it)
+         {
+         if (it == _romClassMap.end())
+            it = _romClassMap.begin();
+         // Stop after a full revolution from the first victim to avoid selecting it twice
+         if (!victims.empty() && (it->first == (J9Class *)victims.front()))
+            break;
+         if (it->second._referenced)
+            {
+            it->second._referenced = false;
+            }
+         else
+            {
+            victims.push_back((TR_OpaqueClassBlock *)it->first);
+            footprint -= classInfoFootprint(it->second._romClass);
+            }
+         }
+      _evictionClockHand = (it == _romClassMap.end()) ? NULL : it->first;
+      }
+
+   if (victims.empty())
+      return;
+
+   if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+      TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
+         "compThreadID=%d will evict %zu classes for clientUID %llu: class cache footprint %zu bytes exceeds budget %zu bytes",
+         TR::compInfoPT->getCompThreadId(), victims.size(), (unsigned long long)_clientUID, _classCacheFootprint, budget);
+
+   // Evicted classes are not unloaded at the client, so they must not be added to _unloadedClassAddresses
+   processUnloadedClasses(victims, false);
+   _numEvictedClasses += victims.size();
    }
 
 ClientSessionData::ClassInfo::ClassInfo() :
@@ -395,7 +468,8 @@ ClientSessionData::ClassInfo::ClassInfo() :
    _fieldOrStaticDeclaringClassCache(decltype(_fieldOrStaticDeclaringClassCache)::allocator_type(TR::Compiler->persistentAllocator())),
    _fieldOrStaticDefiningClassCache(decltype(_fieldOrStaticDefiningClassCache)::allocator_type(TR::Compiler->persistentAllocator())),
    _J9MethodNameCache(decltype(_J9MethodNameCache)::allocator_type(TR::Compiler->persistentAllocator())),
-   _referencingClassLoaders(decltype(_referencingClassLoaders)::allocator_type(TR::Compiler->persistentAllocator()))
+   _referencingClassLoaders(decltype(_referencingClassLoaders)::allocator_type(TR::Compiler->persistentAllocator())),
+   _referenced(true)
    {
    }
 
@@ -517,6 +591,9 @@ ClientSessionData::clearCaches()
       it.second.freeClassInfo(_persistentMemory);
 
    _romClassMap.clear();
+   _classCacheFootprint = 0;
+   _evictionClockHand = NULL;
+   _classByROMClassHashMap.clear();
 
    _classChainDataMap.clear();
 
@@ -27,6 +27,7 @@
 #include "env/PersistentCollections.hpp" // for PersistentUnorderedMap
 #include "il/DataTypes.hpp" // for DataType
 #include "env/VMJ9.h" // for TR_StaticFinalData
+#include "runtime/JITServerROMClassHash.hpp"
 #include "runtime/SymbolValidationManager.hpp"
 
 class J9ROMClass;
@@ -216,6 +217,7 @@ class ClientSessionData
       PersistentUnorderedMap<int32_t, TR_OpaqueClassBlock *> _fieldOrStaticDefiningClassCache;
       PersistentUnorderedMap<int32_t, J9MethodNameAndSignature> _J9MethodNameCache; // key is a cpIndex
       PersistentUnorderedSet<J9ClassLoader *> _referencingClassLoaders;
+      bool _referenced; // set when the entry is used; cleared by the clock sweep of evictClassesOverMemoryBudget()
 
       char* getROMString(int32_t& len, void *basePtr, std::initializer_list<size_t> offsets);
       }; // struct ClassInfo
@@ -318,12 +320,25 @@ class ClientSessionData
    TR_PersistentCHTable *getCHTable();
    PersistentUnorderedMap<J9Class*, ClassInfo> & getROMClassMap() { return _romClassMap; }
    PersistentUnorderedMap<J9Method*, J9MethodInfo> & getJ9MethodMap() { return _J9MethodMap; }
+   // Only populated when profiling data is shared across clients; must be accessed with the ROMMapMonitor in hand
+   PersistentUnorderedMap<JITServerROMClassHash, J9Class*> & getClassByROMClassHashMap() { return _classByROMClassHashMap; }
    PersistentUnorderedMap<ClassLoaderStringPair, TR_OpaqueClassBlock*> & getClassBySignatureMap() { return _classBySignatureMap; }
    PersistentUnorderedMap<J9Class *, UDATA *> & getClassChainDataCache() { return _classChainDataMap; }
    PersistentUnorderedMap<J9ConstantPool *, TR_OpaqueClassBlock*> & getConstantPoolToClassMap() { return _constantPoolToClassMap; }
    void initializeUnloadedClassAddrRanges(const std::vector<TR_AddressRange> &unloadedClassRanges, int32_t maxRanges);
    void processUnloadedClasses(const std::vector<TR_OpaqueClassBlock*> &classes, bool updateUnloadedClasses);
    void processIllegalFinalFieldModificationList(const std::vector<TR_OpaqueClassBlock*> &classes);
+   // Estimated memory held by the _romClassMap and _J9MethodMap entries of a class
+   static size_t classInfoFootprint(const J9ROMClass *romClass);
+   // Must be called with the ROMMapMonitor in hand
+   void addToClassCacheFootprint(const J9ROMClass *romClass) { _classCacheFootprint += classInfoFootprint(romClass); }
+   size_t getClassCacheFootprint() const { return _classCacheFootprint; }
+   // Evicts the least recently used classes when the footprint of the class caches exceeds the
+   // budget set with -XX:JITServerClientSessionMemoryBudget=. Evicted classes are purged like unloaded
+   // classes and are fetched again from the client when needed. Must only be called when no other
+   // thread is working on a compilation for this client, because such threads may hold pointers
+   // into the evicted entries.
+   void evictClassesOverMemoryBudget();
    TR::Monitor *getROMMapMonitor() { return _romMapMonitor; }
    TR::Monitor *getClassMapMonitor() { return _classMapMonitor; }
    TR::Monitor *getClassChainDataMapMonitor() { return _classChainDataMapMonitor; }
@@ -418,6 +433,12 @@ class ClientSessionData
    PersistentUnorderedMap<J9Class*, ClassInfo> _romClassMap;
    // Hashtable for information related to one J9Method
    PersistentUnorderedMap<J9Method*, J9MethodInfo> _J9MethodMap;
+   size_t _classCacheFootprint; // estimated bytes held by _romClassMap and _J9MethodMap; guarded by ROMMapMonitor
+   J9Class *_evictionClockHand; // class where the next eviction sweep resumes; NULL means start of _romClassMap
+   uint64_t _numEvictedClasses;
+   // Maps the hash of a shared ROMClass to a class of this client with that ROMClass. Used to translate
+   // receiver classes in the profiling data aggregated across clients (see JITServerSharedProfileCache)
+   PersistentUnorderedMap<JITServerROMClassHash, J9Class*> _classByROMClassHashMap;
    // The following hashtable caches <classname> --> <J9Class> mappings
    // All classes in here are loaded by the systemClassLoader so we know they cannot be unloaded
    PersistentUnorderedMap<ClassLoaderStringPair, TR_OpaqueClassBlock*> _classBySignatureMap;
@@ -23,6 +23,7 @@
 #include "control/CompilationRuntime.hpp"
 #include "env/StackMemoryRegion.hpp"
 #include "infra/CriticalSection.hpp"
+#include "net/CommunicationStream.hpp"
 #include "runtime/JITServerAOTCache.hpp"
 #include "runtime/JITServerSharedROMClassCache.hpp"
 
@@ -87,6 +88,30 @@ AOTCacheClassRecord::create(uintptr_t id, const AOTCacheClassLoaderRecord *class
    return new (ptr) AOTCacheClassRecord(id, classLoaderRecord, hash, romClass);
    }
 
+ClassSerializationRecord::ClassSerializationRecord(uintptr_t id, uintptr_t classLoaderId,
+                                                   const JITServerROMClassHash &hash, uint32_t romClassSize,
+                                                   const uint8_t *name, size_t nameLength) :
+   AOTSerializationRecord(size(nameLength), id, AOTSerializationRecordType::Class),
+   _classLoaderId(classLoaderId), _hash(hash), _romClassSize(romClassSize), _nameLength(nameLength)
+   {
+   memcpy(_name, name, nameLength);
+   }
+
+AOTCacheClassRecord::AOTCacheClassRecord(uintptr_t id, const AOTCacheClassLoaderRecord *classLoaderRecord,
+                                         const ClassSerializationRecord &data) :
+   _classLoaderRecord(classLoaderRecord),
+   _data(id, classLoaderRecord->data().id(), data.hash(), data.romClassSize(), data.name(), data.nameLength())
+   {
+   }
+
+AOTCacheClassRecord *
+AOTCacheClassRecord::create(uintptr_t id, const AOTCacheClassLoaderRecord *classLoaderRecord,
+                            const ClassSerializationRecord &data)
+   {
+   void *ptr = AOTCacheRecord::allocate(size(data.nameLength()));
+   return new (ptr) AOTCacheClassRecord(id, classLoaderRecord, data);
+   }
+
 void
 AOTCacheClassRecord::subRecordsDo(const std::function<void(const AOTCacheRecord *)> &f) const
    {
@@ -227,6 +252,30 @@ CachedAOTMethod::create(const AOTCacheClassChainRecord *definingClassChainRecord
                                     records, code, codeSize, data, dataSize);
    }
 
+CachedAOTMethod::CachedAOTMethod(const AOTCacheClassChainRecord *definingClassChainRecord,
+                                 const AOTCacheAOTHeaderRecord *aotHeaderRecord,
+                                 const AOTCacheRecord *const *records, const SerializedAOTMethod &data) :
+   _definingClassChainRecord(definingClassChainRecord),
+   _data(definingClassChainRecord->data().id(), data.index(), data.optLevel(), aotHeaderRecord->data().id(),
+         data.numRecords(), data.code(), data.codeSize(), data.data(), data.dataSize())
+   {
+   for (size_t i = 0; i < data.numRecords(); ++i)
+      {
+      const AOTSerializationRecord *record = records[i]->dataAddr();
+      new (&_data.offsets()[i]) SerializedSCCOffset(record->id(), record->type(), data.offsets()[i].reloDataOffset());
+      ((const AOTCacheRecord **)this->records())[i] = records[i];
+      }
+   }
+
+CachedAOTMethod *
+CachedAOTMethod::create(const AOTCacheClassChainRecord *definingClassChainRecord,
+                        const AOTCacheAOTHeaderRecord *aotHeaderRecord,
+                        const AOTCacheRecord *const *records, const SerializedAOTMethod &data)
+   {
+   void *ptr = AOTCacheRecord::allocate(size(data.numRecords(), data.codeSize(), data.dataSize()));
+   return new (ptr) CachedAOTMethod(definingClassChainRecord, aotHeaderRecord, records, data);
+   }
+
 
 bool
 JITServerAOTCache::ClassLoaderKey::operator==(const ClassLoaderKey &k) const
@@ -662,6 +711,636 @@ JITServerAOTCache::addRecord(const AOTCacheRecord *record, Vector<const AOTSeria
    }
 
 
+// Snapshot file layout:
+// - AOTCacheSnapshotHeader;
+// - AOT cache name (nameLength bytes);
+// - serialization records of each type (in the order of AOTSerializationRecordType values), sorted by ID;
+// - serialized AOT methods.
+// Records and methods are stored in the same format that is used to send them to clients over the network.
+// Since records are never removed from the cache, record IDs of each type are always 1..numRecords[type].
+struct AOTCacheSnapshotHeader
+   {
+   char _eyeCatcher[8];
+   // Full JITServer version (including configuration flags) of the server that wrote the snapshot
+   uint64_t _version;
+   size_t _nameLength;
+   size_t _numRecords[AOTSerializationRecordType_MAX];
+   size_t _numCachedMethods;
+   };
+
+static const char AOT_CACHE_SNAPSHOT_EYECATCHER[sizeof(AOTCacheSnapshotHeader::_eyeCatcher)] = "J9AOTCS";
+
+
+// Collect the records stored in the map into a vector indexed by (record ID - 1)
+template<typename K, typename V, typename H> static void
+getRecordsById(const PersistentUnorderedMap<K, V *, H> &map, TR::Monitor *monitor,
+               PersistentVector<const AOTCacheRecord *> &result)
+   {
+   OMR::CriticalSection cs(monitor);
+
+   result.resize(map.size(), NULL);
+   for (auto &kv : map)
+      {
+      uintptr_t id = kv.second->data().id();
+      TR_ASSERT((id > 0) && (id <= result.size()), "Invalid record ID %zu", id);
+      result[id - 1] = kv.second;
+      }
+   }
+
+bool
+JITServerAOTCache::writeCache(FILE *f) const
+   {
+   PersistentVector<const CachedAOTMethod *> methods(
+      PersistentVector<const CachedAOTMethod *>::allocator_type(TR::Compiler->persistentAllocator())
+   );
+   PersistentVector<const AOTCacheRecord *>::allocator_type allocator(TR::Compiler->persistentAllocator());
+   PersistentVector<const AOTCacheRecord *> classLoaderRecords(allocator);
+   PersistentVector<const AOTCacheRecord *> classRecords(allocator);
+   PersistentVector<const AOTCacheRecord *> methodRecords(allocator);
+   PersistentVector<const AOTCacheRecord *> classChainRecords(allocator);
+   PersistentVector<const AOTCacheRecord *> wellKnownClassesRecords(allocator);
+   PersistentVector<const AOTCacheRecord *> aotHeaderRecords(allocator);
+
+   // Collect methods and records in reverse dependency order. Records are never removed, and a record is
+   // always created after its sub-records. This guarantees that the snapshot is consistent even if new
+   // records and methods are concurrently added while it is being collected.
+      {
+      OMR::CriticalSection cs(_cachedMethodMonitor);
+      methods.reserve(_cachedMethodMap.size());
+      for (auto &kv : _cachedMethodMap)
+         methods.push_back(kv.second);
+      }
+   getRecordsById(_aotHeaderMap, _aotHeaderMonitor, aotHeaderRecords);
+   getRecordsById(_wellKnownClassesMap, _wellKnownClassesMonitor, wellKnownClassesRecords);
+   getRecordsById(_classChainMap, _classChainMonitor, classChainRecords);
+   getRecordsById(_methodMap, _methodMonitor, methodRecords);
+   getRecordsById(_classMap, _classMonitor, classRecords);
+   getRecordsById(_classLoaderMap, _classLoaderMonitor, classLoaderRecords);
+
+   // Indexed by AOTSerializationRecordType
+   const PersistentVector<const AOTCacheRecord *> *records[] =
+      {
+      &classLoaderRecords, &classRecords, &methodRecords,
+      &classChainRecords, &wellKnownClassesRecords, &aotHeaderRecords
+      };
+   static_assert(sizeof(records) / sizeof(records[0]) == AOTSerializationRecordType_MAX, "Missing record types");
+
+   AOTCacheSnapshotHeader header;
+   memcpy(header._eyeCatcher, AOT_CACHE_SNAPSHOT_EYECATCHER, sizeof(header._eyeCatcher));
+   header._version = JITServer::CommunicationStream::getJITServerFullVersion();
+   header._nameLength = _name.size();
+   for (size_t i = 0; i < AOTSerializationRecordType_MAX; ++i)
+      header._numRecords[i] = records[i]->size();
+   header._numCachedMethods = methods.size();
+
+   if ((1 != fwrite(&header, sizeof(header), 1, f)) || (_name.size() != fwrite(_name.data(), 1, _name.size(), f)))
+      return false;
+
+   for (size_t i = 0; i < AOTSerializationRecordType_MAX; ++i)
+      {
+      for (auto r : *records[i])
+         {
+         const AOTSerializationRecord *record = r->dataAddr();
+         if (1 != fwrite(record, record->size(), 1, f))
+            return false;
+         }
+      }
+
+   for (auto m : methods)
+      {
+      if (1 != fwrite(&m->data(), m->data().size(), 1, f))
+         return false;
+      }
+
+   if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+      TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
+         "AOT cache %s: wrote snapshot with %zu methods, %zu classes, %zu class chains",
+         _name.c_str(), methods.size(), classRecords.size(), classChainRecords.size()
+      );
+
+   return true;
+   }
+
+
+// Read a contiguous object (serialization record or serialized AOT method) that
+// starts with its size into the buffer. Returns false if the object is invalid.
+static bool
+readSizedObject(FILE *f, std::string &buffer, size_t minSize, size_t maxSize)
+   {
+   size_t size = 0;
+   if ((1 != fread(&size, sizeof(size), 1, f)) || (size < minSize) || (size > maxSize))
+      return false;
+
+   buffer.resize(size);
+   memcpy(&buffer[0], &size, sizeof(size));
+   return 1 == fread(&buffer[sizeof(size)], size - sizeof(size), 1, f);
+   }
+
+// Returns the record with the given ID from the vector indexed by (record ID - 1), or NULL if the ID is invalid
+static const AOTCacheRecord *
+getRecordById(const PersistentVector<const AOTCacheRecord *> &records, uintptr_t id)
+   {
+   return ((id > 0) && (id <= records.size())) ? records[id - 1] : NULL;
+   }
+
+// Resolve the list of record IDs into a list of record pointers. Returns false if any of the IDs is invalid.
+template<class R> static bool
+resolveIdList(const IdList &list, const PersistentVector<const AOTCacheRecord *> &records,
+              PersistentVector<const R *> &result)
+   {
+   result.resize(list.length());
+   for (size_t i = 0; i < list.length(); ++i)
+      {
+      result[i] = static_cast<const R *>(getRecordById(records, list.ids()[i]));
+      if (!result[i])
+         return false;
+      }
+   return true;
+   }
+
+bool
+JITServerAOTCache::readRecords(FILE *f, const size_t numRecords[], size_t numCachedMethods, size_t fileSize)
+   {
+   //NOTE: This cache is not yet visible to other threads, so there is no need to acquire any monitors
+   PersistentVector<const AOTCacheRecord *>::allocator_type allocator(TR::Compiler->persistentAllocator());
+   // Indexed by AOTSerializationRecordType and (record ID - 1)
+   PersistentVector<const AOTCacheRecord *> records[] =
+      {
+      PersistentVector<const AOTCacheRecord *>(allocator), PersistentVector<const AOTCacheRecord *>(allocator),
+      PersistentVector<const AOTCacheRecord *>(allocator), PersistentVector<const AOTCacheRecord *>(allocator),
+      PersistentVector<const AOTCacheRecord *>(allocator), PersistentVector<const AOTCacheRecord *>(allocator)
+      };
+   static_assert(sizeof(records) / sizeof(records[0]) == AOTSerializationRecordType_MAX, "Missing record types");
+
+   PersistentVector<const AOTCacheClassRecord *> classRecords(
+      PersistentVector<const AOTCacheClassRecord *>::allocator_type(TR::Compiler->persistentAllocator())
+   );
+   PersistentVector<const AOTCacheClassChainRecord *> classChainRecords(
+      PersistentVector<const AOTCacheClassChainRecord *>::allocator_type(TR::Compiler->persistentAllocator())
+   );
+   std::string buffer;
+
+   for (size_t type = 0; type < AOTSerializationRecordType_MAX; ++type)
+      {
+      records[type].reserve(numRecords[type]);
+      for (size_t i = 0; i < numRecords[type]; ++i)
+         {
+         if (!readSizedObject(f, buffer, sizeof(AOTSerializationRecord), fileSize))
+            return false;
+         auto data = AOTSerializationRecord::get(buffer);
+         if ((data->type() != type) || (data->id() != i + 1))
+            return false;
+
+         const AOTCacheRecord *result = NULL;
+         switch (type)
+            {
+            case AOTSerializationRecordType::ClassLoader:
+               {
+               auto r = (const ClassLoaderSerializationRecord *)data;
+               if ((r->size() < sizeof(*r)) || (r->nameLength() == 0) || (r->nameLength() > r->size() - sizeof(*r)))
+                  return false;
+               auto it = _classLoaderMap.find({ r->name(), r->nameLength() });
+               if (it != _classLoaderMap.end())
+                  return false;
+
+               auto record = AOTCacheClassLoaderRecord::create(r->id(), r->name(), r->nameLength());
+               addToMap(_classLoaderMap, it, { record->data().name(), record->data().nameLength() }, record);
+               result = record;
+               break;
+               }
+
+            case AOTSerializationRecordType::Class:
+               {
+               auto r = (const ClassSerializationRecord *)data;
+               if ((r->size() < sizeof(*r)) || (r->nameLength() > r->size() - sizeof(*r)))
+                  return false;
+               auto loaderRecord = (const AOTCacheClassLoaderRecord *)getRecordById(
+                  records[AOTSerializationRecordType::ClassLoader], r->classLoaderId()
+               );
+               if (!loaderRecord)
+                  return false;
+               auto it = _classMap.find({ loaderRecord, &r->hash() });
+               if (it != _classMap.end())
+                  return false;
+
+               auto record = AOTCacheClassRecord::create(r->id(), loaderRecord, *r);
+               addToMap(_classMap, it, { loaderRecord, &record->data().hash() }, record);
+               result = record;
+               break;
+               }
+
+            case AOTSerializationRecordType::Method:
+               {
+               auto r = (const MethodSerializationRecord *)data;
+               if (r->size() != sizeof(*r))
+                  return false;
+               auto classRecord = (const AOTCacheClassRecord *)getRecordById(
+                  records[AOTSerializationRecordType::Class], r->definingClassId()
+               );
+               if (!classRecord)
+                  return false;
+               MethodKey key(classRecord, r->index());
+               auto it = _methodMap.find(key);
+               if (it != _methodMap.end())
+                  return false;
+
+               auto record = AOTCacheMethodRecord::create(r->id(), classRecord, r->index());
+               addToMap(_methodMap, it, key, record);
+               result = record;
+               break;
+               }
+
+            case AOTSerializationRecordType::ClassChain:
+               {
+               auto r = (const ClassChainSerializationRecord *)data;
+               if ((r->size() < sizeof(*r)) || (r->list().length() == 0) ||
+                   (r->list().length() > (r->size() - sizeof(*r)) / sizeof(uintptr_t)))
+                  return false;
+               if (!resolveIdList(r->list(), records[AOTSerializationRecordType::Class], classRecords))
+                  return false;
+               size_t length = classRecords.size();
+               auto it = _classChainMap.find({ classRecords.data(), length });
+               if (it != _classChainMap.end())
+                  return false;
+
+               auto record = AOTCacheClassChainRecord::create(r->id(), classRecords.data(), length);
+               addToMap(_classChainMap, it, { record->records(), length }, record);
+               result = record;
+               break;
+               }
+
+            case AOTSerializationRecordType::WellKnownClasses:
+               {
+               auto r = (const WellKnownClassesSerializationRecord *)data;
+               if ((r->size() < sizeof(*r)) || (r->list().length() > (r->size() - sizeof(*r)) / sizeof(uintptr_t)))
+                  return false;
+               if (!resolveIdList(r->list(), records[AOTSerializationRecordType::ClassChain], classChainRecords))
+                  return false;
+               size_t length = classChainRecords.size();
+               auto it = _wellKnownClassesMap.find({ classChainRecords.data(), length, r->includedClasses() });
+               if (it != _wellKnownClassesMap.end())
+                  return false;
+
+               auto record = AOTCacheWellKnownClassesRecord::create(r->id(), classChainRecords.data(),
+                                                                    length, r->includedClasses());
+               addToMap(_wellKnownClassesMap, it, { record->records(), length, r->includedClasses() }, record);
+               result = record;
+               break;
+               }
+
+            case AOTSerializationRecordType::AOTHeader:
+               {
+               auto r = (const AOTHeaderSerializationRecord *)data;
+               if (r->size() != sizeof(*r))
+                  return false;
+               auto it = _aotHeaderMap.find({ r->header() });
+               if (it != _aotHeaderMap.end())
+                  return false;
+
+               auto record = AOTCacheAOTHeaderRecord::create(r->id(), r->header());
+               addToMap(_aotHeaderMap, it, { record->data().header() }, record);
+               result = record;
+               break;
+               }
+            }
+
+         records[type].push_back(result);
+         }
+      }
+
+   _nextClassLoaderId = records[AOTSerializationRecordType::ClassLoader].size() + 1;
+   _nextClassId = records[AOTSerializationRecordType::Class].size() + 1;
+   _nextMethodId = records[AOTSerializationRecordType::Method].size() + 1;
+   _nextClassChainId = records[AOTSerializationRecordType::ClassChain].size() + 1;
+   _nextWellKnownClassesId = records[AOTSerializationRecordType::WellKnownClasses].size() + 1;
+   _nextAOTHeaderId = records[AOTSerializationRecordType::AOTHeader].size() + 1;
+
+   PersistentVector<const AOTCacheRecord *> methodRecords(allocator);
+   for (size_t i = 0; i < numCachedMethods; ++i)
+      {
+      if (!readSizedObject(f, buffer, sizeof(SerializedAOTMethod), fileSize))
+         return false;
+      auto m = (const SerializedAOTMethod *)buffer.data();
+      size_t varSize = m->size() - sizeof(*m);
+      if ((m->numRecords() > varSize / sizeof(SerializedSCCOffset)) ||
+          (m->codeSize() > varSize) || (m->dataSize() > varSize) ||
+          (m->numRecords() * sizeof(SerializedSCCOffset) + m->codeSize() + m->dataSize() > varSize))
+         return false;
+
+      auto chainRecord = (const AOTCacheClassChainRecord *)getRecordById(
+         records[AOTSerializationRecordType::ClassChain], m->definingClassChainId()
+      );
+      auto aotHeaderRecord = (const AOTCacheAOTHeaderRecord *)getRecordById(
+         records[AOTSerializationRecordType::AOTHeader], m->aotHeaderId()
+      );
+      if (!chainRecord || !aotHeaderRecord)
+         return false;
+
+      methodRecords.resize(m->numRecords());
+      for (size_t j = 0; j < m->numRecords(); ++j)
+         {
+         const SerializedSCCOffset &offset = m->offsets()[j];
+         // Only these record types can correspond to SCC offsets in AOT method relocation data
+         if ((offset.recordType() <= AOTSerializationRecordType::ClassLoader) ||
+             (offset.recordType() >= AOTSerializationRecordType::AOTHeader))
+            return false;
+         methodRecords[j] = getRecordById(records[offset.recordType()], offset.recordId());
+         if (!methodRecords[j])
+            return false;
+         }
+
+      CachedMethodKey key(chainRecord, m->index(), m->optLevel(), aotHeaderRecord);
+      auto it = _cachedMethodMap.find(key);
+      if (it != _cachedMethodMap.end())
+         return false;
+
+      auto method = CachedAOTMethod::create(chainRecord, aotHeaderRecord, methodRecords.data(), *m);
+      addToMap(_cachedMethodMap, it, key, method);
+      }
+
+   return true;
+   }
+
+JITServerAOTCache *
+JITServerAOTCache::readCache(FILE *f, const std::string &name)
+   {
+   if ((0 != fseek(f, 0, SEEK_END)))
+      return NULL;
+   long fileSize = ftell(f);
+   if ((fileSize < 0) || (0 != fseek(f, 0, SEEK_SET)))
+      return NULL;
+
+   AOTCacheSnapshotHeader header;
+   if (1 != fread(&header, sizeof(header), 1, f))
+      return NULL;
+   if ((0 != memcmp(header._eyeCatcher, AOT_CACHE_SNAPSHOT_EYECATCHER, sizeof(header._eyeCatcher))) ||
+       (header._version != JITServer::CommunicationStream::getJITServerFullVersion()) ||
+       (header._nameLength != name.size()))
+      return NULL;
+
+   std::string snapshotName(name.size(), '\0');
+   if ((name.size() != fread(&snapshotName[0], 1, name.size(), f)) || (snapshotName != name))
+      return NULL;
+
+   auto cache = new (TR::Compiler->persistentGlobalMemory()) JITServerAOTCache(name);
+   if (!cache)
+      throw std::bad_alloc();
+
+   bool success = false;
+   try
+      {
+      success = cache->readRecords(f, header._numRecords, header._numCachedMethods, (size_t)fileSize);
+      }
+   catch (...)
+      {
+      cache->~JITServerAOTCache();
+      TR::Compiler->persistentGlobalMemory()->freePersistentMemory(cache);
+      throw;
+      }
+
+   if (!success)
+      {
+      cache->~JITServerAOTCache();
+      TR::Compiler->persistentGlobalMemory()->freePersistentMemory(cache);
+      return NULL;
+      }
+
+   if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+      TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
+         "AOT cache %s: read snapshot with %zu methods, %zu classes, %zu class chains",
+         name.c_str(), header._numCachedMethods, header._numRecords[AOTSerializationRecordType::Class],
+         header._numRecords[AOTSerializationRecordType::ClassChain]
+      );
+
+   return cache;
+   }
+
+size_t
+JITServerAOTCache::mergeCache(const JITServerAOTCache &other)
+   {
+   PersistentVector<const AOTCacheRecord *>::allocator_type allocator(TR::Compiler->persistentAllocator());
+   // Records of the other cache indexed by (record ID - 1)
+   PersistentVector<const AOTCacheRecord *> otherRecords(allocator);
+   // Records of this cache corresponding to the records of the other cache,
+   // indexed by AOTSerializationRecordType and (other record ID - 1)
+   PersistentVector<const AOTCacheRecord *> records[] =
+      {
+      PersistentVector<const AOTCacheRecord *>(allocator), PersistentVector<const AOTCacheRecord *>(allocator),
+      PersistentVector<const AOTCacheRecord *>(allocator), PersistentVector<const AOTCacheRecord *>(allocator),
+      PersistentVector<const AOTCacheRecord *>(allocator), PersistentVector<const AOTCacheRecord *>(allocator)
+      };
+   static_assert(sizeof(records) / sizeof(records[0]) == AOTSerializationRecordType_MAX, "Missing record types");
+
+   PersistentVector<const AOTCacheClassRecord *> classRecords(
+      PersistentVector<const AOTCacheClassRecord *>::allocator_type(TR::Compiler->persistentAllocator())
+   );
+   PersistentVector<const AOTCacheClassChainRecord *> classChainRecords(
+      PersistentVector<const AOTCacheClassChainRecord *>::allocator_type(TR::Compiler->persistentAllocator())
+   );
+   size_t numNewRecords = 0;
+
+   // Records are merged in dependency order, so that the sub-records of each record are already mapped
+   getRecordsById(other._classLoaderMap, other._classLoaderMonitor, otherRecords);
+      {
+      OMR::CriticalSection cs(_classLoaderMonitor);
+      for (auto r : otherRecords)
+         {
+         auto &data = ((const AOTCacheClassLoaderRecord *)r)->data();
+         auto it = _classLoaderMap.find({ data.name(), data.nameLength() });
+         if (it == _classLoaderMap.end())
+            {
+            auto record = AOTCacheClassLoaderRecord::create(_nextClassLoaderId, data.name(), data.nameLength());
+            addToMap(_classLoaderMap, it, { record->data().name(), record->data().nameLength() }, record);
+            ++_nextClassLoaderId;
+            ++numNewRecords;
+            records[AOTSerializationRecordType::ClassLoader].push_back(record);
+            }
+         else
+            {
+            records[AOTSerializationRecordType::ClassLoader].push_back(it->second);
+            }
+         }
+      }
+
+   getRecordsById(other._classMap, other._classMonitor, otherRecords);
+      {
+      OMR::CriticalSection cs(_classMonitor);
+      for (auto r : otherRecords)
+         {
+         auto &data = ((const AOTCacheClassRecord *)r)->data();
+         auto loaderRecord = (const AOTCacheClassLoaderRecord *)getRecordById(
+            records[AOTSerializationRecordType::ClassLoader], data.classLoaderId()
+         );
+         TR_ASSERT(loaderRecord, "Invalid class loader ID %zu", data.classLoaderId());
+         auto it = _classMap.find({ loaderRecord, &data.hash() });
+         if (it == _classMap.end())
+            {
+            auto record = AOTCacheClassRecord::create(_nextClassId, loaderRecord, data);
+            addToMap(_classMap, it, { loaderRecord, &record->data().hash() }, record);
+            ++_nextClassId;
+            ++numNewRecords;
+            records[AOTSerializationRecordType::Class].push_back(record);
+            }
+         else
+            {
+            records[AOTSerializationRecordType::Class].push_back(it->second);
+            }
+         }
+      }
+
+   getRecordsById(other._methodMap, other._methodMonitor, otherRecords);
+      {
+      OMR::CriticalSection cs(_methodMonitor);
+      for (auto r : otherRecords)
+         {
+         auto &data = ((const AOTCacheMethodRecord *)r)->data();
+         auto classRecord = (const AOTCacheClassRecord *)getRecordById(
+            records[AOTSerializationRecordType::Class], data.definingClassId()
+         );
+         TR_ASSERT(classRecord, "Invalid class ID %zu", data.definingClassId());
+         MethodKey key(classRecord, data.index());
+         auto it = _methodMap.find(key);
+         if (it == _methodMap.end())
+            {
+            auto record = AOTCacheMethodRecord::create(_nextMethodId, classRecord, data.index());
+            addToMap(_methodMap, it, key, record);
+            ++_nextMethodId;
+            ++numNewRecords;
+            records[AOTSerializationRecordType::Method].push_back(record);
+            }
+         else
+            {
+            records[AOTSerializationRecordType::Method].push_back(it->second);
+            }
+         }
+      }
+
+   getRecordsById(other._classChainMap, other._classChainMonitor, otherRecords);
+      {
+      OMR::CriticalSection cs(_classChainMonitor);
+      for (auto r : otherRecords)
+         {
+         auto &data = ((const AOTCacheClassChainRecord *)r)->data();
+         bool valid = resolveIdList(data.list(), records[AOTSerializationRecordType::Class], classRecords);
+         TR_ASSERT(valid, "Invalid class chain record ID %zu", data.id());
+         size_t length = classRecords.size();
+         auto it = _classChainMap.find({ classRecords.data(), length });
+         if (it == _classChainMap.end())
+            {
+            auto record = AOTCacheClassChainRecord::create(_nextClassChainId, classRecords.data(), length);
+            addToMap(_classChainMap, it, { record->records(), length }, record);
+            ++_nextClassChainId;
+            ++numNewRecords;
+            records[AOTSerializationRecordType::ClassChain].push_back(record);
+            }
+         else
+            {
+            records[AOTSerializationRecordType::ClassChain].push_back(it->second);
+            }
+         }
+      }
+
+   getRecordsById(other._wellKnownClassesMap, other._wellKnownClassesMonitor, otherRecords);
+      {
+      OMR::CriticalSection cs(_wellKnownClassesMonitor);
+      for (auto r : otherRecords)
+         {
+         auto &data = ((const AOTCacheWellKnownClassesRecord *)r)->data();
+         bool valid = resolveIdList(data.list(), records[AOTSerializationRecordType::ClassChain], classChainRecords);
+         TR_ASSERT(valid, "Invalid well-known classes record ID %zu", data.id());
+         size_t length = classChainRecords.size();
+         auto it = _wellKnownClassesMap.find({ classChainRecords.data(), length, data.includedClasses() });
+         if (it == _wellKnownClassesMap.end())
+            {
+            auto record = AOTCacheWellKnownClassesRecord::create(_nextWellKnownClassesId, classChainRecords.data(),
+                                                                 length, data.includedClasses());
+            addToMap(_wellKnownClassesMap, it, { record->records(), length, data.includedClasses() }, record);
+            ++_nextWellKnownClassesId;
+            ++numNewRecords;
+            records[AOTSerializationRecordType::WellKnownClasses].push_back(record);
+            }
+         else
+            {
+            records[AOTSerializationRecordType::WellKnownClasses].push_back(it->second);
+            }
+         }
+      }
+
+   getRecordsById(other._aotHeaderMap, other._aotHeaderMonitor, otherRecords);
+      {
+      OMR::CriticalSection cs(_aotHeaderMonitor);
+      for (auto r : otherRecords)
+         {
+         auto &data = ((const AOTCacheAOTHeaderRecord *)r)->data();
+         auto it = _aotHeaderMap.find({ data.header() });
+         if (it == _aotHeaderMap.end())
+            {
+            auto record = AOTCacheAOTHeaderRecord::create(_nextAOTHeaderId, data.header());
+            addToMap(_aotHeaderMap, it, { record->data().header() }, record);
+            ++_nextAOTHeaderId;
+            ++numNewRecords;
+            records[AOTSerializationRecordType::AOTHeader].push_back(record);
+            }
+         else
+            {
+            records[AOTSerializationRecordType::AOTHeader].push_back(it->second);
+            }
+         }
+      }
+
+   PersistentVector<const CachedAOTMethod *> otherMethods(
+      PersistentVector<const CachedAOTMethod *>::allocator_type(TR::Compiler->persistentAllocator())
+   );
+      {
+      OMR::CriticalSection cs(other._cachedMethodMonitor);
+      otherMethods.reserve(other._cachedMethodMap.size());
+      for (auto &kv : other._cachedMethodMap)
+         otherMethods.push_back(kv.second);
+      }
+
+   size_t numNewMethods = 0;
+   PersistentVector<const AOTCacheRecord *> methodRecords(allocator);
+   for (auto m : otherMethods)
+      {
+      const SerializedAOTMethod &data = m->data();
+      auto chainRecord = (const AOTCacheClassChainRecord *)getRecordById(
+         records[AOTSerializationRecordType::ClassChain], data.definingClassChainId()
+      );
+      auto aotHeaderRecord = (const AOTCacheAOTHeaderRecord *)getRecordById(
+         records[AOTSerializationRecordType::AOTHeader], data.aotHeaderId()
+      );
+      TR_ASSERT(chainRecord && aotHeaderRecord, "Invalid cached method records");
+
+      methodRecords.resize(data.numRecords());
+      for (size_t i = 0; i < data.numRecords(); ++i)
+         {
+         const SerializedSCCOffset &offset = data.offsets()[i];
+         methodRecords[i] = getRecordById(records[offset.recordType()], offset.recordId());
+         TR_ASSERT(methodRecords[i], "Invalid record ID %zu type %u", offset.recordId(), (unsigned)offset.recordType());
+         }
+
+      CachedMethodKey key(chainRecord, data.index(), data.optLevel(), aotHeaderRecord);
+      OMR::CriticalSection cs(_cachedMethodMonitor);
+      auto it = _cachedMethodMap.find(key);
+      if (it != _cachedMethodMap.end())
+         continue;
+
+      // The new method refers to the records of this cache, and its serialized data is updated with their IDs
+      auto method = CachedAOTMethod::create(chainRecord, aotHeaderRecord, methodRecords.data(), data);
+      addToMap(_cachedMethodMap, it, key, method);
+      ++numNewMethods;
+      }
+
+   if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+      TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
+         "AOT cache %s: merged %zu new methods and %zu new records from snapshot",
+         _name.c_str(), numNewMethods, numNewRecords
+      );
+
+   return numNewMethods;
+   }
+
+
 JITServerAOTCacheMap::JITServerAOTCacheMap() :
    _map(decltype(_map)::allocator_type(TR::Compiler->persistentGlobalAllocator())),
    _monitor(TR::Monitor::create("JIT-JITServerAOTCacheMapMonitor"))
@@ -695,9 +1374,13 @@ JITServerAOTCacheMap::get(const std::string &name, uint64_t clientUID)
       return it->second;
       }
 
-   auto cache = new (TR::Compiler->persistentGlobalMemory()) JITServerAOTCache(name);
+   auto cache = loadSnapshot(name);
    if (!cache)
-      throw std::bad_alloc();
+      {
+      cache = new (TR::Compiler->persistentGlobalMemory()) JITServerAOTCache(name);
+      if (!cache)
+         throw std::bad_alloc();
+      }
 
    try
       {
@@ -715,3 +1398,124 @@ JITServerAOTCacheMap::get(const std::string &name, uint64_t clientUID)
                                      name.c_str(), (unsigned long long)clientUID);
    return cache;
    }
+
+
+std::string
+JITServerAOTCacheMap::snapshotFileName(const std::string &name) const
+   {
+   // AOT cache names are specified by clients and can contain arbitrary characters; replace
+   // the ones that are not safe to use in file names. The full name is stored in the snapshot
+   // header and verified when the snapshot is loaded, so collisions are harmless.
+   std::string fileName = name;
+   for (auto &c : fileName)
+      {
+      if (!isalnum((unsigned char)c) && (c != '-') && (c != '_') && (c != '.'))
+         c = '_';
+      }
+   return TR::CompilationInfo::get()->getPersistentInfo()->getJITServerAOTCacheDir() + "/" + fileName + ".aotcache";
+   }
+
+JITServerAOTCache *
+JITServerAOTCacheMap::loadSnapshot(const std::string &name) const
+   {
+   if (TR::CompilationInfo::get()->getPersistentInfo()->getJITServerAOTCacheDir().empty())
+      return NULL;
+
+   std::string fileName = snapshotFileName(name);
+   FILE *f = fopen(fileName.c_str(), "rb");
+   if (!f)
+      return NULL;
+
+   JITServerAOTCache *cache = NULL;
+   try
+      {
+      cache = JITServerAOTCache::readCache(f, name);
+      }
+   catch (...)
+      {
+      fclose(f);
+      throw;
+      }
+   fclose(f);
+
+   if (!cache && TR::Options::getVerboseOption(TR_VerboseJITServer))
+      TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Ignoring invalid or incompatible AOT cache snapshot %s",
+                                     fileName.c_str());
+   return cache;
+   }
+
+void
+JITServerAOTCacheMap::saveSnapshots()
+   {
+   if (TR::CompilationInfo::get()->getPersistentInfo()->getJITServerAOTCacheDir().empty())
+      return;
+
+   // AOT caches are never removed from the map, so it is safe to use them after releasing the monitor
+   PersistentVector<JITServerAOTCache *> caches(
+      PersistentVector<JITServerAOTCache *>::allocator_type(TR::Compiler->persistentAllocator())
+   );
+      {
+      OMR::CriticalSection cs(_monitor);
+      caches.reserve(_map.size());
+      for (auto &kv : _map)
+         caches.push_back(kv.second);
+      }
+
+   bool shared = TR::CompilationInfo::get()->getPersistentInfo()->getJITServerShareAOTCacheDir();
+   PORT_ACCESS_FROM_PORT(TR::Compiler->portLib);
+   for (auto cache : caches)
+      {
+      if (shared)
+         {
+         // Pick up the methods written by other servers since our last snapshot, so that they can be served
+         // by this server and are preserved when the file is overwritten. Concurrent writers can still race;
+         // the methods lost in that case are recovered by the writer's next snapshot.
+         if (JITServerAOTCache *snapshot = loadSnapshot(cache->name()))
+            {
+            try
+               {
+               cache->mergeCache(*snapshot);
+               }
+            catch (const std::bad_alloc &)
+               {
+               // Not enough memory to merge the rest of the snapshot; write what we have
+               }
+            snapshot->~JITServerAOTCache();
+            TR::Compiler->persistentGlobalMemory()->freePersistentMemory(snapshot);
+            }
+         }
+
+      // Write into a temporary file first so that a complete snapshot is never replaced with a partial one.
+      // The temporary file name is unique to this process in case the directory is shared.
+      std::string fileName = snapshotFileName(cache->name());
+      std::string tmpFileName = fileName + "." + std::to_string((unsigned long long)j9sysinfo_get_pid()) + ".tmp";
+      FILE *f = fopen(tmpFileName.c_str(), "wb");
+      if (!f)
+         {
+         if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "ERROR: Failed to create AOT cache snapshot file %s",
+                                           tmpFileName.c_str());
+         continue;
+         }
+
+      bool success = false;
+      try
+         {
+         success = cache->writeCache(f);
+         }
+      catch (const std::bad_alloc &)
+         {
+         // Not enough memory to collect the snapshot; skip this cache
+         }
+      success = (0 == fclose(f)) && success;
+      success = success && (0 == rename(tmpFileName.c_str(), fileName.c_str()));
+
+      if (!success)
+         {
+         remove(tmpFileName.c_str());
+         if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "ERROR: Failed to write AOT cache snapshot file %s",
+                                           fileName.c_str());
+         }
+      }
+   }
@@ -24,6 +24,7 @@
 #define JITSERVER_AOTCACHE_H
 
 #include <functional>
+#include <stdio.h>
 
 #include "env/TRMemory.hpp"
 #include "env/PersistentCollections.hpp"
@@ -98,11 +99,16 @@ public:
 
    static AOTCacheClassRecord *create(uintptr_t id, const AOTCacheClassLoaderRecord *classLoaderRecord,
                                       const JITServerROMClassHash &hash, const J9ROMClass *romClass);
+   // Used when loading a cache snapshot, where the original ROMClass is not available
+   static AOTCacheClassRecord *create(uintptr_t id, const AOTCacheClassLoaderRecord *classLoaderRecord,
+                                      const ClassSerializationRecord &data);
    void subRecordsDo(const std::function<void(const AOTCacheRecord *)> &f) const override;
 
 private:
    AOTCacheClassRecord(uintptr_t id, const AOTCacheClassLoaderRecord *classLoaderRecord,
                        const JITServerROMClassHash &hash, const J9ROMClass *romClass);
+   AOTCacheClassRecord(uintptr_t id, const AOTCacheClassLoaderRecord *classLoaderRecord,
+                       const ClassSerializationRecord &data);
 
    static size_t size(size_t nameLength)
       {
@@ -212,12 +218,19 @@ public:
                                   TR_Hotness optLevel, const AOTCacheAOTHeaderRecord *aotHeaderRecord,
                                   const Vector<std::pair<const AOTCacheRecord *, uintptr_t>> &records,
                                   const void *code, size_t codeSize, const void *data, size_t dataSize);
+   // Used when loading a cache snapshot; records[i] corresponds to data.offsets()[i]
+   static CachedAOTMethod *create(const AOTCacheClassChainRecord *definingClassChainRecord,
+                                  const AOTCacheAOTHeaderRecord *aotHeaderRecord,
+                                  const AOTCacheRecord *const *records, const SerializedAOTMethod &data);
 
 private:
    CachedAOTMethod(const AOTCacheClassChainRecord *definingClassChainRecord, uint32_t index,
                    TR_Hotness optLevel, const AOTCacheAOTHeaderRecord *aotHeaderRecord,
                    const Vector<std::pair<const AOTCacheRecord *, uintptr_t>> &records,
                    const void *code, size_t codeSize, const void *data, size_t dataSize);
+   CachedAOTMethod(const AOTCacheClassChainRecord *definingClassChainRecord,
+                   const AOTCacheAOTHeaderRecord *aotHeaderRecord,
+                   const AOTCacheRecord *const *records, const SerializedAOTMethod &data);
 
    static size_t size(size_t numRecords, size_t codeSize, size_t dataSize)
       {
@@ -281,6 +294,19 @@ public:
    Vector<const AOTSerializationRecord *>
    getSerializationRecords(const CachedAOTMethod *method, const KnownIdSet &knownIds, TR_Memory &trMemory) const;
 
+   // Write a snapshot of all the records and cached methods to a file.
+   // The snapshot is consistent (all the sub-records of the written records and methods are also written),
+   // but can miss records and methods that are added concurrently. Returns false in case of an I/O error.
+   bool writeCache(FILE *f) const;
+   // Read a cache snapshot previously written with writeCache(). Class records are not validated here;
+   // they are matched to ROMClasses of each client lazily by their hashes, same as newly created records.
+   // Returns NULL if the snapshot is invalid or was written by an incompatible JITServer version.
+   static JITServerAOTCache *readCache(FILE *f, const std::string &name);
+   // Add the records and methods of another cache (typically a snapshot written by another server sharing
+   // the same snapshot directory) that are missing in this cache. Merged records are assigned new IDs in
+   // this cache, so the IDs already known by clients stay valid. Returns the number of methods added.
+   size_t mergeCache(const JITServerAOTCache &other);
+
 private:
    struct ClassLoaderKey
       {
@@ -338,6 +364,9 @@ private:
    void addRecord(const AOTCacheRecord *record, Vector<const AOTSerializationRecord *> &result,
                   UnorderedSet<const AOTCacheRecord *> &newRecords, const KnownIdSet &knownIds) const;
 
+   // Helper method used in readCache(); returns false if the snapshot is invalid
+   bool readRecords(FILE *f, const size_t numRecords[], size_t numCachedMethods, size_t fileSize);
+
    const std::string _name;
 
    PersistentUnorderedMap<ClassLoaderKey, AOTCacheClassLoaderRecord *, ClassLoaderKey::Hash> _classLoaderMap;
@@ -381,7 +410,18 @@ public:
 
    JITServerAOTCache *get(const std::string &name, uint64_t clientUID);
 
+   // Write snapshots of all the AOT caches into the directory specified with -XX:JITServerAOTCacheDir=.
+   // Each cache is stored in its own file named after the cache name. With -XX:+JITServerShareAOTCacheDir
+   // the directory is shared by multiple server instances: the snapshot currently in the file is first merged
+   // into the cache, so that methods compiled by other instances are not lost and can be served by this one.
+   void saveSnapshots();
+
 private:
+   // Returns the snapshot file name for the AOT cache with the given name
+   std::string snapshotFileName(const std::string &name) const;
+   // Returns NULL if there is no valid snapshot for the AOT cache with the given name
+   JITServerAOTCache *loadSnapshot(const std::string &name) const;
+
    PersistentUnorderedMap<std::string, JITServerAOTCache *> _map;
    TR::Monitor *const _monitor;
    };
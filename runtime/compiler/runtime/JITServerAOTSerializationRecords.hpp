@@ -140,6 +140,8 @@ private:
 
    ClassSerializationRecord(uintptr_t id, uintptr_t classLoaderId,
                             const JITServerROMClassHash &hash, const J9ROMClass *romClass);
+   ClassSerializationRecord(uintptr_t id, uintptr_t classLoaderId, const JITServerROMClassHash &hash,
+                            uint32_t romClassSize, const uint8_t *name, size_t nameLength);
 
    static size_t size(size_t nameLength)
       {
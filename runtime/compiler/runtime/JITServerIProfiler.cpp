@@ -25,6 +25,7 @@
 #include "control/JITServerCompilationThread.hpp"
 #include "env/j9methodServer.hpp"
 #include "runtime/JITClientSession.hpp"
+#include "runtime/JITServerSharedProfileCache.hpp"
 #include "infra/CriticalSection.hpp" // for OMR::CriticalSection
 #include "ilgen/J9ByteCode.hpp"
 #include "ilgen/J9ByteCodeIterator.hpp"
@@ -43,7 +44,8 @@ JITServerIProfiler::allocate(J9JITConfig *jitConfig)
 
 JITServerIProfiler::JITServerIProfiler(J9JITConfig *jitConfig)
    : TR_IProfiler(jitConfig), _statsIProfilerInfoFromCache(0), _statsIProfilerInfoMsgToClient(0),
-   _statsIProfilerInfoReqNotCacheable(0), _statsIProfilerInfoIsEmpty(0), _statsIProfilerInfoCachingFailures(0)
+   _statsIProfilerInfoReqNotCacheable(0), _statsIProfilerInfoIsEmpty(0), _statsIProfilerInfoCachingFailures(0),
+   _statsIProfilerInfoFromSharedCache(0)
    {
    _useCaching = feGetEnv("TR_DisableIPCaching") ? false: true;
    }
@@ -234,16 +236,42 @@ JITServerIProfiler::profilingSample(TR_OpaqueMethodBlock *method, uint32_t byteC
          }
       }
    
+   std::string ipdata;
+   bool wholeMethod = false; // indicates whether the client sent info for entire method
+   bool usePersistentCache = false; // indicates whether info can be saved in persistent memory, or only in heap memory
+   bool isCompiled = false;
+
+   // Profiling data aggregated from other clients running the same code
+   // is used instead of asking this client, if available
+   auto sharedProfileCache = _useCaching ? TR::CompilationInfo::get()->getJITServerSharedProfileCache() : NULL;
+   if (sharedProfileCache)
+      {
+      ipdata = sharedProfileCache->getMethodProfile(clientSessionData, (J9Method *)method);
+      if (!ipdata.empty())
+         {
+         wholeMethod = true;
+         usePersistentCache = true;
+         _statsIProfilerInfoFromSharedCache++;
+         }
+      }
+
    // Now ask the client
    //
-   auto stream = TR::CompilationInfo::getStream();
-   stream->write(JITServer::MessageType::IProfiler_profilingSample, method, byteCodeIndex, (uintptr_t)(_useCaching ? 0 : 1));
-   auto recv = stream->read<std::string, bool, bool, bool>();
-   const std::string ipdata = std::get<0>(recv);
-   bool wholeMethod = std::get<1>(recv); // indicates whether the client sent info for entire method
-   bool usePersistentCache = std::get<2>(recv); // indicates whether info can be saved in persistent memory, or only in heap memory
-   bool isCompiled = std::get<3>(recv);
-   _statsIProfilerInfoMsgToClient++;
+   if (ipdata.empty())
+      {
+      auto stream = TR::CompilationInfo::getStream();
+      stream->write(JITServer::MessageType::IProfiler_profilingSample, method, byteCodeIndex, (uintptr_t)(_useCaching ? 0 : 1));
+      auto recv = stream->read<std::string, bool, bool, bool>();
+      ipdata = std::get<0>(recv);
+      wholeMethod = std::get<1>(recv);
+      usePersistentCache = std::get<2>(recv);
+      isCompiled = std::get<3>(recv);
+      _statsIProfilerInfoMsgToClient++;
+
+      // Only data for methods whose profile is no longer growing is shared with other clients
+      if (sharedProfileCache && wholeMethod && usePersistentCache)
+         sharedProfileCache->addMethodProfile(clientSessionData, (J9Method *)method, ipdata);
+      }
 
    bool doCache = _useCaching && wholeMethod;
    if (!doCache)
@@ -398,6 +426,11 @@ JITServerIProfiler::printStats()
       j9tty_printf(PORTLIB, "IProfilerInfoNotCacheable:   %6u\n", _statsIProfilerInfoReqNotCacheable);
       j9tty_printf(PORTLIB, "IProfilerInfoCachingFailure: %6u\n", _statsIProfilerInfoCachingFailures);
       j9tty_printf(PORTLIB, "IProfilerInfoFromCache:   %6u\n", _statsIProfilerInfoFromCache);
+      if (auto sharedProfileCache = TR::CompilationInfo::get()->getJITServerSharedProfileCache())
+         {
+         j9tty_printf(PORTLIB, "IProfilerInfoFromSharedCache: %6u\n", _statsIProfilerInfoFromSharedCache);
+         sharedProfileCache->printStats(stdout);
+         }
       }
    }
 
@@ -71,6 +71,9 @@ struct TR_ContiguousIPMethodHashTableEntry
  * object while the global IProfile cache is stored in `struct J9MethodInfo`
  * which is part of `ClientSessionData` (thus, the global cache is more like
  * a collection of caches, one for each method).
+ * With -Xjit:shareProfilingData, whole-method profiles of compiled methods are
+ * also aggregated across clients (see JITServerSharedProfileCache) and used to
+ * answer queries from other clients without asking them.
  * As a RAS feature, caching can be disabled if the environment variable 
  * TR_DisableIPCaching is set.
  * Another RAS feature is the validation of the cached data. For a build with
@@ -119,6 +122,7 @@ private:
    uint32_t _statsIProfilerInfoReqNotCacheable; // info returned from client should not be cached
    uint32_t _statsIProfilerInfoIsEmpty; // client has no IP info for indicated PC
    uint32_t _statsIProfilerInfoCachingFailures;
+   uint32_t _statsIProfilerInfoFromSharedCache; // shared profile cache answered the query instead of the client
    };
 
 /**
@@ -0,0 +1,481 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <algorithm>
+#include "control/CompilationRuntime.hpp"
+#include "env/CompilerEnv.hpp"
+#include "infra/CriticalSection.hpp"
+#include "runtime/JITClientSession.hpp"
+#include "runtime/JITServerSharedProfileCache.hpp"
+#include "runtime/JITServerSharedROMClassCache.hpp"
+
+
+// Distinct receiver classes tracked per call site. More than in a client entry
+// (NUM_CS_SLOTS) because different clients can observe different receivers.
+#define SHARED_PROFILE_MAX_RECEIVERS (2 * NUM_CS_SLOTS)
+
+struct JITServerSharedProfileCache::BytecodeProfile
+   {
+   struct Receiver
+      {
+      JITServerROMClassHash _classHash;
+      uint32_t _weight;
+      };
+
+   BytecodeProfile() :
+      _type(0), _branchTaken(0), _branchNotTaken(0),
+      _numReceivers(0), _residueWeight(0), _tooBigToBeInlined(false)
+      {
+      memset(_switchData, 0, sizeof(_switchData));
+      }
+
+   // Returns false if the stored data and the new entry have different types
+   bool merge(const TR_IPBCDataStorageHeader *storage, ClientSessionData *clientData);
+   // Returns false if the two profiles have different types
+   bool merge(const BytecodeProfile &other);
+   // Size of the serialized entry in bytes
+   size_t serialize(TR_IPBCDataStorageHeader *storage, uint32_t pc, ClientSessionData *clientData) const;
+   static size_t serializedSize(uint32_t type);
+
+   void addReceiver(const JITServerROMClassHash &hash, uint32_t weight);
+
+   uint32_t _type; // TR_IPBCD_* value
+   // TR_IPBCD_FOUR_BYTES: branch counters summed over all contributions
+   uint32_t _branchTaken;
+   uint32_t _branchNotTaken;
+   // TR_IPBCD_EIGHT_WORDS: switch data from one of the contributions
+   uint64_t _switchData[SWITCH_DATA_COUNT];
+   // TR_IPBCD_CALL_GRAPH: receiver weights summed over all contributions
+   Receiver _receivers[SHARED_PROFILE_MAX_RECEIVERS];
+   uint32_t _numReceivers;
+   uint32_t _residueWeight;
+   bool _tooBigToBeInlined;
+   };
+
+struct JITServerSharedProfileCache::MethodProfile
+   {
+   TR_PERSISTENT_ALLOC(TR_Memory::IProfiler)
+
+   // Keyed by the pc field (bytecode index) of the serialized entries
+   typedef PersistentUnorderedMap<uint32_t, BytecodeProfile> BytecodeMap;
+
+   MethodProfile() :
+      _bytecodes(BytecodeMap::allocator_type(TR::Compiler->persistentGlobalAllocator())),
+      _contributions(decltype(_contributions)::allocator_type(TR::Compiler->persistentGlobalAllocator()))
+      { }
+
+   // Rebuild the aggregated profile from the contributions
+   void aggregate();
+   // True if no client other than clientUID has contributed
+   bool onlyContributedBy(uint64_t clientUID) const
+      {
+      return _contributions.empty() ||
+             ((_contributions.size() == 1) && (_contributions.begin()->first == clientUID));
+      }
+
+   BytecodeMap _bytecodes; // aggregated over all contributions
+   // Latest contribution of each client, keyed by client UID. A client that contributes
+   // again replaces its earlier data, so that its samples are not counted twice.
+   PersistentUnorderedMap<uint64_t, BytecodeMap> _contributions;
+   };
+
+
+static uint32_t
+saturatingAdd(uint32_t a, uint32_t b)
+   {
+   uint32_t sum = a + b;
+   return (sum < a) ? UINT32_MAX : sum;
+   }
+
+// Returns the hash of the ROMClass of a class cached for this client; the caller must hold the ROMMapMonitor
+static bool
+getClassHash(ClientSessionData *clientData, J9Class *clazz, JITServerROMClassHash &hash)
+   {
+   auto &romClassMap = clientData->getROMClassMap();
+   auto it = romClassMap.find(clazz);
+   if (it == romClassMap.end())
+      return false;
+   hash = JITServerSharedROMClassCache::getHash(it->second._romClass);
+   return true;
+   }
+
+void
+JITServerSharedProfileCache::BytecodeProfile::addReceiver(const JITServerROMClassHash &hash, uint32_t weight)
+   {
+   for (uint32_t i = 0; i < _numReceivers; ++i)
+      {
+      if (_receivers[i]._classHash == hash)
+         {
+         _receivers[i]._weight = saturatingAdd(_receivers[i]._weight, weight);
+         return;
+         }
+      }
+
+   if (_numReceivers < SHARED_PROFILE_MAX_RECEIVERS)
+      _receivers[_numReceivers++] = { hash, weight };
+   else
+      _residueWeight = saturatingAdd(_residueWeight, weight);
+   }
+
+bool
+JITServerSharedProfileCache::BytecodeProfile::merge(const TR_IPBCDataStorageHeader *storage, ClientSessionData *clientData)
+   {
+   if (_type && (_type != storage->ID))
+      return false;
+   _type = storage->ID;
+
+   switch (storage->ID)
+      {
+      case TR_IPBCD_FOUR_BYTES:
+         {
+         uint32_t data = ((const TR_IPBCDataFourBytesStorage *)storage)->data;
+         _branchTaken = saturatingAdd(_branchTaken, data >> 16);
+         _branchNotTaken = saturatingAdd(_branchNotTaken, data & 0xFFFF);
+         break;
+         }
+      case TR_IPBCD_EIGHT_WORDS:
+         {
+         memcpy(_switchData, ((const TR_IPBCDataEightWordsStorage *)storage)->data, sizeof(_switchData));
+         break;
+         }
+      case TR_IPBCD_CALL_GRAPH:
+         {
+         CallSiteProfileInfo csInfo = ((const TR_IPBCDataCallGraphStorage *)storage)->_csInfo;
+         for (int i = 0; i < NUM_CS_SLOTS; ++i)
+            {
+            J9Class *clazz = (J9Class *)csInfo.getClazz(i);
+            if (!clazz || !csInfo._weight[i])
+               continue;
+            // Receivers not known to the server cannot be matched across clients
+            JITServerROMClassHash hash;
+            if (getClassHash(clientData, clazz, hash))
+               addReceiver(hash, csInfo._weight[i]);
+            else
+               _residueWeight = saturatingAdd(_residueWeight, csInfo._weight[i]);
+            }
+         _residueWeight = saturatingAdd(_residueWeight, csInfo._residueWeight);
+         _tooBigToBeInlined |= (csInfo._tooBigToBeInlined != 0);
+         break;
+         }
+      default:
+         return false;
+      }
+   return true;
+   }
+
+bool
+JITServerSharedProfileCache::BytecodeProfile::merge(const BytecodeProfile &other)
+   {
+   if (_type && (_type != other._type))
+      return false;
+   _type = other._type;
+
+   switch (_type)
+      {
+      case TR_IPBCD_FOUR_BYTES:
+         _branchTaken = saturatingAdd(_branchTaken, other._branchTaken);
+         _branchNotTaken = saturatingAdd(_branchNotTaken, other._branchNotTaken);
+         break;
+      case TR_IPBCD_EIGHT_WORDS:
+         memcpy(_switchData, other._switchData, sizeof(_switchData));
+         break;
+      case TR_IPBCD_CALL_GRAPH:
+         for (uint32_t i = 0; i < other._numReceivers; ++i)
+            addReceiver(other._receivers[i]._classHash, other._receivers[i]._weight);
+         _residueWeight = saturatingAdd(_residueWeight, other._residueWeight);
+         _tooBigToBeInlined |= other._tooBigToBeInlined;
+         break;
+      default:
+         return false;
+      }
+   return true;
+   }
+
+void
+JITServerSharedProfileCache::MethodProfile::aggregate()
+   {
+   _bytecodes.clear();
+   for (auto &contribution : _contributions)
+      {
+      for (auto &bcIt : contribution.second)
+         {
+         // A type mismatch means that the bytecodes of this method differ between clients; keep the first version
+         _bytecodes[bcIt.first].merge(bcIt.second);
+         }
+      }
+   }
+
+size_t
+JITServerSharedProfileCache::BytecodeProfile::serializedSize(uint32_t type)
+   {
+   switch (type)
+      {
+      case TR_IPBCD_FOUR_BYTES: return sizeof(TR_IPBCDataFourBytesStorage);
+      case TR_IPBCD_EIGHT_WORDS: return sizeof(TR_IPBCDataEightWordsStorage);
+      case TR_IPBCD_CALL_GRAPH: return sizeof(TR_IPBCDataCallGraphStorage);
+      default: return 0;
+      }
+   }
+
+size_t
+JITServerSharedProfileCache::BytecodeProfile::serialize(TR_IPBCDataStorageHeader *storage, uint32_t pc, ClientSessionData *clientData) const
+   {
+   storage->pc = pc;
+   storage->left = 0;
+   storage->right = 0;
+   storage->ID = _type;
+
+   switch (_type)
+      {
+      case TR_IPBCD_FOUR_BYTES:
+         {
+         // Scale the counters down to 16 bits each, preserving their ratio
+         uint32_t taken = _branchTaken;
+         uint32_t notTaken = _branchNotTaken;
+         while ((taken > 0xFFFF) || (notTaken > 0xFFFF))
+            {
+            taken >>= 1;
+            notTaken >>= 1;
+            }
+         ((TR_IPBCDataFourBytesStorage *)storage)->data = (taken << 16) | notTaken;
+         break;
+         }
+      case TR_IPBCD_EIGHT_WORDS:
+         {
+         memcpy(((TR_IPBCDataEightWordsStorage *)storage)->data, _switchData, sizeof(_switchData));
+         break;
+         }
+      case TR_IPBCD_CALL_GRAPH:
+         {
+         CallSiteProfileInfo &csInfo = ((TR_IPBCDataCallGraphStorage *)storage)->_csInfo;
+         csInfo.initialize();
+
+         // Pick the heaviest receivers that this client has loaded; the rest become residue
+         bool used[SHARED_PROFILE_MAX_RECEIVERS] = {};
+         uint32_t maxWeight = 0;
+         uint32_t residue = _residueWeight;
+         auto &classByHashMap = clientData->getClassByROMClassHashMap();
+         for (int slot = 0; slot < NUM_CS_SLOTS; ++slot)
+            {
+            int best = -1;
+            J9Class *bestClass = NULL;
+            for (uint32_t i = 0; i < _numReceivers; ++i)
+               {
+               if (used[i] || ((best >= 0) && (_receivers[i]._weight <= _receivers[best]._weight)))
+                  continue;
+               auto it = classByHashMap.find(_receivers[i]._classHash);
+               if (it == classByHashMap.end())
+                  continue;
+               best = i;
+               bestClass = it->second;
+               }
+            if (best < 0)
+               break;
+            used[best] = true;
+            csInfo.setClazz(slot, (uintptr_t)bestClass);
+            maxWeight = std::max(maxWeight, _receivers[best]._weight);
+            }
+         for (uint32_t i = 0; i < _numReceivers; ++i)
+            {
+            if (!used[i])
+               residue = saturatingAdd(residue, _receivers[i]._weight);
+            }
+
+         // Scale all weights down by the same factor to fit into the client's 16-bit (15-bit residue) counters
+         uint32_t shift = 0;
+         while (((maxWeight >> shift) > 0xFFFF) || ((residue >> shift) > 0x7FFF))
+            ++shift;
+         for (int slot = 0; slot < NUM_CS_SLOTS; ++slot)
+            {
+            if (!csInfo.getClazz(slot))
+               continue;
+            for (uint32_t i = 0; i < _numReceivers; ++i)
+               {
+               auto it = classByHashMap.find(_receivers[i]._classHash);
+               if (used[i] && (it != classByHashMap.end()) && ((uintptr_t)it->second == csInfo.getClazz(slot)))
+                  {
+                  csInfo._weight[slot] = (uint16_t)(_receivers[i]._weight >> shift);
+                  break;
+                  }
+               }
+            }
+         csInfo._residueWeight = residue >> shift;
+         csInfo._tooBigToBeInlined = _tooBigToBeInlined ? 1 : 0;
+         break;
+         }
+      }
+   return serializedSize(_type);
+   }
+
+
+JITServerSharedProfileCache::JITServerSharedProfileCache() :
+   _methods(decltype(_methods)::allocator_type(TR::Compiler->persistentGlobalAllocator())),
+   _monitor(TR::Monitor::create("JIT-JITServerSharedProfileCacheMonitor")),
+   _numContributions(0), _numProfilesServed(0), _numProfilesNotFound(0)
+   {
+   if (!_monitor)
+      throw std::bad_alloc();
+   }
+
+JITServerSharedProfileCache::~JITServerSharedProfileCache()
+   {
+   for (auto &it : _methods)
+      {
+      it.second->~MethodProfile();
+      TR::Compiler->persistentGlobalMemory()->freePersistentMemory(it.second);
+      }
+   TR::Monitor::destroy(_monitor);
+   }
+
+bool
+JITServerSharedProfileCache::getMethodKey(ClientSessionData *clientData, J9Method *method, MethodKey &key)
+   {
+   auto &methodMap = clientData->getJ9MethodMap();
+   auto it = methodMap.find(method);
+   if (it == methodMap.end())
+      return false;
+
+   auto &romClassMap = clientData->getROMClassMap();
+   auto cit = romClassMap.find((J9Class *)it->second._owningClass);
+   if (cit == romClassMap.end())
+      return false;
+
+   J9ROMClass *romClass = cit->second._romClass;
+   key._classHash = JITServerSharedROMClassCache::getHash(romClass);
+   key._romMethodOffset = (uint32_t)((uint8_t *)it->second._romMethod - (uint8_t *)romClass);
+   return true;
+   }
+
+void
+JITServerSharedProfileCache::addMethodProfile(ClientSessionData *clientData, J9Method *method, const std::string &ipdata)
+   {
+   if (ipdata.empty())
+      return;
+
+   // Classes are looked up under the ROMMapMonitor, which is always acquired before the cache monitor
+   OMR::CriticalSection romMapCS(clientData->getROMMapMonitor());
+   MethodKey key;
+   if (!getMethodKey(clientData, method, key))
+      return;
+
+   OMR::CriticalSection addMethodProfile(_monitor);
+
+   auto it = _methods.find(key);
+   MethodProfile *profile = NULL;
+   if (it != _methods.end())
+      {
+      profile = it->second;
+      }
+   else
+      {
+      profile = new (TR::Compiler->persistentGlobalMemory()) MethodProfile();
+      if (!profile)
+         throw std::bad_alloc();
+      _methods.insert({ key, profile });
+      }
+
+   // Replace the earlier contribution of this client, if any
+   uint64_t clientUID = clientData->getClientUID();
+   auto cit = profile->_contributions.find(clientUID);
+   if (cit == profile->_contributions.end())
+      cit = profile->_contributions.insert({ clientUID, MethodProfile::BytecodeMap(MethodProfile::BytecodeMap::allocator_type(TR::Compiler->persistentGlobalAllocator())) }).first;
+   else
+      cit->second.clear();
+   MethodProfile::BytecodeMap &contribution = cit->second;
+
+   const char *bufferPtr = &ipdata[0];
+   const char *bufferEnd = bufferPtr + ipdata.size();
+   const TR_IPBCDataStorageHeader *storage = NULL;
+   do
+      {
+      storage = (const TR_IPBCDataStorageHeader *)bufferPtr;
+      if ((bufferPtr + sizeof(*storage) > bufferEnd) ||
+          (bufferPtr + BytecodeProfile::serializedSize(storage->ID) > bufferEnd))
+         break;
+
+      auto &bcProfile = contribution[storage->pc];
+      if (!bcProfile.merge(storage, clientData))
+         {
+         // Type mismatch; the bytecodes of this method differ between clients, so keep the first version
+         TR_ASSERT(false, "Shared profile type mismatch at pc %u: %u vs %u", storage->pc, bcProfile._type, storage->ID);
+         }
+      bufferPtr += storage->left;
+      } while (storage->left != 0);
+
+   profile->aggregate();
+   ++_numContributions;
+   }
+
+std::string
+JITServerSharedProfileCache::getMethodProfile(ClientSessionData *clientData, J9Method *method)
+   {
+   OMR::CriticalSection romMapCS(clientData->getROMMapMonitor());
+   MethodKey key;
+   if (!getMethodKey(clientData, method, key))
+      return std::string();
+
+   OMR::CriticalSection getMethodProfile(_monitor);
+
+   auto it = _methods.find(key);
+   // A profile contributed only by this client is not newer than what the client itself has
+   if ((it == _methods.end()) || it->second->_bytecodes.empty() ||
+       it->second->onlyContributedBy(clientData->getClientUID()))
+      {
+      ++_numProfilesNotFound;
+      return std::string();
+      }
+
+   const MethodProfile *profile = it->second;
+   size_t totalSize = 0;
+   for (auto &bcIt : profile->_bytecodes)
+      totalSize += BytecodeProfile::serializedSize(bcIt.second._type);
+
+   std::string ipdata(totalSize, '\0');
+   char *bufferPtr = &ipdata[0];
+   TR_IPBCDataStorageHeader *storage = NULL;
+   for (auto &bcIt : profile->_bytecodes)
+      {
+      storage = (TR_IPBCDataStorageHeader *)bufferPtr;
+      size_t bytes = bcIt.second.serialize(storage, bcIt.first, clientData);
+      storage->left = bytes;
+      bufferPtr += bytes;
+      }
+   // The last entry marks the end of the data
+   if (storage)
+      storage->left = 0;
+
+   ++_numProfilesServed;
+   return ipdata;
+   }
+
+void
+JITServerSharedProfileCache::printStats(FILE *f) const
+   {
+   fprintf(f,
+      "JITServer shared profile cache statistics:\n"
+      "\tmethods: %zu\n"
+      "\tcontributions: %zu\n"
+      "\tprofiles served: %zu\n"
+      "\tprofiles not found: %zu\n",
+      _methods.size(), _numContributions, _numProfilesServed, _numProfilesNotFound
+   );
+   }
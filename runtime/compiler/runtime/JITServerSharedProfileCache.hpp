@@ -0,0 +1,102 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef JITSERVER_SHARED_PROFILE_CACHE_H
+#define JITSERVER_SHARED_PROFILE_CACHE_H
+
+#include <string>
+#include "env/TRMemory.hpp"
+#include "env/PersistentCollections.hpp"
+#include "infra/Monitor.hpp"
+#include "runtime/IProfiler.hpp"
+#include "runtime/JITServerROMClassHash.hpp"
+
+class ClientSessionData;
+
+
+// Stores bytecode profiling data aggregated across all clients connected to the JITServer.
+// Methods are identified by the hash of their (shared) ROMClass and the offset of their
+// ROMMethod in that ROMClass, so that identical applications running in different client
+// JVMs map to the same profile. Receiver classes in call graph entries are stored as
+// ROMClass hashes and translated to the class pointers of the requesting client when
+// the profile is handed out.
+//
+// Only profiles that the client allows to be cached persistently (i.e. for methods that
+// are already compiled and do not accumulate more samples) are added to the cache.
+//
+// Requires ROMClass sharing (-Xjit:shareROMClasses) to obtain ROMClass hashes.
+class JITServerSharedProfileCache
+   {
+public:
+   TR_PERSISTENT_ALLOC(TR_Memory::IProfiler)
+
+   JITServerSharedProfileCache();
+   ~JITServerSharedProfileCache();
+
+   // Merge whole-method profiling data serialized by a client
+   // (a sequence of TR_IPBCDataStorageHeader entries) into the aggregated profile.
+   // The data replaces any earlier contribution of the same client for this method.
+   void addMethodProfile(ClientSessionData *clientData, J9Method *method, const std::string &ipdata);
+
+   // Returns the aggregated profile for the method serialized in the same format as the client
+   // would send it, with receiver classes translated for clientData. Returns an empty string
+   // if there is no profile for this method or it was only contributed by the same client.
+   std::string getMethodProfile(ClientSessionData *clientData, J9Method *method);
+
+   void printStats(FILE *f) const;
+
+private:
+   struct MethodKey
+      {
+      bool operator==(const MethodKey &k) const
+         {
+         return (_romMethodOffset == k._romMethodOffset) && (_classHash == k._classHash);
+         }
+      struct Hash
+         {
+         size_t operator()(const MethodKey &k) const noexcept
+            {
+            return std::hash<JITServerROMClassHash>()(k._classHash) ^ k._romMethodOffset;
+            }
+         };
+
+      JITServerROMClassHash _classHash;
+      uint32_t _romMethodOffset;
+      };
+
+   struct BytecodeProfile;
+   struct MethodProfile;
+
+   // The caller must hold the ROMMapMonitor of the client session
+   static bool getMethodKey(ClientSessionData *clientData, J9Method *method, MethodKey &key);
+
+   PersistentUnorderedMap<MethodKey, MethodProfile *, MethodKey::Hash> _methods;
+   TR::Monitor *const _monitor;
+
+   // Statistics
+   size_t _numContributions;
+   size_t _numProfilesServed;
+   size_t _numProfilesNotFound;
+   };
+
+
+#endif /* JITSERVER_SHARED_PROFILE_CACHE_H */
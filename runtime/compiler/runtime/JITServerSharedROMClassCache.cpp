@@ -22,16 +22,35 @@
 #include "AtomicSupport.hpp"
 #include "control/CompilationRuntime.hpp"
 #include "env/CompilerEnv.hpp"
+#include "env/VerboseLog.hpp"
 #include "infra/CriticalSection.hpp"
 #include "runtime/JITServerSharedROMClassCache.hpp"
 
 
 #define JITSERVER_SHARED_ROMCLASS_EYECATCHER 0xC1A55E7E
+// Generations smaller than this (summed over all partitions) are never retired,
+// since their segments are not worth reclaiming
+#define JITSERVER_SHARED_ROMCLASS_MIN_COMPACTION_BYTES (16 << 20)
+
+// Entries are allocated from a generation which owns a separate persistent allocator,
+// so that all its memory segments can be released at once when its last entry is freed.
+struct JITServerSharedROMClassCache::Generation
+   {
+   Generation(TR::PersistentAllocator *allocator) :
+      _allocator(allocator), _numEntries(0), _liveBytes(0), _peakBytes(0) { }
+
+   TR::PersistentAllocator *const _allocator;
+   size_t _numEntries;
+   size_t _liveBytes;
+   // Freed blocks are reused by the allocator, so the peak number of live bytes
+   // approximates the amount of memory held in the generation's segments
+   size_t _peakBytes;
+   };
 
 struct JITServerSharedROMClassCache::Entry
    {
-   Entry(const J9ROMClass *romClass) :
-      _refCount(1), _hash(NULL), _eyeCatcher(JITSERVER_SHARED_ROMCLASS_EYECATCHER)
+   Entry(const J9ROMClass *romClass, const JITServerROMClassHash &hash, Generation *generation) :
+      _refCount(1), _hash(hash), _generation(generation), _eyeCatcher(JITSERVER_SHARED_ROMCLASS_EYECATCHER)
       {
       memcpy(_data, romClass, romClass->romSize);
       }
@@ -54,34 +73,50 @@ struct JITServerSharedROMClassCache::Entry
    // Returns new reference count
    size_t release() { return VM_AtomicSupport::subtract(&_refCount, 1); }
 
+   size_t size() const { return sizeof(Entry) + ((const J9ROMClass *)_data)->romSize; }
+
    volatile size_t _refCount;
-   // Store the pointer to this entry's key so that we don't have to
-   // recompute it when deleting the entry from the map.
-   //NOTE: The entity pointed to by _hash is not owned by this Entry,
-   //      and must not be deleted when the Entry is destroyed.
-   const JITServerROMClassHash *_hash;
+   // The hash is stored by value rather than pointing to the map key, since an entry
+   // that was replaced in the map by a copy in a newer generation outlives its key.
+   const JITServerROMClassHash _hash;
+   Generation *const _generation;
    const size_t _eyeCatcher;
    uint8_t _data[];// embedded J9ROMClass
    };
 
 
+// Each partition allocates its entries from its own generations, so that allocation,
+// deallocation and compaction are all synchronized with the partition's monitor.
 struct JITServerSharedROMClassCache::Partition
    {
    Partition(TR_PersistentMemory *persistentMemory, TR::Monitor *monitor) :
-      _persistentMemory(persistentMemory), _monitor(monitor),
+      _monitor(monitor),
       _map(decltype(_map)::allocator_type(persistentMemory->_persistentAllocator.get())),
-      _maxSize(0) { }
+      _maxSize(0), _numHits(0), _numMisses(0), _numMigrations(0),
+      _currentGeneration(createGeneration()), _retiredGeneration(NULL),
+      _numCompactions(0), _numReclaimedGenerations(0) { }
 
    ~Partition()
       {
       for (const auto &kv : _map)
-         _persistentMemory->freePersistentMemory(kv.second);
+         freeEntry(kv.second);
+      destroyGenerations();
       }
 
    J9ROMClass *getOrCreate(const J9ROMClass *packedROMClass, const JITServerROMClassHash &hash);
    void release(Entry *entry);
 
-   TR_PersistentMemory *const _persistentMemory;
+   // Retires the current generation if it is large enough and mostly free, and if the previously
+   // retired generation (if any) was already reclaimed. Returns true if the generation was retired.
+   bool compact(size_t minBytes, size_t &liveBytes, size_t &peakBytes);
+   // Releases all the memory segments holding the entries
+   void destroyGenerations();
+
+   Entry *allocateEntry(const J9ROMClass *packedROMClass, const JITServerROMClassHash &hash);
+   void freeEntry(Entry *entry);
+   // Must be called with the partition monitor in hand
+   void removeFromGeneration(Generation *generation, size_t size);
+
    TR::Monitor *const _monitor;
    // To avoid comparing the ROMClass contents inside a critical section when
    // inserting a new entry (which would increase lock contention), we instead
@@ -89,6 +124,13 @@ struct JITServerSharedROMClassCache::Partition
    // the critical section, and key hashing and comparison are very quick.
    PersistentUnorderedMap<JITServerROMClassHash, Entry *> _map;
    size_t _maxSize;
+   size_t _numHits; // lookups that found an existing ROMClass
+   size_t _numMisses; // lookups that created a new entry
+   size_t _numMigrations; // lookups that copied an entry out of the retired generation
+   Generation *_currentGeneration; // new entries are allocated from this generation
+   Generation *_retiredGeneration; // generation waiting for its surviving entries to be released, if any
+   size_t _numCompactions;
+   size_t _numReclaimedGenerations;
    };
 
 
@@ -134,16 +176,19 @@ JITServerSharedROMClassCache::initialize(J9JITConfig *jitConfig)
 
    TR::PersistentAllocatorKit kit(1 << 20/*1 MB*/, *TR::Compiler->javaVM);
    auto allocator = new (TR::Compiler->rawAllocator) TR::PersistentAllocator(kit);
+   size_t numCreatedPartitions = 0;
    try
       {
       _persistentMemory = new (TR::Compiler->rawAllocator) TR_PersistentMemory(jitConfig, *allocator);
-      for (size_t i = 0; i < _numPartitions; ++i)
-         new (&_partitions[i]) Partition(_persistentMemory, _monitors[i]);
+      for (; numCreatedPartitions < _numPartitions; ++numCreatedPartitions)
+         new (&_partitions[numCreatedPartitions]) Partition(_persistentMemory, _monitors[numCreatedPartitions]);
       }
    catch (...)
       {
       if (TR::Options::getVerboseOption(TR_VerboseJITServer))
          TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "ERROR: Failed to initialize shared ROMClass cache");
+      for (size_t i = 0; i < numCreatedPartitions; ++i)
+         _partitions[i].destroyGenerations();
       // This automatically releases all resources (persistent allocations) in Partition objects
       allocator->~PersistentAllocator();
       TR::Compiler->rawAllocator.deallocate(allocator);
@@ -188,11 +233,15 @@ JITServerSharedROMClassCache::shutdown(bool lastClient)
          }
       }
 
-#if defined(DEBUG)
-   // Calling destructors is not necessary - memory will be freed automatically with the persistent allocator
    for (size_t i = 0; i < _numPartitions; ++i)
+      {
+#if defined(DEBUG)
+      // Calling destructors is not necessary - memory will be freed automatically with the persistent allocators
       _partitions[i].~Partition();
+#else /* defined(DEBUG) */
+      _partitions[i].destroyGenerations();
 #endif /* defined(DEBUG) */
+      }
 
    auto allocator = &_persistentMemory->_persistentAllocator.get();
    // This automatically releases all resources (persistent allocations) in Partition objects
@@ -219,13 +268,104 @@ JITServerSharedROMClassCache::release(J9ROMClass *romClass)
    // unless it's the last reference. This should help in the scenario when a
    // client session is destroyed and all its cached ROMClasses are released.
    if (entry->release() == 0)
-      getPartition(*entry->_hash).release(entry);
+      getPartition(entry->_hash).release(entry);
+   }
+
+void
+JITServerSharedROMClassCache::compact()
+   {
+   TR_ASSERT(TR::CompilationInfo::get()->getCompilationMonitor()->owned_by_self(), "Must hold compilationMonitor");
+   if (!isInitialized())
+      return;
+
+   // Partitions are compacted one at a time under their own monitors,
+   // so lookups in the other partitions are not blocked meanwhile
+   size_t minBytes = JITSERVER_SHARED_ROMCLASS_MIN_COMPACTION_BYTES / _numPartitions;
+   size_t numRetired = 0, liveBytes = 0, peakBytes = 0;
+   for (size_t i = 0; i < _numPartitions; ++i)
+      {
+      if (_partitions[i].compact(minBytes, liveBytes, peakBytes))
+         ++numRetired;
+      }
+
+   if (numRetired && TR::Options::getVerboseOption(TR_VerboseJITServer))
+      TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
+         "Retired %zu shared ROMClass cache generations with %zu live bytes out of %zu peak bytes",
+         numRetired, liveBytes, peakBytes);
+   }
+
+void
+JITServerSharedROMClassCache::printStats()
+   {
+   TR_ASSERT(TR::CompilationInfo::get()->getCompilationMonitor()->owned_by_self(), "Must hold compilationMonitor");
+   if (!isInitialized())
+      return;
+
+   size_t totalClasses = 0, totalHits = 0, totalMisses = 0, totalMigrations = 0;
+   size_t totalLiveBytes = 0, totalPeakBytes = 0, totalRetiredBytes = 0;
+   size_t totalCompactions = 0, totalReclaimed = 0;
+   for (size_t i = 0; i < _numPartitions; ++i)
+      {
+      Partition &partition = _partitions[i];
+      size_t numClasses, maxClasses, numHits, numMisses;
+         {
+         OMR::CriticalSection sharedROMClassCache(partition._monitor);
+         numClasses = partition._map.size();
+         maxClasses = partition._maxSize;
+         numHits = partition._numHits;
+         numMisses = partition._numMisses;
+         totalMigrations += partition._numMigrations;
+         totalLiveBytes += partition._currentGeneration->_liveBytes;
+         totalPeakBytes += partition._currentGeneration->_peakBytes;
+         if (partition._retiredGeneration)
+            totalRetiredBytes += partition._retiredGeneration->_liveBytes;
+         totalCompactions += partition._numCompactions;
+         totalReclaimed += partition._numReclaimedGenerations;
+         }
+      totalClasses += numClasses;
+      totalHits += numHits;
+      totalMisses += numMisses;
+      TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
+         "Shared ROMClass cache partition %zu: classes %zu (max %zu) hits %zu misses %zu",
+         i, numClasses, maxClasses, numHits, numMisses);
+      }
+
+   TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
+      "Shared ROMClass cache: classes %zu hits %zu misses %zu migrations %zu live bytes %zu peak bytes %zu retired bytes %zu compactions %zu reclaimed %zu",
+      totalClasses, totalHits, totalMisses, totalMigrations, totalLiveBytes, totalPeakBytes,
+      totalRetiredBytes, totalCompactions, totalReclaimed);
    }
 
 const JITServerROMClassHash &
 JITServerSharedROMClassCache::getHash(const J9ROMClass *romClass)
    {
-   return *Entry::get(romClass)->_hash;
+   return Entry::get(romClass)->_hash;
+   }
+
+JITServerSharedROMClassCache::Generation *
+JITServerSharedROMClassCache::createGeneration()
+   {
+   TR::PersistentAllocatorKit kit(1 << 20/*1 MB*/, *TR::Compiler->javaVM);
+   auto allocator = new (TR::Compiler->rawAllocator) TR::PersistentAllocator(kit);
+   try
+      {
+      return new (TR::Compiler->rawAllocator) Generation(allocator);
+      }
+   catch (...)
+      {
+      allocator->~PersistentAllocator();
+      TR::Compiler->rawAllocator.deallocate(allocator);
+      throw;
+      }
+   }
+
+void
+JITServerSharedROMClassCache::destroyGeneration(Generation *generation)
+   {
+   auto allocator = generation->_allocator;
+   allocator->~PersistentAllocator();
+   TR::Compiler->rawAllocator.deallocate(allocator);
+   TR::Compiler->rawAllocator.deallocate(generation);
    }
 
 JITServerSharedROMClassCache::Partition &
@@ -245,16 +385,17 @@ JITServerSharedROMClassCache::Partition::getOrCreate(const J9ROMClass *packedROM
       {
       OMR::CriticalSection sharedROMClassCache(_monitor);
       auto it = _map.find(hash);
-      if (it != _map.end())
+      // Entries of a retired generation are not handed out anymore, otherwise the generation
+      // would never drain. Such an entry is replaced with a copy in the current generation below.
+      if ((it != _map.end()) && (it->second->_generation == _currentGeneration))
+         {
+         ++_numHits;
          return it->second->acquire();// Reuse existing entry, incrementing its reference count
+         }
       }
 
    // Create new entry outside of the critical section to reduce lock contention
-   size_t size = sizeof(Entry) + packedROMClass->romSize;
-   void *ptr = _persistentMemory->allocatePersistentMemory(size, TR_Memory::ROMClass);
-   if (!ptr)
-      throw std::bad_alloc();
-   auto entry = new (ptr) Entry(packedROMClass);
+   auto entry = allocateEntry(packedROMClass, hash);
    auto romClass = (J9ROMClass *)entry->_data;
 
    try
@@ -263,25 +404,33 @@ JITServerSharedROMClassCache::Partition::getOrCreate(const J9ROMClass *packedROM
       auto it = _map.insert({ hash, entry });
       if (it.second)
          {
-         entry->_hash = &it.first->first;
          _maxSize = std::max(_maxSize, _map.size());
+         ++_numMisses;
+         }
+      else if (it.first->second->_generation != _currentGeneration)
+         {
+         // The existing entry stays valid for the clients that already hold it,
+         // and is freed without touching the map once they all release it
+         it.first->second = entry;
+         ++_numMigrations;
          }
       else
          {
          // Another thread already created this entry; reuse it
          romClass = it.first->second->acquire();
+         ++_numHits;
          }
       }
    catch (...)
       {
       // Prevent memory leak if map insertion failed
-      _persistentMemory->freePersistentMemory(entry);
+      freeEntry(entry);
       throw;
       }
 
    // Free the newly allocated entry if it won't be used
    if (romClass != (J9ROMClass *)entry->_data)
-      _persistentMemory->freePersistentMemory(entry);
+      freeEntry(entry);
    return romClass;
    }
 
@@ -297,11 +446,118 @@ JITServerSharedROMClassCache::Partition::release(JITServerSharedROMClassCache::E
       if (entry->_refCount != 0)
          return;
 
-      auto it = _map.find(*entry->_hash);
-      TR_ASSERT(it != _map.end(), "Entry to be removed not found");
-      TR_ASSERT(it->second == entry, "Duplicate entry");
-      _map.erase(it);
+      // An entry of a retired generation could have been replaced in the map with a newer copy
+      auto it = _map.find(entry->_hash);
+      if ((it != _map.end()) && (it->second == entry))
+         _map.erase(it);
+      else
+         TR_ASSERT(entry->_generation != _currentGeneration, "Entry to be removed not found");
+      }
+
+   freeEntry(entry);
+   }
+
+bool
+JITServerSharedROMClassCache::Partition::compact(size_t minBytes, size_t &liveBytes, size_t &peakBytes)
+   {
+   OMR::CriticalSection sharedROMClassCache(_monitor);
+   // Wait until the previously retired generation is reclaimed; retiring generations that are
+   // still mostly in use would increase memory usage instead of reducing it
+   if (_retiredGeneration)
+      return false;
+
+   Generation *generation = _currentGeneration;
+   if ((generation->_peakBytes < minBytes) || (generation->_liveBytes > generation->_peakBytes / 2))
+      return false;
+
+   Generation *newGeneration = NULL;
+   try
+      {
+      newGeneration = createGeneration();
+      }
+   catch (const std::bad_alloc &)
+      {
+      return false;
       }
 
-   _persistentMemory->freePersistentMemory(entry);
+   liveBytes += generation->_liveBytes;
+   peakBytes += generation->_peakBytes;
+   _currentGeneration = newGeneration;
+   ++_numCompactions;
+   if (generation->_numEntries == 0)
+      {
+      destroyGeneration(generation);
+      ++_numReclaimedGenerations;
+      }
+   else
+      {
+      _retiredGeneration = generation;
+      }
+   return true;
+   }
+
+void
+JITServerSharedROMClassCache::Partition::destroyGenerations()
+   {
+   if (_retiredGeneration)
+      destroyGeneration(_retiredGeneration);
+   destroyGeneration(_currentGeneration);
+   _retiredGeneration = NULL;
+   _currentGeneration = NULL;
+   }
+
+JITServerSharedROMClassCache::Entry *
+JITServerSharedROMClassCache::Partition::allocateEntry(const J9ROMClass *packedROMClass,
+                                                       const JITServerROMClassHash &hash)
+   {
+   size_t size = sizeof(Entry) + packedROMClass->romSize;
+   Generation *generation = NULL;
+      {
+      OMR::CriticalSection sharedROMClassCache(_monitor);
+      generation = _currentGeneration;
+      // Account for the entry before allocating it so that the generation
+      // cannot be reclaimed if it is retired in the meantime
+      ++generation->_numEntries;
+      generation->_liveBytes += size;
+      generation->_peakBytes = std::max(generation->_peakBytes, generation->_liveBytes);
+      }
+
+   // The persistent allocator is thread safe, so the allocation and the copy
+   // of the ROMClass are done outside of the critical section
+   void *ptr = generation->_allocator->allocate(size, std::nothrow);
+   if (!ptr)
+      {
+      OMR::CriticalSection sharedROMClassCache(_monitor);
+      removeFromGeneration(generation, size);
+      throw std::bad_alloc();
+      }
+
+   return new (ptr) Entry(packedROMClass, hash, generation);
+   }
+
+void
+JITServerSharedROMClassCache::Partition::freeEntry(Entry *entry)
+   {
+   size_t size = entry->size();
+   Generation *generation = entry->_generation;
+   // The generation cannot be reclaimed before the entry is removed from it below
+   generation->_allocator->deallocate(entry, size);
+
+   OMR::CriticalSection sharedROMClassCache(_monitor);
+   removeFromGeneration(generation, size);
+   }
+
+void
+JITServerSharedROMClassCache::Partition::removeFromGeneration(Generation *generation, size_t size)
+   {
+   --generation->_numEntries;
+   generation->_liveBytes -= size;
+
+   // Release all the segments of a retired generation when its last entry is freed
+   if ((generation == _retiredGeneration) && (generation->_numEntries == 0))
+      {
+      destroyGeneration(generation);
+      _retiredGeneration = NULL;
+      ++_numReclaimedGenerations;
+      }
    }
@@ -50,9 +50,22 @@ public:
    // Get precomputed hash of a shared ROMClass
    static const JITServerROMClassHash &getHash(const J9ROMClass *romClass);
 
+   // Cached ROMClasses cannot be moved since client sessions and compilations hold pointers to them.
+   // Instead, when the memory held by the current allocation generation is mostly free (e.g. because
+   // clients disconnected), new entries are allocated from a fresh generation. The segments of the old
+   // generation are released as a whole once all of its surviving ROMClasses are released; lookups
+   // stop handing out its ROMClasses and copy them into the current generation instead. Each partition
+   // has its own generations and is compacted under its own monitor.
+   // Must be called with the compilation monitor in hand.
+   void compact();
+   // Prints occupancy and hit statistics to the verbose log.
+   // Must be called with the compilation monitor in hand.
+   void printStats();
+
 private:
    struct Entry;
    struct Partition;
+   struct Generation;
 
    // To reduce lock contention, the cache is divided into a number of
    // partitions, each synchronized with a separate monitor
@@ -63,8 +76,11 @@ private:
 
    bool isInitialized() const { return _persistentMemory != NULL; }
 
+   static Generation *createGeneration();
+   static void destroyGeneration(Generation *generation);
+
    const size_t _numPartitions;
-   TR_PersistentMemory *_persistentMemory;
+   TR_PersistentMemory *_persistentMemory; // used for partition maps; NULL if the cache is not initialized
    Partition *const _partitions;
    TR::Monitor **const _monitors;
 };
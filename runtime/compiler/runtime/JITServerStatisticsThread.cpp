@@ -22,6 +22,9 @@
 
 #include "runtime/JITServerStatisticsThread.hpp"
 #include "runtime/JITClientSession.hpp" // for purgeOldDataIfNeeded()
+#include "runtime/JITServerAOTCache.hpp"
+#include "runtime/JITServerSharedROMClassCache.hpp"
+#include "net/CommunicationStream.hpp"
 #include "env/VMJ9.h" // for TR_JitPrivateConfig
 #include "env/VerboseLog.hpp"
 #include "control/CompilationRuntime.hpp" // for CompilatonInfo
@@ -76,6 +79,7 @@ static int32_t J9THREAD_PROC statisticsThreadProc(void * entryarg)
    uint64_t lastStatsTime = crtTime;
    uint64_t lastPurgeTime = crtTime;
    uint64_t lastCpuUpdate = crtTime;
+   uint64_t lastAOTCacheSnapshotTime = crtTime;
 
    persistentInfo->setStartTime(crtTime);
    persistentInfo->setElapsedTime(0);
@@ -97,8 +101,19 @@ static int32_t J9THREAD_PROC statisticsThreadProc(void * entryarg)
             lastPurgeTime = crtTime;
             OMR::CriticalSection compilationMonitorLock(compInfo->getCompilationMonitor());
             compInfo->getClientSessionHT()->purgeOldDataIfNeeded();
+            // Reclaim memory of the shared ROMClass cache left behind by departed clients
+            if (auto cache = compInfo->getJITServerSharedROMClassCache())
+               cache->compact();
             }     
 
+         // Periodically write AOT cache snapshots so that a restarted server can reuse them
+         uint32_t snapshotInterval = persistentInfo->getJITServerAOTCacheSnapshotInterval();
+         if (snapshotInterval && compInfo->getJITServerAOTCacheMap() && (crtTime - lastAOTCacheSnapshotTime >= snapshotInterval))
+            {
+            lastAOTCacheSnapshotTime = crtTime;
+            compInfo->getJITServerAOTCacheMap()->saveSnapshots();
+            }
+
          // Print operational statistics to vlog if enabled
          CpuUtilization *cpuUtil = compInfo->getCpuUtil(); 
          if ((statsThreadObj->getStatisticsFrequency() != 0) && ((crtTime - lastStatsTime) > statsThreadObj->getStatisticsFrequency()))
@@ -122,7 +137,14 @@ static int32_t J9THREAD_PROC statisticsThreadProc(void * entryarg)
                {
                TR_VerboseLog::writeLine(TR_Vlog_JITServer, "CpuLoad %d%% (AvgUsage %d%%) JvmCpu %d%%", cpuUsage, avgCpuUsage, vmCpuUsage);
                }
+            if (persistentInfo->getJITServerUseCompression())
+               JITServer::CommunicationStream::printCompressionStats();
             TR_VerboseLog::vlogRelease();
+            if (auto cache = compInfo->getJITServerSharedROMClassCache())
+               {
+               OMR::CriticalSection compilationMonitorLock(compInfo->getCompilationMonitor());
+               cache->printStats();
+               }
             lastStatsTime = crtTime;
             }
             
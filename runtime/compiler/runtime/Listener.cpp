@@ -27,7 +27,8 @@
 #include <netinet/in.h>
 #include <netinet/tcp.h>	/* for TCP_NODELAY option */
 #include <openssl/err.h>
-#include <poll.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
 #include <sys/types.h>
 #include <sys/socket.h>
 #include <sys/un.h>
@@ -38,6 +39,7 @@
 #include "env/TRMemory.hpp"
 #include "env/VMJ9.h"
 #include "env/VerboseLog.hpp"
+#include "infra/CriticalSection.hpp"
 #include "net/CommunicationStream.hpp"
 #include "net/LoadSSLLibs.hpp"
 #include "net/ServerStream.hpp"
@@ -186,10 +188,157 @@ acceptOpenSSLConnection(SSL_CTX *sslCtx, int connfd, BIO *&bio)
 
 TR_Listener::TR_Listener()
    : _listenerThread(NULL), _listenerMonitor(NULL), _listenerOSThread(NULL),
-   _listenerThreadAttachAttempted(false), _listenerThreadExitFlag(false)
+   _listenerThreadAttachAttempted(false), _listenerThreadExitFlag(false),
+   _parkedStreamsMonitor(NULL),
+   _streamsToPark(TR::Compiler->persistentAllocator()),
+   _parkedStreams(decltype(_parkedStreams)::allocator_type(TR::Compiler->persistentAllocator())),
+   _wakeupfd(-1), _parkingEnabled(false)
    {
    }
 
+bool
+TR_Listener::parkStream(JITServer::ServerStream *stream)
+   {
+   if (!_parkedStreamsMonitor)
+      return false;
+
+   OMR::CriticalSection parkStream(_parkedStreamsMonitor);
+   if (!_parkingEnabled)
+      return false;
+
+   try
+      {
+      _streamsToPark.push_back(stream);
+      }
+   catch (const std::bad_alloc &)
+      {
+      return false;
+      }
+
+   // Wake up the listener thread; the counter is reset when the listener reads it
+   uint64_t one = 1;
+   if (write(_wakeupfd, &one, sizeof(one)) < 0 && (EAGAIN != errno))
+      {
+      // The listener will still see the stream on its next epoll_wait() timeout
+      if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+         TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Error waking up listener for parked stream %p: errno=%d", stream, errno);
+      }
+   return true;
+   }
+
+void
+TR_Listener::watchParkedStreams(int epollfd, BaseCompileDispatcher *compiler)
+   {
+   uint64_t counter;
+   if (read(_wakeupfd, &counter, sizeof(counter)) < 0 && (EAGAIN != errno))
+      {
+      perror("error reading listener wakeup descriptor");
+      exit(1);
+      }
+
+   PersistentVector<JITServer::ServerStream *> streams(TR::Compiler->persistentAllocator());
+      {
+      OMR::CriticalSection watchParkedStreams(_parkedStreamsMonitor);
+      streams.swap(_streamsToPark);
+      }
+
+   // Streams are dispatched outside of _parkedStreamsMonitor because the
+   // compilation handler acquires the compilation monitor, which is held
+   // by compilation threads calling parkStream()
+   for (auto stream : streams)
+      watchStream(epollfd, stream, compiler);
+   }
+
+void
+TR_Listener::watchStream(int epollfd, JITServer::ServerStream *stream, BaseCompileDispatcher *compiler)
+   {
+   if (stream->hasBufferedInput())
+      {
+      compiler->compile(stream);
+      return;
+      }
+
+   struct epoll_event ev = {0};
+   ev.events = EPOLLIN | EPOLLRDHUP;
+   ev.data.ptr = stream;
+   if (epoll_ctl(epollfd, EPOLL_CTL_ADD, stream->getConnFD(), &ev) < 0)
+      {
+      // Let a compilation thread wait on the stream as it would without parking
+      if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+         TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Error parking stream %p: errno=%d", stream, errno);
+      compiler->compile(stream);
+      return;
+      }
+   _parkedStreams.insert(stream);
+   }
+
+void
+TR_Listener::acceptConnections(int sockfd, int epollfd, uint32_t timeoutMs, SSL_CTX *sslCtx, BaseCompileDispatcher *compiler)
+   {
+   int connfd = -1;
+   do
+      {
+      struct sockaddr_in cli_addr;
+      socklen_t clilen = sizeof(cli_addr);
+      /* at this stage we should have a valid request for new connection */
+      connfd = accept(sockfd, (struct sockaddr *)&cli_addr, &clilen);
+      if (connfd < 0)
+         {
+         if ((EAGAIN != errno) && (EWOULDBLOCK != errno))
+            {
+            if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+               {
+               TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Error accepting connection: errno=%d", errno);
+               }
+            }
+         }
+      else
+         {
+         struct timeval timeoutMsForConnection = {(timeoutMs / 1000), ((timeoutMs % 1000) * 1000)};
+         if (setsockopt(connfd, SOL_SOCKET, SO_RCVTIMEO, (void *)&timeoutMsForConnection, sizeof(timeoutMsForConnection)) < 0)
+            {
+            perror("Can't set option SO_RCVTIMEO on connfd socket");
+            exit(1);
+            }
+         if (setsockopt(connfd, SOL_SOCKET, SO_SNDTIMEO, (void *)&timeoutMsForConnection, sizeof(timeoutMsForConnection)) < 0)
+            {
+            perror("Can't set option SO_SNDTIMEO on connfd socket");
+            exit(1);
+            }
+
+         BIO *bio = NULL;
+         if (sslCtx && !acceptOpenSSLConnection(sslCtx, connfd, bio))
+            continue;
+
+         JITServer::ServerStream *stream = new (TR::Compiler->persistentGlobalAllocator()) JITServer::ServerStream(connfd, bio);
+         // A new connection does not need a compilation thread until the client sends its first request
+         if (_parkingEnabled)
+            watchStream(epollfd, stream, compiler);
+         else
+            compiler->compile(stream);
+         }
+      } while ((-1 != connfd) && !getListenerThreadExitFlag());
+   }
+
+void
+TR_Listener::deleteParkedStreams()
+   {
+      {
+      OMR::CriticalSection deleteParkedStreams(_parkedStreamsMonitor);
+      _parkingEnabled = false;
+      for (auto stream : _streamsToPark)
+         _parkedStreams.insert(stream);
+      _streamsToPark.clear();
+      }
+
+   for (auto stream : _parkedStreams)
+      {
+      stream->~ServerStream();
+      TR::Compiler->persistentGlobalAllocator().deallocate(stream);
+      }
+   _parkedStreams.clear();
+   }
+
 void
 TR_Listener::serveRemoteCompilationRequests(BaseCompileDispatcher *compiler)
    {
@@ -203,7 +352,6 @@ TR_Listener::serveRemoteCompilationRequests(BaseCompileDispatcher *compiler)
 
    uint32_t port = info->getJITServerPort();
    uint32_t timeoutMs = info->getSocketTimeout();
-   struct pollfd pfd = {0};
    int sockfd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0);
    if (sockfd < 0)
       {
@@ -241,22 +389,55 @@ TR_Listener::serveRemoteCompilationRequests(BaseCompileDispatcher *compiler)
       exit(1);
       }
 
-   pfd.fd = sockfd;
-   pfd.events = POLLIN;
+   int epollfd = epoll_create1(EPOLL_CLOEXEC);
+   if (epollfd < 0)
+      {
+      perror("can't create epoll instance");
+      exit(1);
+      }
 
-   while (!getListenerThreadExitFlag())
+   // A NULL data pointer identifies the listening socket
+   struct epoll_event ev = {0};
+   ev.events = EPOLLIN;
+   ev.data.ptr = NULL;
+   if (epoll_ctl(epollfd, EPOLL_CTL_ADD, sockfd, &ev) < 0)
       {
-      int32_t rc = 0;
-      struct sockaddr_in cli_addr;
-      socklen_t clilen = sizeof(cli_addr);
-      int connfd = -1;
+      perror("can't add server socket to epoll instance");
+      exit(1);
+      }
 
-      rc = poll(&pfd, 1, OPENJ9_LISTENER_POLL_TIMEOUT);
-      if (getListenerThreadExitFlag()) // if we are exiting, no need to check poll() status
+   // Idle persistent connections are parked here instead of blocking a compilation thread.
+   // This does not apply to the per-compilation connection mode, where streams are never reused.
+   static bool disableStreamParking = (feGetEnv("TR_DisableJITServerStreamParking") || feGetEnv("TR_EnableJITServerPerCompConn")) ? true : false;
+   if (!disableStreamParking && _parkedStreamsMonitor)
+      {
+      _wakeupfd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+      if (_wakeupfd < 0)
+         {
+         perror("can't create listener wakeup descriptor");
+         exit(1);
+         }
+      // The address of _wakeupfd identifies the wakeup descriptor
+      ev.events = EPOLLIN;
+      ev.data.ptr = &_wakeupfd;
+      if (epoll_ctl(epollfd, EPOLL_CTL_ADD, _wakeupfd, &ev) < 0)
+         {
+         perror("can't add wakeup descriptor to epoll instance");
+         exit(1);
+         }
+      OMR::CriticalSection enableParking(_parkedStreamsMonitor);
+      _parkingEnabled = true;
+      }
+
+   struct epoll_event events[OPENJ9_LISTENER_MAX_EVENTS];
+   while (!getListenerThreadExitFlag())
+      {
+      int32_t rc = epoll_wait(epollfd, events, OPENJ9_LISTENER_MAX_EVENTS, OPENJ9_LISTENER_POLL_TIMEOUT);
+      if (getListenerThreadExitFlag()) // if we are exiting, no need to check epoll_wait() status
          {
          break;
          }
-      else if (0 == rc) // poll() timed out and no fd is ready
+      else if (0 == rc) // epoll_wait() timed out and no fd is ready
          {
          continue;
          }
@@ -272,47 +453,41 @@ TR_Listener::serveRemoteCompilationRequests(BaseCompileDispatcher *compiler)
             exit(1);
             }
          }
-      else if (pfd.revents != POLLIN)
-         {
-         fprintf(stderr, "Unexpected event occurred during poll for new connection: revents=%d\n", pfd.revents);
-         exit(1);
-         }
-      do
+
+      for (int32_t i = 0; (i < rc) && !getListenerThreadExitFlag(); ++i)
          {
-         /* at this stage we should have a valid request for new connection */
-         connfd = accept(sockfd, (struct sockaddr *)&cli_addr, &clilen);
-         if (connfd < 0)
+         if (events[i].data.ptr == &_wakeupfd)
             {
-            if ((EAGAIN != errno) && (EWOULDBLOCK != errno))
-               {
-               if (TR::Options::getVerboseOption(TR_VerboseJITServer))
-                  {
-                  TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Error accepting connection: errno=%d", errno);
-                  }
-               }
+            watchParkedStreams(epollfd, compiler);
             }
-         else
+         else if (events[i].data.ptr)
             {
-            struct timeval timeoutMsForConnection = {(timeoutMs / 1000), ((timeoutMs % 1000) * 1000)};
-            if (setsockopt(connfd, SOL_SOCKET, SO_RCVTIMEO, (void *)&timeoutMsForConnection, sizeof(timeoutMsForConnection)) < 0)
-               {
-               perror("Can't set option SO_RCVTIMEO on connfd socket");
-               exit(1);
-               }
-            if (setsockopt(connfd, SOL_SOCKET, SO_SNDTIMEO, (void *)&timeoutMsForConnection, sizeof(timeoutMsForConnection)) < 0)
-               {
-               perror("Can't set option SO_SNDTIMEO on connfd socket");
-               exit(1);
-               }
-
-            BIO *bio = NULL;
-            if (sslCtx && !acceptOpenSSLConnection(sslCtx, connfd, bio))
-               continue;
-
-            JITServer::ServerStream *stream = new (TR::Compiler->persistentGlobalAllocator()) JITServer::ServerStream(connfd, bio);
+            // The client sent its next request on a parked stream, or closed the connection.
+            // Either way a compilation thread reads from the stream and handles the outcome.
+            JITServer::ServerStream *stream = static_cast<JITServer::ServerStream *>(events[i].data.ptr);
+            epoll_ctl(epollfd, EPOLL_CTL_DEL, stream->getConnFD(), NULL);
+            _parkedStreams.erase(stream);
             compiler->compile(stream);
             }
-         } while ((-1 != connfd) && !getListenerThreadExitFlag());
+         else if (events[i].events != EPOLLIN)
+            {
+            fprintf(stderr, "Unexpected event occurred during poll for new connection: revents=%d\n", events[i].events);
+            exit(1);
+            }
+         else
+            {
+            acceptConnections(sockfd, epollfd, timeoutMs, sslCtx, compiler);
+            }
+         }
+      }
+
+   if (_parkedStreamsMonitor)
+      deleteParkedStreams();
+   close(epollfd);
+   if (_wakeupfd >= 0)
+      {
+      close(_wakeupfd);
+      _wakeupfd = -1;
       }
 
    // The following piece of code will be executed only if the server shuts down properly
@@ -377,6 +552,7 @@ void TR_Listener::startListenerThread(J9JavaVM *javaVM)
    priority = J9THREAD_PRIORITY_NORMAL;
 
    _listenerMonitor = TR::Monitor::create("JITServer-ListenerMonitor");
+   _parkedStreamsMonitor = TR::Monitor::create("JITServer-ParkedStreamsMonitor");
    if (_listenerMonitor)
       {
       // create the thread for listening to a Client compilation request
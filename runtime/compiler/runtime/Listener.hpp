@@ -24,6 +24,7 @@
 #define LISTENER_HPP
 
 #include "j9.h"
+#include "env/PersistentCollections.hpp"
 #include "infra/Monitor.hpp"  // TR::Monitor
 #include "net/ServerStream.hpp"
 
@@ -38,6 +39,7 @@
  */
 
 #define OPENJ9_LISTENER_POLL_TIMEOUT 100 // in milliseconds
+#define OPENJ9_LISTENER_MAX_EVENTS 64 // events handled per epoll_wait() call
 
 class BaseCompileDispatcher;
 
@@ -60,11 +62,27 @@ public:
       opened socket descriptor as a parameter) and passed to the compilation handler.
       Typically, the compilation handler places the ServerStream object in a queue and
       returns immediately so that other connection requests can be accepted.
+      Idle connections handed back with parkStream() are watched by the same epoll instance
+      as the listening socket. When the client sends its next request (or closes the connection)
+      the stream is passed to the compilation handler again, so a compilation thread is only
+      used for a connection while that connection has work to do.
       Note: it must be executed on a separate thread as it needs to keep listening for new connections.
 
       @param [in] compiler Object that defines the behavior when a new connection is accepted
    */
    void serveRemoteCompilationRequests(BaseCompileDispatcher *compiler);
+   /**
+      @brief Hand an idle persistent connection back to the listener
+
+      Called by a compilation thread after it finished a request from this stream.
+      The listener waits for the next request on the stream instead of a compilation
+      thread blocking on it.
+
+      @param [in] stream Stream with no outstanding request
+      @return true if the listener took ownership of the stream, false if the caller
+              must queue the stream itself (parking disabled or the listener is exiting)
+   */
+   bool parkStream(JITServer::ServerStream *stream);
    int32_t waitForListenerThreadExit(J9JavaVM *javaVM);
    void setAttachAttempted(bool b) { _listenerThreadAttachAttempted = b; }
    bool getAttachAttempted() const { return _listenerThreadAttachAttempted; }
@@ -78,11 +96,34 @@ public:
    void setListenerThreadExitFlag() { _listenerThreadExitFlag = true; }
 
 private:
+   /**
+      @brief Start watching the streams handed over by parkStream() since the last call
+
+      Must be executed by the listener thread.
+   */
+   void watchParkedStreams(int epollfd, BaseCompileDispatcher *compiler);
+   /**
+      @brief Add a stream to the epoll set, or dispatch it if SSL already buffered its next request
+   */
+   void watchStream(int epollfd, JITServer::ServerStream *stream, BaseCompileDispatcher *compiler);
+   void acceptConnections(int sockfd, int epollfd, uint32_t timeoutMs, SSL_CTX *sslCtx, BaseCompileDispatcher *compiler);
+   void deleteParkedStreams();
+
    J9VMThread *_listenerThread;
    TR::Monitor *_listenerMonitor;
    j9thread_t _listenerOSThread;
    volatile bool _listenerThreadAttachAttempted;
    volatile bool _listenerThreadExitFlag;
+
+   // Protects _streamsToPark and _parkingEnabled
+   TR::Monitor *_parkedStreamsMonitor;
+   // Streams handed over by compilation threads, not yet added to the epoll set
+   PersistentVector<JITServer::ServerStream *> _streamsToPark;
+   // Streams in the epoll set; only accessed by the listener thread
+   PersistentUnorderedSet<JITServer::ServerStream *> _parkedStreams;
+   // eventfd used by parkStream() to wake up the listener thread
+   int _wakeupfd;
+   bool _parkingEnabled;
    };
 
 /**
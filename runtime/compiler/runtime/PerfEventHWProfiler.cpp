@@ -0,0 +1,646 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "runtime/PerfEventHWProfiler.hpp"
+
+#include "j9cfg.h"
+#include "j9port_generated.h"
+#include "util_api.h"
+#include "AtomicSupport.hpp"
+#include "control/CompilationRuntime.hpp"
+#include "control/Recompilation.hpp"
+#include "control/RecompilationInfo.hpp"
+#include "env/VMJ9.h"
+#include "env/VerboseLog.hpp"
+#include "env/jittypes.h"
+#include "infra/Annotations.hpp"
+
+#if defined(TR_PERF_EVENT_HW_PROFILER)
+
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <syscall.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <linux/perf_event.h>
+
+#define VERBOSE(...)                                                                    \
+   do                                                                                   \
+      {                                                                                 \
+      if (OMR_UNLIKELY(TR::Options::isAnyVerboseOptionSet(TR_VerboseHWProfiler)))        \
+         {                                                                              \
+         TR_VerboseLog::writeLineLocked(TR_Vlog_HWPROFILER, __VA_ARGS__);               \
+         }                                                                              \
+      }                                                                                 \
+   while (0)
+
+// Only the most recent branch records of every sample are kept; LBR stacks are up to
+// 32 deep but the branches closest to the sampled instruction are the interesting ones.
+#define PERF_EVENT_MAX_BRANCHES        8
+#define PERF_EVENT_SAMPLES_PER_BUFFER  64
+
+struct TR_PerfEventBranch
+   {
+   uintptr_t from;
+   uintptr_t to;
+   uintptr_t mispredicted;
+   };
+
+struct TR_PerfEventSample
+   {
+   uintptr_t          ip;
+   uintptr_t          numBranches;
+   TR_PerfEventBranch branches[PERF_EVENT_MAX_BRANCHES];
+   };
+
+struct TR_PerfEventHWProfilerContext
+   {
+   J9VMThread                  *vmThread;
+   int                          fd;
+   int                          itlbFd;
+   struct perf_event_mmap_page *ring;
+   uint8_t                     *ringData;
+   uint64_t                     ringDataSize;
+   uint64_t                     mmapSize;
+   bool                         hasBranchStack;
+   TR_PerfEventSample          *buffer;
+   uint32_t                     spaceLeft;
+   };
+
+static int
+openPerfEvent(bool preciseIP, bool branchStack)
+   {
+   struct perf_event_attr pe;
+   memset(&pe, 0, sizeof(struct perf_event_attr));
+
+   pe.type = PERF_TYPE_HARDWARE;
+   pe.size = sizeof(struct perf_event_attr);
+   pe.config = PERF_COUNT_HW_INSTRUCTIONS;
+   pe.sample_period = TR::Options::_hwprofilerPerfEventSamplingPeriod;
+   pe.sample_type = PERF_SAMPLE_IP;
+   if (branchStack)
+      {
+      pe.sample_type |= PERF_SAMPLE_BRANCH_STACK;
+      pe.branch_sample_type = PERF_SAMPLE_BRANCH_USER | PERF_SAMPLE_BRANCH_ANY;
+      }
+   // On x86 a non-zero precise_ip selects PEBS, which records the IP of the instruction that
+   // overflowed the counter rather than wherever the interrupt happened to land
+   pe.precise_ip = preciseIP ? 2 : 0;
+   pe.disabled = 1;
+   pe.exclude_kernel = 1;
+   pe.exclude_hv = 1;
+   pe.exclude_idle = 1;
+
+   // Measure the calling thread on whichever CPU it runs
+   return syscall(SYS_perf_event_open, &pe, 0, -1, -1, 0);
+   }
+
+// Counts, without sampling, the instruction TLB misses of the calling thread; a rising
+// count as the code caches grow is the cost of a scattered compiled code working set
+static int
+openITLBMissCounter()
+   {
+   struct perf_event_attr pe;
+   memset(&pe, 0, sizeof(struct perf_event_attr));
+
+   pe.type = PERF_TYPE_HW_CACHE;
+   pe.size = sizeof(struct perf_event_attr);
+   pe.config = PERF_COUNT_HW_CACHE_ITLB |
+               (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+               (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+   pe.disabled = 1;
+   pe.exclude_kernel = 1;
+   pe.exclude_hv = 1;
+
+   return syscall(SYS_perf_event_open, &pe, 0, -1, -1, 0);
+   }
+
+TR_PerfEventHWProfiler *
+TR_PerfEventHWProfiler::allocate(J9JITConfig *jitConfig)
+   {
+   uint32_t ringPages = TR::Options::_hwprofilerPerfEventRingPages;
+   if (ringPages == 0 || (ringPages & (ringPages - 1)) != 0)
+      {
+      VERBOSE("HWProfilerPerfEventRingPages=%u is not a power of 2.", ringPages);
+      return NULL;
+      }
+
+   // Find the best configuration the PMU and the kernel accept. PEBS and LBR are
+   // commonly unavailable in virtual machines and BRBE needs a recent AArch64 kernel.
+   bool tryBranchStack = !TR::Options::_hwprofilerPerfEventDisableBranchStack;
+#if defined(TR_HOST_X86)
+   bool tryPreciseIP = true;
+#else
+   bool tryPreciseIP = false;
+#endif /* TR_HOST_X86 */
+
+   static const struct { bool preciseIP; bool branchStack; } probes[] =
+      {
+      { true,  true  },
+      { false, true  },
+      { true,  false },
+      { false, false }
+      };
+
+   int fd = -1;
+   bool preciseIP = false;
+   bool branchStack = false;
+   for (size_t i = 0; i < sizeof(probes) / sizeof(probes[0]) && fd < 0; ++i)
+      {
+      if ((probes[i].preciseIP && !tryPreciseIP) || (probes[i].branchStack && !tryBranchStack))
+         continue;
+      preciseIP = probes[i].preciseIP;
+      branchStack = probes[i].branchStack;
+      fd = openPerfEvent(preciseIP, branchStack);
+      }
+
+   if (fd < 0)
+      {
+      VERBOSE("Failed to open a sampling perf_event, errno: %d, perf_event_open : %s.", errno, strerror(errno));
+      return NULL;
+      }
+   close(fd);
+
+   TR_PerfEventHWProfiler *profiler = new (PERSISTENT_NEW) TR_PerfEventHWProfiler(jitConfig);
+   if (profiler)
+      {
+      profiler->_usePreciseIP = preciseIP;
+      profiler->_useBranchStack = branchStack;
+      VERBOSE("HWProfiler initialized, precise IP %s, branch stack %s.", preciseIP ? "on" : "off", branchStack ? "on" : "off");
+      }
+
+   return profiler;
+   }
+
+TR_PerfEventHWProfiler::TR_PerfEventHWProfiler(J9JITConfig *jitConfig)
+   : TR_HWProfiler(jitConfig),
+     _perfEventBufferMemoryAllocated(0), _perfEventBufferMaximumMemory(TR::Options::_hwprofilerRIBufferPoolSize),
+     _usePreciseIP(false), _useBranchStack(false),
+     _STATS_SamplesLost(0), _STATS_SamplesDropped(0), _STATS_BranchRecords(0),
+     _STATS_JittedBranchRecords(0), _STATS_MispredictedJittedBranches(0), _STATS_ITLBMisses(0)
+   {}
+
+bool
+TR_PerfEventHWProfiler::initializeThread(J9VMThread *vmThread)
+   {
+   if (IS_THREAD_RI_INITIALIZED(vmThread))
+      return true;
+
+   // If we've already hit our memory budget don't even try to go further
+   if (_perfEventBufferMemoryAllocated >= _perfEventBufferMaximumMemory)
+      return false;
+
+   TR_PerfEventHWProfilerContext *context = NULL;
+   void *buffer = NULL;
+   void *ring = MAP_FAILED;
+   bool setUnavailableOnFail = true;
+   uint64_t pageSize = sysconf(_SC_PAGESIZE);
+   uint64_t mmapSize = (1 + TR::Options::_hwprofilerPerfEventRingPages) * pageSize;
+   uint64_t bufferSize = PERF_EVENT_SAMPLES_PER_BUFFER * sizeof(TR_PerfEventSample);
+
+   int fd = openPerfEvent(_usePreciseIP, _useBranchStack);
+   if (fd < 0)
+      {
+      VERBOSE("Failed to open perf interface for J9VMThread=%p, errno: %d, perf_event_open : %s.", vmThread, errno, strerror(errno));
+      // Running out of file descriptors is transient; anything else means the PMU went away
+      setUnavailableOnFail = (errno != EMFILE && errno != ENFILE);
+      goto fail;
+      }
+
+   ring = mmap(NULL, mmapSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+   if (ring == MAP_FAILED)
+      {
+      VERBOSE("Failed to map perf ring buffer for J9VMThread=%p, errno: %d, mmap : %s.", vmThread, errno, strerror(errno));
+      // Usually the per-user perf_event_mlock_kb limit, which frees up as threads exit
+      setUnavailableOnFail = false;
+      goto closefd;
+      }
+
+   buffer = allocateBuffer(bufferSize);
+   if (!buffer)
+      {
+      VERBOSE("Failed to allocate buffer for J9VMThread=%p.", vmThread);
+      // Don't have enough memory now, but might in the future, so don't disable HWP completely
+      setUnavailableOnFail = false;
+      goto unmap;
+      }
+
+   context = (TR_PerfEventHWProfilerContext*)jitPersistentAlloc(sizeof(TR_PerfEventHWProfilerContext));
+   if (!context)
+      {
+      VERBOSE("Failed to allocate context for J9VMThread=%p.", vmThread);
+      setUnavailableOnFail = false;
+      goto freebuf;
+      }
+
+   context->vmThread = vmThread;
+   context->fd = fd;
+   context->ring = (struct perf_event_mmap_page *)ring;
+   context->ringData = (uint8_t *)ring + pageSize;
+   context->ringDataSize = mmapSize - pageSize;
+   context->mmapSize = mmapSize;
+   context->hasBranchStack = _useBranchStack;
+   context->buffer = (TR_PerfEventSample *)buffer;
+   context->spaceLeft = PERF_EVENT_SAMPLES_PER_BUFFER;
+
+   // Not every PMU exposes an iTLB miss event; profiling goes ahead without it
+   context->itlbFd = openITLBMissCounter();
+   if (context->itlbFd < 0)
+      VERBOSE("No iTLB miss counter for J9VMThread=%p, errno: %d, perf_event_open : %s.", vmThread, errno, strerror(errno));
+
+   if (ioctl(fd, PERF_EVENT_IOC_ENABLE, 0) < 0)
+      {
+      VERBOSE("Failed to enable perf interface for J9VMThread=%p, errno: %d, ioctl : %s.", vmThread, errno, strerror(errno));
+      goto freectx;
+      }
+   if (context->itlbFd >= 0)
+      ioctl(context->itlbFd, PERF_EVENT_IOC_ENABLE, 0);
+
+   vmThread->riParameters->controlBlock = context;
+   vmThread->riParameters->flags |= J9PORT_RI_INITIALIZED | J9PORT_RI_ENABLED;
+
+   VERBOSE("J9VMThread=%p, initialized for HW profiling, context=%p.", vmThread, context);
+   return true;
+
+freectx:
+   if (context->itlbFd >= 0)
+      close(context->itlbFd);
+   jitPersistentFree(context);
+freebuf:
+   freeBuffer(buffer, bufferSize);
+unmap:
+   munmap(ring, mmapSize);
+closefd:
+   close(fd);
+fail:
+   // Prevent any future threads from trying to initialize if we hit a failure that is not transient
+   if (setUnavailableOnFail)
+      {
+      VERBOSE("Failure on J9VMThread=%p was critical. HW profiling will be unavailable from now on.", vmThread);
+      setHWProfilingAvailable(false);
+      }
+   return false;
+   }
+
+bool
+TR_PerfEventHWProfiler::deinitializeThread(J9VMThread *vmThread)
+   {
+   if (!IS_THREAD_RI_INITIALIZED(vmThread))
+      return true;
+
+   TR_PerfEventHWProfilerContext *context = (TR_PerfEventHWProfilerContext *)vmThread->riParameters->controlBlock;
+   VERBOSE("Retrieved context=%p for terminating J9VMThread=%p.", context, vmThread);
+
+   ioctl(context->fd, PERF_EVENT_IOC_DISABLE, 0);
+   if (context->itlbFd >= 0)
+      {
+      uint64_t itlbMisses = 0;
+      if (read(context->itlbFd, &itlbMisses, sizeof(itlbMisses)) == sizeof(itlbMisses))
+         {
+         VERBOSE("J9VMThread=%p had %" OMR_PRIu64 " iTLB misses.", vmThread, itlbMisses);
+         // Threads terminate concurrently
+         VM_AtomicSupport::addU64(&_STATS_ITLBMisses, itlbMisses);
+         }
+      close(context->itlbFd);
+      }
+   if (context->buffer)
+      freeBuffer(context->buffer, PERF_EVENT_SAMPLES_PER_BUFFER * sizeof(TR_PerfEventSample));
+   munmap(context->ring, context->mmapSize);
+   if (close(context->fd))
+      VERBOSE("Failed to close perf interface (fd=%d) on J9VMThread=%p, errno: %d, close : %s.", context->fd, vmThread, errno, strerror(errno));
+
+   jitPersistentFree(context);
+   vmThread->riParameters->flags &= ~(J9PORT_RI_INITIALIZED | J9PORT_RI_ENABLED);
+   vmThread->riParameters->controlBlock = NULL;
+
+   return !IS_THREAD_RI_INITIALIZED(vmThread);
+   }
+
+/**
+ * Copy len bytes starting at offset in the ring, wrapping around its end if needed.
+ */
+static void
+copyFromRing(TR_PerfEventHWProfilerContext *context, uint64_t offset, void *dest, uint64_t len)
+   {
+   uint64_t start = offset & (context->ringDataSize - 1);
+   uint64_t firstPart = context->ringDataSize - start;
+   if (firstPart >= len)
+      {
+      memcpy(dest, context->ringData + start, len);
+      }
+   else
+      {
+      memcpy(dest, context->ringData + start, firstPart);
+      memcpy((uint8_t *)dest + firstPart, context->ringData, len - firstPart);
+      }
+   }
+
+void
+TR_PerfEventHWProfiler::drainRing(TR_PerfEventHWProfilerContext *context)
+   {
+   struct perf_event_mmap_page *ring = context->ring;
+   uint64_t head = ring->data_head;
+   // Pairs with the kernel's write barrier between writing the records and updating data_head
+   VM_AtomicSupport::readBarrier();
+   uint64_t tail = ring->data_tail;
+
+   while (tail < head)
+      {
+      struct perf_event_header header;
+      copyFromRing(context, tail, &header, sizeof(header));
+      if (OMR_UNLIKELY(header.size < sizeof(header)))
+         {
+         // Corrupt record; drop everything written so far
+         tail = head;
+         break;
+         }
+
+      if (header.type == PERF_RECORD_SAMPLE)
+         {
+         if (OMR_LIKELY(context->spaceLeft))
+            {
+            TR_PerfEventSample *sample = &context->buffer[PERF_EVENT_SAMPLES_PER_BUFFER - context->spaceLeft];
+            uint64_t cursor = tail + sizeof(header);
+            uint64_t ip;
+            copyFromRing(context, cursor, &ip, sizeof(ip));
+            cursor += sizeof(ip);
+            sample->ip = (uintptr_t)ip;
+            sample->numBranches = 0;
+
+            if (context->hasBranchStack)
+               {
+               uint64_t nr;
+               copyFromRing(context, cursor, &nr, sizeof(nr));
+               cursor += sizeof(nr);
+               _STATS_BranchRecords += nr;
+               // Entries are ordered from the most recent branch to the oldest
+               for (uint64_t i = 0; i < nr && i < PERF_EVENT_MAX_BRANCHES; ++i)
+                  {
+                  struct perf_branch_entry entry;
+                  copyFromRing(context, cursor + i * sizeof(entry), &entry, sizeof(entry));
+                  sample->branches[i].from = (uintptr_t)entry.from;
+                  sample->branches[i].to = (uintptr_t)entry.to;
+                  sample->branches[i].mispredicted = entry.mispred;
+                  sample->numBranches++;
+                  }
+               }
+            --context->spaceLeft;
+            }
+         else
+            {
+            _STATS_SamplesDropped++;
+            }
+         }
+      else if (header.type == PERF_RECORD_LOST)
+         {
+         struct { struct perf_event_header header; uint64_t id; uint64_t lost; } lostRecord;
+         copyFromRing(context, tail, &lostRecord, sizeof(lostRecord));
+         _STATS_SamplesLost += lostRecord.lost;
+         }
+
+      tail += header.size;
+      }
+
+   // Make sure all reads of the records complete before handing the space back to the kernel
+   VM_AtomicSupport::readWriteBarrier();
+   ring->data_tail = tail;
+   }
+
+bool
+TR_PerfEventHWProfiler::processBuffers(J9VMThread *vmThread, TR_J9VMBase *fe)
+   {
+   TR_ASSERT(IS_THREAD_RI_INITIALIZED(vmThread), "processBuffers() called on uninitialized thread");
+   TR_ASSERT((vmThread->publicFlags & J9_PUBLIC_FLAGS_VM_ACCESS), "Must have vm access!");
+
+   TR_PerfEventHWProfilerContext *context = (TR_PerfEventHWProfilerContext *)vmThread->riParameters->controlBlock;
+
+   // The buffer may be missing if a previous swap could not get a new one
+   if (OMR_UNLIKELY(!context->buffer))
+      {
+      context->buffer = (TR_PerfEventSample *)allocateBuffer(PERF_EVENT_SAMPLES_PER_BUFFER * sizeof(TR_PerfEventSample));
+      context->spaceLeft = PERF_EVENT_SAMPLES_PER_BUFFER;
+      if (!context->buffer)
+         {
+         // Keep the kernel writing into free space; the samples are discarded
+         context->spaceLeft = 0;
+         drainRing(context);
+         return false;
+         }
+      }
+
+   drainRing(context);
+
+   uint32_t bufferSize = PERF_EVENT_SAMPLES_PER_BUFFER;
+   uint32_t spaceLeft = context->spaceLeft;
+   float    bufferSpaceLeftPercentage = (float)spaceLeft / (float)bufferSize * 100.0f;
+   if (bufferSpaceLeftPercentage > (100 - TR::Options::_hwprofilerRIBufferThreshold))
+      return false;
+
+   uint32_t bufferSizeInBytes = bufferSize * sizeof(TR_PerfEventSample);
+   uint32_t bufferFilledSizeInBytes = (bufferSize - spaceLeft) * sizeof(TR_PerfEventSample);
+
+   _numRequests++;
+
+   uint8_t *newBuffer = swapBufferToWorkingQueue((U_8*)context->buffer,
+                                                  bufferSizeInBytes,
+                                                  bufferFilledSizeInBytes);
+   if (OMR_LIKELY(newBuffer != NULL))
+      {
+      context->buffer = (TR_PerfEventSample *)newBuffer;
+      context->spaceLeft = bufferSize;
+      }
+   else
+      {
+      if (TR::Options::getCmdLineOptions()->getOption(TR_DisableHWProfilerThread) ||
+          (100*_numRequestsSkipped) >= ((uint64_t)TR::Options::_hwProfilerBufferMaxPercentageToDiscard * _numRequests))
+         {
+         // Process buffer by application thread and reuse the buffer
+         processBufferRecords(vmThread, (U_8*)context->buffer,
+                              bufferSizeInBytes,
+                              bufferFilledSizeInBytes);
+         _STATS_BuffersProcessedByAppThread++;
+         }
+      else
+         {
+         _numRequestsSkipped++;
+         }
+      context->spaceLeft = bufferSize;
+      }
+
+   return false;
+   }
+
+// This helps when you have several consecutive samples in a buffer hitting the same method,
+// however even with just a few hits it's probably a net win considering how much work is
+// done for a single metadata search.
+static J9JITExceptionTable *
+findMetaData(J9JITConfig *jitConfig, uintptr_t pc, J9JITExceptionTable *&lastMetaData)
+   {
+   if (lastMetaData && pc >= lastMetaData->startPC && pc <= lastMetaData->endPC)
+      return lastMetaData;
+
+   J9JITExceptionTable *metaData = jit_artifact_search(jitConfig->translationArtifacts, pc);
+   if (metaData)
+      lastMetaData = metaData;
+   return metaData;
+   }
+
+static void
+recordTick(J9VMThread *vmThread, TR_FrontEnd *fe, TR_HWProfiler *hwProfiler, J9JITExceptionTable *metaData, bool recompilationEnabled)
+   {
+   TR::Recompilation::hwpGlobalSampleCount++;
+   if (recompilationEnabled && metaData->bodyInfo != NULL)
+      {
+      TR_PersistentJittedBodyInfo *bodyInfo = (TR_PersistentJittedBodyInfo *) metaData->bodyInfo;
+
+      bodyInfo->_hwpInstructionCount++;
+      if (hwProfiler->recompilationLogic(bodyInfo,
+                                         (void *) metaData->startPC,
+                                         bodyInfo->_hwpInstructionStartCount,
+                                         bodyInfo->_hwpInstructionCount,
+                                         TR::Recompilation::hwpGlobalSampleCount,
+                                         fe,
+                                         vmThread))
+         {
+         // Start a new interval
+         bodyInfo->_hwpInstructionStartCount   = TR::Recompilation::hwpGlobalSampleCount;
+         bodyInfo->_hwpInstructionCount        = 0;
+         }
+      }
+   }
+
+void
+TR_PerfEventHWProfiler::processBufferRecords(J9VMThread *vmThread, uint8_t *bufferStart, uintptr_t size, uintptr_t bufferFilledSize, uint32_t dataTag)
+   {
+   TR_PerfEventSample *samples   = (TR_PerfEventSample *)bufferStart;
+   uint32_t numSamples           = bufferFilledSize / sizeof(TR_PerfEventSample);
+   uint32_t numJittedSamples     = 0;
+   TR_FrontEnd *fe               = TR_J9VMBase::get(_jitConfig, vmThread);
+   bool recompilationEnabled     = _compInfo->getPersistentInfo()->isRuntimeInstrumentationRecompilationEnabled()
+                                   && vmThread != NULL
+                                   && fe != NULL;
+   J9JITExceptionTable *lastMetaData = NULL;
+
+   for (uint32_t i = 0; i < numSamples; ++i)
+      {
+      J9JITExceptionTable *metaData = findMetaData(_jitConfig, samples[i].ip, lastMetaData);
+      if (metaData)
+         {
+         ++numJittedSamples;
+         recordTick(vmThread, fe, this, metaData, recompilationEnabled);
+         }
+
+      // Every taken branch that lands in a jitted body is an additional observation of where
+      // the thread spent its time, which lets a sparse PMU sampling period reach the
+      // recompilation decision points as quickly as dense sampling would.
+      for (uint32_t j = 0; j < samples[i].numBranches; ++j)
+         {
+         TR_PerfEventBranch &branch = samples[i].branches[j];
+         J9JITExceptionTable *targetMetaData = findMetaData(_jitConfig, branch.to, lastMetaData);
+         if (!targetMetaData)
+            continue;
+
+         ++_STATS_JittedBranchRecords;
+         if (branch.mispredicted)
+            ++_STATS_MispredictedJittedBranches;
+         recordTick(vmThread, fe, this, targetMetaData, recompilationEnabled);
+         }
+      }
+
+   _STATS_TotalEntriesProcessed += numSamples;
+
+   if (bufferFilledSize >= size)
+      _numBuffersCompletelyFilled++;
+
+   _bufferSizeSum += size;
+   _bufferFilledSum += bufferFilledSize;
+   ++_STATS_TotalBuffersProcessed;
+   }
+
+void *
+TR_PerfEventHWProfiler::allocateBuffer(uint64_t size)
+   {
+   void * temp = NULL;
+
+   if (_hwProfilerMonitor)
+      {
+      if (_hwProfilerMonitor->try_enter())
+         return NULL;
+
+      // First try to get a buffer from the free list
+      HWProfilerBuffer *newHWProfilerBuffer = _freeBufferList.pop();
+      if (newHWProfilerBuffer)
+         {
+         temp = (void *)newHWProfilerBuffer->getBuffer();
+         TR_Memory::jitPersistentFree(newHWProfilerBuffer);
+         }
+      // Try to allocate a buffer from jitPersistentAlloc
+      else if (_perfEventBufferMemoryAllocated + size < _perfEventBufferMaximumMemory)
+         {
+         _perfEventBufferMemoryAllocated += size;
+         temp = (void*)TR_Memory::jitPersistentAlloc(size, TR_Memory::HWProfile);
+         }
+
+      _hwProfilerMonitor->exit();
+      }
+
+   return temp;
+   }
+
+void
+TR_PerfEventHWProfiler::freeBuffer(void *buffer, uint64_t size)
+   {
+   if (_hwProfilerMonitor)
+      {
+      _hwProfilerMonitor->enter();
+
+      // Put the buffers into the free list for another thread
+      HWProfilerBuffer *newHWProfilerBuffer = (HWProfilerBuffer*)TR_Memory::jitPersistentAlloc(sizeof(HWProfilerBuffer));
+      if (newHWProfilerBuffer)
+         {
+         newHWProfilerBuffer->setBuffer((U_8*)buffer);
+         newHWProfilerBuffer->setSize(size);
+         newHWProfilerBuffer->setIsInvalidated(false);
+
+         _freeBufferList.add(newHWProfilerBuffer);
+         }
+
+      _hwProfilerMonitor->exit();
+      }
+   }
+
+void
+TR_PerfEventHWProfiler::printStats()
+   {
+   printf("\n");
+   printf("perf_event precise IP = %s, branch stack = %s\n", _usePreciseIP ? "yes" : "no", _useBranchStack ? "yes" : "no");
+   printf("Number of samples lost by the kernel = %" OMR_PRIu64 "\n",          _STATS_SamplesLost);
+   printf("Number of samples dropped on full buffers = %" OMR_PRIu64 "\n",     _STATS_SamplesDropped);
+   printf("Number of branch records = %" OMR_PRIu64 "\n",                      _STATS_BranchRecords);
+   printf("Number of branch records into jitted code = %" OMR_PRIu64 "\n",     _STATS_JittedBranchRecords);
+   printf("Number of mispredicted branches into jitted code = %" OMR_PRIu64 "\n", _STATS_MispredictedJittedBranches);
+   printf("Number of iTLB misses of terminated threads = %" OMR_PRIu64 "\n",   _STATS_ITLBMisses);
+   TR_HWProfiler::printStats();
+   }
+
+#endif /* defined(TR_PERF_EVENT_HW_PROFILER) */
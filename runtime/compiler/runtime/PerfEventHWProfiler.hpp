@@ -0,0 +1,160 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef PERFEVENTHWPROFILER_INCL
+#define PERFEVENTHWPROFILER_INCL
+
+#include "runtime/HWProfiler.hpp"
+
+#include <stdint.h>
+#include "env/jittypes.h"
+
+class TR_J9VMBase;
+struct TR_PerfEventHWProfilerContext;
+
+/**
+ * HW Profiler for Linux on x86-64 and AArch64.
+ *
+ * Each application thread opens a sampling perf_event on retired user instructions
+ * (precise/PEBS when the PMU supports it) and, where available, asks the kernel to
+ * attach the last-branch records (LBR on x86, BRBE on AArch64) to every sample. The
+ * kernel writes the samples into a per-thread ring buffer; the thread drains the ring
+ * into HWProfilerBuffers when it handles its sampling interrupt and the buffers are
+ * processed either by the HW profiler thread or by the application thread itself.
+ */
+class TR_PerfEventHWProfiler : public TR_HWProfiler
+   {
+public:
+   TR_PERSISTENT_ALLOC(TR_Memory::HWProfile);
+
+   /**
+    * Constructor.
+    * @param jitConfig the J9JITConfig
+    */
+   TR_PerfEventHWProfiler(J9JITConfig *jitConfig);
+
+
+   // --------------------------------------------------------------------------------------
+   // HW Profiler Management Methods
+
+   /**
+    * Static method used to allocate the HW Profiler. Probes the kernel for a usable
+    * perf_event configuration first and returns NULL if there is none.
+    * @param jitConfig The J9JITConfig
+    * @return pointer to the HWPRofiler
+    */
+   static TR_PerfEventHWProfiler* allocate(J9JITConfig *jitConfig);
+
+   /**
+    * Open and map a sampling perf_event for the given app thread.
+    * @param vmThread The VM thread to initialize profiling.
+    * @return true if initialization is successful; false otherwise.
+    */
+   virtual bool initializeThread(J9VMThread *vmThread);
+
+   /**
+    * Close the perf_event of the given app thread and release its buffers.
+    * @param vmThread The VM thread to deinitialize profiling.
+    * @return true if deinitialization is successful; false otherwise.
+    */
+   virtual bool deinitializeThread(J9VMThread *vmThread);
+
+
+   // --------------------------------------------------------------------------------------
+   // HW Profiler Buffer Processing Methods
+
+   /**
+    * Drain the perf_event ring of the given app thread into its HWProfilerBuffer and
+    * hand the buffer over for processing once it is full enough.
+    * @param vmThread The VM thread to query
+    * @param fe The Front End
+    * @return false if the thread cannot be used for HW Profiling; true otherwise.
+    */
+   virtual bool processBuffers(J9VMThread *vmThread, TR_J9VMBase *fe);
+
+   /**
+    * Method to process the samples in the buffers.
+    * @param vmThread The VM thread
+    * @param dataStart The start of the data buffer.
+    * @param size      Size of the data buffer.
+    * @param bufferFilledSize The amount of the buffer that is filled
+    * @param dataTag   Unused.
+    */
+   virtual void processBufferRecords(J9VMThread *vmThread,
+                                     uint8_t *bufferStart,
+                                     uintptr_t size,
+                                     uintptr_t bufferFilledSize,
+                                     uint32_t dataTag = 0);
+
+   /**
+    * Method to allocate a buffer for HW Profiling.
+    * There is a maximum amount of memory the HW Profiler is allowed to allocate. It first tries to
+    * pull a buffer from TR_HWPRofiler::_freeBufferList. If there are no free buffers, it uses
+    * TR_Memory::jitPersistentAlloc to allocate a buffer.
+    * @param size The size of the buffer to be allocated
+    * @return a pointer to the buffer
+    */
+   virtual void* allocateBuffer(uint64_t size);
+
+   /**
+    * Method to free a buffer allocated for HW Profiling (places it into the free list).
+    * @param buffer The buffer to be freed
+    * @param Parameter for the size of the buffer to be freed
+    */
+   virtual void freeBuffer(void * buffer, uint64_t size = 0);
+
+
+   // --------------------------------------------------------------------------------------
+   // HW Profiler Miscellaneous Helper Methods
+
+   /**
+    * Prints out perf_event HW Profiler stats first and then calls TR_HWProfiler::printStats()
+    */
+   virtual void printStats();
+
+protected:
+
+   /**
+    * Copy the records written by the kernel since the last call from the ring of
+    * the given context into its HWProfilerBuffer.
+    * @param context The per-thread perf_event context
+    */
+   void drainRing(TR_PerfEventHWProfilerContext *context);
+
+   // Buffer Memory Allocated
+   uint64_t                 _perfEventBufferMemoryAllocated;
+   uint64_t                 _perfEventBufferMaximumMemory;
+
+   // Whether the precise (PEBS) variant and branch records were accepted by the probe in allocate()
+   bool                     _usePreciseIP;
+   bool                     _useBranchStack;
+
+   // Stats
+   uint64_t                 _STATS_SamplesLost;
+   uint64_t                 _STATS_SamplesDropped;
+   uint64_t                 _STATS_BranchRecords;
+   uint64_t                 _STATS_JittedBranchRecords;
+   uint64_t                 _STATS_MispredictedJittedBranches;
+   volatile uint64_t        _STATS_ITLBMisses;
+   };
+
+#endif /* PERFEVENTHWPROFILER_INCL */
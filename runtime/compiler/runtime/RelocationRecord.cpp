@@ -488,8 +488,9 @@ TR_RelocationRecordGroup::applyRelocations(TR_RelocationRuntime *reloRuntime,
       {
       TR::SymbolValidationManager *svm =
          reloRuntime->comp()->getSymbolValidationManager();
+      svm->setValidationCache(reloRuntime->validationCache());
 
-      if (!svm->validateWellKnownClasses(wkClassChainOffsets))
+      if (!svm->validateWellKnownClasses(wkClassChainOffsets, reloRuntime->wellKnownClassesCache()))
          {
          if (aotStats)
             aotStats->numWellKnownClassesValidationsFailed++;
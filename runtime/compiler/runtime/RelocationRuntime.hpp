@@ -31,6 +31,7 @@
 #include "runtime/HWProfiler.hpp"
 #include "env/VMJ9.h"
 #include "env/J9CPU.hpp"
+#include "runtime/SymbolValidationManager.hpp"
 
 namespace TR { class CompilationInfo; }
 class TR_RelocationRecord;
@@ -130,6 +131,8 @@ class TR_RelocationRuntime {
       TR_RelocationTarget *reloTarget()                           { return _reloTarget; }
       TR_RelocationRuntimeLogger *reloLogger()                    { return _reloLogger; }
       TR_AOTStats *aotStats()                                     { return _aotStats; }
+      TR::SymbolValidationManager::WellKnownClassesCache *wellKnownClassesCache() { return &_wellKnownClassesCache; }
+      TR::SymbolValidationManager::ValidationCache *validationCache() { return &_validationCache; }
 
       J9JITConfig *jitConfig()                                    { return _jitConfig; }
       TR_FrontEnd *fe()                                           { return _fe; }
@@ -293,6 +296,9 @@ class TR_RelocationRuntime {
       TR_RelocationTarget *_reloTarget;
       TR_RelocationRuntimeLogger *_reloLogger;
       TR_AOTStats *_aotStats;
+      // Shared by all the bodies relocated by this runtime
+      TR::SymbolValidationManager::WellKnownClassesCache _wellKnownClassesCache;
+      TR::SymbolValidationManager::ValidationCache _validationCache;
       J9JITExceptionTable *_exceptionTable;
       uint8_t *_newExceptionTableStart;
       uint8_t *_newPersistentInfo;
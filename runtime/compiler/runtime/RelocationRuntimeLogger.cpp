@@ -243,7 +243,9 @@ TR_RelocationRuntimeLogger::relocationTime()
       JITRT_PRINTF(jitConfig())(jitConfig(), " <%p-%p> ",
                                              reloRuntime()->exceptionTable()->startPC,
                                              reloRuntime()->exceptionTable()->endPC);
-      JITRT_PRINTF(jitConfig())(jitConfig(), " Time: %d usec\n", reloEndTime-_reloStartTime);
+      JITRT_PRINTF(jitConfig())(jitConfig(), " Time: %d usec", reloEndTime-_reloStartTime);
+      TR::SymbolValidationManager::ValidationCache *validationCache = reloRuntime()->validationCache();
+      JITRT_PRINTF(jitConfig())(jitConfig(), " SVM cache hits: %u misses: %u\n", validationCache->hits(), validationCache->misses());
       unlockLog(wasLocked);
       }
    }
@@ -76,6 +76,7 @@ TR::SymbolValidationManager::SymbolValidationManager(TR::Region &region, TR_Reso
      _chTable(_comp->getPersistentInfo()->getPersistentCHTable()),
      _rootClass(compilee->classOfMethod()),
      _wellKnownClassChainOffsets(NULL),
+     _validationCache(NULL),
      _symbolValidationRecords(_region),
      _alreadyGeneratedRecords(LessSymbolValidationRecord(), _region),
      _classesFromAnyCPIndex(LessClassFromAnyCPIndex(), _region),
@@ -310,31 +311,111 @@ TR::SymbolValidationManager::populateWellKnownClasses()
 #undef REQUIRED_WELL_KNOWN_CLASS_COUNT
    }
 
+void
+TR::SymbolValidationManager::ValidationCache::flushIfClassesWereUnloaded()
+   {
+   int32_t classUnloadID = TR::CompilationInfo::get()->getPersistentInfo()->getGlobalClassUnloadID();
+   if (_classUnloadID != classUnloadID)
+      {
+      if (_classes != NULL)
+         _classes->clear();
+      _classUnloadID = classUnloadID;
+      }
+   }
+
+TR_OpaqueClassBlock *
+TR::SymbolValidationManager::ValidationCache::find(TR_ExternalRelocationTargetKind kind, void *classChain, void *loaderKey)
+   {
+   flushIfClassesWereUnloaded();
+
+   if (_classes != NULL)
+      {
+      auto it = _classes->find(Key(std::make_pair(classChain, loaderKey), kind));
+      // Classes replaced by a (non fast) HCR are obsolete; callers revalidate the class
+      // chain of a hit, since fast HCR keeps the J9Class but gives it a new ROM class
+      if (it != _classes->end() && !J9_IS_CLASS_OBSOLETE((J9Class *)it->second))
+         {
+         _hits++;
+         return it->second;
+         }
+      }
+
+   _misses++;
+   return NULL;
+   }
+
+void
+TR::SymbolValidationManager::ValidationCache::insert(TR_ExternalRelocationTargetKind kind, void *classChain, void *loaderKey, TR_OpaqueClassBlock *clazz)
+   {
+   if (clazz == NULL)
+      return;
+
+   if (_classes == NULL)
+      {
+      _classes = new (PERSISTENT_NEW) ClassMap(ClassMap::allocator_type(TR::Compiler->persistentAllocator()));
+      if (_classes == NULL)
+         return;
+      }
+
+   (*_classes)[Key(std::make_pair(classChain, loaderKey), kind)] = clazz;
+   }
+
 bool
-TR::SymbolValidationManager::validateWellKnownClasses(const uintptr_t *wellKnownClassChainOffsets)
+TR::SymbolValidationManager::validateWellKnownClasses(const uintptr_t *wellKnownClassChainOffsets, WellKnownClassesCache *cache)
    {
    // We may have already run populateWellKnownClasses on this
    // SymbolValidationManager, if there was no delay before processing the
    // relocations, in which case the Compilation is reused.
    bool assignNewIDs = _wellKnownClassChainOffsets == NULL;
    int classCount = static_cast<int>(wellKnownClassChainOffsets[0]);
-   for (int i = 1; i <= classCount; i++)
+
+   if (classCount > WELL_KNOWN_CLASS_COUNT)
+      cache = NULL;
+
+   // Well-known classes are system classes, so they are never unloaded; however,
+   // they can be redefined. Fast HCR keeps the J9Class and only replaces its ROM
+   // class, so the cached classes must still match their class chains. This skips
+   // the class lookups by name, not the class chain validation.
+   bool useCache = cache != NULL && cache->_classChainOffsets == wellKnownClassChainOffsets;
+   for (int i = 0; useCache && i < classCount; i++)
       {
-      uintptr_t classChainOffset = wellKnownClassChainOffsets[i];
       uintptr_t *classChain = reinterpret_cast<uintptr_t*>(
-         _fej9->sharedCache()->pointerFromOffsetInSharedCache(classChainOffset));
-      J9ROMClass *romClass = _fej9->sharedCache()->startingROMClassOfClassChain(classChain);
-      J9UTF8 * className = J9ROMCLASS_CLASSNAME(romClass);
+         _fej9->sharedCache()->pointerFromOffsetInSharedCache(wellKnownClassChainOffsets[i + 1]));
+      if (J9_IS_CLASS_OBSOLETE((J9Class *)cache->_classes[i])
+          || !_fej9->sharedCache()->classMatchesCachedVersion((J9Class *)cache->_classes[i], classChain))
+         useCache = false;
+      }
+   if (cache != NULL && !useCache)
+      cache->_classChainOffsets = NULL;
 
-      TR_OpaqueClassBlock *clazz = _fej9->getSystemClassFromClassName(
-         reinterpret_cast<const char *>(J9UTF8_DATA(className)),
-         J9UTF8_LENGTH(className));
+   for (int i = 1; i <= classCount; i++)
+      {
+      TR_OpaqueClassBlock *clazz = NULL;
+      if (useCache)
+         {
+         clazz = cache->_classes[i - 1];
+         }
+      else
+         {
+         uintptr_t classChainOffset = wellKnownClassChainOffsets[i];
+         uintptr_t *classChain = reinterpret_cast<uintptr_t*>(
+            _fej9->sharedCache()->pointerFromOffsetInSharedCache(classChainOffset));
+         J9ROMClass *romClass = _fej9->sharedCache()->startingROMClassOfClassChain(classChain);
+         J9UTF8 * className = J9ROMCLASS_CLASSNAME(romClass);
 
-      if (clazz == NULL)
-         return false;
+         clazz = _fej9->getSystemClassFromClassName(
+            reinterpret_cast<const char *>(J9UTF8_DATA(className)),
+            J9UTF8_LENGTH(className));
 
-      if (!_fej9->sharedCache()->classMatchesCachedVersion(clazz, classChain))
-         return false;
+         if (clazz == NULL)
+            return false;
+
+         if (!_fej9->sharedCache()->classMatchesCachedVersion(clazz, classChain))
+            return false;
+
+         if (cache != NULL)
+            cache->_classes[i - 1] = clazz;
+         }
 
       _seenSymbolsSet.insert(clazz);
       if (assignNewIDs)
@@ -345,6 +426,9 @@ TR::SymbolValidationManager::validateWellKnownClasses(const uintptr_t *wellKnown
          }
       }
 
+   if (cache != NULL)
+      cache->_classChainOffsets = wellKnownClassChainOffsets;
+
    // These classes are definitely visible to any other class defined by the
    // bootstrap loader.
    _loadersOkForWellKnownClasses.push_back(TR::Compiler->javaVM->systemClassLoader);
@@ -1109,23 +1193,45 @@ TR::SymbolValidationManager::validateClassByNameRecord(uint16_t classID, uint16_
    {
    J9Class *beholder = getJ9ClassFromID(beholderID);
    J9ConstantPool *beholderCP = J9_CP_FROM_CLASS(beholder);
+
+   if (_validationCache != NULL)
+      {
+      TR_OpaqueClassBlock *clazz = _validationCache->find(TR_ValidateClassByName, classChain, beholder->classLoader);
+      if (clazz != NULL && _fej9->sharedCache()->classMatchesCachedVersion(clazz, classChain))
+         return validateSymbol(classID, clazz);
+      }
+
    J9ROMClass *romClass = _fej9->sharedCache()->startingROMClassOfClassChain(classChain);
    J9UTF8 * classNameData = J9ROMCLASS_CLASSNAME(romClass);
    char *className = reinterpret_cast<char *>(J9UTF8_DATA(classNameData));
    uint32_t classNameLength = J9UTF8_LENGTH(classNameData);
    TR_OpaqueClassBlock *clazz = _fej9->getClassFromSignature(className, classNameLength, beholderCP);
-   return validateSymbol(classID, clazz)
-      && _fej9->sharedCache()->classMatchesCachedVersion(clazz, classChain);
+   if (!validateSymbol(classID, clazz)
+       || !_fej9->sharedCache()->classMatchesCachedVersion(clazz, classChain))
+      return false;
+
+   if (_validationCache != NULL)
+      _validationCache->insert(TR_ValidateClassByName, classChain, beholder->classLoader, clazz);
+   return true;
    }
 
 bool
 TR::SymbolValidationManager::validateProfiledClassRecord(uint16_t classID, void *classChainIdentifyingLoader, void *classChainForClassBeingValidated)
    {
+   if (_validationCache != NULL)
+      {
+      TR_OpaqueClassBlock *clazz = _validationCache->find(TR_ValidateProfiledClass, classChainForClassBeingValidated, classChainIdentifyingLoader);
+      if (clazz != NULL && _fej9->sharedCache()->classMatchesCachedVersion(clazz, static_cast<uintptr_t *>(classChainForClassBeingValidated)))
+         return validateSymbol(classID, clazz);
+      }
+
    J9ClassLoader *classLoader = (J9ClassLoader *) _fej9->sharedCache()->persistentClassLoaderTable()->lookupClassLoaderAssociatedWithClassChain(classChainIdentifyingLoader);
    if (classLoader == NULL)
       return false;
 
    TR_OpaqueClassBlock *clazz = _fej9->sharedCache()->lookupClassFromChainAndLoader(static_cast<uintptr_t *>(classChainForClassBeingValidated), classLoader);
+   if (_validationCache != NULL)
+      _validationCache->insert(TR_ValidateProfiledClass, classChainForClassBeingValidated, classChainIdentifyingLoader, clazz);
    return validateSymbol(classID, clazz);
    }
 
@@ -1200,12 +1306,24 @@ TR::SymbolValidationManager::validateClassInstanceOfClassRecord(uint16_t classOn
 bool
 TR::SymbolValidationManager::validateSystemClassByNameRecord(uint16_t systemClassID, uintptr_t *classChain)
    {
+   if (_validationCache != NULL)
+      {
+      TR_OpaqueClassBlock *systemClassByName = _validationCache->find(TR_ValidateSystemClassByName, classChain, NULL);
+      if (systemClassByName != NULL && _fej9->sharedCache()->classMatchesCachedVersion(systemClassByName, classChain))
+         return validateSymbol(systemClassID, systemClassByName);
+      }
+
    J9ROMClass *romClass = _fej9->sharedCache()->startingROMClassOfClassChain(classChain);
    J9UTF8 * className = J9ROMCLASS_CLASSNAME(romClass);
    TR_OpaqueClassBlock *systemClassByName = _fej9->getSystemClassFromClassName(reinterpret_cast<const char *>(J9UTF8_DATA(className)),
                                                                               J9UTF8_LENGTH(className));
-   return validateSymbol(systemClassID, systemClassByName)
-      && _fej9->sharedCache()->classMatchesCachedVersion(systemClassByName, classChain);
+   if (!validateSymbol(systemClassID, systemClassByName)
+       || !_fej9->sharedCache()->classMatchesCachedVersion(systemClassByName, classChain))
+      return false;
+
+   if (_validationCache != NULL)
+      _validationCache->insert(TR_ValidateSystemClassByName, classChain, NULL, systemClassByName);
+   return true;
    }
 
 bool
@@ -34,6 +34,7 @@
 #include "j9nonbuilder.h"
 #include "infra/TRlist.hpp"
 #include "env/TRMemory.hpp"
+#include "env/PersistentCollections.hpp"
 #include "env/VMJ9.h"
 #include "exceptions/AOTFailure.hpp"
 #include "runtime/J9Runtime.hpp"
@@ -648,8 +649,54 @@ public:
 
    #define WELL_KNOWN_CLASS_COUNT 9
 
+   /**
+    * Remembers the well-known classes found when validating a set of class chain offsets.
+    * AOT bodies stored with the same set of well-known classes share the offsets array
+    * in the SCC, so the next body can reuse the classes instead of looking them up by name.
+    * Their class chains are still matched, since fast HCR redefines a class in place.
+    */
+   struct WellKnownClassesCache
+      {
+      WellKnownClassesCache() : _classChainOffsets(NULL) {}
+
+      const uintptr_t *_classChainOffsets;
+      TR_OpaqueClassBlock *_classes[WELL_KNOWN_CLASS_COUNT];
+      };
+
+   /**
+    * Caches the classes found while validating the records that are identified by an SCC
+    * class chain (and, for some record kinds, a class loader), so that the AOT bodies
+    * relocated after the first one can skip the class lookups. Only successful lookups are
+    * cached, and the cache is flushed whenever classes are unloaded. Callers must match
+    * the class chain of a hit again, since fast HCR redefines a class in place.
+    */
+   class ValidationCache
+      {
+   public:
+      ValidationCache() : _classes(NULL), _classUnloadID(-1), _hits(0), _misses(0) {}
+
+      TR_OpaqueClassBlock *find(TR_ExternalRelocationTargetKind kind, void *classChain, void *loaderKey);
+      void insert(TR_ExternalRelocationTargetKind kind, void *classChain, void *loaderKey, TR_OpaqueClassBlock *clazz);
+
+      uint32_t hits() const { return _hits; }
+      uint32_t misses() const { return _misses; }
+
+   private:
+      typedef std::pair<std::pair<void *, void *>, int32_t> Key;
+      typedef PersistentUnorderedMap<Key, TR_OpaqueClassBlock *> ClassMap;
+
+      void flushIfClassesWereUnloaded();
+
+      ClassMap *_classes;
+      int32_t _classUnloadID;
+      uint32_t _hits;
+      uint32_t _misses;
+      };
+
+   void setValidationCache(ValidationCache *cache) { _validationCache = cache; }
+
    void populateWellKnownClasses();
-   bool validateWellKnownClasses(const uintptr_t *wellKnownClassChainOffsets);
+   bool validateWellKnownClasses(const uintptr_t *wellKnownClassChainOffsets, WellKnownClassesCache *cache = NULL);
    bool isWellKnownClass(TR_OpaqueClassBlock *clazz);
    bool classCanSeeWellKnownClasses(TR_OpaqueClassBlock *clazz);
    const void *wellKnownClassChainOffsets() { return _wellKnownClassChainOffsets; }
@@ -852,6 +899,9 @@ private:
    TR_OpaqueClassBlock *_rootClass;
    const void *_wellKnownClassChainOffsets;
 
+   /* Lookup results shared with the other AOT loads done by the same relocation runtime */
+   ValidationCache *_validationCache;
+
    /* List of validation records to be written to the AOT buffer */
    SymbolValidationRecordList _symbolValidationRecords;
 
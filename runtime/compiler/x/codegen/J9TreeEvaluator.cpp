@@ -5581,6 +5581,23 @@ bool J9::X86::TreeEvaluator::monEntryExitHelper(
    return false;
    }
 
+// Prefetching ahead of the TLH allocation pointer only pays off at allocation
+// sites that run often enough to stream through the TLH.  At a site in a cold
+// block the prefetch sequence only grows the mainline code, so leave it out and
+// let the hot sites in the method keep the TLH warm.
+//
+static bool shouldPrefetchTLHAtAllocationSite(TR::Node *node, TR::CodeGenerator *cg)
+   {
+   static bool prefetchColdSites = feGetEnv("TR_PrefetchTLHAtColdAllocationSites") != NULL;
+   TR::Block *block = cg->getCurrentEvaluationBlock();
+   if (prefetchColdSites || !block || !block->isCold())
+      return true;
+
+   TR::Compilation *comp = cg->comp();
+   TR::DebugCounter::incStaticDebugCounter(comp, TR::DebugCounter::debugCounterName(comp, "tlhPrefetch/skipped/coldSite/%s/(%s)", node->getOpCode().getName(), comp->signature()));
+   return false;
+   }
+
 
 
 // Generate code to allocate from the object heap.  Returns the register
@@ -6191,7 +6208,7 @@ static void genHeapAlloc(
                                 generateX86MemoryReference(vmThreadReg, heapAlloc_offset, cg),
                                 tempReg, cg);
 
-      if (!isSmallAllocation && cg->enableTLHPrefetching())
+      if (!isSmallAllocation && cg->enableTLHPrefetching() && shouldPrefetchTLHAtAllocationSite(node, cg))
          {
          TR::LabelSymbol *prefetchSnippetLabel = generateLabelSymbol(cg);
          TR::LabelSymbol *restartLabel = generateLabelSymbol(cg);
@@ -6505,11 +6522,13 @@ static void genHeapAlloc2(
 
       generateLabelInstruction(JA4, node, failLabel, cg);
 
+      bool shouldPrefetch = !isTooSmallToPrefetch && shouldPrefetchTLHAtAllocationSite(node, cg);
+
       // ------------
       // 1st PREFETCH
       // ------------
 
-      if (!isTooSmallToPrefetch)
+      if (shouldPrefetch)
          generateMemInstruction(PREFETCHNTA, node, generateX86MemoryReference(segmentReg, 0xc0, cg), cg);
 
       if (shouldAlignToCacheBoundary)
@@ -6591,7 +6610,7 @@ static void genHeapAlloc2(
                                 generateX86MemoryReference(vmThreadReg, offsetof(J9VMThread, heapAlloc), cg),
                                 segmentReg, cg);
 
-      if (!isTooSmallToPrefetch && node->getOpCodeValue() != TR::New)
+      if (shouldPrefetch && node->getOpCodeValue() != TR::New)
          {
          // ------------
          // 2nd PREFETCH
@@ -1385,6 +1385,58 @@ void TR::X86CallSite::computeProfiledTargets()
                _profiledTargets->add(new(comp()->trStackMemory()) TR::X86PICSlot((uintptr_t)topValue, profiledVirtualMethod, true, methodToBeCompared, slot));
                }
             }
+
+         // Give the next most frequent receivers their own static PIC slots in profile order, as is done
+         // for interface calls, so that polymorphic sites test their hot classes before falling back to
+         // the patchable VPIC slots and the vtable dispatch.
+         //
+         static const bool disableMultipleStaticVirtualPICSlots = feGetEnv("TR_DisableMultipleStaticVirtualPICSlots") != NULL;
+         if (!disableMultipleStaticVirtualPICSlots && valueInfo && topValue && !_profiledTargets->isEmpty())
+            {
+            TR_OpaqueClassBlock *callSiteMethodClass = methodSymRef->getSymbol()->getResolvedMethodSymbol()->getResolvedMethod()->classOfMethod();
+            uint32_t totalFrequency = valueInfo->getTotalFrequency();
+            int32_t numStaticPICSlots = 1;
+            ListElement<TR::X86PICSlot> *lastSlot = _profiledTargets->getListHead();
+            TR_ScratchList<TR_ExtraAddressInfo> valuesSortedByFrequency(comp()->trMemory());
+            valueInfo->getSortedList(comp(), &valuesSortedByFrequency);
+            ListIterator<TR_ExtraAddressInfo> sortedValuesIt(&valuesSortedByFrequency);
+            for (TR_ExtraAddressInfo *profiledInfo = sortedValuesIt.getFirst();
+                 profiledInfo != NULL && totalFrequency > 0 && numStaticPICSlots < comp()->getOptions()->getMaxStaticPICSlots(comp()->getMethodHotness());
+                 profiledInfo = sortedValuesIt.getNext())
+               {
+               TR_OpaqueClassBlock *thisType = (TR_OpaqueClassBlock *) profiledInfo->_value;
+               if (!thisType || (uintptr_t)thisType == topValue)
+                  continue;
+
+               // The list is sorted by frequency, so every remaining receiver is too infrequent as well
+               float frequency = ((float)profiledInfo->_frequency) / totalFrequency;
+               if (frequency < getMinProfiledCallFrequency())
+                  break;
+
+               if (comp()->getPersistentInfo()->isObsoleteClass((void *)thisType, fej9) ||
+                   fej9->isInstanceOf(thisType, callSiteMethodClass, true, true) != TR_yes)
+                  continue;
+
+               TR_ResolvedMethod *profiledVirtualMethod = callNode->getSymbolReference()->getOwningMethod(comp())->getResolvedVirtualMethod(comp(),
+                  thisType, methodSymRef->getOffset());
+               if (!profiledVirtualMethod ||
+                   (profiledVirtualMethod->isInterpreted() && !profiledVirtualMethod->isJITInternalNative()))
+                  continue;
+
+               TR_OpaqueMethodBlock *methodToBeCompared = NULL;
+               int32_t slot = -1;
+               if (profiledVirtualMethod->isJITInternalNative())
+                  {
+                  slot = fej9->virtualCallOffsetToVTableSlot(callNode->getSymbolReference()->getOffset());
+                  methodToBeCompared = profiledVirtualMethod->getPersistentIdentifier();
+                  }
+
+               lastSlot = _profiledTargets->addAfter(new(comp()->trStackMemory()) TR::X86PICSlot((uintptr_t)thisType, profiledVirtualMethod, true, methodToBeCompared, slot), lastSlot);
+               numStaticPICSlots++;
+               if (comp()->getOption(TR_TraceCG))
+                  traceMsg(comp(), "  Profiled target frequency %f + Added static virtual PIC slot for %s\n", frequency, profiledVirtualMethod->signature(comp()->trMemory(), stackAlloc));
+               }
+            }
          }
       }
    else if (getMethodSymbol()->isInterface())
@@ -120,6 +120,20 @@ J9::X86::CPU::hasPopulationCountInstruction()
       return false;
    }
 
+uint32_t
+J9::X86::CPU::getMaxVectorLengthInBytes()
+   {
+   // The width only tunes heuristics and no AVX2 or AVX-512 instructions are generated, so
+   // the CPUID bits are queried directly instead of adding these features to the utilized
+   // feature masks, which would make AOT code incompatible across such processors
+   uint32_t featureFlags8 = self()->getX86ProcessorFeatureFlags8();
+   if ((featureFlags8 & TR_AVX512F) != 0x00000000)
+      return 64;
+   if ((featureFlags8 & TR_AVX2) != 0x00000000)
+      return 32;
+   return 16;
+   }
+
 bool
 J9::X86::CPU::isCompatible(const OMRProcessorDesc& processorDescription)
    {
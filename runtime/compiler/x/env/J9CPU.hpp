@@ -75,6 +75,12 @@ public:
    bool testOSForSSESupport() { return true; } // VM guarantees SSE/SSE2 are available
    bool hasPopulationCountInstruction();
 
+   /**
+    * @brief Returns the width of the widest vector registers the processor provides
+    * @return 64 with AVX-512, 32 with AVX2 and 16 otherwise
+    */
+   uint32_t getMaxVectorLengthInBytes();
+
    bool isCompatible(const OMRProcessorDesc& processorDescription);
 
    uint32_t getX86ProcessorFeatureFlags();
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2013, 2017 IBM Corp. and others
+ * Copyright (c) 2013, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -28,6 +28,12 @@
 namespace
 {
 
+/**
+ * Copies of at most this many bytes are staged through a buffer on
+ * the native stack rather than through freshly allocated memory.
+ */
+#define STACK_BUFFER_SIZE 1024
+
 /**
  * A macro that expands the argument macro for each primitive type.
  */
@@ -154,7 +160,8 @@ copyFromHost(
 
 	PORT_ACCESS_FROM_ENV(env);
 
-	void * buffer = J9CUDA_ALLOCATE_MEMORY(byteCount);
+	uint64_t stackBuffer[STACK_BUFFER_SIZE / sizeof(uint64_t)];
+	void * buffer = (byteCount <= sizeof(stackBuffer)) ? (void *)stackBuffer : J9CUDA_ALLOCATE_MEMORY(byteCount);
 	int32_t error = J9CUDA_ERROR_MEMORY_ALLOCATION;
 
 	if (NULL != buffer) {
@@ -166,7 +173,9 @@ copyFromHost(
 				buffer,
 				byteCount);
 
-		J9CUDA_FREE_MEMORY(buffer);
+		if (stackBuffer != buffer) {
+			J9CUDA_FREE_MEMORY(buffer);
+		}
 	}
 
 	if (0 != error) {
@@ -197,7 +206,8 @@ copyToHost(JNIEnv * env, jint deviceId, jlong devicePtr, ArrayType array, jint f
 
 	PORT_ACCESS_FROM_ENV(env);
 
-	void * buffer = J9CUDA_ALLOCATE_MEMORY(byteCount);
+	uint64_t stackBuffer[STACK_BUFFER_SIZE / sizeof(uint64_t)];
+	void * buffer = (byteCount <= sizeof(stackBuffer)) ? (void *)stackBuffer : J9CUDA_ALLOCATE_MEMORY(byteCount);
 	int32_t error = J9CUDA_ERROR_MEMORY_ALLOCATION;
 
 	if (NULL != buffer) {
@@ -211,7 +221,9 @@ copyToHost(JNIEnv * env, jint deviceId, jlong devicePtr, ArrayType array, jint f
 			setArrayRegion(env, array, fromIndex, length, buffer);
 		}
 
-		J9CUDA_FREE_MEMORY(buffer);
+		if (stackBuffer != buffer) {
+			J9CUDA_FREE_MEMORY(buffer);
+		}
 	}
 
 	if (0 != error) {
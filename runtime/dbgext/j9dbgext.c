@@ -422,6 +422,7 @@ dbgReadJavaVM(J9JavaVM * remoteVM)
 #endif
 			localVM->walkStackFrames = NULL;
 			localVM->localMapFunction = NULL;
+			localVM->mapCache = NULL;
 #ifdef J9VM_INTERP_VERBOSE
 			localVM->verboseStackDump = NULL;
 #endif
@@ -170,6 +170,25 @@ MM_ClassLoaderManager::flushUndeadSegments(MM_EnvironmentBase *env)
 	}
 }
 
+void
+MM_ClassLoaderManager::flushUndeadSegmentsConcurrently(MM_EnvironmentBase *env, volatile bool *forceExit)
+{
+	while (!*forceExit) {
+		omrthread_monitor_enter(_undeadSegmentListMonitor);
+		J9MemorySegment *segment = _firstUndeadSegment;
+		if (NULL != segment) {
+			_firstUndeadSegment = segment->nextSegmentInClassLoader;
+			_undeadSegmentsTotalSize -= segment->size;
+		}
+		omrthread_monitor_exit(_undeadSegmentListMonitor);
+
+		if (NULL == segment) {
+			break;
+		}
+		_javaVM->internalVMFunctions->freeMemorySegment(_javaVM, segment, TRUE);
+	}
+}
+
 void
 MM_ClassLoaderManager::setLastUnloadNumOfClassLoaders() 
 {
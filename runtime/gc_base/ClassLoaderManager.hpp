@@ -97,6 +97,14 @@ public:
 	 * @param env The environment
 	 */
 	void flushUndeadSegments(MM_EnvironmentBase *env);
+
+	/**
+	 * Flushes the cached list of segments one segment at a time, outside of a GC pause, until it is empty or forceExit is set.
+	 * Segments which are not freed before forceExit is set stay queued for a later flush.
+	 * @param env The environment
+	 * @param forceExit Set by another thread to interrupt the flush
+	 */
+	void flushUndeadSegmentsConcurrently(MM_EnvironmentBase *env, volatile bool *forceExit);
 	
 	/**
 	 * Returns the total amount of memory (in bytes) which would be reclaimed if the buffer were to be flushed
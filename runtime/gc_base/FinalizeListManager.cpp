@@ -285,4 +285,24 @@ GC_FinalizeListManager::consumeJob(J9VMThread *vmThread, GC_FinalizeJob * job)
 	return NULL;
 }
 
+GC_FinalizeJob *
+GC_FinalizeListManager::consumeFinalizableObjectJob(J9VMThread *vmThread, GC_FinalizeJob *job)
+{
+	Assert_MM_true(J9_PUBLIC_FLAGS_VM_ACCESS == (vmThread->publicFlags & J9_PUBLIC_FLAGS_VM_ACCESS));
+	Assert_MM_true(1 == omrthread_monitor_owned_by_self(_mutex)); /* caller must be holding _mutex */
+
+	j9object_t object = popDefaultFinalizableObject();
+	if (NULL == object) {
+		object = popSystemFinalizableObject();
+	}
+
+	if (NULL != object) {
+		job->type = FINALIZE_JOB_TYPE_OBJECT;
+		job->object = object;
+		return job;
+	}
+
+	return NULL;
+}
+
 #endif /* J9VM_GC_FINALIZATION */
@@ -331,6 +331,16 @@ public:
 	 */
 	virtual GC_FinalizeJob *consumeJob(J9VMThread *vmThread, GC_FinalizeJob * job);
 
+	/**
+	 * Pop the next finalizable object job to process, leaving reference and classloader jobs
+	 * for the finalize worker thread.  Used by the finalize assist threads.
+	 *
+	 * @note Must be called while holding this class' _mutex
+	 *
+	 * @return the next finalizable object job or NULL
+	 */
+	GC_FinalizeJob *consumeFinalizableObjectJob(J9VMThread *vmThread, GC_FinalizeJob *job);
+
 
 	/**
 	 * Create a FinalizeListManager object
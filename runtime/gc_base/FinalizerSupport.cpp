@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2020 IBM Corp. and others
+ * Copyright (c) 1991, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -181,6 +181,7 @@ static int J9THREAD_PROC FinalizeWorkerThread(void *arg);
 IDATA FinalizeMainRunFinalization(J9JavaVM * vm, omrthread_t * indirectWorkerThreadHandle, struct finalizeWorkerData **indirectWorkerData, IDATA finalizeCycleLimit, IDATA mode);
 static int J9THREAD_PROC FinalizeMainThread(void *javaVM);
 static int  J9THREAD_PROC gpProtectedFinalizeWorkerThread(void *entryArg);
+static void startFinalizeAssistThreads(J9JavaVM *vm);
 
 static int J9THREAD_PROC FinalizeMainThread(void *javaVM)
 {
@@ -466,6 +467,24 @@ process(J9VMThread *vmThread, const GC_FinalizeJob *finalizeJob, jclass j9VMInte
 	}
 }
 
+/**
+ * Wake the finalize assist threads if there is more than one finalizable object waiting,
+ * so that they share the finalizable lists with the worker thread.
+ */
+static void
+wakeFinalizeAssistThreads(MM_GCExtensions *extensions)
+{
+	if (NULL != extensions->finalizeAssistMonitor) {
+		GC_FinalizeListManager *finalizeListManager = extensions->finalizeListManager;
+		/* the counts are read without the list lock: they are only a hint that there is work to share */
+		if (1 < (finalizeListManager->getDefaultCount() + finalizeListManager->getSystemCount())) {
+			omrthread_monitor_enter(extensions->finalizeAssistMonitor);
+			omrthread_monitor_notify_all(extensions->finalizeAssistMonitor);
+			omrthread_monitor_exit(extensions->finalizeAssistMonitor);
+		}
+	}
+}
+
 /**
  * Worker thread consumes jobs from Finalize List Manager and process them
  */
@@ -535,6 +554,11 @@ static int J9THREAD_PROC FinalizeWorkerThread(void *arg)
 	}		
 	workerData->vmThread = env;
 
+	/* The first worker to come on line starts the assist threads, once the class library can run finalizers */
+	if ((0 != extensions->finalizeAssistThreadCount) && (NULL == extensions->finalizeAssistMonitor)) {
+		startFinalizeAssistThreads(vm);
+	}
+
 	/* Notify that the worker has come on line (We should check the result from above) */
 	omrthread_monitor_enter(monitor);
 	omrthread_monitor_notify_all(monitor);
@@ -564,6 +588,10 @@ static int J9THREAD_PROC FinalizeWorkerThread(void *arg)
 			}
 		}
 
+		if (FINALIZE_WORKER_MODE_CL_UNLOAD != workerData->mode) {
+			wakeFinalizeAssistThreads(extensions);
+		}
+
 		do {
 
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
@@ -822,6 +850,193 @@ gpProtectedFinalizeWorkerThread(void *entryArg)
 	return 0;
 }
 
+/**
+ * Answer whether a finalizable object is queued for the assist threads.
+ */
+static bool
+hasFinalizableObjects(GC_FinalizeListManager *finalizeListManager)
+{
+	finalizeListManager->lock();
+	bool result = (0 != (finalizeListManager->getDefaultCount() + finalizeListManager->getSystemCount()));
+	finalizeListManager->unlock();
+	return result;
+}
+
+/**
+ * Assist thread runs finalizable objects from the Finalize List Manager in parallel with the worker thread.
+ * Reference and classloader jobs are left to the worker, which owns reference processing notification
+ * and classloader freeing.
+ */
+static int J9THREAD_PROC
+FinalizeAssistThread(void *arg)
+{
+	J9JavaVM *vm = (J9JavaVM *)arg;
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(vm);
+	GC_FinalizeListManager *finalizeListManager = extensions->finalizeListManager;
+	omrthread_monitor_t monitor = extensions->finalizeAssistMonitor;
+	J9InternalVMFunctions *fns = vm->internalVMFunctions;
+	J9VMThread *env = NULL;
+	jclass j9VMInternalsClass = NULL;
+	jmethodID runFinalizeMID = NULL;
+	GC_FinalizeJob localJob;
+
+	if (JNI_OK != fns->attachSystemDaemonThread(vm, &env, "Finalizer assist thread")) {
+		/* Failed to attach the thread - the worker will run the finalizers on its own */
+		omrthread_monitor_enter(monitor);
+		extensions->finalizeAssistActiveThreadCount -= 1;
+		omrthread_monitor_notify_all(monitor);
+		omrthread_exit(monitor);		/* exit the monitor, and terminate the thread */
+		/* NO EXECUTION GUARANTEE BEYOND THIS POINT */
+		return 0;
+	}
+
+	fns->internalEnterVMFromJNI(env);
+	env->privateFlags |= (J9_PRIVATE_FLAGS_FINALIZE_WORKER | J9_PRIVATE_FLAGS_USE_BOOTSTRAP_LOADER);
+	fns->internalReleaseVMAccess(env);
+
+	/* Remember that the thread was gpProtected -- important for the JIT */
+	env->gpProtected = 1;
+
+	if (vm->jclFlags & J9_JCL_FLAG_FINALIZATION) {
+		j9VMInternalsClass = ((JNIEnv *)env)->FindClass("java/lang/J9VMInternals");
+		if (j9VMInternalsClass) {
+			j9VMInternalsClass = (jclass)((JNIEnv *)env)->NewGlobalRef(j9VMInternalsClass);
+			if (j9VMInternalsClass) {
+				runFinalizeMID = ((JNIEnv *)env)->GetStaticMethodID(j9VMInternalsClass, "runFinalize", "(Ljava/lang/Object;)V");
+			}
+		}
+		if (!runFinalizeMID) {
+			((JNIEnv *)env)->ExceptionClear();
+		}
+	}
+
+	omrthread_monitor_enter(monitor);
+	while (!extensions->finalizeAssistShutdown) {
+		/* The worker may have sent its notification before this thread started waiting (or while it
+		 * was running a finalizer), so only wait when there is nothing queued to process.
+		 */
+		if (!hasFinalizableObjects(finalizeListManager)) {
+			omrthread_monitor_wait(monitor);
+			if (extensions->finalizeAssistShutdown) {
+				break;
+			}
+		}
+		omrthread_monitor_exit(monitor);
+
+		fns->internalEnterVMFromJNI(env);
+		do {
+			finalizeListManager->lock();
+			const GC_FinalizeJob *finalizeJob = finalizeListManager->consumeFinalizableObjectJob(env, &localJob);
+			finalizeListManager->unlock();
+
+			if (NULL == finalizeJob) {
+				break;
+			}
+
+			/* processing will release/acquire VM access */
+			process_finalizable(env, finalizeJob->object, j9VMInternalsClass, runFinalizeMID);
+			fns->jniResetStackReferences((JNIEnv *)env);
+			MM_AtomicOperations::add(&extensions->finalizeAssistProcessedCount, 1);
+		} while (!extensions->finalizeAssistShutdown);
+		fns->internalReleaseVMAccess(env);
+
+		omrthread_monitor_enter(monitor);
+	}
+	omrthread_monitor_exit(monitor);
+
+	if (j9VMInternalsClass) {
+		((JNIEnv *)env)->DeleteGlobalRef(j9VMInternalsClass);
+	}
+
+	((JavaVM *)vm)->DetachCurrentThread();
+
+	omrthread_monitor_enter(monitor);
+	extensions->finalizeAssistActiveThreadCount -= 1;
+	omrthread_monitor_notify_all(monitor);
+	omrthread_exit(monitor);		/* exit the monitor, and terminate the thread */
+
+	/* NO EXECUTION GUARANTEE BEYOND THIS POINT */
+
+	return 0;
+}
+
+static UDATA
+FinalizeAssistThreadGlue(J9PortLibrary* portLib, void* userData)
+{
+	return FinalizeAssistThread(userData);
+}
+
+static int J9THREAD_PROC
+gpProtectedFinalizeAssistThread(void *entryArg)
+{
+	J9JavaVM *vm = (J9JavaVM *)entryArg;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	UDATA rc;
+
+	j9sig_protect(FinalizeAssistThreadGlue, vm,
+		vm->internalVMFunctions->structuredSignalHandlerVM, vm,
+		J9PORT_SIG_FLAG_SIGALLSYNC | J9PORT_SIG_FLAG_MAY_CONTINUE_EXECUTION,
+		&rc);
+
+	return 0;
+}
+
+/**
+ * Start the -Xgc:finalizeAssistThreads= assist threads.  Failing to start them is not fatal,
+ * the worker thread runs all of the finalizers in that case.
+ */
+static void
+startFinalizeAssistThreads(J9JavaVM *vm)
+{
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(vm);
+
+	if (0 != omrthread_monitor_init_with_name(&extensions->finalizeAssistMonitor, 0, "GC finalize assist")) {
+		extensions->finalizeAssistMonitor = NULL;
+		return;
+	}
+
+	omrthread_monitor_enter(extensions->finalizeAssistMonitor);
+	for (UDATA i = 0; i < extensions->finalizeAssistThreadCount; i++) {
+		IDATA result = vm->internalVMFunctions->createThreadWithCategory(
+							NULL,
+							vm->defaultOSStackSize,
+							extensions->finalizeWorkerPriority,
+							0,
+							&gpProtectedFinalizeAssistThread,
+							vm,
+							J9THREAD_CATEGORY_APPLICATION_THREAD);
+		if (0 != result) {
+			break;
+		}
+		extensions->finalizeAssistActiveThreadCount += 1;
+	}
+	omrthread_monitor_exit(extensions->finalizeAssistMonitor);
+}
+
+/**
+ * Tell the finalize assist threads to exit once their current finalizer returns, and wait for them
+ * (subject to -Xgc:finalizeCycleLimit=).  The monitor is kept until MM_GCExtensions::tearDown(),
+ * since verbose GC may still read the assist thread count under it.
+ */
+static void
+stopFinalizeAssistThreads(J9JavaVM *vm)
+{
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(vm);
+	omrthread_monitor_t monitor = extensions->finalizeAssistMonitor;
+
+	if (NULL != monitor) {
+		omrthread_monitor_enter(monitor);
+		extensions->finalizeAssistShutdown = true;
+		omrthread_monitor_notify_all(monitor);
+		while (0 != extensions->finalizeAssistActiveThreadCount) {
+			if (J9THREAD_TIMED_OUT == omrthread_monitor_wait_timed(monitor, extensions->finalizeCycleLimit, 0)) {
+				break;
+			}
+		}
+		omrthread_monitor_exit(monitor);
+	}
+}
+
 void
 j9gc_finalizer_completeFinalizersOnExit(J9VMThread* vmThread)
 {
@@ -940,6 +1155,7 @@ void j9gc_finalizer_shutdown(J9JavaVM * vm)
 				while (!(vm->finalizeMainFlags & J9_FINALIZE_FLAGS_SHUTDOWN_COMPLETE)) {
 					omrthread_monitor_wait(vm->finalizeMainMonitor);
 				}
+				stopFinalizeAssistThreads(vm);
 			}
 		}
 	}
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2020 IBM Corp. and others
+ * Copyright (c) 1991, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -179,6 +179,14 @@ MM_GCExtensions::tearDown(MM_EnvironmentBase *env)
 	}
 #endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 
+#if defined(J9VM_GC_FINALIZATION)
+	/* an assist thread that did not exit in time at finalizer shutdown may still use the monitor */
+	if ((NULL != finalizeAssistMonitor) && (0 == finalizeAssistActiveThreadCount)) {
+		omrthread_monitor_destroy(finalizeAssistMonitor);
+		finalizeAssistMonitor = NULL;
+	}
+#endif /* J9VM_GC_FINALIZATION */
+
 	MM_GCExtensionsBase::tearDown(env);
 }
 
@@ -121,6 +121,7 @@ public:
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 
 	U_32 _stringTableListToTreeThreshold; /**< Threshold at which we start using trees instead of lists for collision resolution in the String table */
+	UDATA _stringTableCount; /**< Number of independently locked String table sub-tables (0 means derive it from the maximum GC thread count) */
 
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
 	bool fvtest_forceFinalizeClassLoaders;
@@ -142,6 +143,11 @@ public:
 #if defined(J9VM_GC_FINALIZATION)
 	UDATA finalizeMainPriority; /**< cmd line option to set finalize main thread priority */
 	UDATA finalizeWorkerPriority; /**< cmd line option to set finalize worker thread priority */
+	UDATA finalizeAssistThreadCount; /**< cmd line option to set the number of assist threads running finalizable objects alongside the finalize worker (0 disables them) */
+	omrthread_monitor_t finalizeAssistMonitor; /**< monitor the finalize assist threads wait on for finalizable objects */
+	UDATA finalizeAssistActiveThreadCount; /**< number of finalize assist threads currently alive (protected by finalizeAssistMonitor) */
+	bool finalizeAssistShutdown; /**< set when the finalize assist threads must exit (protected by finalizeAssistMonitor) */
+	volatile UDATA finalizeAssistProcessedCount; /**< number of finalizable objects run by the finalize assist threads, reported in verbose GC */
 #endif /* J9VM_GC_FINALIZATION */
 
 	MM_ClassLoaderManager* classLoaderManager; /**< Pointer to the gc's classloader manager to process classloaders/classes */
@@ -184,6 +190,17 @@ public:
 	MM_IdleGCManager* idleGCManager; /**< Manager which registers for VM Runtime State notification & manages free heap on notification */
 #endif
 
+	UDATA tarokTargetPGCPauseMillis; /**< Pause time the Balanced GC sizes Eden to meet for each PGC, 0 to size Eden for throughput */
+	bool tarokEnableRememberedSetDeduplication; /**< Remove duplicate cards from an RSCL before overflowing it for being too large */
+	UDATA tarokOverflowedRegionsGMPKickoffPercent; /**< Percentage of regions with overflowed RSCLs at which the next GMP is kicked off right away to rebuild them, 0 to disable */
+	bool tarokEnableConcurrentClassSegmentRelease; /**< Free the class memory segments of unloaded class loaders on the main GC thread after the pause, rather than inside it */
+	bool tarokEnableDynamicTenuring; /**< Copy-forward objects from regions at or above tarokDynamicTenureAge straight into the oldest compact group */
+	UDATA tarokDynamicTenureSurvivalPercent; /**< Survival rate (as a percentage) an age group and all older groups must show for that age to become the tenure age */
+	UDATA tarokDynamicTenureAge; /**< Logical region age from which objects are tenured, derived from survival rates after each collection (UDATA_MAX when not tenuring) */
+#if defined(J9VM_GC_REALTIME)
+	bool realtimeAdaptBeatsToAllocationRate; /**< Let the Metronome scheduler give up mutator double beats, and allow more GC double beats, when the observed allocation rate predicts the heap will be exhausted before the next quantum */
+#endif /* J9VM_GC_REALTIME */
+
 	double maxRAMPercent; /**< Value of -XX:MaxRAMPercentage specified by the user */
 	double initialRAMPercent; /**< Value of -XX:InitialRAMPercentage specified by the user */
 
@@ -296,10 +313,16 @@ public:
 		, classUnloadingAnonymousClassWeight(1.0)
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 		, _stringTableListToTreeThreshold(1024)
+		, _stringTableCount(0)
 		, maxSoftReferenceAge(32)
 #if defined(J9VM_GC_FINALIZATION)
 		, finalizeMainPriority(J9THREAD_PRIORITY_NORMAL)
 		, finalizeWorkerPriority(J9THREAD_PRIORITY_NORMAL)
+		, finalizeAssistThreadCount(0)
+		, finalizeAssistMonitor(NULL)
+		, finalizeAssistActiveThreadCount(0)
+		, finalizeAssistShutdown(false)
+		, finalizeAssistProcessedCount(0)
 #endif /* J9VM_GC_FINALIZATION */
 		, classLoaderManager(NULL)
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
@@ -315,6 +338,16 @@ public:
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
 		, idleGCManager(NULL)
 #endif
+		, tarokTargetPGCPauseMillis(0)
+		, tarokEnableRememberedSetDeduplication(true)
+		, tarokOverflowedRegionsGMPKickoffPercent(10)
+		, tarokEnableConcurrentClassSegmentRelease(true)
+		, tarokEnableDynamicTenuring(false)
+		, tarokDynamicTenureSurvivalPercent(90)
+		, tarokDynamicTenureAge(UDATA_MAX)
+#if defined(J9VM_GC_REALTIME)
+		, realtimeAdaptBeatsToAllocationRate(true)
+#endif /* J9VM_GC_REALTIME */
 		, maxRAMPercent(0.0) /* this would get overwritten by user specified value */
 		, initialRAMPercent(0.0) /* this would get overwritten by user specified value */
 	{
@@ -64,6 +64,14 @@ public:
 	 */
 	j9object_t *getStringInternCache(UDATA hash) { return &_cache[hash % cacheSize]; }
 
+	/**
+	 * Sub-tables are both the unit of locking for interning and the unit of work for parallel
+	 * String table clearing, so the default gives each GC thread several of them to balance load
+	 * and to spread contention from mutator threads interning at the same time.
+	 * @return default number of hash sub-tables per GC thread
+	 */
+	static UDATA getDefaultTableCountPerGCThread() { return 4; }
+
 	/**
 	 * @return hash sub-table count
 	 */
@@ -221,6 +221,8 @@ typedef struct GCCHK_Extensions {
 	UDATA globalGcInterval;
 	UDATA globalGcCount;
 	UDATA gcStartIndex;
+	UDATA heapSliceRegions; /**< Number of regions the object heap check covers per cycle, 0 for the whole heap */
+	UDATA heapSliceCursor; /**< Index of the first region to be checked by the next sliced cycle */
 #if defined(J9VM_GC_MODRON_SCAVENGER)	
 	UDATA localGcInterval;
 	UDATA localGcCount;
@@ -123,6 +123,7 @@ GC_CheckCycle::printHelp(J9PortLibrary *portLib)
 	j9tty_printf(PORTLIB, "  localinterval=X\n");
 #endif /* J9VM_GC_MODRON_SCAVENGER */
 	j9tty_printf(PORTLIB, "  startindex=x\n");
+	j9tty_printf(PORTLIB, "  heapslice=X\n");
 #if defined(J9VM_GC_MODRON_SCAVENGER)
 	j9tty_printf(PORTLIB, "  scavengerbackout\n");
 	j9tty_printf(PORTLIB, "  suppresslocal\n");
@@ -350,6 +351,11 @@ top:
 							continue;
 						}
 
+						if (try_scan(&scan_start, "heapslice=")) {
+							scan_udata(&scan_start, &extensions->heapSliceRegions);
+							continue;
+						}
+
 #if defined(J9VM_GC_MODRON_SCAVENGER)
 						if (try_scan(&scan_start, "scavengerbackout")) {
 							miscFlags |= J9MODRON_GCCHK_SCAVENGER_BACKOUT;
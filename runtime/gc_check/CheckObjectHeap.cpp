@@ -35,6 +35,9 @@ typedef struct ObjectIteratorCallbackUserData {
 	GC_CheckEngine* engine; /* Input */
 	J9PortLibrary* portLibrary; /* Input */
 	J9MM_IterateRegionDescriptor* regionDesc; /* Temp - used internally by iterator functions */
+	UDATA regionIndex; /* Temp - index of the next region visited by the region iterator callback */
+	UDATA sliceStart; /* Input - index of the first region to check */
+	UDATA sliceEnd; /* Input - index of the region after the last one to check, UDATA_MAX for all */
 } ObjectIteratorCallbackUserData;
 
 /**
@@ -67,12 +70,31 @@ GC_CheckObjectHeap::kill()
 void
 GC_CheckObjectHeap::check()
 {
+	GCCHK_Extensions *extensions = (GCCHK_Extensions *)MM_GCExtensions::getExtensions(_javaVM)->gcchkExtensions;
+	UDATA sliceRegions = extensions->heapSliceRegions;
+
 	/* Check by using the HeapIteratorAPI */
 	ObjectIteratorCallbackUserData userData;
 	userData.engine = _engine;
 	userData.portLibrary = _portLibrary;
 	userData.regionDesc = NULL;
+	userData.regionIndex = 0;
+	userData.sliceStart = 0;
+	userData.sliceEnd = UDATA_MAX;
+
+	if (0 != sliceRegions) {
+		/* heapslice=X: check the next X regions, continuing round-robin from where the previous cycle stopped */
+		userData.sliceStart = extensions->heapSliceCursor;
+		userData.sliceEnd = userData.sliceStart + sliceRegions;
+	}
+
 	_javaVM->memoryManagerFunctions->j9mm_iterate_heaps(_javaVM, _portLibrary, 0, check_heapIteratorCallback, &userData);
+
+	if (0 != sliceRegions) {
+		extensions->heapSliceCursor = (userData.sliceEnd < userData.regionIndex) ? userData.sliceEnd : 0;
+		/* Only part of the heap was counted, so it can't be compared to the ownable synchronizer lists */
+		_engine->clearCountsForOwnableSynchronizerObjects();
+	}
 }
 
 void
@@ -102,6 +124,10 @@ static jvmtiIterationControl
 check_regionIteratorCallback(J9JavaVM* vm, J9MM_IterateRegionDescriptor* regionDesc, void* userData)
 {
 	ObjectIteratorCallbackUserData* castUserData = (ObjectIteratorCallbackUserData*)userData;
+	UDATA regionIndex = castUserData->regionIndex++;
+	if ((regionIndex < castUserData->sliceStart) || (regionIndex >= castUserData->sliceEnd)) {
+		return JVMTI_ITERATION_CONTINUE;
+	}
 	castUserData->regionDesc = regionDesc;
 	vm->memoryManagerFunctions->j9mm_iterate_region_objects(vm, castUserData->portLibrary, regionDesc, j9mm_iterator_flag_include_holes, check_objectIteratorCallback, castUserData);
 	return JVMTI_ITERATION_CONTINUE;
@@ -72,7 +72,12 @@ MM_ReferenceObjectBufferStandard::flushImpl(MM_EnvironmentBase* env)
 {
 	MM_HeapRegionDescriptorStandard *region = (MM_HeapRegionDescriptorStandard*)_region;
 	MM_HeapRegionDescriptorStandardExtension *regionExtension = MM_ConfigurationDelegate::getHeapRegionDescriptorStandardExtension(env, region);
-	MM_ReferenceObjectList *list = &regionExtension->_referenceObjectLists[_referenceObjectListIndex];
+	/* Offset the cyclic index by the worker ID so that GC threads which only flush a few buffers per region
+	 * still spread them across all of the region's lists, rather than all filling the first ones. The clearing
+	 * phases hand out one list per work unit, so an overloaded list becomes a serial tail.
+	 */
+	UDATA listIndex = (_referenceObjectListIndex + env->getWorkerID()) % regionExtension->_maxListIndex;
+	MM_ReferenceObjectList *list = &regionExtension->_referenceObjectLists[listIndex];
 	list->addAll(env, _referenceObjectType, _head, _tail);
 	_referenceObjectListIndex += 1;
 	if (regionExtension->_maxListIndex == _referenceObjectListIndex) {
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2020 IBM Corp. and others
+ * Copyright (c) 1991, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -668,6 +668,44 @@ MM_StandardAccessBarrier::doCopyContiguousForwardWithReadBarrier(J9VMThread *vmT
 }
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 
+/**
+ * Snapshot-at-the-beginning barrier for a reference array copy, applied to the whole
+ * destination range before any slot is written. Every value about to be overwritten is
+ * remembered (and, while the double barrier is active, every value about to be stored),
+ * so that the slots can then be copied in bulk without a per-slot pre barrier.
+ * Nothing is done unless an SATB marking cycle is in progress.
+ */
+void
+MM_StandardAccessBarrier::preBatchArrayCopySATB(J9VMThread *vmThread, J9IndexableObject *srcObject, J9IndexableObject *destObject, I_32 srcIndex, I_32 destIndex, I_32 lengthInSlots)
+{
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(vmThread->omrVMThread);
+
+	if (isSATBBarrierActive(env)) {
+		UDATA referenceSize = J9VMTHREAD_REFERENCE_SIZE(vmThread);
+		bool rememberStoredValues = isDoubleBarrierActiveOnThread(vmThread);
+		UDATA destSlot = (UDATA)indexableEffectiveAddress(vmThread, destObject, destIndex, referenceSize);
+		UDATA srcSlot = (UDATA)indexableEffectiveAddress(vmThread, srcObject, srcIndex, referenceSize);
+		UDATA destEndSlot = destSlot + ((UDATA)lengthInSlots * referenceSize);
+
+		while (destSlot < destEndSlot) {
+			GC_SlotObject destSlotObject(vmThread->javaVM->omrVM, (fj9object_t *)destSlot);
+			J9Object *oldObject = destSlotObject.readReferenceFromSlot();
+			if (NULL != oldObject) {
+				rememberObjectToRescan(env, oldObject);
+			}
+			if (rememberStoredValues) {
+				GC_SlotObject srcSlotObject(vmThread->javaVM->omrVM, (fj9object_t *)srcSlot);
+				J9Object *value = srcSlotObject.readReferenceFromSlot();
+				if (NULL != value) {
+					rememberObjectToRescan(env, value);
+				}
+			}
+			destSlot += referenceSize;
+			srcSlot += referenceSize;
+		}
+	}
+}
+
 /**
  * Finds opportunities for doing the copy without or partially executing writeBarrier.
  * @return ARRAY_COPY_SUCCESSFUL if copy was successful, ARRAY_COPY_NOT_DONE no copy is done
@@ -676,10 +714,6 @@ I_32
 MM_StandardAccessBarrier::backwardReferenceArrayCopyIndex(J9VMThread *vmThread, J9IndexableObject *srcObject, J9IndexableObject *destObject, I_32 srcIndex, I_32 destIndex, I_32 lengthInSlots)
 {
 	I_32 retValue = ARRAY_COPY_NOT_DONE;
-	//TODO SATB re-enable opt?
-	if (_extensions->configuration->isSnapshotAtTheBeginningBarrierEnabled()) {
-		return retValue;
-	}
 
 	if(0 == lengthInSlots) {
 		retValue = ARRAY_COPY_SUCCESSFUL;
@@ -688,6 +722,8 @@ MM_StandardAccessBarrier::backwardReferenceArrayCopyIndex(J9VMThread *vmThread,
 		Assert_MM_true(destObject == srcObject);
 		Assert_MM_true(_extensions->indexableObjectModel.isInlineContiguousArraylet(destObject));
 
+		preBatchArrayCopySATB(vmThread, srcObject, destObject, srcIndex, destIndex, lengthInSlots);
+
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 		if (_extensions->isConcurrentScavengerInProgress()) {
 			/* During active CS cycle, we need a RB for every slot being copied.
@@ -713,19 +749,16 @@ MM_StandardAccessBarrier::backwardReferenceArrayCopyIndex(J9VMThread *vmThread,
 I_32
 MM_StandardAccessBarrier::forwardReferenceArrayCopyIndex(J9VMThread *vmThread, J9IndexableObject *srcObject, J9IndexableObject *destObject, I_32 srcIndex, I_32 destIndex, I_32 lengthInSlots)
 {
-	//TODO SATB re-enable opt
 	I_32 retValue = ARRAY_COPY_NOT_DONE;
 
-	if (_extensions->configuration->isSnapshotAtTheBeginningBarrierEnabled()) {
-		return retValue;
-	}
-
 	if(0 == lengthInSlots) {
 		retValue = ARRAY_COPY_SUCCESSFUL;
 	} else {
 		Assert_MM_true(_extensions->indexableObjectModel.isInlineContiguousArraylet(destObject));
 		Assert_MM_true(_extensions->indexableObjectModel.isInlineContiguousArraylet(srcObject));
 
+		preBatchArrayCopySATB(vmThread, srcObject, destObject, srcIndex, destIndex, lengthInSlots);
+
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 		if (_extensions->isConcurrentScavengerInProgress()) {
 			/* During active CS cycle, we need a RB for every slot being copied.
@@ -473,7 +473,10 @@ j9gc_initialize_heap(J9JavaVM *vm, IDATA *memoryParameterTable, UDATA heapBytesR
 		goto error_no_memory;
 	}
 
-	extensions->stringTable = MM_StringTable::newInstance(&env, extensions->dispatcher->threadCountMaximum());
+	if (0 == extensions->_stringTableCount) {
+		extensions->_stringTableCount = extensions->dispatcher->threadCountMaximum() * MM_StringTable::getDefaultTableCountPerGCThread();
+	}
+	extensions->stringTable = MM_StringTable::newInstance(&env, extensions->_stringTableCount);
 	if (NULL == extensions->stringTable) {
 		goto error_no_memory;
 	}
@@ -207,6 +207,14 @@ gcParseXXgcArguments(J9JavaVM *vm, char *optArg)
 			extensions->concurrentSweepingEnabled = true;
 			continue;
 		}
+		if(try_scan(&scan_start, "adaptBeatsToAllocationRate")) {
+			extensions->realtimeAdaptBeatsToAllocationRate = true;
+			continue;
+		}
+		if(try_scan(&scan_start, "noAdaptBeatsToAllocationRate")) {
+			extensions->realtimeAdaptBeatsToAllocationRate = false;
+			continue;
+		}
 		if(try_scan(&scan_start, "concurrentTrace")) {
 			extensions->concurrentTracingEnabled = true;
 			continue;
@@ -434,6 +442,59 @@ gcParseXXgcArguments(J9JavaVM *vm, char *optArg)
 			}
 			continue;
 		}
+		if (try_scan(&scan_start, "tarokEnableRememberedSetDeduplication")) {
+			extensions->tarokEnableRememberedSetDeduplication = true;
+			continue;
+		}
+		if (try_scan(&scan_start, "tarokDisableRememberedSetDeduplication")) {
+			extensions->tarokEnableRememberedSetDeduplication = false;
+			continue;
+		}
+		if (try_scan(&scan_start, "tarokOverflowedRegionsGMPKickoffPercent=")) {
+			if(!scan_udata_helper(vm, &scan_start, &extensions->tarokOverflowedRegionsGMPKickoffPercent, "tarokOverflowedRegionsGMPKickoffPercent=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if(extensions->tarokOverflowedRegionsGMPKickoffPercent > 100) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+		if (try_scan(&scan_start, "tarokEnableConcurrentClassSegmentRelease")) {
+			extensions->tarokEnableConcurrentClassSegmentRelease = true;
+			continue;
+		}
+		if (try_scan(&scan_start, "tarokDisableConcurrentClassSegmentRelease")) {
+			extensions->tarokEnableConcurrentClassSegmentRelease = false;
+			continue;
+		}
+		if (try_scan(&scan_start, "tarokEnableDynamicTenuring")) {
+			extensions->tarokEnableDynamicTenuring = true;
+			continue;
+		}
+		if (try_scan(&scan_start, "tarokDisableDynamicTenuring")) {
+			extensions->tarokEnableDynamicTenuring = false;
+			continue;
+		}
+		if (try_scan(&scan_start, "tarokDynamicTenureSurvivalPercent=")) {
+			if(!scan_udata_helper(vm, &scan_start, &extensions->tarokDynamicTenureSurvivalPercent, "tarokDynamicTenureSurvivalPercent=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if(extensions->tarokDynamicTenureSurvivalPercent > 100) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+		if (try_scan(&scan_start, "tarokTargetPGCPauseMillis=")) {
+			if(!scan_udata_helper(vm, &scan_start, &extensions->tarokTargetPGCPauseMillis, "tarokTargetPGCPauseMillis=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
 		if (try_scan(&scan_start, "tarokPGCtoGMP=")) {
 			if(!scan_udata_helper(vm, &scan_start, &extensions->tarokPGCtoGMPNumerator, "tarokPGCtoGMP=")) {
 				returnValue = JNI_EINVAL;
@@ -1448,6 +1509,19 @@ gcParseXXgcArguments(J9JavaVM *vm, char *optArg)
 			continue;
 		}
 
+		if (try_scan(&scan_start, "stringTableCount=")) {
+			if(!scan_udata_helper(vm, &scan_start, &(extensions->_stringTableCount), "stringTableCount=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if (0 == extensions->_stringTableCount) {
+				j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_VALUE_MUST_BE_ABOVE, "-XXgc:stringTableCount=", (UDATA)0);
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+
 		if (try_scan(&scan_start, "objectListFragmentCount=")) {
 			if(!scan_udata_helper(vm, &scan_start, &(extensions->objectListFragmentCount), "objectListFragmentCount=")) {
 				returnValue = JNI_EINVAL;
@@ -1298,6 +1298,13 @@ gcParseXgcArguments(J9JavaVM *vm, char *optArg)
 			}
 			continue;
 		}
+		if (try_scan(&scan_start, "finalizeAssistThreads=")) {
+			if(!scan_udata_helper(vm, &scan_start, &extensions->finalizeAssistThreadCount, "finalizeAssistThreads=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
 #endif /* J9VM_GC_FINALIZATION */
 
 #if defined(J9MODRON_USE_CUSTOM_SPINLOCKS)
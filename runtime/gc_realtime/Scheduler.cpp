@@ -29,6 +29,7 @@
 #include "AtomicOperations.hpp"
 #include "EnvironmentRealtime.hpp"
 #include "GCCode.hpp"
+#include "GCExtensions.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
 #include "IncrementalParallelTask.hpp"
@@ -464,20 +465,52 @@ MM_Scheduler::shouldGCDoubleBeat(MM_EnvironmentRealtime *env)
 	_utilTracker->addTimeSlice(env, env->getTimer(), false);
 	double excessTime = (_utilTracker->getCurrentUtil() - targetUtilization) * window;
 	double excessBeats = excessTime / beat;
-	return (excessBeats >= 2.0);
+	/* if the mutators would run out of memory during the next mutator beat, spend one more beat of the
+	 * utilization excess now rather than risk falling back to a synchronous collection
+	 */
+	double requiredExcessBeats = isHeapExhaustionPredicted(beatNanos) ? 1.0 : 2.0;
+	return (excessBeats >= requiredExcessBeats);
 }
 
 bool
 MM_Scheduler::shouldMutatorDoubleBeat(MM_EnvironmentRealtime *env, MM_Timer *timer)
 {
 	_utilTracker->addTimeSlice(env, timer, true);
+	updateAllocationRate(timer);
 
 	/* The call to currentUtil will modify the timeSlice array, so calls to shouldMutatorDoubleBeat
 	 * must be protected by a mutex (which is indeed currently the case) */
 	double curUtil = _utilTracker->getCurrentUtil();
 	double excessTime = (curUtil - _utilTracker->getTargetUtilization()) * window;
 	double excessBeats = excessTime / beat;
-	return (excessBeats <= 1.0);
+	/* skipping this quantum means the mutators run for another beat before the GC gets to free anything */
+	return (excessBeats <= 1.0) && !isHeapExhaustionPredicted(2 * beatNanos);
+}
+
+void
+MM_Scheduler::updateAllocationRate(MM_Timer *timer)
+{
+	U_64 currentTime = timer->getTimeInNanos();
+	uintptr_t bytesInUse = _gc->_memoryPool->getBytesInUse();
+
+	if ((0 != _allocationRateSampleTimeInNanos) && (currentTime > _allocationRateSampleTimeInNanos) && (bytesInUse >= _allocationRateSampleBytesInUse)) {
+		double sampleRate = (double)(bytesInUse - _allocationRateSampleBytesInUse) / (double)(currentTime - _allocationRateSampleTimeInNanos);
+		/* weigh the new sample at 1/4 so that a single bursty slice doesn't dominate the prediction */
+		_allocationRateBytesPerNano = (0.75 * _allocationRateBytesPerNano) + (0.25 * sampleRate);
+	}
+	_allocationRateSampleTimeInNanos = currentTime;
+	_allocationRateSampleBytesInUse = bytesInUse;
+}
+
+bool
+MM_Scheduler::isHeapExhaustionPredicted(U_64 horizonNanos)
+{
+	bool result = false;
+	if (MM_GCExtensions::getExtensions(_extensions)->realtimeAdaptBeatsToAllocationRate) {
+		double predictedBytes = _allocationRateBytesPerNano * (double)horizonNanos;
+		result = (predictedBytes >= (double)_gc->_memoryPool->getApproximateFreeMemorySize());
+	}
+	return result;
 }
 
 void
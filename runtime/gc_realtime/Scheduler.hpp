@@ -64,6 +64,9 @@ private:
 	U_64 _mutatorStartTimeInNanos; /**< Time in nanoseconds when the mutator slice started.  This is updated at increment end and when a GC quantum is skipped due to shouldMutatorDoubleBeat */
 	U_64 _incrementStartTimeInNanos; /**< Time in nanoseconds when the last gc increment started */
 	MM_GCCode _gcCode; /**< The gc code that will be used for the next GC cycle.  If this is modified during a collect it will be unused.  This variable is reset at the end of every cycle to the default collection type */
+	U_64 _allocationRateSampleTimeInNanos; /**< Time in nanoseconds of the last allocation rate sample, 0 if none has been taken yet */
+	uintptr_t _allocationRateSampleBytesInUse; /**< Bytes in use in the heap at the last allocation rate sample */
+	double _allocationRateBytesPerNano; /**< Smoothed rate at which mutators consumed heap memory over recent mutator slices */
 
 protected:
 public:
@@ -159,6 +162,19 @@ protected:
 
 	bool internalShouldGCYield(MM_EnvironmentRealtime *env, U_64 timeSlack);
 
+	/**
+	 * Sample the heap occupancy at the end of a mutator slice and fold the memory consumed since the previous sample
+	 * into the smoothed allocation rate.  Samples over which the heap shrank (because of sweeping) are ignored.
+	 * @param timer[in] the timer used to measure the slice
+	 */
+	void updateAllocationRate(MM_Timer *timer);
+
+	/**
+	 * @param horizonNanos[in] the amount of mutator time to predict for
+	 * @return true if, at the observed allocation rate, mutators would exhaust the free memory within horizonNanos
+	 */
+	bool isHeapExhaustionPredicted(U_64 horizonNanos);
+
 	/** @} */
 
 public:
@@ -244,6 +260,9 @@ public:
 		_mutatorStartTimeInNanos(J9CONST64(0)),
 		_incrementStartTimeInNanos(J9CONST64(0)),
 		_gcCode(J9MMCONSTANT_IMPLICIT_GC_DEFAULT),
+		_allocationRateSampleTimeInNanos(J9CONST64(0)),
+		_allocationRateSampleBytesInUse(0),
+		_allocationRateBytesPerNano(0.0),
 		_isInitialized(false),
 		_yieldCollaborator(NULL),
 		_shouldGCYield(false),
@@ -73,6 +73,14 @@ public:
 #endif /* J9VM_GC_ENABLE_DOUBLE_MAP */
 
 	uint64_t _cycleStartTime; /**< The start time of a copy forward cycle */
+	uint64_t _predictedTimeMicros; /**< The copy forward time predicted when Eden was sized for a pause target, 0 if there was no prediction */
+
+	uintptr_t _numaLocalScanCaches; /**< scan caches taken from the scan list of the NUMA node of the scanning thread */
+	uintptr_t _numaCommonScanCaches; /**< scan caches taken from the scan list of the common (node-less) context */
+	uintptr_t _numaRemoteScanCaches; /**< scan caches stolen from the scan list of another NUMA node */
+	uintptr_t _numaCrossNodeCopyBytes; /**< bytes copied into a survivor region on a different NUMA node than the source region */
+	uintptr_t _hashGrowthObjects; /**< hashed objects that grew by a hash slot when moved for the first time */
+	uintptr_t _hashGrowthBytes; /**< heap bytes added to hashed objects moved for the first time */
 
 private:
 	
@@ -101,6 +109,15 @@ public:
 		_monitorReferenceCleared = 0;
 		_monitorReferenceCandidates = 0;
 
+		_predictedTimeMicros = 0;
+
+		_numaLocalScanCaches = 0;
+		_numaCommonScanCaches = 0;
+		_numaRemoteScanCaches = 0;
+		_numaCrossNodeCopyBytes = 0;
+		_hashGrowthObjects = 0;
+		_hashGrowthBytes = 0;
+
 #if defined(J9VM_GC_ENABLE_DOUBLE_MAP)
 		_doubleMappedArrayletsCleared = 0;
 		_doubleMappedArrayletsCandidates = 0;
@@ -128,6 +145,13 @@ public:
 		_monitorReferenceCleared += stats->_monitorReferenceCleared;
 		_monitorReferenceCandidates += stats->_monitorReferenceCandidates;
 
+		_numaLocalScanCaches += stats->_numaLocalScanCaches;
+		_numaCommonScanCaches += stats->_numaCommonScanCaches;
+		_numaRemoteScanCaches += stats->_numaRemoteScanCaches;
+		_numaCrossNodeCopyBytes += stats->_numaCrossNodeCopyBytes;
+		_hashGrowthObjects += stats->_hashGrowthObjects;
+		_hashGrowthBytes += stats->_hashGrowthBytes;
+
 #if defined(J9VM_GC_ENABLE_DOUBLE_MAP)
 		_doubleMappedArrayletsCleared += stats->_doubleMappedArrayletsCleared;
 		_doubleMappedArrayletsCandidates += stats->_doubleMappedArrayletsCandidates;
@@ -151,6 +175,14 @@ public:
 		, _doubleMappedArrayletsCleared(0)
 		, _doubleMappedArrayletsCandidates(0)
 #endif /* J9VM_GC_ENABLE_DOUBLE_MAP */
+		, _cycleStartTime(0)
+		, _predictedTimeMicros(0)
+		, _numaLocalScanCaches(0)
+		, _numaCommonScanCaches(0)
+		, _numaRemoteScanCaches(0)
+		, _numaCrossNodeCopyBytes(0)
+		, _hashGrowthObjects(0)
+		, _hashGrowthBytes(0)
 	{}
 };
 
@@ -47,14 +47,64 @@ private:
 	fj9object_t *_scanPtr; /**< pointer to the current array element's first slot */
 	fj9object_t *_endPtr; /**< pointer to the array slot where the iteration will terminate */
 	J9Class *_elementClass; /**< Pointer to class of the elements in the flattened array */
+	GC_SlotObject _slotObject; /**< Slot returned by the strided scan */
+	bool _stridedScan; /**< true if reference slots are visited through _referenceSlots rather than _mixedObjectIterator */
+	uintptr_t _referenceSlotCount; /**< Number of reference slots in each element (strided scan only) */
+	uintptr_t _nextReferenceSlot; /**< Index in _referenceSlots of the next slot to return in the current element */
+	uintptr_t _referenceSlots[J9BITS_BITS_IN_SLOT]; /**< Slot index, within an element, of each reference field */
 protected:
 	OMR_VM *_omrVM;
+
+	MMINLINE bool compressObjectReferences()
+	{
+		return _mixedObjectIterator.compressObjectReferences();
+	}
+
+	/**
+	 * Decode the element description once so that each element only visits its reference slots.
+	 * This is possible when the description fits in the immediate (tagged) description word,
+	 * which covers the small value types that flattened arrays are typically made of.
+	 */
+	MMINLINE void initializeStridedScan()
+	{
+		UDATA description = (UDATA)_elementClass->instanceDescription;
+		_stridedScan = J9_ARE_ANY_BITS_SET(description, 1);
+		_referenceSlotCount = 0;
+		_nextReferenceSlot = 0;
+		if (_stridedScan) {
+			description >>= 1;
+			for (uintptr_t slotIndex = 0; 0 != description; slotIndex++) {
+				if (J9_ARE_ANY_BITS_SET(description, 1)) {
+					_referenceSlots[_referenceSlotCount] = slotIndex;
+					_referenceSlotCount += 1;
+				}
+				description >>= 1;
+			}
+			if (0 == _referenceSlotCount) {
+				/* primitive-only elements, nothing to scan */
+				_scanPtr = _endPtr;
+			}
+		}
+	}
+
 public:
 	MMINLINE GC_SlotObject *nextSlot()
 	{
 		/* If no more object slots to scan, returns NULL */
 		GC_SlotObject *result = NULL;
-		if (_scanPtr < _endPtr) {
+		if (_stridedScan) {
+			while (_scanPtr < _endPtr) {
+				if (_nextReferenceSlot < _referenceSlotCount) {
+					_slotObject.writeAddressToSlot(GC_SlotObject::addToSlotAddress(_scanPtr, _referenceSlots[_nextReferenceSlot], compressObjectReferences()));
+					_nextReferenceSlot += 1;
+					result = &_slotObject;
+					break;
+				}
+				/* move to the first reference slot of the next element */
+				_scanPtr = (fj9object_t *)(_elementStride + (uintptr_t)_scanPtr);
+				_nextReferenceSlot = 0;
+			}
+		} else if (_scanPtr < _endPtr) {
 			result = _mixedObjectIterator.nextSlot();
 			if (NULL == result) {
 				_scanPtr = (fj9object_t *)(_elementStride + (uintptr_t)_scanPtr);
@@ -80,7 +130,8 @@ public:
 		_endPtr = (fomrobject_t *)((uintptr_t)_basePtr + (arrayObjectModel->getSizeInElements(_arrayPtr) * _elementStride));
 		_elementClass = ((J9ArrayClass *) clazzPtr)->componentType;
 
-		if (_scanPtr < _endPtr) {
+		initializeStridedScan();
+		if (!_stridedScan && (_scanPtr < _endPtr)) {
 			_mixedObjectIterator.initialize(_omrVM, _elementClass, _scanPtr);
 		}
 	}
@@ -100,6 +151,7 @@ public:
 	 */
 	MMINLINE void setIndex(UDATA index) {
 		_scanPtr = (fj9object_t *)((uintptr_t)_basePtr + (index * _elementStride));
+		_nextReferenceSlot = 0;
 	}
 
 	/**
@@ -110,6 +162,7 @@ public:
 	{
 		_scanPtr = objectIteratorState->_scanPtr;
 		_endPtr = objectIteratorState->_endPtr;
+		_nextReferenceSlot = 0;
 	}
 
 	/**
@@ -135,6 +188,10 @@ public:
 		, _scanPtr(NULL)
 		, _endPtr(NULL)
 		, _elementClass(NULL)
+		, _slotObject(GC_SlotObject(omrVM, NULL))
+		, _stridedScan(false)
+		, _referenceSlotCount(0)
+		, _nextReferenceSlot(0)
 		, _omrVM(omrVM)
 	{
 		initialize(objectPtr);
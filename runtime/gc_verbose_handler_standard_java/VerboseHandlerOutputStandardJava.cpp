@@ -182,8 +182,19 @@ MM_VerboseHandlerOutputStandardJava::handleSlowExclusive(J9HookInterface **hook,
 	char threadName[64];
 	getThreadName(threadName,sizeof(threadName),event->currentThread->omrVMThread);
 
+	/* The event is reported by the last responder while it still holds the exclusiveAccessMutex, so the request
+	 * statistics identify the thread which is waiting. haltedThreads already counts the slow responder itself,
+	 * so the threads which had responded before it are all but one of them.
+	 */
+	J9ExclusiveVMStats *exclusiveVMAccessStats = &_omrVM->exclusiveVMAccessStats;
+	char requesterName[64] = "external thread";
+	if (NULL != exclusiveVMAccessStats->requester) {
+		getThreadName(requesterName, sizeof(requesterName), exclusiveVMAccessStats->requester);
+	}
+	UDATA respondedBefore = (0 != exclusiveVMAccessStats->haltedThreads) ? (exclusiveVMAccessStats->haltedThreads - 1) : 0;
+
 	enterAtomicReportingBlock();
-	writer->formatAndOutput(env, 0,"<warning details=\"slow exclusive request due to %s\" threadname=\"%s\" timems=\"%zu\" />", (event->reason == 1)?"JNICritical":"Exclusive Access", threadName, event->timeTaken);
+	writer->formatAndOutput(env, 0,"<warning details=\"slow exclusive request due to %s\" threadname=\"%s\" timems=\"%zu\" requestername=\"%s\" respondedbefore=\"%zu\" />", (event->reason == 1)?"JNICritical":"Exclusive Access", threadName, event->timeTaken, requesterName, respondedBefore);
 	writer->flush(env);
 	exitAtomicReportingBlock();
 
@@ -407,6 +407,18 @@ MM_VerboseHandlerOutputVLHGC::handleCopyForwardEnd(J9HookInterface** hook, UDATA
 				(copyForwardStats->_edenEvacuateRegionCount + copyForwardStats->_nonEdenEvacuateRegionCount - copyForwardStats->_nonEvacuateRegionCount),
 				copyForwardStats->_nonEvacuateRegionCount);
 	}
+	if (0 != copyForwardStats->_predictedTimeMicros) {
+		writer->formatAndOutput(env, 1, "<pause-target targetms=\"%zu\" predictedms=\"%llu.%03llu\" />",
+				extensions->tarokTargetPGCPauseMillis, copyForwardStats->_predictedTimeMicros / 1000, copyForwardStats->_predictedTimeMicros % 1000);
+	}
+	if (extensions->_numaManager.isPhysicalNUMASupported()) {
+		writer->formatAndOutput(env, 1, "<numa-scan-caches local=\"%zu\" common=\"%zu\" remote=\"%zu\" crossnodebytes=\"%zu\" />",
+				copyForwardStats->_numaLocalScanCaches, copyForwardStats->_numaCommonScanCaches, copyForwardStats->_numaRemoteScanCaches, copyForwardStats->_numaCrossNodeCopyBytes);
+	}
+	if (0 != copyForwardStats->_hashGrowthObjects) {
+		writer->formatAndOutput(env, 1, "<memory-hashed-growth objects=\"%zu\" bytes=\"%zu\" />",
+				copyForwardStats->_hashGrowthObjects, copyForwardStats->_hashGrowthBytes);
+	}
 	outputRememberedSetClearedInfo(env, irrsStats);
 
 	outputUnfinalizedInfo(env, 1, copyForwardStats->_unfinalizedCandidates, copyForwardStats->_unfinalizedEnqueued);
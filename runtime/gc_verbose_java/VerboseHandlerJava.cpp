@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2020 IBM Corp. and others
+ * Copyright (c) 1991, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -48,6 +48,18 @@ MM_VerboseHandlerJava::outputFinalizableInfo(MM_VerboseManager *manager, MM_Envi
 
 	if((0 != systemCount) || (0 != defaultCount) || (0 != referenceCount) || (0 != classloaderCount)) {
 		manager->getWriterChain()->formatAndOutput(env, indent, "<pending-finalizers system=\"%zu\" default=\"%zu\" reference=\"%zu\" classloader=\"%zu\" />", systemCount, defaultCount, referenceCount, classloaderCount);
+		if (0 != extensions->finalizeAssistThreadCount) {
+			/* the assist threads update their count under the monitor as they start and exit */
+			UDATA activeCount = 0;
+			omrthread_monitor_t assistMonitor = extensions->finalizeAssistMonitor;
+			if (NULL != assistMonitor) {
+				omrthread_monitor_enter(assistMonitor);
+				activeCount = extensions->finalizeAssistActiveThreadCount;
+				omrthread_monitor_exit(assistMonitor);
+			}
+			/* finalizers run by the assist threads so far, to compare against the backlog above */
+			manager->getWriterChain()->formatAndOutput(env, indent, "<finalizer-assist threads=\"%zu\" processed=\"%zu\" />", activeCount, extensions->finalizeAssistProcessedCount);
+		}
 	}
 }
 
@@ -75,6 +75,24 @@ public:
 		return getCompactGroupNumberForAge(env, region->getLogicalAge(), migrationDestination);
 	}
 
+	/**
+	 * Computes the 0-indexed compact group that copy-forward copies the live objects of the given region into.
+	 * Objects from regions at or above the dynamic tenure age skip the remaining age groups and go straight to the oldest one.
+	 * @param env[in] The thread
+	 * @param region Region the objects are copied from
+	 * @param migrationDestination The context the objects are copied into
+	 * @return A 0-indexed value which can be used to look up the destination compact group
+	 */
+	MMINLINE static UDATA getCompactGroupNumberForCopy(MM_EnvironmentVLHGC *env, MM_HeapRegionDescriptorVLHGC *region, MM_AllocationContextTarok *migrationDestination)
+	{
+		MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env);
+		UDATA age = region->getLogicalAge();
+		if (age >= extensions->tarokDynamicTenureAge) {
+			age = extensions->tarokRegionMaxAge;
+		}
+		return getCompactGroupNumberForAge(env, age, migrationDestination);
+	}
+
 	/**
 	 * Computes the 0-indexed compact group index for the receiver
 	 * @param env[in] The thread
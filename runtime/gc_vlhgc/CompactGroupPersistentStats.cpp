@@ -56,6 +56,7 @@ MM_CompactGroupPersistentStats::allocateCompactGroupPersistentStats(MM_Environme
 			result[i]._liveBytesAbsoluteDeviation = 0;
 			result[i]._regionCount = 0;
 			result[i]._statsHaveBeenUpdatedThisCycle = false;
+			result[i]._survivalRateHasBeenMeasured = false;
 			/* this is not really stats, but a constant; calculate only if unit is set */
 			if (0 != extensions->tarokAllocationAgeUnit) {
 				UDATA ageGroup = MM_CompactGroupManager::getRegionAgeFromGroup(env, i);
@@ -116,6 +117,37 @@ MM_CompactGroupPersistentStats::deriveWeightedSurvivalRates(MM_EnvironmentVLHGC
 	Trc_MM_CompactGroupPersistentStats_deriveWeightedSurvivalRates_Exit(env->getLanguageVMThread());
 }
 
+void
+MM_CompactGroupPersistentStats::deriveDynamicTenureAge(MM_EnvironmentVLHGC *env, MM_CompactGroupPersistentStats *persistentStats)
+{
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env);
+
+	if (extensions->tarokEnableDynamicTenuring) {
+		MM_GlobalAllocationManagerTarok *allocationManager = (MM_GlobalAllocationManagerTarok*)extensions->globalAllocationManager;
+		UDATA managedAllocationContextCount = allocationManager->getManagedAllocationContextCount();
+		UDATA regionMaxAge = extensions->tarokRegionMaxAge;
+		UDATA nurseryMaxAge = extensions->tarokNurseryMaxAge._valueSpecified;
+		double survivalThreshold = (double)extensions->tarokDynamicTenureSurvivalPercent / 100.0;
+		UDATA tenureAge = UDATA_MAX;
+
+		/* walk from the oldest age below the maximum towards the nursery, as long as every age seen keeps (nearly) all its bytes */
+		for (UDATA age = regionMaxAge - 1; (age > nurseryMaxAge) && (age < regionMaxAge); age--) {
+			bool ageIsStable = true;
+			for (UDATA contextIndex = 0; ageIsStable && (contextIndex < managedAllocationContextCount); contextIndex++) {
+				MM_AllocationContextTarok *context = allocationManager->getAllocationContextByIndex(contextIndex);
+				UDATA compactGroup = MM_CompactGroupManager::getCompactGroupNumberForAge(env, age, context);
+				/* a group never measured still has the initial survival rate of 1.0, which says nothing about the objects in it */
+				ageIsStable = persistentStats[compactGroup]._survivalRateHasBeenMeasured && (persistentStats[compactGroup]._historicalSurvivalRate >= survivalThreshold);
+			}
+			if (!ageIsStable) {
+				break;
+			}
+			tenureAge = age;
+		}
+
+		extensions->tarokDynamicTenureAge = tenureAge;
+	}
+}
 
 void
 MM_CompactGroupPersistentStats::calculateAgeGroupFractionsAtEdenBoundary(MM_EnvironmentVLHGC *env, U_64 ageInThisAgeGroup, U_64 *ageInThisCompactGroup, U_64 currentAge, U_64 allocatedSinceLastPGC, U_64 *edenFractionOfCompactGroup, U_64 *nonEdenFractionOfCompactGroup)
@@ -671,6 +703,7 @@ MM_CompactGroupPersistentStats::updateStatsAfterCollectionOperation(MM_Environme
 			if(!persistentStats[compactGroup]._statsHaveBeenUpdatedThisCycle) {
 				persistentStats[compactGroup]._statsHaveBeenUpdatedThisCycle = true;
 				updateProjectedSurvivalRate(env, persistentStats, compactGroup);
+				persistentStats[compactGroup]._survivalRateHasBeenMeasured = true;
 				compactGroupUpdated = true;
 			}
 		}
@@ -678,6 +711,7 @@ MM_CompactGroupPersistentStats::updateStatsAfterCollectionOperation(MM_Environme
 
 	if (compactGroupUpdated) {
 		deriveWeightedSurvivalRates(env, persistentStats);
+		deriveDynamicTenureAge(env, persistentStats);
 	}
 }
 
@@ -53,6 +53,7 @@ public:
 	double _weightedSurvivalRate; /**< The historical survival rate in the corresponding compact group, weighted to take into consideration older groups in the same context */
 
 	bool _statsHaveBeenUpdatedThisCycle; /** < Indicates whether we have updated the stats shown below yet this cycle.  They will be updated only once per cycle */
+	bool _survivalRateHasBeenMeasured; /**< Indicates whether _historicalSurvivalRate has been updated from a collection at least once (rather than holding its initial value) */
 	UDATA _measuredLiveBytesBeforeCollectInCollectedSet;	/**< The number of bytes allocated in the collection set subset in this group at the beginning of the collect (both live and dead objects) */
 	UDATA _projectedLiveBytesBeforeCollectInCollectedSet;	/**< The projected number of bytes allocated in the collection set subset in this group at the beginning of the collect (the reason for the projection is that this attempts to account for only live objects) */
 	UDATA _projectedLiveBytesAfterPreviousPGCInCollectedSetForNonEdenFraction; /**< Non-Eden Fraction (in case age group spans over Eden boundary) of _projectedLiveBytesAfterPreviousPGCInCollectedSet. This could be approximation! */
@@ -145,6 +146,16 @@ private:
 	 */
 	static void deriveWeightedSurvivalRates(MM_EnvironmentVLHGC *env, MM_CompactGroupPersistentStats *persistentStats);
 
+	/**
+	 * Derive the dynamic tenure age (the youngest age, above the nursery, from which every age group keeps at least
+	 * tarokDynamicTenureSurvivalPercent of its bytes) from the _historicalSurvivalRate of the compact groups.
+	 * Objects in groups past that age are expected to live on, so copying them up one age group at a time only copies them again.
+	 *
+	 * @param env[in] the current thread
+	 * @param persistentStats[in] an array of MM_CompactGroupPersistentStats with as many elements as there are compact groups
+	 */
+	static void deriveDynamicTenureAge(MM_EnvironmentVLHGC *env, MM_CompactGroupPersistentStats *persistentStats);
+
 	/**
 	 * Auxiliary function to calculation various values for measured/projected live bytes before current/after previous PGC, invoked for each region in Collection Set
   	 * @param env[in] The Main GC thread
@@ -71,6 +71,16 @@
  */
 #define COMPRESSED_CARD_TABLE_DIV	1
 
+/*
+ * Cards are read a UDATA at a time so that runs of cards which can not be dirty for a partial collect are skipped
+ * without decoding every card. CARD_WORD_FILLED_WITH(state) is a UDATA with each of its cards set to state.
+ */
+#define CARDS_PER_UDATA	sizeof(UDATA)
+#define CARD_WORD_FILLED_WITH(state)	((UDATA_MAX / 0xFF) * (UDATA)(U_8)(state))
+
+/* A byte of compressed card table bits with all of its cards clean */
+#define AllCompressedCardsInByteClean	((U_8)AllCompressedCardsInWordClean)
+
 MM_CompressedCardTable *
 MM_CompressedCardTable::newInstance(MM_EnvironmentBase *env, MM_Heap *heap)
 {
@@ -171,9 +181,6 @@ MM_CompressedCardTable::rebuildCompressedCardTableForPartialCollect(MM_Environme
 	UDATA compressedCardStartOffset = ((UDATA)startHeapAddress - _heapBase) / (CARD_SIZE * COMPRESSED_CARD_TABLE_DIV);
 	UDATA compressedCardStartIndex = compressedCardStartOffset / COMPRESSED_CARDS_PER_WORD;
 	UDATA *compressedCard = &_compressedCardTable[compressedCardStartIndex];
-	UDATA mask = 1;
-	const UDATA endOfWord = ((UDATA)1) << (COMPRESSED_CARDS_PER_WORD - 1);
-	UDATA compressedCardWord = AllCompressedCardsInWordClean;
 
 	/*
 	 *  To simplify test logic assume here that given addresses are aligned to correspondent compressed card word border
@@ -182,17 +189,41 @@ MM_CompressedCardTable::rebuildCompressedCardTableForPartialCollect(MM_Environme
 	 */
 	Assert_MM_true(0 == (compressedCardStartOffset % COMPRESSED_CARDS_PER_WORD));
 
-	while (card < cardLast) {
-
 #if (1 == COMPRESSED_CARD_TABLE_DIV)
+	/*
+	 * Build a whole compressed card word at a time. A UDATA of cards holding only clean or GMP-must-scan cards
+	 * has no dirty card, so its bits are left clean without decoding each of its cards.
+	 */
+	const UDATA allCardsClean = CARD_WORD_FILLED_WITH(CARD_CLEAN);
+	const UDATA allCardsGMPMustScan = CARD_WORD_FILLED_WITH(CARD_GMP_MUST_SCAN);
+
+	/* end heap address must be aligned*/
+	Assert_MM_true(0 == ((UDATA)card % sizeof(UDATA)));
+	Assert_MM_true(0 == (((UDATA)cardLast - (UDATA)card) % COMPRESSED_CARDS_PER_WORD));
 
-		Card state = *card++;
-		if (isDirtyCardForPartialCollect(state)) {
-			/* invert bit */
-			compressedCardWord ^= mask;
+	while (card < cardLast) {
+		UDATA compressedCardWord = AllCompressedCardsInWordClean;
+		for (UDATA bit = 0; bit < COMPRESSED_CARDS_PER_WORD; bit += CARDS_PER_UDATA) {
+			UDATA cardGroup = *(UDATA *)card;
+			if ((allCardsClean != cardGroup) && (allCardsGMPMustScan != cardGroup)) {
+				for (UDATA j = 0; j < CARDS_PER_UDATA; j++) {
+					if (isDirtyCardForPartialCollect(card[j])) {
+						/* invert bit */
+						compressedCardWord ^= (((UDATA)1) << (bit + j));
+					}
+				}
+			}
+			card += CARDS_PER_UDATA;
 		}
+		*compressedCard++ = compressedCardWord;
+	}
 
 #else /* COMPRESSED_CARD_TABLE_DIV == 1 */
+	UDATA mask = 1;
+	const UDATA endOfWord = ((UDATA)1) << (COMPRESSED_CARDS_PER_WORD - 1);
+	UDATA compressedCardWord = AllCompressedCardsInWordClean;
+
+	while (card < cardLast) {
 		/*
 		 * This implementation supports case for COMPRESSED_CARD_TABLE_DIV == 1 as well
 		 * Special implementation above extracted with hope that it is faster
@@ -209,7 +240,6 @@ MM_CompressedCardTable::rebuildCompressedCardTableForPartialCollect(MM_Environme
 		}
 		/* rewind card pointer to first card for next bit */
 		card = next;
-#endif /* COMPRESSED_CARD_TABLE_DIV == 1 */
 
 		if (mask == endOfWord) {
 			/* last bit in word handled - save word and prepare mask for next one */
@@ -224,6 +254,7 @@ MM_CompressedCardTable::rebuildCompressedCardTableForPartialCollect(MM_Environme
 
 	/* end heap address must be aligned*/
 	Assert_MM_true(1 == mask);
+#endif /* COMPRESSED_CARD_TABLE_DIV == 1 */
 }
 
 bool
@@ -284,8 +315,15 @@ MM_CompressedCardTable::cleanCardsInRange(MM_EnvironmentBase *env, MM_CardCleane
 	for (UDATA i = compressedCardStartIndex; i < compressedCardEndIndex; i++) {
 		UDATA compressedCardWord = _compressedCardTable[i];
 		if (AllCompressedCardsInWordClean != compressedCardWord) {
-			/* search for dirty cards - iterate bits */
+			/* search for dirty cards - iterate bits, skipping a byte of bits at a time while all of them are clean */
 			for (UDATA j = 0; j < COMPRESSED_CARDS_PER_WORD; j++) {
+				if ((0 == (j % BITS_PER_BYTE)) && (AllCompressedCardsInByteClean == (U_8)compressedCardWord)) {
+					card += (COMPRESSED_CARD_TABLE_DIV * BITS_PER_BYTE);
+					address += (CARD_SIZE * COMPRESSED_CARD_TABLE_DIV * BITS_PER_BYTE);
+					compressedCardWord >>= BITS_PER_BYTE;
+					j += (BITS_PER_BYTE - 1);
+					continue;
+				}
 				if (CompressedCardDirty == (compressedCardWord & 1)) {
 					for (UDATA k = 0; k < COMPRESSED_CARD_TABLE_DIV; k++) {
 						/* clean card */
@@ -71,6 +71,9 @@
 #include "HeapRegionDescriptorVLHGC.hpp"
 #include "HeapRegionIteratorVLHGC.hpp"
 #include "HeapRegionManager.hpp"
+#if defined(OMR_GC_VLHGC_CONCURRENT_COPY_FORWARD)
+#include "HeapRegionStateTable.hpp"
+#endif /* defined(OMR_GC_VLHGC_CONCURRENT_COPY_FORWARD) */
 #include "HotFieldUtil.hpp"
 #include "InterRegionRememberedSet.hpp"
 #include "MarkMap.hpp"
@@ -471,7 +474,18 @@ MM_CopyForwardScheme::preProcessRegions(MM_EnvironmentVLHGC *env)
 		} else {
 			region->_copyForwardData._evacuateSet = false;
 		}
-		
+
+#if defined(OMR_GC_VLHGC_CONCURRENT_COPY_FORWARD)
+		if (NULL != _extensions->heapRegionStateTable) {
+			/* publish the regions which objects will be evacuated from so that the read barrier can find them */
+			if (region->_copyForwardData._evacuateSet && !region->_markData._noEvacuation) {
+				_extensions->heapRegionStateTable->setState(region->getLowAddress(), OMR::GC::HEAP_REGION_STATE_COPY_FORWARD);
+			} else {
+				_extensions->heapRegionStateTable->setState(region->getLowAddress(), OMR::GC::HEAP_REGION_STATE_NONE);
+			}
+		}
+#endif /* defined(OMR_GC_VLHGC_CONCURRENT_COPY_FORWARD) */
+
 		region->getReferenceObjectList()->resetPriorLists();
 		Assert_MM_false(region->_copyForwardData._requiresPhantomReferenceProcessing);
 	}
@@ -545,6 +559,11 @@ MM_CopyForwardScheme::postProcessRegions(MM_EnvironmentVLHGC *env)
 		}
 
 		/* Clear any copy forward data */
+#if defined(OMR_GC_VLHGC_CONCURRENT_COPY_FORWARD)
+		if (NULL != _extensions->heapRegionStateTable) {
+			_extensions->heapRegionStateTable->setState(region->getLowAddress(), OMR::GC::HEAP_REGION_STATE_NONE);
+		}
+#endif /* defined(OMR_GC_VLHGC_CONCURRENT_COPY_FORWARD) */
 		region->_copyForwardData._initialLiveSet = false;
 		region->_copyForwardData._requiresPhantomReferenceProcessing = false;
 		region->_copyForwardData._survivorBase = NULL;
@@ -1098,7 +1117,7 @@ MM_CopyForwardScheme::reserveMemoryForCopy(MM_EnvironmentVLHGC *env, J9Object *o
 	Assert_MM_objectAligned(env, objectReserveSizeInBytes);
 
 	MM_HeapRegionDescriptorVLHGC *region = (MM_HeapRegionDescriptorVLHGC *)_regionManager->tableDescriptorForAddress(objectToEvacuate);
-	UDATA compactGroup = MM_CompactGroupManager::getCompactGroupNumberInContext(env, region, reservingContext);
+	UDATA compactGroup = MM_CompactGroupManager::getCompactGroupNumberForCopy(env, region, reservingContext);
 	MM_CopyForwardCompactGroup *copyForwardCompactGroup = &env->_copyForwardCompactGroups[compactGroup];
 	
 	Assert_MM_true(compactGroup < _compactGroupMaxCount);
@@ -2008,6 +2027,12 @@ MM_CopyForwardScheme::copy(MM_EnvironmentVLHGC *env, MM_AllocationContextTarok *
 					U_32 *hashCodePointer = (U_32*)((U_8*)destinationObjectPtr + hashOffset);
 					*hashCodePointer = objectModel->computeObjectHash(forwardedHeader);
 					objectModel->setObjectHasBeenMoved(destinationObjectPtr);
+					/* the hash slot costs heap space only when the object had no padding to hold it */
+					UDATA hashGrowthInBytes = objectReserveSizeInBytes - objectModel->adjustSizeInBytes(objectCopySizeInBytes);
+					if (0 != hashGrowthInBytes) {
+						env->_copyForwardStats._hashGrowthObjects += 1;
+						env->_copyForwardStats._hashGrowthBytes += hashGrowthInBytes;
+					}
 				}
 
 				/* Update any mark maps and transfer card table data as appropriate for a successful copy */
@@ -2042,10 +2067,24 @@ MM_CopyForwardScheme::copy(MM_EnvironmentVLHGC *env, MM_AllocationContextTarok *
 					env->_copyForwardCompactGroups[destinationCompactGroup]._nonEdenStats._copiedObjects += 1;
 					env->_copyForwardCompactGroups[destinationCompactGroup]._nonEdenStats._copiedBytes += objectCopySizeInBytes;
 				}
-				copyCache->_allocationAgeSizeProduct += ((double)objectReserveSizeInBytes * (double)sourceRegion->getAllocationAge());
+				if (_extensions->_numaManager.isPhysicalNUMASupported() && (sourceRegion->getNumaNode() != reservingContext->getNumaNode())) {
+					env->_copyForwardStats._numaCrossNodeCopyBytes += objectCopySizeInBytes;
+				}
+				U_64 allocationAge = sourceRegion->getAllocationAge();
+				U_64 lowerAgeBound = sourceRegion->getLowerAgeBound();
+				U_64 upperAgeBound = sourceRegion->getUpperAgeBound();
+				if (_extensions->tarokAllocationAgeEnabled && (sourceCompactGroup != destinationCompactGroup)
+					&& (MM_CompactGroupManager::getRegionAgeFromGroup(env, destinationCompactGroup) != sourceRegion->getLogicalAge())) {
+					/* the object was tenured past the remaining age groups, so age it to the start of its new group */
+					U_64 tenuredAge = _extensions->compactGroupPersistentStats[destinationCompactGroup - 1]._maxAllocationAge;
+					allocationAge = OMR_MAX(allocationAge, tenuredAge);
+					lowerAgeBound = OMR_MAX(lowerAgeBound, tenuredAge);
+					upperAgeBound = OMR_MAX(upperAgeBound, tenuredAge);
+				}
+				copyCache->_allocationAgeSizeProduct += ((double)objectReserveSizeInBytes * (double)allocationAge);
 				copyCache->_objectSize += objectReserveSizeInBytes;
-				copyCache->_lowerAgeBound = OMR_MIN(copyCache->_lowerAgeBound, sourceRegion->getLowerAgeBound());
-				copyCache->_upperAgeBound = OMR_MAX(copyCache->_upperAgeBound, sourceRegion->getUpperAgeBound());
+				copyCache->_lowerAgeBound = OMR_MIN(copyCache->_lowerAgeBound, lowerAgeBound);
+				copyCache->_upperAgeBound = OMR_MAX(copyCache->_upperAgeBound, upperAgeBound);
 
 #if defined(J9VM_GC_LEAF_BITS)
 				if (_extensions->tarokEnableLeafFirstCopying) {
@@ -2746,17 +2785,25 @@ MM_CopyForwardScheme::getNextWorkUnitNoWait(MM_EnvironmentVLHGC *env, UDATA pref
 	ScanReason ret = SCAN_REASON_NONE;
 	/* local node first */
 	ret = getNextWorkUnitOnNode(env, preferredNumaNode);
-	if (SCAN_REASON_NONE == ret) {
+	if (SCAN_REASON_NONE != ret) {
+		env->_copyForwardStats._numaLocalScanCaches += 1;
+	} else {
 		/* we failed to find a scan cache on our preferred node */
 		if (COMMON_CONTEXT_INDEX != preferredNumaNode) {
 			/* try the common node */
 			ret = getNextWorkUnitOnNode(env, COMMON_CONTEXT_INDEX);
+			if (SCAN_REASON_NONE != ret) {
+				env->_copyForwardStats._numaCommonScanCaches += 1;
+			}
 		}
 		/* now try the remaining nodes */
 		UDATA nextNode = (preferredNumaNode + 1) % nodeLists;
 		while ((SCAN_REASON_NONE == ret) && (nextNode != preferredNumaNode)) {
 			if (COMMON_CONTEXT_INDEX != nextNode) {
 				ret = getNextWorkUnitOnNode(env, nextNode);
+				if (SCAN_REASON_NONE != ret) {
+					env->_copyForwardStats._numaRemoteScanCaches += 1;
+				}
 			}
 			nextNode = (nextNode + 1) % nodeLists;
 		}
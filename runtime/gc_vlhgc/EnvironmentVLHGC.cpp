@@ -41,6 +41,8 @@ MM_EnvironmentVLHGC::MM_EnvironmentVLHGC(OMR_VMThread *omrVMThread)
 	, _rsclBufferControlBlockCount(0)
 	, _rememberedSetCardBucketPool(NULL)
 	, _lastOverflowedRsclWithReleasedBuffers(NULL)
+	, _rsclDeduplicationBuffer(NULL)
+	, _rsclDeduplicationBufferSize(0)
 {
 	_typeId = __FUNCTION__;
 }
@@ -60,6 +62,8 @@ MM_EnvironmentVLHGC::MM_EnvironmentVLHGC(J9JavaVM *javaVM)
 	, _rsclBufferControlBlockCount(0)
 	, _rememberedSetCardBucketPool(NULL)
 	, _lastOverflowedRsclWithReleasedBuffers(NULL)
+	, _rsclDeduplicationBuffer(NULL)
+	, _rsclDeduplicationBufferSize(0)
 {
 	_typeId = __FUNCTION__;
 }
@@ -109,6 +113,12 @@ MM_EnvironmentVLHGC::initializeGCThread()
 void
 MM_EnvironmentVLHGC::tearDown(MM_GCExtensionsBase *extensions)
 {
+	if (NULL != _rsclDeduplicationBuffer) {
+		extensions->getForge()->free(_rsclDeduplicationBuffer);
+		_rsclDeduplicationBuffer = NULL;
+		_rsclDeduplicationBufferSize = 0;
+	}
+
 	/* tearDown base class */
 	MM_EnvironmentBase::tearDown(extensions);
 }
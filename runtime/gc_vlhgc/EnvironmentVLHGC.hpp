@@ -74,6 +74,8 @@ public:
 	IDATA _rsclBufferControlBlockCount;	/**< count of buffers in BufferControlBlock thread local pool list */
 	MM_RememberedSetCardBucket *_rememberedSetCardBucketPool; /**< GC thread local pool of RS Card Buckets for each Region (its Card List) */
 	MM_RememberedSetCardList *_lastOverflowedRsclWithReleasedBuffers; /**< in global list of overflowed RSCL, this is the last RSCL this thread visited */
+	UDATA *_rsclDeduplicationBuffer; /**< scratch space used to sort the cards of an RSCL bucket when removing duplicates (lazily allocated) */
+	UDATA _rsclDeduplicationBufferSize; /**< number of cards that fit in _rsclDeduplicationBuffer */
 
 	MM_CopyForwardStats _copyForwardStats;  /**< GC thread local statistics structure for copy forward collections */
 
@@ -104,6 +104,8 @@ MM_IncrementalGenerationalGC::MM_IncrementalGenerationalGC(MM_EnvironmentVLHGC *
 	, _persistentGlobalMarkPhaseState()
 	, _forceConcurrentTermination(false)
 	, _globalMarkPhaseIncrementBytesStillToScan(0)
+	, _concurrentUndeadSegmentFlushPending(false)
+	, _concurrentPhaseIsUndeadSegmentFlush(false)
 {
 	_typeId = __FUNCTION__;
 }
@@ -1364,6 +1366,8 @@ MM_IncrementalGenerationalGC::postProcessPGCUsingCopyForward(MM_EnvironmentVLHGC
 	cycleState->_vlhgcIncrementStats._copyForwardStats._freeMemoryAfter = _extensions->getHeap()->getActualFreeMemorySize();
 	cycleState->_vlhgcIncrementStats._copyForwardStats._totalMemoryAfter = _extensions->getHeap()->getMemorySize();
 
+	cycleState->_vlhgcIncrementStats._copyForwardStats._predictedTimeMicros = _schedulingDelegate.getPredictedCopyForwardMicros();
+
 	reportCopyForwardEnd(env, endTimeOfCopyForward - cycleState->_vlhgcIncrementStats._copyForwardStats._cycleStartTime);
 
 	postMarkMapCompletion(env);
@@ -1937,6 +1941,14 @@ MM_IncrementalGenerationalGC::reportCopyForwardEnd(MM_EnvironmentVLHGC *env, U_6
 
 bool
 MM_IncrementalGenerationalGC::isConcurrentWorkAvailable(MM_EnvironmentBase *env)
+{
+	bool isUndeadSegmentFlushAvailable = _concurrentUndeadSegmentFlushPending && !_forceConcurrentTermination;
+
+	return isConcurrentGMPWorkAvailable() || isUndeadSegmentFlushAvailable;
+}
+
+bool
+MM_IncrementalGenerationalGC::isConcurrentGMPWorkAvailable()
 {
 	bool isConcurrentEnabled = _extensions->tarokEnableConcurrentGMP;
 	bool isGMPRunning = isGlobalMarkPhaseRunning();
@@ -1954,6 +1966,12 @@ MM_IncrementalGenerationalGC::preConcurrentInitializeStatsAndReport(MM_Environme
 	Assert_MM_true(NULL == env->_cycleState);
 	PORT_ACCESS_FROM_ENVIRONMENT(env);
 
+	/* GMP work takes priority. Freeing the undead segments is not a GMP phase so it is not reported as one */
+	_concurrentPhaseIsUndeadSegmentFlush = !isConcurrentGMPWorkAvailable();
+	if (_concurrentPhaseIsUndeadSegmentFlush) {
+		return;
+	}
+
 	stats->_cycleID = _persistentGlobalMarkPhaseState._verboseContextID;
 	stats->_scanTargetInBytes = _globalMarkPhaseIncrementBytesStillToScan;
 	env->_cycleState = &_persistentGlobalMarkPhaseState;
@@ -1971,6 +1989,17 @@ MM_IncrementalGenerationalGC::mainThreadConcurrentCollect(MM_EnvironmentBase *en
 {
 	MM_EnvironmentVLHGC *env = MM_EnvironmentVLHGC::getEnvironment(envBase);
 
+	if (_concurrentPhaseIsUndeadSegmentFlush) {
+		Assert_MM_true(NULL == env->_cycleState);
+		_concurrentUndeadSegmentFlushPending = false;
+		Trc_MM_FlushUndeadSegments_Entry(env->getLanguageVMThread(), "Concurrent");
+		_extensions->classLoaderManager->flushUndeadSegmentsConcurrently(env, &_forceConcurrentTermination);
+		Trc_MM_FlushUndeadSegments_Exit(env->getLanguageVMThread());
+		/* anything left behind by an interrupted flush is picked up the next time the main thread is idle */
+		_concurrentUndeadSegmentFlushPending = (_extensions->classLoaderManager->reclaimableMemory() > 0);
+		return 0;
+	}
+
 	/* note that we can't check isConcurrentWorkAvailable at this point since another thread could have set _forceConcurrentTermination since the
 	 * main thread calls this outside of the control monitor
 	 */
@@ -2001,7 +2030,13 @@ MM_IncrementalGenerationalGC::mainThreadConcurrentCollect(MM_EnvironmentBase *en
 void
 MM_IncrementalGenerationalGC::postConcurrentUpdateStatsAndReport(MM_EnvironmentBase *env, MM_ConcurrentPhaseStatsBase *stats, UDATA bytesConcurrentlyScanned)
 {
-	Assert_MM_false(isConcurrentWorkAvailable(env));
+	if (_concurrentPhaseIsUndeadSegmentFlush) {
+		Assert_MM_true(NULL == env->_cycleState);
+		_concurrentPhaseIsUndeadSegmentFlush = false;
+		return;
+	}
+
+	Assert_MM_false(isConcurrentGMPWorkAvailable());
 	Assert_MM_true(env->_cycleState == &_persistentGlobalMarkPhaseState);
 	PORT_ACCESS_FROM_ENVIRONMENT(env);
 
@@ -2449,9 +2484,17 @@ MM_IncrementalGenerationalGC::unloadDeadClassLoaders(MM_EnvironmentVLHGC *env)
 		_extensions->classLoaderManager->cleanUpClassLoadersEnd(env, unloadLink);
 		/* we can now flush these since we don't need to walk any dead objects in Balanced */
 		if (_extensions->classLoaderManager->reclaimableMemory() > 0) {
-			Trc_MM_FlushUndeadSegments_Entry(env->getLanguageVMThread(), "Mark Map Completed");
-			_extensions->classLoaderManager->flushUndeadSegments(env);
-			Trc_MM_FlushUndeadSegments_Exit(env->getLanguageVMThread());
+			if (_extensions->tarokEnableConcurrentClassSegmentRelease && !_concurrentUndeadSegmentFlushPending) {
+				/* leave the segments for the main GC thread to free once the pause is over. If segments from an earlier
+				 * cycle are still pending then the main thread has not had a chance to run, so flush everything now
+				 */
+				_concurrentUndeadSegmentFlushPending = true;
+			} else {
+				_concurrentUndeadSegmentFlushPending = false;
+				Trc_MM_FlushUndeadSegments_Entry(env->getLanguageVMThread(), "Mark Map Completed");
+				_extensions->classLoaderManager->flushUndeadSegments(env);
+				Trc_MM_FlushUndeadSegments_Exit(env->getLanguageVMThread());
+			}
 		}
 		classUnloadStats->_endPostTime = j9time_hires_clock();
 
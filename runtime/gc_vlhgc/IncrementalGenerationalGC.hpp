@@ -107,6 +107,8 @@ private:
 	volatile bool _forceConcurrentTermination;	/**< Setting this to true will cause any concurrent GMP work being done for this collector to stop and return.  It is volatile because it is shared state between this and the concurrent task's increment manager */
 	
 	UDATA _globalMarkPhaseIncrementBytesStillToScan;	/**< The number of bytes which must be scanned in the next GMP increment.  This is used by the concurrent GMP task to determine when it can terminate */
+	volatile bool _concurrentUndeadSegmentFlushPending;	/**< Set when class unloading left segments of dead class loaders for the main GC thread to free after the pause */
+	bool _concurrentPhaseIsUndeadSegmentFlush;	/**< True while the current concurrent operation of the main GC thread is freeing undead segments rather than doing GMP work */
 
 private:
 	/* hook routines to be called on AF start and End */
@@ -363,6 +365,11 @@ public:
 	 */
 	virtual bool isConcurrentWorkAvailable(MM_EnvironmentBase *env);
 
+	/**
+	 * @return true if there is concurrent GMP mark work for the main GC thread
+	 */
+	bool isConcurrentGMPWorkAvailable();
+
 	/**
 	 * Called by the MainGCThread while it still owns the GC control monitor in order to allow for the initial population of stats
 	 * and reporting of triggers to occur in-order relative to threads outside the GC.
@@ -236,6 +236,14 @@ public:
 		return OMR_COMPRESS_OBJECT_REFERENCES(_compressObjectReferences);
 	}
 
+	/**
+	 * @return the number of regions whose RSCL overflowed as full (not as stable), and can not be collected until a GMP rebuilds it
+	 */
+	MMINLINE UDATA getOverflowedRegionCount()
+	{
+		return _overflowedRegionCount;
+	}
+
 	/**
 	 *	Setup for partial collect
 	 *	@param env current thread environment
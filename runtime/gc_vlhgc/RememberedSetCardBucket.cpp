@@ -22,6 +22,9 @@
 
 #include "AtomicOperations.hpp"
 #include "CycleState.hpp"
+#include "j9port.h"
+#include "gcutils.h"
+
 #include "HeapRegionManager.hpp"
 #include "InterRegionRememberedSet.hpp"
 #include "RememberedSetCardBucket.hpp"
@@ -76,7 +79,12 @@ MM_RememberedSetCardBucket::addToNewBuffer(MM_EnvironmentVLHGC *env, UDATA card)
 			MM_AtomicOperations::subtract(&_rscl->_bufferCount, 1);
 			_bufferCount -= 1;
 
-			setListAsOverflow(env, _rscl);
+			if (MM_GCExtensions::getExtensions(env)->tarokEnableRememberedSetDeduplication && deduplicate(env)) {
+				/* enough duplicates were removed to make room - retry the add against the smaller list */
+				add(env, card);
+			} else {
+				setListAsOverflow(env, _rscl);
+			}
 		} else {
 			MM_InterRegionRememberedSet *interRegionRememberedSet = MM_GCExtensions::getExtensions(env)->interRegionRememberedSet;
 
@@ -125,6 +133,121 @@ MM_RememberedSetCardBucket::addToNewBuffer(MM_EnvironmentVLHGC *env, UDATA card)
 	Assert_MM_true(_rscl->_bufferCount >= _bufferCount);
 }
 
+/**
+ * Helper function used by J9_SORT to sort the cards of a bucket.
+ *
+ * @param[in] element1 first element to compare
+ * @param[in] element2 second element to compare
+ */
+static int
+compareCardsFunc(const void *element1, const void *element2)
+{
+	UDATA card1 = *(UDATA *)element1;
+	UDATA card2 = *(UDATA *)element2;
+
+	if (card1 == card2) {
+		return 0;
+	} else if (card1 < card2) {
+		return -1;
+	} else {
+		return 1;
+	}
+}
+
+bool
+MM_RememberedSetCardBucket::deduplicate(MM_EnvironmentVLHGC *env)
+{
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env);
+	UDATA size = getSize(env);
+
+	/* a bucket within a single buffer has nothing to gain */
+	if (size <= MAX_BUFFER_SIZE) {
+		return false;
+	}
+
+	if (size > env->_rsclDeduplicationBufferSize) {
+		UDATA newBufferSize = OMR_MIN(OMR_MAX(size, 2 * env->_rsclDeduplicationBufferSize), extensions->tarokRememberedSetCardListMaxSize);
+		if (newBufferSize < size) {
+			return false;
+		}
+		UDATA *newBuffer = (UDATA *)extensions->getForge()->allocate(newBufferSize * sizeof(UDATA), MM_AllocationCategory::REMEMBERED_SET, J9_GET_CALLSITE());
+		if (NULL == newBuffer) {
+			return false;
+		}
+		if (NULL != env->_rsclDeduplicationBuffer) {
+			extensions->getForge()->free(env->_rsclDeduplicationBuffer);
+		}
+		env->_rsclDeduplicationBuffer = newBuffer;
+		env->_rsclDeduplicationBufferSize = newBufferSize;
+	}
+
+	/* gather the cards of all the buffers */
+	bool const compressed = env->compressObjectReferences();
+	UDATA *cards = env->_rsclDeduplicationBuffer;
+	UDATA cardCount = 0;
+	MM_CardBufferControlBlock *cardBufferControlBlock = _cardBufferControlBlockHead;
+	while (NULL != cardBufferControlBlock) {
+		MM_RememberedSetCard *bufferCardList = cardBufferControlBlock->_card;
+		UDATA cardIndexTop = MAX_BUFFER_SIZE;
+		if (isCurrentSlotWithinBuffer(env, bufferCardList)) {
+			cardIndexTop = MM_RememberedSetCard::subtractCardAddresses(_current, bufferCardList, compressed);
+		}
+		for (UDATA cardIndex = 0; cardIndex < cardIndexTop; cardIndex++) {
+			UDATA card = MM_RememberedSetCard::readCard(MM_RememberedSetCard::addToCardAddress(bufferCardList, cardIndex, compressed), compressed);
+			if (0 != card) {
+				cards[cardCount] = card;
+				cardCount += 1;
+			}
+		}
+		cardBufferControlBlock = cardBufferControlBlock->_next;
+	}
+	Assert_MM_true(cardCount <= size);
+
+	J9_SORT(cards, cardCount, sizeof(UDATA), compareCardsFunc);
+	UDATA uniqueCount = 0;
+	for (UDATA i = 0; i < cardCount; i++) {
+		if ((0 == uniqueCount) || (cards[uniqueCount - 1] != cards[i])) {
+			cards[uniqueCount] = cards[i];
+			uniqueCount += 1;
+		}
+	}
+
+	/* only rewrite the bucket if at least a quarter of it is recovered, so that a list which keeps growing with distinct cards
+	 * is not repeatedly sorted just before it overflows anyway
+	 */
+	if ((size - uniqueCount) < (size / 4)) {
+		return false;
+	}
+
+	/* write the distinct cards back from the head of the buffer list */
+	UDATA cardIndex = 0;
+	MM_CardBufferControlBlock *lastUsedCardBufferControlBlock = _cardBufferControlBlockHead;
+	while (cardIndex < uniqueCount) {
+		MM_RememberedSetCard *bufferCardList = lastUsedCardBufferControlBlock->_card;
+		UDATA bufferCardCount = OMR_MIN((UDATA)MAX_BUFFER_SIZE, uniqueCount - cardIndex);
+		for (UDATA i = 0; i < bufferCardCount; i++) {
+			MM_RememberedSetCard::writeCard(MM_RememberedSetCard::addToCardAddress(bufferCardList, i, compressed), cards[cardIndex + i], compressed);
+		}
+		cardIndex += bufferCardCount;
+		if (cardIndex < uniqueCount) {
+			lastUsedCardBufferControlBlock = lastUsedCardBufferControlBlock->_next;
+		} else {
+			_current = MM_RememberedSetCard::addToCardAddress(bufferCardList, bufferCardCount, compressed);
+		}
+	}
+
+	/* release the buffers past the last one used (uniqueCount is not 0 since size exceeded a single buffer) */
+	MM_CardBufferControlBlock *toDeleteCardBufferControlBlock = lastUsedCardBufferControlBlock->_next;
+	lastUsedCardBufferControlBlock->_next = NULL;
+	UDATA releasedCount = extensions->interRegionRememberedSet->releaseCardBufferControlBlockListToLocalPool(env, toDeleteCardBufferControlBlock, UDATA_MAX);
+	Assert_MM_true(releasedCount <= _bufferCount);
+	_bufferCount -= releasedCount;
+	/* other threads may be adding to their own buckets of the same list concurrently */
+	MM_AtomicOperations::subtract(&_rscl->_bufferCount, releasedCount);
+
+	return (0 != releasedCount);
+}
+
 bool
 MM_RememberedSetCardBucket::isRemembered(MM_EnvironmentVLHGC *env, UDATA card)
 {
@@ -72,6 +72,14 @@ private:
 	 * @param buffersToLocalPoolCount max buffers returned to the local pool. typically UDATA_MAX (all goes to local) or MAX_LOCAL_RSCL_BUFFER_POOL_SIZE (small part goes to local, rest to global)
 	 */
 	void releaseBuffers(MM_EnvironmentVLHGC *env, UDATA buffersToLocalPoolCount);
+
+	/**
+	 * Remove duplicate cards from the bucket and release the buffers no longer needed.
+	 * Only the owning thread may call this, while it is adding to the bucket.
+	 * The bucket is left unchanged if too few duplicates are found to be worth rewriting it.
+	 * @return true if buffers were released, false otherwise
+	 */
+	bool deduplicate(MM_EnvironmentVLHGC *env);
 protected:
 public:
 	bool initialize(MM_EnvironmentVLHGC *env, MM_RememberedSetCardList *rscl, MM_RememberedSetCardBucket *next);
@@ -45,6 +45,7 @@
 #include "HeapRegionIteratorVLHGC.hpp"
 #include "HeapRegionManager.hpp"
 #include "IncrementalGenerationalGC.hpp"
+#include "InterRegionRememberedSet.hpp"
 #include "MemoryPoolBumpPointer.hpp"
 
 /* NOTE: old logic for determining incremental thresholds has been deleted. Please 
@@ -86,6 +87,8 @@ MM_SchedulingDelegate::MM_SchedulingDelegate (MM_EnvironmentVLHGC *env, MM_HeapR
 	, _averageCopyForwardBytesDiscarded(0.0)
 	, _averageSurvivorSetRegionCount(0.0)
 	, _averageCopyForwardRate(1.0)
+	, _copyForwardRateMeasured(false)
+	, _predictedCopyForwardMicros(0)
 	, _averageMacroDefragmentationWork(0.0)
 	, _currentMacroDefragmentationWork(0)
 	, _didGMPCompleteSinceLastReclaim(false)
@@ -901,6 +904,7 @@ MM_SchedulingDelegate::copyForwardCompleted(MM_EnvironmentVLHGC *env)
 	
 	_averageSurvivorSetRegionCount = (_averageSurvivorSetRegionCount * historicWeight) + ((double)survivorSetRegionCount * (1.0 - historicWeight));
 	_averageCopyForwardRate = (_averageCopyForwardRate * historicWeight) + (copyForwardRate * (1.0 - historicWeight));
+	_copyForwardRateMeasured = true;
 
 	Trc_MM_SchedulingDelegate_copyForwardCompleted_efficiency(
 		env->getLanguageVMThread(),
@@ -966,6 +970,17 @@ MM_SchedulingDelegate::calculateAutomaticGMPIntermission(MM_EnvironmentVLHGC *en
 			UDATA globalMarkIncrementsRequiredWithHeadroom = globalMarkIncrementsRequired + incrementHeadroom;
 			UDATA globalMarkIncrementsRemaining = partialCollectsRemaining * _extensions->tarokPGCtoGMPDenominator / _extensions->tarokPGCtoGMPNumerator;
 			_remainingGMPIntermissionIntervals = MM_Math::saturatingSubtract(globalMarkIncrementsRemaining, globalMarkIncrementsRequiredWithHeadroom);
+
+			/* regions with overflowed RSCLs are excluded from collection sets until a GMP rebuilds their lists - don't make them wait
+			 * for the heap to run low if enough of them have accumulated
+			 */
+			UDATA kickoffPercent = _extensions->tarokOverflowedRegionsGMPKickoffPercent;
+			if ((0 != kickoffPercent) && (0 < _remainingGMPIntermissionIntervals)) {
+				UDATA overflowedRegionCount = _extensions->interRegionRememberedSet->getOverflowedRegionCount();
+				if ((overflowedRegionCount * 100) >= (_regionManager->getTableRegionCount() * kickoffPercent)) {
+					_remainingGMPIntermissionIntervals = 0;
+				}
+			}
 		}
 	}
 
@@ -1004,6 +1019,9 @@ MM_SchedulingDelegate::calculateEdenSize(MM_EnvironmentVLHGC *env)
 	} else if (desiredEdenCount < edenMinimumCount) {
 		desiredEdenCount = edenMinimumCount;
 	}
+	if (0 != _extensions->tarokTargetPGCPauseMillis) {
+		desiredEdenCount = calculatePauseTargetEdenCount(env, desiredEdenCount, edenMinimumCount);
+	}
 	Trc_MM_SchedulingDelegate_calculateEdenSize_dynamic(env->getLanguageVMThread(), desiredEdenCount, _edenSurvivalRateCopyForward, _nonEdenSurvivalCountCopyForward, freeRegions, edenMinimumCount, edenMaximumCount);
 	if (desiredEdenCount <= freeRegions) {
 		_edenRegionCount = desiredEdenCount;
@@ -1017,6 +1035,34 @@ MM_SchedulingDelegate::calculateEdenSize(MM_EnvironmentVLHGC *env)
 	Trc_MM_SchedulingDelegate_calculateEdenSize_Exit(env->getLanguageVMThread(), (_edenRegionCount * regionSize));
 }
 
+UDATA
+MM_SchedulingDelegate::calculatePauseTargetEdenCount(MM_EnvironmentVLHGC *env, UDATA desiredEdenCount, UDATA edenMinimumCount)
+{
+	UDATA edenCount = desiredEdenCount;
+
+	/* until a copy-forward has been measured the initial rate is only a placeholder, so leave Eden alone */
+	if (_copyForwardRateMeasured && (_averageCopyForwardRate > 0.0)) {
+		double regionSize = (double)_regionManager->getRegionSize();
+		double targetMicros = (double)_extensions->tarokTargetPGCPauseMillis * 1000.0;
+		/* survivors from the rest of the collection set are copied regardless of the Eden size */
+		double nonEdenCopyMicros = ((double)_nonEdenSurvivalCountCopyForward * regionSize) / _averageCopyForwardRate;
+		double edenCopyMicrosPerRegion = (_edenSurvivalRateCopyForward * regionSize) / _averageCopyForwardRate;
+
+		if (targetMicros <= nonEdenCopyMicros) {
+			edenCount = edenMinimumCount;
+		} else if (edenCopyMicrosPerRegion > 0.0) {
+			double maximumEdenCount = (targetMicros - nonEdenCopyMicros) / edenCopyMicrosPerRegion;
+			if (maximumEdenCount < (double)edenCount) {
+				edenCount = (UDATA)maximumEdenCount;
+			}
+		}
+		edenCount = OMR_MAX(edenCount, edenMinimumCount);
+		_predictedCopyForwardMicros = (U_64)(nonEdenCopyMicros + ((double)edenCount * edenCopyMicrosPerRegion));
+	}
+
+	return edenCount;
+}
+
 UDATA
 MM_SchedulingDelegate::currentGlobalMarkIncrementTimeMillis(MM_EnvironmentVLHGC *env) const
 {
@@ -64,6 +64,8 @@ private:
 	double _averageCopyForwardBytesDiscarded; /**< Weighted average of bytes discarded (lost) by the copy-forward scheme */
 	double _averageSurvivorSetRegionCount; /**< Weighted average of survivor regions */
 	double _averageCopyForwardRate; /**< Weighted average of (bytesCopied / timeSpentInCopyForward).  Disregards time spent related RSCL clearing. Measured in bytes/microseconds */
+	bool _copyForwardRateMeasured; /**< True once a copy-forward has completed, so _averageCopyForwardRate reflects a measurement rather than its initial value */
+	U_64 _predictedCopyForwardMicros; /**< Copy-forward time predicted for the next PGC when sizing Eden to meet tarokTargetPGCPauseMillis, 0 if no prediction was made */
 	double _averageMacroDefragmentationWork; /**< Average work to be done to mitigate influx of fragmented regions into the oldest age */
 	UDATA _currentMacroDefragmentationWork;	 /**< As we age out regions and find macro defrag work, we sum it up */
 	bool _didGMPCompleteSinceLastReclaim; /**< true if a GMP completed since the last reclaim cycle */
@@ -201,6 +203,16 @@ private:
 	 */
 	void calculateEdenSize(MM_EnvironmentVLHGC *env);
 
+	/**
+	 * Reduce the Eden size for the next PGC so that the predicted copy-forward time stays within tarokTargetPGCPauseMillis.
+	 * The prediction uses the average copy-forward rate and the running survival averages of Eden and non-Eden regions.
+	 * @param env[in] the main GC thread
+	 * @param desiredEdenCount[in] The Eden size, in regions, chosen without a pause target
+	 * @param edenMinimumCount[in] The smallest Eden size, in regions, which may be returned
+	 * @return the Eden size, in regions, to use for the next PGC
+	 */
+	UDATA calculatePauseTargetEdenCount(MM_EnvironmentVLHGC *env, UDATA desiredEdenCount, UDATA edenMinimumCount);
+
 	/**
 	 * Calculate the new Global Mark increment time given the most recent Partial GC time.
 	 * Attempt to keep the GMP times in line with the times in PGC.  Keep track of a weighted
@@ -299,6 +311,11 @@ public:
 	 */
 	double getAverageCopyForwardRate() { return _averageCopyForwardRate; }
 
+	/**
+	 * @return the copy-forward time in microseconds predicted for the current PGC when Eden was sized for tarokTargetPGCPauseMillis, or 0 if there is no prediction
+	 */
+	U_64 getPredictedCopyForwardMicros() { return _predictedCopyForwardMicros; }
+
 	/*
 	 * Returns the scan time cost (in microseconds) we attribute to performing a GMP.  Attempts to
 	 * factor in stop-the-world global mark increment time as well as any concurrent global marking which
@@ -561,7 +561,7 @@ MM_WriteOnceCompactor::compact(MM_EnvironmentVLHGC *env)
 
 	env->_compactVLHGCStats._fixupStartTime = timeTemp;
 	/* TODO:  Change statistics since fixup is no longer completely distinct from move */
-	fixupArrayletLeafRegionContentsAndObjectLists(env);
+	fixupUnfinalizedObjectLists(env);
 	timeTemp = j9time_hires_clock();
 	env->_compactVLHGCStats._fixupEndTime = timeTemp;
 
@@ -906,6 +906,9 @@ MM_WriteOnceCompactor::moveObjects(MM_EnvironmentVLHGC *env)
 			Card *base = cardTable->heapAddrToCardAddr(env, startAddress);
 			Card *top = cardTable->heapAddrToCardAddr(env, endOfExtent);
 			memset(base, CARD_CLEAN, (UDATA)top - (UDATA)base);
+		} else if (region->_compactData._shouldFixup) {
+			/* leaf regions don't move so their contents can be fixed up while we wait for move work to become available */
+			fixupArrayletLeafRegionContents(env, region);
 		} else if ((MM_CycleState::CT_GLOBAL_GARBAGE_COLLECTION == env->_cycleState->_collectionType) && (region->_criticalRegionsInUse > 0)) {
 			/* in the case of a global collection, mark will have avoided updating the RSCL but this region has pinned objects so the entire region must be walked for fixup */
 			void *lowAddress = region->getLowAddress();
@@ -1316,7 +1319,7 @@ MM_WriteOnceCompactor::fixupPointerArrayObject(MM_EnvironmentVLHGC* env, J9Objec
 	/* object may have moved so ensure that its class loader knows where it is */
 	_extensions->classLoaderRememberedSet->rememberInstance(env, objectPtr);
 
-	/* arraylet leaves are walked separately in fixupArrayletLeafRegionContentsAndObjectLists(), to increase parallelism. Just walk the spine */
+	/* arraylet leaves are walked separately in fixupArrayletLeafRegionContents(), to increase parallelism. Just walk the spine */
 	GC_ArrayletObjectModel::ArrayLayout layout = _extensions->indexableObjectModel.getArrayLayout((J9IndexableObject*)objectPtr);
 		
 	if (GC_ArrayletObjectModel::InlineContiguous == layout) {
@@ -1543,6 +1546,14 @@ MM_WriteOnceCompactor::tagArrayletLeafRegionsForFixup(MM_EnvironmentVLHGC *env)
 						Assert_MM_unreachable();
 					}
 				}
+				if (region->_compactData._shouldFixup) {
+					/* setupMoveWorkStack() ran before tagging, so add the leaf to the fixup-only work list here.  The sync points
+					 * before moveObjects() ensure that the list is complete before any thread pops work from it.
+					 */
+					Assert_MM_true(NULL == region->_compactData._nextInWorkList);
+					region->_compactData._nextInWorkList = _fixupOnlyWorkList;
+					_fixupOnlyWorkList = region;
+				}
 			}
 		}
 	}
@@ -1926,44 +1937,41 @@ MM_WriteOnceCompactor::fixupArrayletLeafRegionSpinePointers()
 }
 
 void
-MM_WriteOnceCompactor::fixupArrayletLeafRegionContentsAndObjectLists(MM_EnvironmentVLHGC* env)
+MM_WriteOnceCompactor::fixupArrayletLeafRegionContents(MM_EnvironmentVLHGC* env, MM_HeapRegionDescriptorVLHGC *region)
 {
 	bool const compressed = env->compressObjectReferences();
+	Assert_MM_true(region->isArrayletLeaf());
+	J9Object* spineObject = (J9Object*)region->_allocateData.getSpine();
+	Assert_MM_true(NULL != spineObject);
+
+	/* spine objects get fixed up later in fixupArrayletLeafRegionSpinePointers(), after a sync point */
+	spineObject = getForwardingPtr(spineObject);
+
+	fj9object_t* slotPointer = (fj9object_t*)region->getLowAddress();
+	fj9object_t* endOfLeaf = (fj9object_t*)region->getHighAddress();
+	while (slotPointer < endOfLeaf) {
+		GC_SlotObject slotObject(_javaVM->omrVM, slotPointer);
+		J9Object *pointer = slotObject.readReferenceFromSlot();
+		if (NULL != pointer) {
+			J9Object *forwardedPtr = getForwardingPtr(pointer);
+			slotObject.writeReferenceToSlot(forwardedPtr);
+			_interRegionRememberedSet->rememberReferenceForCompact(env, spineObject, forwardedPtr);
+		}
+		slotPointer = GC_SlotObject::addToSlotAddress(slotPointer, 1, compressed);
+	}
+
+	/* prove we didn't miss anything at the end */
+	Assert_MM_true(slotPointer == endOfLeaf);
+}
+
+void
+MM_WriteOnceCompactor::fixupUnfinalizedObjectLists(MM_EnvironmentVLHGC* env)
+{
 	GC_HeapRegionIteratorVLHGC regionIterator(_regionManager);
 	MM_HeapRegionDescriptorVLHGC *region = NULL;
 	
 	while(NULL != (region = regionIterator.nextRegion())) {
-		if (region->_compactData._shouldFixup) {  
-			Assert_MM_true(region->isArrayletLeaf());
-			J9Object* spineObject = (J9Object*)region->_allocateData.getSpine();
-			Assert_MM_true(NULL != spineObject);
-
-			/* spine objects get fixed up later in fixupArrayletLeafRegionSpinePointers(), after a sync point */
-			spineObject = getForwardingPtr(spineObject);
-
-			fj9object_t* slotPointer = (fj9object_t*)region->getLowAddress();
-			fj9object_t* endOfLeaf = (fj9object_t*)region->getHighAddress();
-			while (slotPointer < endOfLeaf) {
-				/* TODO: 4096 elements is an arbitrary number */
-				fj9object_t* endPointer = GC_SlotObject::addToSlotAddress(slotPointer, 4096, compressed);
-				if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
-					while (slotPointer < endPointer) {
-						GC_SlotObject slotObject(_javaVM->omrVM, slotPointer);
-						J9Object *pointer = slotObject.readReferenceFromSlot();
-						if (NULL != pointer) {
-							J9Object *forwardedPtr = getForwardingPtr(pointer);
-							slotObject.writeReferenceToSlot(forwardedPtr);
-							_interRegionRememberedSet->rememberReferenceForCompact(env, spineObject, forwardedPtr);
-						}
-						slotPointer = GC_SlotObject::addToSlotAddress(slotPointer, 1, compressed);
-					}
-				}
-				slotPointer = endPointer;
-			}
-				
-			/* prove we didn't miss anything at the end */
-			Assert_MM_true(slotPointer == endOfLeaf);
-		} else if (region->_compactData._shouldCompact) {
+		if (region->_compactData._shouldCompact) {
 			if (!region->getUnfinalizedObjectList()->wasEmpty()) {
 				if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
 					J9Object *pointer = region->getUnfinalizedObjectList()->getPriorList();
@@ -2313,7 +2321,7 @@ MM_WriteOnceCompactor::setupMoveWorkStack(MM_EnvironmentVLHGC *env)
 				endOfQueue = region;
 			}
 		} else if (region->containsObjects()) {
-			/* non-compacted regions which do contain objects need to have their cards cleaned */
+			/* non-compacted regions which do contain objects need to have their cards cleaned (tagged arraylet leaf regions are added by tagArrayletLeafRegionsForFixup()) */
 			if (NULL == endOfFixupQueue) {
 				endOfFixupQueue = region;
 				_fixupOnlyWorkList = region;
@@ -113,7 +113,7 @@ private:
 	omrthread_monitor_t _workListMonitor;  /**< The monitor used to control work sharing of object movement/fixup tasks */
 	MM_HeapRegionDescriptorVLHGC *_readyWorkList;  /**< The root of the list of regions which can have some work done on them */
 	MM_HeapRegionDescriptorVLHGC *_readyWorkListHighPriority;  /**< Like _readyWorkList but is higher priority as it only contains regions which are compact destinations (that is, they block other move operations) */
-	MM_HeapRegionDescriptorVLHGC *_fixupOnlyWorkList;  /**< The root of the list of regions which must have their cards cleaned in order to fixup references into the compact set */
+	MM_HeapRegionDescriptorVLHGC *_fixupOnlyWorkList;  /**< The root of the list of regions which must have their cards cleaned or their arraylet leaf contents fixed up in order to fixup references into the compact set */
 	MM_HeapRegionDescriptorVLHGC *_rebuildWorkList;  /**< The root of the list of regions which must have their previous mark map extents rebuilt (this list is built as the object movement phase completes) */
 	MM_HeapRegionDescriptorVLHGC *_rebuildWorkListHighPriority;	/**< Like _rebuildWorkList but is higher priority as it only contains regions which are compact destinations (that is, they block other rebuild operations) */
 	UDATA _threadsWaiting;  /**< The number of threads waiting for work on _workListMonitor */
@@ -253,13 +253,22 @@ private:
 	void fixupArrayletLeafRegionSpinePointers();
 	
 	/**
-	 * Fix up the data in required arraylet leaf regions, unfinalized lists and ownable synchronizer lists.
+	 * Fix up the slots of an arraylet leaf region tagged for fixup, remembering the references from its (post-move) spine.
+	 * Leaf regions never move and forwarding data is complete once planning is done so this is called from moveObjects()
+	 * by threads waiting for move work, rather than in a distinct phase after all objects have moved.
 	 * @param env[in] the current thread
+	 * @param region[in] the arraylet leaf region to fix up
 	 */
-	void fixupArrayletLeafRegionContentsAndObjectLists(MM_EnvironmentVLHGC* env);
+	void fixupArrayletLeafRegionContents(MM_EnvironmentVLHGC* env, MM_HeapRegionDescriptorVLHGC *region);
+
+	/**
+	 * Fix up the unfinalized object lists of the regions in the compact set.  Must be called after all objects have moved.
+	 * @param env[in] the current thread
+	 */
+	void fixupUnfinalizedObjectLists(MM_EnvironmentVLHGC* env);
 	
 	/**
-	 * Identify any arraylet leaf regions which require fix up and tag them using the _shouldFixup flag.
+	 * Identify any arraylet leaf regions which require fix up, tag them using the _shouldFixup flag and add them to the fixup-only work list.
 	 * This must be called by only one GC thread.
 	 * @param env[in] A GC thread
 	 */
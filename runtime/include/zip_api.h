@@ -52,6 +52,9 @@ extern "C" {
 /* Accept the file as a zip file even if it does not start with a local header */
 #define J9ZIP_OPEN_ALLOW_NONSTANDARD_ZIP 2
 
+/* Map the file into memory, if supported, and read entry data from the mapping. Only valid with a cache pool. */
+#define J9ZIP_OPEN_MAP_FILE 4
+
 /* Empty set of options */
 #define J9ZIP_GETENTRY_NO_FLAGS 0
 
@@ -441,6 +441,11 @@ JVM_FillInStackTrace(JNIEnv* env, jobject throwable)
 			flags |= J9_STACKWALK_HIDE_EXCEPTION_FRAMES;
 			walkState->restartException = unwrappedThrowable;
 		}
+		/* -XX:MaxJavaStackTraceDepth bounds the walk, not just the recorded trace */
+		if (0 != javaVM->maxStackTraceDepth) {
+			flags |= J9_STACKWALK_COUNT_SPECIFIED;
+			walkState->maxFrames = javaVM->maxStackTraceDepth;
+		}
 		walkState->skipCount = 1; /* skip the INL frame -- TODO revisit this */
 #if JAVA_SPEC_VERSION >= 15
 		{
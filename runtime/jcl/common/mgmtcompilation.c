@@ -63,3 +63,65 @@ Java_com_ibm_java_lang_management_internal_CompilationMXBeanImpl_isJITEnabled(JN
 
 	return JNI_FALSE;
 }
+
+/**
+ * Copy the most expensive entries of the JIT compilation cost ledger into the given arrays.
+ *
+ * @param env
+ * @param beanInstance
+ * @param[in] count The maximum number of entries to return
+ * @param[out] methodNames Receives the signature of each method
+ * @param[out] values Receives, for each method, its compilation CPU time (ns), peak scratch memory (bytes),
+ * number of compilations, number of recompilations, number of failed compilations and code size (bytes)
+ * @return the number of entries filled in; 0 if the ledger is not enabled
+ */
+jint JNICALL
+Java_com_ibm_lang_management_internal_CompilationCostMXBeanImpl_getCompilationCostsImpl(JNIEnv *env, jobject beanInstance, jint count, jobjectArray methodNames, jlongArray values)
+{
+	J9JavaVM *javaVM = ((J9VMThread *) env)->javaVM;
+	J9JITConfig *jitConfig = javaVM->jitConfig;
+	J9JITMethodCompilationCost *costs = NULL;
+	UDATA numCosts = 0;
+	UDATA i = 0;
+	PORT_ACCESS_FROM_JAVAVM(javaVM);
+
+	if ((NULL == jitConfig) || (NULL == jitConfig->getCompilationCosts) || (count <= 0)) {
+		return 0;
+	}
+
+	costs = j9mem_allocate_memory(count * sizeof(J9JITMethodCompilationCost), J9MEM_CATEGORY_VM_JCL);
+	if (NULL == costs) {
+		javaVM->internalVMFunctions->throwNativeOOMError(env, 0, 0);
+		return 0;
+	}
+
+	numCosts = jitConfig->getCompilationCosts(jitConfig, costs, (UDATA)count);
+	for (i = 0; i < numCosts; i++) {
+		jlong entryValues[6];
+		jstring methodName = (*env)->NewStringUTF(env, costs[i].methodName);
+
+		if (NULL == methodName) {
+			break;
+		}
+		(*env)->SetObjectArrayElement(env, methodNames, (jsize)i, methodName);
+		(*env)->DeleteLocalRef(env, methodName);
+		if ((*env)->ExceptionCheck(env)) {
+			break;
+		}
+
+		entryValues[0] = (jlong)costs[i].cpuTime;
+		entryValues[1] = (jlong)costs[i].peakScratchMemory;
+		entryValues[2] = (jlong)costs[i].compilations;
+		entryValues[3] = (jlong)costs[i].recompilations;
+		entryValues[4] = (jlong)costs[i].failures;
+		entryValues[5] = (jlong)costs[i].codeSize;
+		(*env)->SetLongArrayRegion(env, values, (jsize)(i * 6), 6, entryValues);
+		if ((*env)->ExceptionCheck(env)) {
+			break;
+		}
+	}
+
+	j9mem_free_memory(costs);
+
+	return (jint)i;
+}
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1998, 2020 IBM Corp. and others
+ * Copyright (c) 1998, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -44,6 +44,7 @@
 #include "j9cp.h"
 #include "jniidcacheinit.h"
 
+#include <stdlib.h>
 #include <string.h>
 
 #include "vmaccess.h"
@@ -103,9 +104,14 @@ typedef struct ThreadInfo {
 	} lockedSynchronizers;
 } ThreadInfo;
 
+typedef struct ThreadInfoByObject {
+	j9object_t threadObject;
+	ThreadInfo *info;
+} ThreadInfoByObject;
+
 typedef struct SynchronizerIterData {
-	ThreadInfo *allinfo;
-	UDATA allinfolen;
+	ThreadInfoByObject *sortedInfo;	/**< examined threads, sorted by thread object address */
+	UDATA sortedInfoLen;
 } SynchronizerIterData;
 
 static void handlerContendedEnter(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
@@ -129,6 +135,7 @@ static IDATA getStackFramePCs(J9VMThread *currentThread, J9VMThread *targetThrea
 static IDATA getMonitors(J9VMThread *currentThread, J9VMThread *targetThread, ThreadInfo *tinfo, UDATA stackLen);
 static UDATA getSynchronizers(J9VMThread *currentThread, ThreadInfo *allinfo, UDATA allinfolen);
 static jvmtiIterationControl getSynchronizersHeapIterator(J9VMThread *vmThread, J9MM_IterateObjectDescriptor *objectDesc, void *userData);
+static int compareThreadInfoByObject(const void *left, const void *right);
 
 static void freeThreadInfos(J9VMThread *currentThread, ThreadInfo *allinfo, UDATA allinfolen);
 static IDATA saveObjectRefs(JNIEnv *env, ThreadInfo *info);
@@ -1485,15 +1492,36 @@ static UDATA
 getSynchronizers(J9VMThread *currentThread, ThreadInfo *allinfo, UDATA allinfolen)
 {
 	J9JavaVM *vm = currentThread->javaVM;
+	PORT_ACCESS_FROM_JAVAVM(vm);
 	J9MemoryManagerFunctions *mmfns = vm->memoryManagerFunctions;
 	SynchronizerIterData data;
 	UDATA exc = 0;
 	jvmtiIterationControl rc;
+	UDATA i;
 	
 	Trc_JCL_threadmxbean_getSynchronizers_Entry(currentThread, allinfo, allinfolen);
 
-	data.allinfo = allinfo;
-	data.allinfolen = allinfolen;
+	/* Objects do not move while exclusive VM access is held, so the owner of each
+	 * synchronizer can be found by a binary search on the thread object address
+	 * instead of a scan of every examined thread.
+	 */
+	data.sortedInfo = NULL;
+	data.sortedInfoLen = 0;
+	if (allinfolen > 0) {
+		data.sortedInfo = j9mem_allocate_memory(sizeof(ThreadInfoByObject) * allinfolen, J9MEM_CATEGORY_VM_JCL);
+		if (NULL == data.sortedInfo) {
+			exc = J9VMCONSTANTPOOL_JAVALANGOUTOFMEMORYERROR;
+			goto done;
+		}
+		for (i = 0; i < allinfolen; ++i) {
+			if (NULL != allinfo[i].thread) {
+				data.sortedInfo[data.sortedInfoLen].threadObject = J9OBJECT_FROM_JOBJECT(allinfo[i].thread);
+				data.sortedInfo[data.sortedInfoLen].info = &allinfo[i];
+				data.sortedInfoLen += 1;
+			}
+		}
+		qsort(data.sortedInfo, data.sortedInfoLen, sizeof(ThreadInfoByObject), compareThreadInfoByObject);
+	}
 
 	/* ensure that all thread-local buffers are flushed */
 	mmfns->j9gc_flush_nonAllocationCaches_for_walk(currentThread->javaVM);	
@@ -1501,7 +1529,9 @@ getSynchronizers(J9VMThread *currentThread, ThreadInfo *allinfo, UDATA allinfole
 	if (rc == JVMTI_ITERATION_ABORT) {
 		exc = J9VMCONSTANTPOOL_JAVALANGOUTOFMEMORYERROR;
 	}
-	
+	j9mem_free_memory(data.sortedInfo);
+
+done:
 	Trc_JCL_threadmxbean_getSynchronizers_Exit(currentThread, exc);
 	return exc;
 }
@@ -1528,7 +1558,6 @@ getSynchronizersHeapIterator(J9VMThread *vmThread, J9MM_IterateObjectDescriptor
 	SynchronizerInfo *sinfo;
 	j9object_t owner;
 	jvmtiIterationControl rc = JVMTI_ITERATION_CONTINUE;
-	UDATA i;
 
 	Assert_JCL_notNull(object);
 
@@ -1543,28 +1572,46 @@ getSynchronizersHeapIterator(J9VMThread *vmThread, J9MM_IterateObjectDescriptor
 	
 	owner = J9VMJAVAUTILCONCURRENTLOCKSABSTRACTOWNABLESYNCHRONIZER_EXCLUSIVEOWNERTHREAD(vmThread, object);
 	if (owner) {
-		/**
-		 * @todo It would be nice to find a better way to get the ThreadInfo
-		 * for the owner thread object.
-		 */
-		for (i = 0; i < data->allinfolen; ++i) {
-			if ((data->allinfo[i].thread != NULL) && (J9OBJECT_FROM_JOBJECT(data->allinfo[i].thread) == owner)) {
-				sinfo = j9mem_allocate_memory(sizeof(SynchronizerInfo), J9MEM_CATEGORY_VM_JCL);
-				if (sinfo) {
-					sinfo->obj.unsafe = object;
-					sinfo->next = data->allinfo[i].lockedSynchronizers.list;
-					data->allinfo[i].lockedSynchronizers.list = sinfo;
-					data->allinfo[i].lockedSynchronizers.len++;
-				} else {
-					rc = JVMTI_ITERATION_ABORT;
-				}
-				break;
+		ThreadInfoByObject key;
+		ThreadInfoByObject *found = NULL;
+
+		key.threadObject = owner;
+		key.info = NULL;
+		found = bsearch(&key, data->sortedInfo, data->sortedInfoLen, sizeof(ThreadInfoByObject), compareThreadInfoByObject);
+		if (NULL != found) {
+			ThreadInfo *ownerInfo = found->info;
+			sinfo = j9mem_allocate_memory(sizeof(SynchronizerInfo), J9MEM_CATEGORY_VM_JCL);
+			if (sinfo) {
+				sinfo->obj.unsafe = object;
+				sinfo->next = ownerInfo->lockedSynchronizers.list;
+				ownerInfo->lockedSynchronizers.list = sinfo;
+				ownerInfo->lockedSynchronizers.len++;
+			} else {
+				rc = JVMTI_ITERATION_ABORT;
 			}
 		}
 	}
 	return rc;
 }
 
+/**
+ * Order ThreadInfoByObject entries by thread object address.
+ * @param[in] left
+ * @param[in] right
+ * @return <0, 0 or >0 as left is below, equal to or above right
+ */
+static int
+compareThreadInfoByObject(const void *left, const void *right)
+{
+	UDATA leftObject = (UDATA)((const ThreadInfoByObject *)left)->threadObject;
+	UDATA rightObject = (UDATA)((const ThreadInfoByObject *)right)->threadObject;
+
+	if (leftObject < rightObject) {
+		return -1;
+	}
+	return (leftObject > rightObject) ? 1 : 0;
+}
+
 /**
  * Allocates and populates owned monitor array.
  * @param[in] currentThread
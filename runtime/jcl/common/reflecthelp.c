@@ -87,9 +87,16 @@ getAnnotationDataAsByteArray(struct J9VMThread *vmThread, U_32 *annotationData)
 		return NULL;
 	}
 
-	/* TODO this is likely horribly inefficient. Rewrite in Builder. */
-	for (i = 0; i < byteCount; ++i) {
-		J9JAVAARRAYOFBYTE_STORE(vmThread, byteArray, i, byteData[i]);
+#if !defined(J9VM_GC_ALWAYS_CALL_OBJECT_ACCESS_BARRIER)
+	/* Annotation data is copied on every request for it - copy contiguous arrays in bulk */
+	if (J9ISCONTIGUOUSARRAY(vmThread, byteArray)) {
+		memcpy(J9JAVAARRAYCONTIGUOUS_EA(vmThread, byteArray, 0, U_8), byteData, byteCount);
+	} else
+#endif /* !defined(J9VM_GC_ALWAYS_CALL_OBJECT_ACCESS_BARRIER) */
+	{
+		for (i = 0; i < byteCount; ++i) {
+			J9JAVAARRAYOFBYTE_STORE(vmThread, byteArray, i, byteData[i]);
+		}
 	}
 
 	return byteArray;
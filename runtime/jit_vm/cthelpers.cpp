@@ -144,15 +144,11 @@ jitGetInterfaceVTableOffsetFromCP(J9VMThread *currentThread, J9ConstantPool *con
 		if (interfaceClass == iTable->interfaceClass) {
 			goto foundITable;
 		}
-		iTable = (J9ITable*)lookupClass->iTable;
-		while (NULL != iTable) {
-			if (interfaceClass == iTable->interfaceClass) {
-				lookupClass->lastITable = iTable;
+		iTable = VM_VMHelpers::findITable(lookupClass, interfaceClass);
+		if (NULL != iTable) {
+			lookupClass->lastITable = iTable;
 foundITable:
-				vTableOffset = ((UDATA*)(iTable + 1))[iTableIndex];
-				break;
-			}
-			iTable = iTable->next;
+			vTableOffset = ((UDATA*)(iTable + 1))[iTableIndex];
 		}
 	}
 	return vTableOffset;
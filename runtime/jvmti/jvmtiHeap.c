@@ -104,6 +104,8 @@ typedef struct J9JVMTIHeapData {
 static UDATA copyObjectTags (J9JVMTIObjectTag * entry, J9JVMTIObjectTagMatch * results);
 static UDATA countObjectTags (J9JVMTIObjectTag * entry, J9JVMTIObjectTagMatch * results);
 static jvmtiIterationControl iterateThroughHeapCallback(J9JavaVM * vm, J9MM_IterateObjectDescriptor *objectDesc, void * userData);
+static jvmtiIterationControl iterateThroughHeapObject(J9JavaVM * vm, j9object_t object, J9JVMTIHeapData * iteratorData);
+static BOOLEAN iterateThroughTaggedObjects(J9JavaVM * vm, J9JVMTIHeapData * iteratorData);
 
 static jvmtiIterationControl wrap_heapReferenceCallback(J9JavaVM * vm, J9JVMTIHeapData * iteratorData);
 static jvmtiIterationControl wrap_heapIterationCallback(J9JavaVM * vm, J9JVMTIHeapData * iteratorData);
@@ -996,6 +998,17 @@ jvmtiFollowRefs_getTags(J9JVMTIHeapData * iteratorData, j9object_t  referrer, j9
 	J9JVMTIObjectTag entry, *result;
 	J9Class *clazz;
 
+	/* Agents commonly walk the heap before tagging anything, in which case every lookup
+	 * below would miss. The table can only change in the callbacks, so check it each time.
+	 */
+	if (0 == hashTableGetCount(iteratorData->env->objectTagTable)) {
+		iteratorData->tags.objectTag = 0;
+		iteratorData->tags.classTag = 0;
+		iteratorData->tags.referrerObjectTag = 0;
+		iteratorData->tags.referrerClassTag = 0;
+		return;
+	}
+
 	/* get the object tag */
 	entry.ref = object;
 	result = hashTableFind(iteratorData->env->objectTagTable, &entry);
@@ -1322,8 +1335,14 @@ jvmtiError JNICALL jvmtiIterateThroughHeap(jvmtiEnv* env,
 		vmFuncs->acquireExclusiveVMAccess(currentThread);
 		ensureHeapWalkable(currentThread);
 
-		/* Walk the heap */
-		vm->memoryManagerFunctions->j9mm_iterate_all_objects(vm, vm->portLibrary, 0, iterateThroughHeapCallback, &iteratorData);
+		/* Only tagged objects can pass JVMTI_HEAP_FILTER_UNTAGGED, so walk the tag table rather
+		 * than the whole heap when it is set. The heap walk remains the fallback.
+		 */
+		if (J9_ARE_NO_BITS_SET(heap_filter, JVMTI_HEAP_FILTER_UNTAGGED)
+			|| !iterateThroughTaggedObjects(vm, &iteratorData)
+		) {
+			vm->memoryManagerFunctions->j9mm_iterate_all_objects(vm, vm->portLibrary, 0, iterateThroughHeapCallback, &iteratorData);
+		}
 		rc = iteratorData.rc;
 
 		vmFuncs->releaseExclusiveVMAccess(currentThread);
@@ -1352,8 +1371,23 @@ done:
 static jvmtiIterationControl
 iterateThroughHeapCallback(J9JavaVM *vm, J9MM_IterateObjectDescriptor *objectDesc, void * userData)
 {
-	j9object_t object = objectDesc->object;
-	J9JVMTIHeapData * iteratorData = userData;
+	return iterateThroughHeapObject(vm, objectDesc->object, (J9JVMTIHeapData *) userData);
+}
+
+
+/** 
+ * \brief      Report a single object to the Iterate Through Heap callbacks
+ * \ingroup    jvmti.heap
+ * 
+ * @param[in] vm             JavaVM structure
+ * @param[in] object         object to report
+ * @param[in] iteratorData   iteration structure containing misc data
+ * @return                   JVMTI_ITERATION_ABORT if the iteration should stop
+ * 
+ */
+static jvmtiIterationControl
+iterateThroughHeapObject(J9JavaVM *vm, j9object_t object, J9JVMTIHeapData * iteratorData)
+{
 	jvmtiIterationControl visitRc = JVMTI_ITERATION_CONTINUE;
 	J9Class *clazz;
 
@@ -1439,6 +1473,55 @@ done:
 }
 
 
+/** 
+ * \brief      Iterate Through Heap using only the objects in the tag table
+ * \ingroup    jvmti.heap
+ * 
+ * @param[in] vm             JavaVM structure
+ * @param[in] iteratorData   iteration structure containing misc data
+ * @return                   FALSE if the table could not be copied and the heap must be walked instead
+ * 
+ *	The callbacks may tag and untag objects, so the tagged objects are copied out of the
+ *	table before any of them are reported. Must be called with exclusive VM access.
+ */
+static BOOLEAN
+iterateThroughTaggedObjects(J9JavaVM *vm, J9JVMTIHeapData * iteratorData)
+{
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	J9HashTable *objectTagTable = iteratorData->env->objectTagTable;
+	UDATA count = hashTableGetCount(objectTagTable);
+	j9object_t *objects = NULL;
+	J9HashTableState walkState;
+	J9JVMTIObjectTag *entry = NULL;
+	UDATA i = 0;
+
+	if (0 == count) {
+		return TRUE;
+	}
+
+	objects = j9mem_allocate_memory(count * sizeof(j9object_t), J9MEM_CATEGORY_JVMTI);
+	if (NULL == objects) {
+		return FALSE;
+	}
+
+	entry = hashTableStartDo(objectTagTable, &walkState);
+	while ((NULL != entry) && (i < count)) {
+		objects[i++] = entry->ref;
+		entry = hashTableNextDo(&walkState);
+	}
+
+	count = i;
+	for (i = 0; i < count; i++) {
+		if (JVMTI_ITERATION_ABORT == iterateThroughHeapObject(vm, objects[i], iteratorData)) {
+			break;
+		}
+	}
+
+	j9mem_free_memory(objects);
+	return TRUE;
+}
+
+
 
 /** 
  * \brief	Wrapper for the Heap Iteration <code>jvmtiHeapIterationCallback</code> user callback 
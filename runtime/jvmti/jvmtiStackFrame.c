@@ -190,6 +190,48 @@ jvmtiGetThreadListStackTraces(jvmtiEnv* env,
 		ENSURE_NON_NEGATIVE(max_frame_count);
 		ENSURE_NON_NULL(stack_info_ptr);
 
+		/* The stack of a single live thread only requires that thread to be halted, not exclusive VM access.
+		 * Invalid, dead or unstarted threads are left to the general case below, which reports them.
+		 */
+		if (1 == thread_count) {
+			jthread thread = *thread_list;
+
+			if ((thread != NULL) && isSameOrSuperClassOf(J9VMJAVALANGTHREAD_OR_NULL(vm), J9OBJECT_CLAZZ(currentThread, *((j9object_t *) thread)))) {
+				J9VMThread * targetThread = NULL;
+
+				if (getVMThread(currentThread, thread, &targetThread, FALSE, TRUE) == JVMTI_ERROR_NONE) {
+					stackInfo = j9mem_allocate_memory(sizeof(jvmtiStackInfo) + (max_frame_count * sizeof(jvmtiFrameInfo)) + sizeof(jlocation), J9MEM_CATEGORY_JVMTI_ALLOCATE);
+					if (stackInfo == NULL) {
+						rc = JVMTI_ERROR_OUT_OF_MEMORY;
+					} else {
+						jvmtiFrameInfo * currentFrameInfo = (jvmtiFrameInfo *) ((((UDATA) (stackInfo + 1)) + sizeof(jlocation)) & ~sizeof(jlocation));
+
+						vm->internalVMFunctions->haltThreadForInspection(currentThread, targetThread);
+						rc = jvmtiInternalGetStackTrace(env,
+						                                currentThread,
+						                                targetThread,
+						                                0,
+						                                (UDATA) max_frame_count,
+						                                (void *) currentFrameInfo,
+						                                &(stackInfo->frame_count));
+						/* The vmthread can't be recycled because getVMThread() prevented it from exiting. */
+						stackInfo->state = getThreadState(currentThread, targetThread->threadObject);
+						vm->internalVMFunctions->resumeThreadForInspection(currentThread, targetThread);
+
+						if (rc == JVMTI_ERROR_NONE) {
+							stackInfo->thread = thread;
+							stackInfo->frame_buffer = currentFrameInfo;
+							rv_stack_info = stackInfo;
+						} else {
+							j9mem_free_memory(stackInfo);
+						}
+					}
+					releaseVMThread(currentThread, targetThread);
+					goto done;
+				}
+			}
+		}
+
 		vm->internalVMFunctions->acquireExclusiveVMAccess(currentThread);
 
 		stackInfo = j9mem_allocate_memory(((sizeof(jvmtiStackInfo) + (max_frame_count * sizeof(jvmtiFrameInfo))) * thread_count) + sizeof(jlocation), J9MEM_CATEGORY_JVMTI_ALLOCATE);
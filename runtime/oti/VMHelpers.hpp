@@ -524,6 +524,44 @@ public:
 		return isSubclass;
 	}
 
+	/**
+	 * Find the iTable for an interface in the iTable chain of a class. Classes with a
+	 * long chain have an iTable selector table which is probed instead of walking the chain.
+	 *
+	 * @param clazz[in] the class whose iTables are searched
+	 * @param interfaceClass[in] the interface class
+	 *
+	 * @returns the iTable for interfaceClass, or NULL if clazz does not implement it
+	 */
+	static VMINLINE J9ITable*
+	findITable(J9Class *clazz, J9Class *interfaceClass)
+	{
+		J9ITable *iTable = NULL;
+		J9ITableSelectorTable *selectorTable = clazz->iTableSelectorTable;
+		if (NULL != selectorTable) {
+			J9ITable **entries = J9ITABLESELECTORTABLE_ENTRIES(selectorTable);
+			UDATA mask = selectorTable->mask;
+			UDATA index = J9ITABLESELECTORTABLE_HASH(interfaceClass) & mask;
+			/* The table is never more than half full, so an empty entry ends every probe */
+			for (;;) {
+				iTable = entries[index];
+				if ((NULL == iTable) || (interfaceClass == iTable->interfaceClass)) {
+					break;
+				}
+				index = (index + 1) & mask;
+			}
+		} else {
+			iTable = (J9ITable*)clazz->iTable;
+			while (NULL != iTable) {
+				if (interfaceClass == iTable->interfaceClass) {
+					break;
+				}
+				iTable = iTable->next;
+			}
+		}
+		return iTable;
+	}
+
 	/**
 	 * Determine if a class is castable to another.  If updateCache is true, the current thread
 	 * must have VM access (or otherwise be blocking the GC) as writes back to classes which might
@@ -564,19 +602,16 @@ retry:
 				if (iTable->interfaceClass == castClass) {
 					goto cacheCastable;
 				}
-				iTable = (J9ITable*)instanceClass->iTable;
-				while (NULL != iTable) {
-					if (iTable->interfaceClass == castClass) {
-						if (updateCache) {
-							instanceClass->lastITable = iTable;
-						}
+				iTable = findITable(instanceClass, castClass);
+				if (NULL != iTable) {
+					if (updateCache) {
+						instanceClass->lastITable = iTable;
+					}
 cacheCastable:
-						if (updateCache) {
-							instanceClass->castClassCache = (UDATA)castClass;
-						}
-						goto done;
+					if (updateCache) {
+						instanceClass->castClassCache = (UDATA)castClass;
 					}
-					iTable = iTable->next;
+					goto done;
 				}
 			} else if (J9CLASS_IS_ARRAY(castClass)) {
 				/* the instanceClass must be an array to continue */
@@ -909,8 +944,10 @@ done:
 	 * @return Size of encoding (1,2,3) on success, 0 on failure
 	 */
 	static VMINLINE UDATA
-	encodeUTF8CharI8(I_8 unicode, U_8 *utfChars)
+	encodeUTF8CharI8(I_8 c, U_8 *utfChars)
 	{
+		/* Latin1 characters are 0x00 to 0xFF; avoid sign extension in the shift below */
+		U_8 unicode = (U_8)c;
 		UDATA length = 1;
 		if ((unicode >= 0x01) && (unicode <= 0x7F)) {
 			utfChars[0] = (U_8)unicode;
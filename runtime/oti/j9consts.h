@@ -340,6 +340,7 @@ extern "C" {
 #define J9_EXTENDED_RUNTIME2_VALUE_BASED_EXCEPTION 0x1000
 #define J9_EXTENDED_RUNTIME2_VALUE_BASED_WARNING 0x2000
 #define J9_EXTENDED_RUNTIME2_LOAD_HEALTHCENTER_MODULE 0x4000
+#define J9_EXTENDED_RUNTIME2_CONSTANT_CLINIT 0x8000
 
 /* TODO: Define this until the JIT removes it */
 #define J9_EXTENDED_RUNTIME_ALLOW_GET_CALLER_CLASS 0
@@ -1032,9 +1032,9 @@ typedef struct J9SharedStartupHintsDataDescriptor {
 	UDATA flags;
 	UDATA heapSize1;
 	UDATA heapSize2;
-	UDATA unused1;
-	UDATA unused2;
-	UDATA unused3;
+	UDATA prefetchSegmentBytes; /* bytes of the ROMClass segment in use at the end of startup */
+	UDATA prefetchMetadataStart; /* offset from the start of the cache of the first metadata accessed during startup */
+	UDATA prefetchMetadataEnd; /* offset from the start of the cache of the last metadata accessed during startup */
 	UDATA unused4;
 	UDATA unused5;
 	UDATA unused6;
@@ -1113,6 +1113,17 @@ typedef struct J9SharedClassJavacoreDataDescriptor {
 	UDATA numObjects;
 	UDATA numStartupHints;
 	UDATA startupHintBytes;
+	/* Runtime counters for this JVM, not stored in the cache */
+	UDATA romClassFinds;
+	UDATA romClassFindHits;
+	UDATA aotMethodFinds;
+	UDATA aotMethodFindHits;
+	UDATA dataFinds;
+	UDATA dataFindHits;
+	UDATA attachedDataFinds;
+	UDATA attachedDataFindHits;
+	UDATA writeMutexEntries;
+	U_64 writeMutexWaitNanos;
 } J9SharedClassJavacoreDataDescriptor;
 
 typedef struct J9SharedStringFarm {
@@ -1240,6 +1251,10 @@ typedef struct J9SharedCacheAPI {
 	U_8 sharedCacheEnabled;
 	U_8 inContainer; /* It is TRUE only when xShareClassesPresent is FALSE and J9_SHARED_CACHE_DEFAULT_BOOT_SHARING(vm) is TRUE and the JVM is running in container */
 	I_8 layer;
+	U_8 prefetchPages; /* TRUE if -Xshareclasses:prefetchPages is specified */
+	U_8 resetWhenStalePercent; /* Value of -Xshareclasses:resetWhenStale=, 0 if not specified */
+	U_8 reproducible; /* TRUE if -Xshareclasses:reproducible is specified */
+	U_8 seal; /* TRUE if -Xshareclasses:seal is specified */
 } J9SharedCacheAPI;
 
 typedef struct J9SharedClassConfig {
@@ -1511,6 +1526,7 @@ typedef struct J9ObjectMonitor {
 #endif /* J9VM_THR_SMART_DEFLATION */
 	j9objectmonitor_t alternateLockword;
 	U_32 hash;
+	U_32 spinYieldRounds;
 } J9ObjectMonitor;
 
 typedef struct J9ClassWalkState {
@@ -1850,6 +1866,8 @@ typedef struct J9TranslationBufferSet {
 #define BCU_ENABLE_INVARIANT_INTERNING  8
 #define BCU_ENABLE_ROMCLASS_RESIZING  0x100
 
+#define J9_BCV_CLASS_CACHE_SIZE  16
+
 typedef struct J9BytecodeVerificationData {
 	IDATA  ( *verifyBytecodesFunction)(struct J9PortLibrary *portLib, struct J9Class *ramClass, struct J9ROMClass *romClass, struct J9BytecodeVerificationData *verifyData) ;
 	UDATA  ( *checkClassLoadingConstraintForNameFunction)(struct J9VMThread* vmThread, struct J9ClassLoader* loader1, struct J9ClassLoader* loader2, U_8* name1, U_8* name2, UDATA length, UDATA copyUTFs) ;
@@ -1902,6 +1920,9 @@ typedef struct J9BytecodeVerificationData {
 	struct J9PortLibrary * portLib;
 	struct J9JavaVM* javaVM;
 	BOOLEAN createdStackMap;
+	struct J9Class* classCache[J9_BCV_CLASS_CACHE_SIZE];
+	UDATA classCacheHits;
+	UDATA classCacheMisses;
 } J9BytecodeVerificationData;
 
 typedef struct J9BytecodeOffset {
@@ -3193,6 +3214,7 @@ typedef struct J9Class {
 #endif /* JAVA_SPEC_VERSION >= 11 */
 	struct J9FlattenedClassCache* flattenedClassCache;
 	struct J9ClassHotFieldsInfo* hotFieldsInfo;
+	struct J9ITableSelectorTable* iTableSelectorTable;
 } J9Class;
 
 /* Interface classes can never be instantiated, so the following fields in J9Class will not be used:
@@ -3282,6 +3304,7 @@ typedef struct J9ArrayClass {
 	/* Added temporarily for consistency */
 	UDATA flattenedElementSize;
 	struct J9ClassHotFieldsInfo* hotFieldsInfo;
+	struct J9ITableSelectorTable* iTableSelectorTable;
 } J9ArrayClass;
 
 
@@ -3679,6 +3702,20 @@ typedef struct J9ITable {
 	struct J9ITable* next;
 } J9ITable;
 
+/* Open addressed hash table of the iTables of a class, keyed by interface class.
+ * It is built when the class is created if its iTable chain is long enough for a
+ * linear walk to be slow, and is followed in memory by (mask + 1) J9ITable pointers,
+ * at most half of which are used. NULL entries are empty.
+ */
+typedef struct J9ITableSelectorTable {
+	UDATA mask;
+} J9ITableSelectorTable;
+
+#define J9ITABLESELECTORTABLE_ENTRIES(table) ((J9ITable **)((table) + 1))
+#define J9ITABLESELECTORTABLE_HASH(interfaceClass) (((UDATA)(interfaceClass)) >> J9_REQUIRED_CLASS_SHIFT)
+/* iTable chains shorter than this are walked rather than hashed */
+#define J9ITABLESELECTORTABLE_MIN_CHAIN_LENGTH 8
+
 typedef struct J9VTableHeader {
 	UDATA size;
 	J9Method* initialVirtualMethod;
@@ -3690,6 +3727,19 @@ typedef struct J9ClassCastParms {
 	struct J9Class* castClass;
 } J9ClassCastParms;
 
+#define J9JIT_COMPILATION_COST_NAME_LENGTH 256
+
+/* One method of the JIT compilation cost ledger, see J9JITConfig.getCompilationCosts */
+typedef struct J9JITMethodCompilationCost {
+	U_64 cpuTime;
+	U_64 peakScratchMemory;
+	U_32 compilations;
+	U_32 recompilations;
+	U_32 failures;
+	U_32 codeSize;
+	char methodName[J9JIT_COMPILATION_COST_NAME_LENGTH];
+} J9JITMethodCompilationCost;
+
 /* @ddr_namespace: map_to_type=J9JITConfig */
 
 typedef struct J9JITConfig {
@@ -3966,6 +4016,7 @@ typedef struct J9JITConfig {
 	I_32  ( *command)(struct J9VMThread *currentThread, const char * cmdString) ;
 	IDATA  ( *compileClass)(struct J9VMThread *jitConfig, jclass clazz) ;
 	IDATA  ( *compileClasses)(struct J9VMThread *jitConfig, const char * pattern) ;
+	UDATA  ( *getCompilationCosts)(struct J9JITConfig *jitConfig, J9JITMethodCompilationCost *costs, UDATA count) ;
 	UDATA fsdEnabled;
 	UDATA inlineFieldWatches;
 	void  ( *jitFramePopNotificationAdded)(struct J9VMThread * currentThread, J9StackWalkState * walkState, UDATA inlineDepth) ;
@@ -5094,6 +5145,19 @@ typedef struct J9VMRuntimeStateListener {
 #define J9VM_RUNTIME_STATE_LISTENER_ABORT 3
 #define J9VM_RUNTIME_STATE_LISTENER_TERMINATED 4
 
+/* @ddr_namespace: map_to_type=J9MapCacheEntry */
+
+/* A local or stack map of at most 32 slots computed for a bytecode PC during a stack walk */
+typedef struct J9MapCacheEntry {
+	struct J9ROMMethod* romMethod;
+	UDATA offsetPC;
+	U_32 slotCount;
+	U_32 bits;
+} J9MapCacheEntry;
+
+#define J9_MAP_CACHE_SIZE 1024
+#define J9_MAP_CACHE_STACK_MAP 0x80000000
+
 /* @ddr_namespace: map_to_type=J9JavaVM */
 
 typedef struct J9JavaVM {
@@ -5240,6 +5304,7 @@ typedef struct J9JavaVM {
 	UDATA thrMaxTryEnterYieldsBeforeBlocking;
 	UDATA thrNestedSpinning;
 	UDATA thrTryEnterNestedSpinning;
+	UDATA thrAdaptiveTryEnterSpinning;
 	UDATA thrDeflationPolicy;
 	UDATA gcOptions;
 	UDATA  ( *unhookVMEvent)(struct J9JavaVM *javaVM, UDATA eventNumber, void * currentHandler, void * oldHandler) ;
@@ -5380,6 +5445,7 @@ typedef struct J9JavaVM {
 	U_8* mapMemoryResultsBuffer;
 	UDATA mapMemoryBufferSize;
 	omrthread_monitor_t mapMemoryBufferMutex;
+	struct J9MapCacheEntry* mapCache;
 	omrthread_monitor_t jclCacheMutex;
 	UDATA arrayletLeafSize;
 	UDATA arrayletLeafLogSize;
@@ -5436,6 +5502,7 @@ typedef struct J9JavaVM {
 	struct J9Pool *customSpinOptions;
 #endif /* J9VM_INTERP_CUSTOM_SPIN_OPTIONS */
 	UDATA romMethodSortThreshold;
+	UDATA maxStackTraceDepth;
 #if defined(J9VM_THR_ASYNC_NAME_UPDATE)
 	IDATA threadNameHandlerKey;
 #endif /* J9VM_THR_ASYNC_NAME_UPDATE */
@@ -5498,6 +5565,7 @@ typedef struct J9JavaVM {
 #define J9VM_DEFLATION_POLICY_ASAP  1
 #define J9VM_IDENTIFIER  (UDATA)0x4A39564D
 #define J9VM_DEFLATION_POLICY_SMART  2
+#define J9VM_ADAPTIVE_SPIN_ROUNDS_SHIFT  3
 #define J9VM_DEBUG_ATTRIBUTE_RECORD_ALL  0x8000
 #define J9VM_DEBUG_ATTRIBUTE_CAN_REDEFINE_CLASSES  0x10000
 #define J9VM_DEBUG_ATTRIBUTE_UNUSED_0x80000  0x80000
@@ -141,11 +141,13 @@
 #define J9SHR_LOCAL_STARTUPHINTS_FLAG_FETCHED	1
 #define J9SHR_LOCAL_STARTUPHINTS_FLAG_STORE_HEAPSIZES	2
 #define J9SHR_LOCAL_STARTUPHINTS_FLAG_OVERWRITE_HEAPSIZES	4
-#define J9SHR_LOCAL_STARTUPHINTS_FLAG_WRITE_HINTS (J9SHR_LOCAL_STARTUPHINTS_FLAG_STORE_HEAPSIZES | J9SHR_LOCAL_STARTUPHINTS_FLAG_OVERWRITE_HEAPSIZES)
-#define J9SHR_LOCAL_STARTUPHINTS_FLAG_OVERWRITE_HINTS (J9SHR_LOCAL_STARTUPHINTS_FLAG_OVERWRITE_HEAPSIZES)
+#define J9SHR_LOCAL_STARTUPHINTS_FLAG_OVERWRITE_PREFETCH_PAGES	8
+#define J9SHR_LOCAL_STARTUPHINTS_FLAG_WRITE_HINTS (J9SHR_LOCAL_STARTUPHINTS_FLAG_STORE_HEAPSIZES | J9SHR_LOCAL_STARTUPHINTS_FLAG_OVERWRITE_HEAPSIZES | J9SHR_LOCAL_STARTUPHINTS_FLAG_OVERWRITE_PREFETCH_PAGES)
+#define J9SHR_LOCAL_STARTUPHINTS_FLAG_OVERWRITE_HINTS (J9SHR_LOCAL_STARTUPHINTS_FLAG_OVERWRITE_HEAPSIZES | J9SHR_LOCAL_STARTUPHINTS_FLAG_OVERWRITE_PREFETCH_PAGES)
 
 /* flags used by J9SharedStartupHintsDataDescriptor->flags */
 #define J9SHR_STARTUPHINTS_HEAPSIZES_SET	1
+#define J9SHR_STARTUPHINTS_PREFETCH_PAGES_SET	2
 
 
 #define J9SHR_LOADTYPE_NORMAL  1
@@ -166,6 +168,10 @@
 #define J9SHR_EXTRA_FLAGS_MPROTECT_PARTIAL_PAGES 0x40
 #define J9SHR_EXTRA_FLAGS_RESTRICT_CLASSPATHS 0x80
 #define J9SHR_EXTRA_FLAGS_MPROTECT_PARTIAL_PAGES_ON_STARTUP 0x100
+/* Cache is full of stale data and is re-created by the next JVM to start up on it */
+#define J9SHR_EXTRA_FLAGS_RESET_MOSTLY_STALE 0x200
+/* Cache was sealed by -Xshareclasses:seal and is not updated by later JVMs */
+#define J9SHR_EXTRA_FLAGS_SEALED 0x400
 
 #define J9SHR_RESOURCE_TYPE_UNKNOWN 0
 #define J9SHR_ATTACHED_DATA_NO_FLAGS 0
@@ -79,6 +79,49 @@ U_32 * j9mapmemory_GetResultsBuffer(void * userData) ;
 */
 void j9mapmemory_ReleaseResultsBuffer(void * userData);
 
+/**
+* @brief Allocate the global cache of local and stack maps computed during stack walks.
+* @param vm
+* @return Void.
+*/
+void j9mapcache_Initialize(J9JavaVM * vm);
+
+/**
+* @brief Free the global map cache.
+* @param vm
+* @return Void.
+*/
+void j9mapcache_Shutdown(J9JavaVM * vm);
+
+/**
+* @brief Discard every map in the global map cache.
+* @param vm
+* @return Void.
+*/
+void j9mapcache_Flush(J9JavaVM * vm);
+
+/**
+* @brief Find a cached map of at most 32 slots.
+* @param vm
+* @param romMethod
+* @param offsetPC
+* @param slotCount number of mapped slots, with J9_MAP_CACHE_STACK_MAP set for pending stack maps
+* @param result set to the map bits if found
+* @return TRUE if the map was found, FALSE otherwise.
+*/
+BOOLEAN j9mapcache_FindMap(J9JavaVM * vm, J9ROMMethod * romMethod, UDATA offsetPC, U_32 slotCount, U_32 * result);
+
+/**
+* @brief Record a computed map of at most 32 slots.
+* @param vm
+* @param romMethod
+* @param offsetPC
+* @param slotCount number of mapped slots, with J9_MAP_CACHE_STACK_MAP set for pending stack maps
+* @param bits the map bits
+* @return Void.
+*/
+void j9mapcache_StoreMap(J9JavaVM * vm, J9ROMMethod * romMethod, UDATA offsetPC, U_32 slotCount, U_32 bits);
+
 
 /* ---------------- fixreturns.c ---------------- */
 
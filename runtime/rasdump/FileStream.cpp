@@ -29,15 +29,29 @@
 FileStream::FileStream(J9PortLibrary* portLibrary) :
 	_PortLibrary(portLibrary),
 	_FileHandle(-1),
-	_Error(0)
+	_Error(0),
+	_Buffer(NULL),
+	_BufferPos(0),
+	_BufferSize(64*1024)
 {
-	/* Nothing to do */
+	/* Binary dumps are written as a long run of 1 to 8 byte fields, so collect them into
+	 * large blocks rather than passing each one to the file cache individually.
+	 */
+	_Buffer = (char *) OMRPORT_FROM_J9PORT(_PortLibrary)->mem_allocate_memory(OMRPORT_FROM_J9PORT(_PortLibrary), _BufferSize, "FileStream::FileStream", OMRMEM_CATEGORY_VM);
+	if (_Buffer == NULL) {
+		_BufferSize = 0;
+	}
 }
 
 /* Destructor */
 FileStream::~FileStream()
 {
 	close();
+
+	if (_Buffer != NULL) {
+		OMRPORT_FROM_J9PORT(_PortLibrary)->mem_free_memory(OMRPORT_FROM_J9PORT(_PortLibrary), _Buffer);
+		_Buffer = NULL;
+	}
 }
 
 /* Method for opening the file */
@@ -47,6 +61,7 @@ FileStream::open(const char* fileName)
 	if (fileName[0] != '-' ) {
 		_FileHandle = j9cached_file_open(_PortLibrary, fileName, EsOpenWrite | EsOpenCreate | EsOpenTruncate | EsOpenCreateNoTag, 0666);
 		_Error = 0;
+		_BufferPos = 0;
 	}
 }
 
@@ -55,6 +70,7 @@ void
 FileStream::close(void)
 {
 	if (_FileHandle != -1) {
+		flush();
 		j9cached_file_sync(_PortLibrary, _FileHandle);
 		j9cached_file_close(_PortLibrary, _FileHandle);
 	}
@@ -62,6 +78,16 @@ FileStream::close(void)
 	_FileHandle = -1;	
 }
 
+/* Method for writing any buffered data to the file */
+void
+FileStream::flush(void)
+{
+	if (_BufferPos != 0) {
+		writeThrough(_Buffer, _BufferPos);
+		_BufferPos = 0;
+	}
+}
+
 /* Methods for getting the object's status */
 bool FileStream::isOpen(void) const
 {
@@ -76,6 +102,29 @@ bool FileStream::hasError(void) const
 /* Method for writing characters described by a pointer and a length to the file*/
 void
 FileStream::writeCharacters(const char* data, IDATA length)
+{
+	if (_FileHandle == -1 || _Error) {
+		return;
+	}
+
+	/* Data that doesn't fit in what remains of the buffer causes a flush; anything at least
+	 * as big as the buffer itself is written straight out.
+	 */
+	if ((UDATA)length > (_BufferSize - _BufferPos)) {
+		flush();
+		if ((UDATA)length >= _BufferSize) {
+			writeThrough(data, length);
+			return;
+		}
+	}
+
+	memcpy(&_Buffer[_BufferPos], data, length);
+	_BufferPos += length;
+}
+
+/* Method for writing data to the file without buffering */
+void
+FileStream::writeThrough(const char* data, IDATA length)
 {
 	if (_FileHandle != -1 && ! _Error) {
 		IDATA rc = j9cached_file_write(_PortLibrary, _FileHandle, data, length);
@@ -45,6 +45,9 @@ public :
 	/* Method for closing the file */
 	void close(void);
 
+	/* Method for writing any buffered data to the file */
+	void flush(void);
+
 	/* Methods for getting the object's status */
 	bool isOpen(void) const;
 	bool hasError(void) const;
@@ -59,11 +62,17 @@ private :
 	FileStream(const FileStream& source);
 	FileStream& operator=(const FileStream& source);
 
+	/* Method for writing data to the file without buffering */
+	void writeThrough(const char* data, IDATA length);
+
 protected :
 	/* Declared data */
 	J9PortLibrary* _PortLibrary;
 	IDATA          _FileHandle;
 	IDATA          _Error;
+	char*          _Buffer;
+	UDATA          _BufferPos;
+	UDATA          _BufferSize;
 };
 
 #endif
@@ -1838,6 +1838,7 @@ printDumpSpec(struct J9JavaVM *vm, IDATA kind, IDATA verboseLevel)
 				j9tty_err_printf(PORTLIB, "  events=<name>        Trigger dump on named events\n"
 					"       [+<name>...]      (see -Xdump:events)\n\n");
 				j9tty_err_printf(PORTLIB, "  filter=[*]<name>[*]  Filter on class (for load)\n"
+					"         [*]<name>[*]  Filter on class of the contended object (for blocked)\n"
 					"         [*]<name>[*]  Filter on exception (for throw,systhrow,uncaught)\n"
 					"         [*]<name>#<class>.<method>[*]  with throwing class and method\n"
 					"         [*]<name>#<class>.<method>#<offset>  with throwing class stack offset\n"
@@ -1166,6 +1166,12 @@ BinaryHeapDumpWriter::BinaryHeapDumpWriter(const char* fileName, J9RASdumpContex
 		stopTimer();
 		*/
 
+		/* Write out any buffered records so that a failure is reported like any other write */
+		if (! _Error) {
+			_OutputStream.flush();
+			checkForIOError();
+		}
+
 		/* Record the status of the operation */
 		_FileMode = _FileMode || _OutputStream.isOpen();
 
@@ -1249,6 +1255,12 @@ BinaryHeapDumpWriter::openNewDumpFile(J9MM_IterateSpaceDescriptor* spaceDescript
 			writeDumpFileTrailer();
 		}
 
+		/* Write out any buffered records so that a failure is reported like any other write */
+		if (! _Error) {
+			_OutputStream.flush();
+			checkForIOError();
+		}
+
 		/* Record the status of the operation */
 		_FileMode = _FileMode || _OutputStream.isOpen();
 
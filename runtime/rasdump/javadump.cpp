@@ -289,6 +289,7 @@ private :
 #if defined(J9VM_OPT_SHARED_CLASSES)
 	void writeSharedClassIPCInfo(const char* textStart, const char* textEnd, IDATA id, UDATA padToLength);
 	void writeSharedClassLockInfo(const char* lockName, IDATA lockSemid, void* lockTID);
+	void writeSharedClassFindStats(const char* text, UDATA finds, UDATA hits);
 	void writeSharedClassSection(void);
 	void writeSharedClassSectionTopLayerStatsHelper(J9SharedClassJavacoreDataDescriptor* javacoreData, bool multiLayerStats);
 	void writeSharedClassSectionTopLayerStatsSummaryHelper(J9SharedClassJavacoreDataDescriptor* javacoreData);
@@ -3123,6 +3124,37 @@ JavaCoreDumpWriter::writeSharedClassSectionTopLayerStatsSummaryHelper(J9SharedCl
 	writeSharedClassLockInfo(
 			"2SCLTEXTCRWL           Cache read/write lock         ", javacoreData->semid, javacoreData->readWriteLockTID
 	);
+
+	_OutputStream.writeCharacters(
+			"NULL\n"
+			"1SCLTEXTCAST       Cache Access Statistics (finds / found)\n"
+			"NULL               ------------------\n"
+	);
+	writeSharedClassFindStats("2SCLTEXTFRC            ROMClasses                                = ", javacoreData->romClassFinds, javacoreData->romClassFindHits);
+	writeSharedClassFindStats("2SCLTEXTFAM            AOT methods                               = ", javacoreData->aotMethodFinds, javacoreData->aotMethodFindHits);
+	writeSharedClassFindStats("2SCLTEXTFBD            Byte data                                 = ", javacoreData->dataFinds, javacoreData->dataFindHits);
+	writeSharedClassFindStats("2SCLTEXTFAD            Attached data                             = ", javacoreData->attachedDataFinds, javacoreData->attachedDataFindHits);
+
+	_OutputStream.writeCharacters(
+			"NULL"
+			"\n2SCLTEXTWME            Write lock entries                        = "
+	);
+	_OutputStream.writeInteger(javacoreData->writeMutexEntries, "%zu");
+	_OutputStream.writeCharacters(
+			"\n2SCLTEXTWMW            Write lock wait time (ms)                 = "
+	);
+	_OutputStream.writeInteger64(javacoreData->writeMutexWaitNanos / 1000000, "%llu");
+	_OutputStream.writeCharacters("\n");
+}
+
+void
+JavaCoreDumpWriter::writeSharedClassFindStats(const char* text, UDATA finds, UDATA hits)
+{
+	_OutputStream.writeCharacters(text);
+	_OutputStream.writeInteger(finds, "%zu");
+	_OutputStream.writeCharacters(" / ");
+	_OutputStream.writeInteger(hits, "%zu");
+	_OutputStream.writeCharacters("\n");
 }
 
 void
@@ -494,7 +494,7 @@ matchesFilter(J9VMThread *vmThread, J9RASdumpEventData *eventData, UDATA eventFl
 		return matchesSlowExclusiveEnterFilter(eventData, filter);
 	} else if (eventFlags & J9RAS_DUMP_ON_VM_SHUTDOWN) {
 		return matchesVMShutdownFilter(eventData, filter);
-	} else if (0 != (eventFlags & (J9RAS_DUMP_EXCEPTION_EVENT_GROUP | J9RAS_DUMP_ON_CLASS_LOAD))) {
+	} else if (0 != (eventFlags & (J9RAS_DUMP_EXCEPTION_EVENT_GROUP | J9RAS_DUMP_ON_CLASS_LOAD | J9RAS_DUMP_ON_THREAD_BLOCKED))) {
 		return matchesExceptionFilter(vmThread, eventData, eventFlags, filter, subFilter);
 	}
 	
@@ -1358,14 +1358,28 @@ rasDumpHookThreadEnd(J9HookInterface** hookInterface, UDATA eventNum, void* even
 static void
 rasDumpHookMonitorContendedEnter(J9HookInterface** hookInterface, UDATA eventNum, void* eventData, void* userData)
 {
+	J9RASdumpEventData dumpData;
 	J9VMMonitorContendedEnterEvent *data = eventData;
 	J9VMThread* vmThread = data->currentThread;
+	j9object_t object = J9WEAKROOT_OBJECT_LOAD(vmThread, &((J9ThreadAbstractMonitor *)data->monitor)->userData);
+
+	/* Report the class of the contended object so that filter= can select the locks of interest */
+	if (NULL != object) {
+		J9UTF8 *className = J9ROMCLASS_CLASSNAME(J9OBJECT_CLAZZ(vmThread, object)->romClass);
+
+		dumpData.detailLength = J9UTF8_LENGTH(className);
+		dumpData.detailData = (char *)J9UTF8_DATA(className);
+	} else {
+		dumpData.detailLength = 0;
+		dumpData.detailData = NULL;
+	}
+	dumpData.exceptionRef = NULL;
 
 	vmThread->javaVM->j9rasDumpFunctions->triggerDumpAgents(
 		vmThread->javaVM, 
 		vmThread, 
 		J9RAS_DUMP_ON_THREAD_BLOCKED, 
-		NULL);
+		&dumpData);
 }
 
 
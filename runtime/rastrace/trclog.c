@@ -2097,15 +2097,20 @@ static void logTracePoint(UtThreadData **thr, UtModuleInfo *modInfo, uint32_t tr
 			}
 		}
 		
-		/* Find and call all registered tracepoint subscribers (public JVMTI interface) */
-		getTraceLock(thr);
-		for (subscription = UT_GLOBAL(tracePointSubscribers); subscription != NULL; subscription = subscription->next) {
-			if (subscription->subscriber != NULL) {
-				COPY_VA_LIST(var, varArgs);
-				callSubscriber(thr, subscription, modInfo, traceId, var);
+		/* Find and call all registered tracepoint subscribers (public JVMTI interface).
+		 * The list is only changed under the trace lock, so an unlocked check is enough to
+		 * avoid serializing every external tracepoint on the lock while nobody is subscribed.
+		 */
+		if (UT_GLOBAL(tracePointSubscribers) != NULL) {
+			getTraceLock(thr);
+			for (subscription = UT_GLOBAL(tracePointSubscribers); subscription != NULL; subscription = subscription->next) {
+				if (subscription->subscriber != NULL) {
+					COPY_VA_LIST(var, varArgs);
+					callSubscriber(thr, subscription, modInfo, traceId, var);
+				}
 			}
+			freeTraceLock(thr);
 		}
-		freeTraceLock(thr);
 	}
 
 	/* Write tracepoint to the global exception buffer. (Usually GC History) */
@@ -242,6 +242,37 @@ SH_CacheMap::dontNeedMetadata(J9VMThread* currentThread)
 		ccToUse->dontNeedMetadata(currentThread);
 		ccToUse = ccToUse->getNext();
 	} while (NULL != ccToUse);
+}
+
+/**
+ * Record the parts of the top layer cache accessed so far into the startup hints.
+ * Must be called before dontNeedMetadata() while the accessed metadata bounds are still meaningful.
+ *
+ * @param [in] currentThread The current JVM thread
+ * @param [out] hints The startup hints to update
+ *
+ * @return true if the hints were updated, false otherwise
+ */
+bool
+SH_CacheMap::getStartupPageRanges(J9VMThread* currentThread, J9SharedStartupHintsDataDescriptor* hints)
+{
+	if (_metadataReleased) {
+		return false;
+	}
+	return _ccHead->getStartupPageRanges(currentThread, &hints->prefetchSegmentBytes, &hints->prefetchMetadataStart, &hints->prefetchMetadataEnd);
+}
+
+/**
+ * Read ahead the parts of the top layer cache recorded in the startup hints of an earlier run.
+ *
+ * @param [in] currentThread The current JVM thread
+ * @param [in] hints The startup hints fetched from the cache
+ */
+void
+SH_CacheMap::prefetchStartupPages(J9VMThread* currentThread, const J9SharedStartupHintsDataDescriptor* hints)
+{
+	Trc_SHR_CM_prefetchStartupPages(currentThread, hints->prefetchSegmentBytes, hints->prefetchMetadataStart, hints->prefetchMetadataEnd);
+	_ccHead->willNeedStartupPages(currentThread, hints->prefetchSegmentBytes, hints->prefetchMetadataStart, hints->prefetchMetadataEnd);
 
 }
 
@@ -521,7 +552,7 @@ SH_CacheMap::startup(J9VMThread* currentThread, J9SharedClassPreinitConfig* pico
 
 				if (storeToCcHead && !isCacheUniqueIdStored && !ccPrevious->isRunningReadOnly()) {
 					if (ccPrevious->enterWriteMutex(currentThread, false, fnName) == 0) {
-						storeCacheUniqueID(currentThread, cacheDirBuf, ccToUse->getCreateTime(), ccToUse->getMetadataBytes(), ccToUse->getClassesBytes(), ccToUse->getLineNumberTableBytes(), ccToUse->getLocalVariableTableBytes(), &cacheUniqueIDPtr, &idLen);
+						storeCacheUniqueID(currentThread, cacheDirBuf, ccToUse->getCacheUniqueIDTime(), ccToUse->getMetadataBytes(), ccToUse->getClassesBytes(), ccToUse->getLineNumberTableBytes(), ccToUse->getLocalVariableTableBytes(), &cacheUniqueIDPtr, &idLen);
 						Trc_SHR_Assert_True(idLen < sizeof(cacheUniqueID));
 						memcpy(cacheUniqueID, cacheUniqueIDPtr, idLen);
 						cacheUniqueID[idLen] = 0;
@@ -2722,6 +2753,8 @@ SH_CacheMap::findROMClass(J9VMThread* currentThread, const char* path, Classpath
 #endif /* !defined(J9ZOS390) && !defined(AIXPPC) */
 	}
 
+	localRCM->recordLookup(NULL != returnVal);
+
 	if (returnVal) {
 		/* Call updateROMSegmentList() to ensure that heapAlloc of the romClass segment is always updated to include the returned romClass */
 		updateROMSegmentList(currentThread, omrthread_monitor_owned_by_self(currentThread->javaVM->classMemorySegments->segmentMutex) != 0);
@@ -3181,6 +3214,7 @@ SH_CacheMap::findCompiledMethod(J9VMThread* currentThread, const J9ROMMethod* ro
 	}
 
 	result = (const U_8*)findROMClassResource(currentThread, romMethod, localCMM, &descriptor, true, NULL, flags);
+	localCMM->recordLookup(NULL != result);
 	if (NULL != result) {
 #if !defined(J9ZOS390) && !defined(AIXPPC)
 		if (_metadataReleased
@@ -3566,6 +3600,7 @@ SH_CacheMap::findAttachedData(J9VMThread* currentThread, const void* addressInCa
 
 	SH_AttachedDataManager::SH_AttachedDataResourceDescriptor descriptor(NULL, 0, (U_16)data->type);
 	result = (const U_8*)findROMClassResource(currentThread, addressInCache, localADM, &descriptor, false, p_subcstr, NULL);
+	localADM->recordLookup(NULL != result);
 	if (NULL != result) {
 		I_32 corrupt;
 		U_32 wrapperLength, dataLength;
@@ -4065,6 +4100,7 @@ SH_CacheMap::findSharedData(J9VMThread* currentThread, const char* key, UDATA ke
 	}
 
 	result = localBDM->find(currentThread, key, keylen, limitDataType, includePrivateData, firstItem, descriptorPool);
+	localBDM->recordLookup(0 < result);
 
 	_ccHead->exitReadMutex(currentThread, fnName);
 
@@ -4286,6 +4322,22 @@ SH_CacheMap::getJavacoreData(J9JavaVM *vm, J9SharedClassJavacoreDataDescriptor*
 		}
 	}
 
+	if (NULL != _rcm) {
+		_rcm->getLookupCounts(&descriptor->romClassFinds, &descriptor->romClassFindHits);
+	}
+	if (NULL != _cmm) {
+		_cmm->getLookupCounts(&descriptor->aotMethodFinds, &descriptor->aotMethodFindHits);
+	}
+	if (NULL != _bdm) {
+		_bdm->getLookupCounts(&descriptor->dataFinds, &descriptor->dataFindHits);
+	}
+	if (NULL != _adm) {
+		_adm->getLookupCounts(&descriptor->attachedDataFinds, &descriptor->attachedDataFindHits);
+	}
+	if (NULL != _ccHead) {
+		_ccHead->getWriteMutexStats(&descriptor->writeMutexEntries, &descriptor->writeMutexWaitNanos);
+	}
+
 	descriptor->romClassBytes += descriptor->unindexedDataBytes;
 	if ((0 >= descriptor->topLayer)
 		|| (true == topLayerOnly)
@@ -5263,6 +5315,10 @@ SH_CacheMap::runExitCode(J9VMThread* currentThread)
 	SH_CompositeCacheImpl* cache = _ccHead;
 
 	printShutdownStats();
+
+	if (0 != currentThread->javaVM->sharedCacheAPI->resetWhenStalePercent) {
+		markCacheForResetIfMostlyStale(currentThread);
+	}
 	
 	walkManager = managers()->startDo(currentThread, 0, &state);
 	while (walkManager) {
@@ -5276,6 +5332,80 @@ SH_CacheMap::runExitCode(J9VMThread* currentThread)
 	}
 }
 
+/**
+ * With -Xshareclasses:resetWhenStale=<percent>, check whether the top layer cache is full and at least
+ * <percent> of its used bytes are stale. If so, mark the cache so that the next JVM to start up on it
+ * destroys and re-creates it, rather than running with a full cache of mostly dead data.
+ *
+ * Stale data cannot be removed from a cache in place, as live ROMClasses may share UTF8 data with stale
+ * ones through SRPs. Re-creating the cache lets the next JVMs repopulate it with only the live classes.
+ *
+ * @param [in] currentThread  The current thread
+ */
+void
+SH_CacheMap::markCacheForResetIfMostlyStale(J9VMThread* currentThread)
+{
+	const char* fnName = "markCacheForResetIfMostlyStale";
+	UDATA percent = currentThread->javaVM->sharedCacheAPI->resetWhenStalePercent;
+	U_32 staleBytes = 0;
+	U_32 usedBytes = 0;
+	ShcItem* it = NULL;
+	PORT_ACCESS_FROM_PORT(_portlib);
+
+	if ((false == _ccHead->isStarted()) || _ccHead->isRunningReadOnly()) {
+		return;
+	}
+
+	Trc_SHR_CM_markCacheForResetIfMostlyStale_Entry(currentThread, percent);
+
+	if (_ccHead->enterWriteMutex(currentThread, false, fnName) != 0) {
+		Trc_SHR_CM_markCacheForResetIfMostlyStale_Exit(currentThread, 0, 0);
+		return;
+	}
+
+	if (_ccHead->isCacheMarkedFull(currentThread)
+		&& (false == _ccHead->isResetMostlyStaleSet(currentThread))
+		&& (0 == enterRefreshMutex(currentThread, fnName))
+	) {
+		/* Read any updates from other JVMs first, so the walk below leaves the cache scan at the end of the metadata */
+		if (-1 == readCacheUpdates(currentThread)) {
+			exitRefreshMutex(currentThread, fnName);
+			_ccHead->exitWriteMutex(currentThread, fnName);
+			Trc_SHR_CM_markCacheForResetIfMostlyStale_Exit(currentThread, 0, 0);
+			return;
+		}
+		_ccHead->findStart(currentThread);
+		do {
+			it = (ShcItem*)_ccHead->nextEntry(currentThread, NULL);		/* Will not skip over stale items */
+			if (NULL != it) {
+				ShcItemHdr* ih = (ShcItemHdr*)ITEMEND(it);
+
+				if (0 != _ccHead->stale((BlockPtr)ih)) {
+					staleBytes += CCITEMLEN(ih);
+					if ((TYPE_ROMCLASS == ITEMTYPE(it)) || (TYPE_SCOPED_ROMCLASS == ITEMTYPE(it))) {
+						J9ROMClass* romClass = (J9ROMClass*)getAddressFromJ9ShrOffset(&(((ROMClassWrapper*)ITEMDATA(it))->romClassOffset));
+
+						if (_ccHead->isAddressInROMClassSegment(romClass)) {
+							staleBytes += romClass->romSize;
+						}
+					}
+				}
+			}
+		} while (NULL != it);
+		exitRefreshMutex(currentThread, fnName);
+
+		usedBytes = _ccHead->getUsedBytes();
+		if (((U_64)staleBytes * 100) >= ((U_64)usedBytes * percent)) {
+			_ccHead->setCacheHeaderExtraFlags(currentThread, J9SHR_EXTRA_FLAGS_RESET_MOSTLY_STALE);
+			CACHEMAP_TRACE2(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE, J9NLS_INFO, J9NLS_SHRC_CM_MARKED_MOSTLY_STALE_CACHE, staleBytes, usedBytes);
+		}
+	}
+
+	_ccHead->exitWriteMutex(currentThread, fnName);
+
+	Trc_SHR_CM_markCacheForResetIfMostlyStale_Exit(currentThread, staleBytes, usedBytes);
+}
+
 /* Note: className can be NULL and if not, is not necessarily null-terminated */
 /* THREADING: Can be called multi-threaded */
 IDATA /*static */
@@ -6685,6 +6815,15 @@ SH_CacheMap::updateLocalHintsData(J9VMThread* currentThread, J9SharedLocalStartu
 			updatedHintsData.flags |= J9SHR_STARTUPHINTS_HEAPSIZES_SET;
 		}
 	}
+	if (J9_ARE_ALL_BITS_SET(localHints->localStartupHintFlags, J9SHR_LOCAL_STARTUPHINTS_FLAG_OVERWRITE_PREFETCH_PAGES)) {
+		if (overwrite) {
+			Trc_SHR_CM_updateLocalHintsData_OverwritePrefetchPages(currentThread, localHints->hintsData.prefetchSegmentBytes, localHints->hintsData.prefetchMetadataStart, localHints->hintsData.prefetchMetadataEnd);
+			updatedHintsData.prefetchSegmentBytes = localHints->hintsData.prefetchSegmentBytes;
+			updatedHintsData.prefetchMetadataStart = localHints->hintsData.prefetchMetadataStart;
+			updatedHintsData.prefetchMetadataEnd = localHints->hintsData.prefetchMetadataEnd;
+			updatedHintsData.flags |= J9SHR_STARTUPHINTS_PREFETCH_PAGES_SET;
+		}
+	}
 	memcpy(&localHints->hintsData, &updatedHintsData, sizeof(J9SharedStartupHintsDataDescriptor));
 }
 
@@ -133,6 +133,10 @@ public:
 
 	void dontNeedMetadata(J9VMThread* currentThread);
 
+	bool getStartupPageRanges(J9VMThread* currentThread, J9SharedStartupHintsDataDescriptor* hints);
+
+	void prefetchStartupPages(J9VMThread* currentThread, const J9SharedStartupHintsDataDescriptor* hints);
+
 	/**
 	 * This function is extremely hot.
 	 * Peeks to see whether compiled code exists for a given ROMMethod in the CompiledMethodManager hashtable
@@ -182,6 +186,8 @@ public:
 	/* @see SharedCache.hpp */
 	virtual void runExitCode(J9VMThread* currentThread);
 
+	void markCacheForResetIfMostlyStale(J9VMThread* currentThread);
+
 	/* @see SharedCache.hpp */
 	virtual void cleanup(J9VMThread* currentThread);
 
@@ -225,6 +225,8 @@ SH_CompositeCacheImpl::commonInit(J9JavaVM* vm)
 	_useWriteHash = false;
 	_reduceStoreContentionDisabled = false;
 	_initializingNewCache = false;
+	_writeMutexEntries = 0;
+	_writeMutexWaitNanos = 0;
 	_minimumAccessedShrCacheMetadata = 0;
 	_maximumAccessedShrCacheMetadata = 0;
 	_layer = 0;
@@ -1156,6 +1158,22 @@ SH_CompositeCacheImpl::startup(J9VMThread* currentThread, J9SharedClassPreinitCo
 					rc = CC_STARTUP_RESET;
 					goto releaseLockCheck;
 				}
+				if (J9_ARE_ALL_BITS_SET(_theca->extraFlags, J9SHR_EXTRA_FLAGS_RESET_MOSTLY_STALE)
+					&& (NULL == _parent)
+					&& !_readOnlyOSCache
+					&& J9_ARE_NO_BITS_SET(*_runtimeFlags, J9SHR_RUNTIMEFLAG_ENABLE_STATS | J9SHR_RUNTIMEFLAG_ENABLE_READONLY)
+				) {
+					/* A previous JVM found the cache full of stale data, re-create it */
+					CC_TRACE(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE, J9NLS_INFO, J9NLS_CC_MOSTLY_STALE_CACHE_RESET);
+					Trc_SHR_CC_startup_resetMostlyStaleCache(currentThread, _theca);
+					rc = CC_STARTUP_RESET;
+					goto releaseLockCheck;
+				}
+				if (J9_ARE_ALL_BITS_SET(_theca->extraFlags, J9SHR_EXTRA_FLAGS_SEALED) && !_readOnlyOSCache) {
+					/* A sealed cache is used as it is, so its contents and CRC stay the same across JVMs */
+					Trc_SHR_CC_startup_sealedCache(currentThread, _theca);
+					*_runtimeFlags |= J9SHR_RUNTIMEFLAG_DENY_CACHE_UPDATES;
+				}
 			}
 
 #if defined(WIN32)
@@ -1590,7 +1608,7 @@ releaseLockCheck:
 		_started = true;
 		/* We don't need to compute the cache id for the top layer. */
 		if ((NULL == cacheMemory) && (NULL != _previous)) {
-			Trc_SHR_CC_startup_getCacheUniqueID_before(currentThread, getCreateTime(), getMetadataBytes(), getClassesBytes(), getLineNumberTableBytes(), getLocalVariableTableBytes());
+			Trc_SHR_CC_startup_getCacheUniqueID_before(currentThread, getCacheUniqueIDTime(), getMetadataBytes(), getClassesBytes(), getLineNumberTableBytes(), getLocalVariableTableBytes());
 			const char* uniqueId = getCacheUniqueID(currentThread);
 			Trc_SHR_CC_startup_getCacheUniqueID_after(currentThread, uniqueId);
 			if (NULL == uniqueId) {
@@ -1879,6 +1897,8 @@ SH_CompositeCacheImpl::enterWriteMutex(J9VMThread* currentThread, bool lockCache
 	IDATA rc;
 	SH_OSCache* oscacheToUse = ((_ccHead == NULL) ? _oscache : _ccHead->_oscache); 
 	const char *fname = "enterWriteMutex";
+	U_64 waitStart = 0;
+	PORT_ACCESS_FROM_PORT(_portlib);
 
 	Trc_SHR_CC_enterWriteMutex_Enter(currentThread, lockCache, caller);
 	
@@ -1896,12 +1916,15 @@ SH_CompositeCacheImpl::enterWriteMutex(J9VMThread* currentThread, bool lockCache
 	Trc_SHR_Assert_NotEquals(currentThread, _commonCCInfo->hasReadWriteMutexThread);
 	Trc_SHR_Assert_NotEquals(currentThread, _commonCCInfo->hasRefreshMutexThread);
 
+	waitStart = j9time_nano_time();
 	if (oscacheToUse) {
 		rc = oscacheToUse->acquireWriteLock(_commonCCInfo->writeMutexID);
 	} else {
 		rc = omrthread_monitor_enter(_utMutex);
 	}
 	if (rc == 0) {
+		_writeMutexEntries += 1;
+		_writeMutexWaitNanos += (j9time_nano_time() - waitStart);
 		_commonCCInfo->hasWriteMutexThread = currentThread;
 		if (*_runtimeFlags & J9SHR_RUNTIMEFLAG_DENY_CACHE_UPDATES) {
 			/*Pass doDecWriteCounter=false b/c exitWriteMutex is being called without updating writerCount*/
@@ -1930,6 +1953,19 @@ SH_CompositeCacheImpl::enterWriteMutex(J9VMThread* currentThread, bool lockCache
 	return rc;
 }
 
+/**
+ * Get the number of times the write mutex has been entered by this JVM and the total time spent waiting to enter it
+ *
+ * @param [out] entries The number of successful enters
+ * @param [out] waitNanos The total time in nanoseconds spent acquiring the mutex
+ */
+void
+SH_CompositeCacheImpl::getWriteMutexStats(UDATA* entries, U_64* waitNanos)
+{
+	*entries = _writeMutexEntries;
+	*waitNanos = _writeMutexWaitNanos;
+}
+
 /**
  * Exit shared semaphore mutex
  *
@@ -3733,6 +3769,11 @@ SH_CompositeCacheImpl::runExitCode(J9VMThread *currentThread)
 		IDATA lockrc = 0;
 		PORT_ACCESS_FROM_PORT(_portlib);
 		if ((lockrc = oscacheToUse->acquireWriteLock(_commonCCInfo->writeMutexID)) == 0) {
+			if ((NULL == _parent) && currentThread->javaVM->sharedCacheAPI->seal && J9_ARE_NO_BITS_SET(_theca->extraFlags, J9SHR_EXTRA_FLAGS_SEALED)) {
+				/* -Xshareclasses:seal, the header has been unprotected above */
+				Trc_SHR_CC_runExitCode_sealCache(currentThread, _theca);
+				_theca->extraFlags |= J9SHR_EXTRA_FLAGS_SEALED;
+			}
 			updateCacheCRC();
 			/* Deny updates so the CRC is not invalidated */
 			*_runtimeFlags |= J9SHR_RUNTIMEFLAG_DENY_CACHE_UPDATES;
@@ -4335,7 +4376,7 @@ SH_CompositeCacheImpl::isMemProtectPartialPagesEnabled(void)
 
 /* THREADING: Pre-req holds the cache write mutex */
 U_32
-SH_CompositeCacheImpl::getCacheCRC(void)
+SH_CompositeCacheImpl::getCacheCRC(void) const
 {
 	U_32 value = 0;
 	U_32 areaForCrcSize;
@@ -4363,7 +4404,7 @@ SH_CompositeCacheImpl::getCacheCRC(void)
 
 /* THREADING: Pre-req holds the cache write mutex */
 U_32
-SH_CompositeCacheImpl::getCacheAreaCRC(U_8* areaStart, U_32 areaSize)
+SH_CompositeCacheImpl::getCacheAreaCRC(U_8* areaStart, U_32 areaSize) const
 {
 	U_32 seed, value, stepsize;
 
@@ -4766,6 +4807,20 @@ SH_CompositeCacheImpl::isRestrictClasspathsSet(J9VMThread *currentThread)
 	return (0 != (this->_theca->extraFlags & J9SHR_EXTRA_FLAGS_RESTRICT_CLASSPATHS));
 }
 
+/**
+ * Checks if the cache has been marked to be re-created on the next startup because it is full of stale data.
+ *
+ * @param [in] currentThread Pointer to J9VMThread structure for the current thread
+ *
+ * @return 	true if J9SHR_EXTRA_FLAGS_RESET_MOSTLY_STALE is set in shared cache header, false otherwise.
+ */
+bool
+SH_CompositeCacheImpl::isResetMostlyStaleSet(J9VMThread *currentThread)
+{
+	Trc_SHR_Assert_True(NULL != this->_theca);
+	return (0 != (this->_theca->extraFlags & J9SHR_EXTRA_FLAGS_RESET_MOSTLY_STALE));
+}
+
 void
 SH_CompositeCacheImpl::setCacheHeaderExtraFlags(J9VMThread* currentThread, UDATA extraFlags)
 {
@@ -5729,6 +5784,70 @@ SH_CompositeCacheImpl::dontNeedMetadata(J9VMThread *currentThread)
 		_oscache->dontNeedMetadata(currentThread, (const void *)min, length);
 	}
 }
+
+/**
+ * Get the parts of the cache accessed so far, as offsets from the start of the cache so
+ * that they can be stored in the startup hints and reused by the JVMs attaching later.
+ *
+ * @param [in] currentThread The current JVM thread
+ * @param [out] segmentBytes The bytes of the ROMClass segment in use
+ * @param [out] metadataStart The offset of the lowest metadata address accessed
+ * @param [out] metadataEnd The offset of the highest metadata address accessed
+ *
+ * @return true if the ranges were found, false otherwise
+ */
+bool
+SH_CompositeCacheImpl::getStartupPageRanges(J9VMThread *currentThread, UDATA *segmentBytes, UDATA *metadataStart, UDATA *metadataEnd)
+{
+	UDATA min = _minimumAccessedShrCacheMetadata;
+	UDATA max = _maximumAccessedShrCacheMetadata;
+
+	if (!_started) {
+		Trc_SHR_Assert_ShouldNeverHappen();
+		return false;
+	}
+	if ((0 == min) || (min >= max)) {
+		return false;
+	}
+
+	*segmentBytes = (UDATA)(SEGUPDATEPTR(_theca) - CASTART(_theca));
+	*metadataStart = min - (UDATA)_theca;
+	*metadataEnd = max - (UDATA)_theca;
+	return true;
+}
+
+/**
+ * Advise the OS that the parts of the cache recorded by getStartupPageRanges() in an earlier
+ * run are about to be used, so that they can be read ahead instead of being faulted in one
+ * page at a time as classes are loaded.
+ *
+ * @param [in] currentThread The current JVM thread
+ * @param [in] segmentBytes The bytes of the ROMClass segment to read ahead
+ * @param [in] metadataStart The offset of the first metadata byte to read ahead
+ * @param [in] metadataEnd The offset of the last metadata byte to read ahead
+ */
+void
+SH_CompositeCacheImpl::willNeedStartupPages(J9VMThread *currentThread, UDATA segmentBytes, UDATA metadataStart, UDATA metadataEnd)
+{
+	if (!_started || (0 == _osPageSize)) {
+		return;
+	}
+
+	/* The cache may have been reset or rebuilt since the hints were stored, only use the parts still in use */
+	BlockPtr segmentStart = CASTART(_theca);
+	BlockPtr segmentEnd = OMR_MIN(segmentStart + segmentBytes, SEGUPDATEPTR(_theca));
+	BlockPtr pageStart = (BlockPtr)ROUND_DOWN_TO(_osPageSize, (UDATA)segmentStart);
+	if (segmentEnd > segmentStart) {
+		_oscache->willNeedPages(currentThread, pageStart, (size_t)(segmentEnd - pageStart));
+	}
+
+	BlockPtr metadataFirst = OMR_MAX(((BlockPtr)_theca) + metadataStart, UPDATEPTR(_theca));
+	BlockPtr metadataLast = OMR_MIN(((BlockPtr)_theca) + metadataEnd, CADEBUGSTART(_theca));
+	pageStart = (BlockPtr)ROUND_DOWN_TO(_osPageSize, (UDATA)metadataFirst);
+	if (metadataLast > metadataFirst) {
+		_oscache->willNeedPages(currentThread, pageStart, (size_t)(metadataLast - pageStart));
+	}
+}
 /**
  * This function changes the permission of the page containing given address by marking the page as read-only or read-write.
  * The address may belong to either segment region, metadata region or class debug data region.
@@ -6607,7 +6726,7 @@ SH_CompositeCacheImpl::getCacheUniqueID(J9VMThread* currentThread) const
 	if (!_started) {
 		return NULL;
 	}
-	return _oscache->getCacheUniqueID(currentThread, getCreateTime(), getMetadataBytes(), getClassesBytes(), getLineNumberTableBytes(), getLocalVariableTableBytes());
+	return _oscache->getCacheUniqueID(currentThread, getCacheUniqueIDTime(), getMetadataBytes(), getClassesBytes(), getLineNumberTableBytes(), getLocalVariableTableBytes());
 }
 
 /**
@@ -6681,6 +6800,22 @@ SH_CompositeCacheImpl::getCreateTime(void) const
 	return _oscache->getCreateTime();
 }
 
+/**
+ * Return the create time field of the cache unique ID. A cache created with -Xshareclasses:reproducible
+ * has a create time of 0, so the CRC of its contents is used instead; otherwise the unique ID of a
+ * reproducible layer would only depend on its name and section sizes.
+ * THREADING: The cache must not be modified concurrently, which is the case for layers below the top layer.
+ */
+U_64
+SH_CompositeCacheImpl::getCacheUniqueIDTime(void) const
+{
+	U_64 createTime = getCreateTime();
+	if (0 == createTime) {
+		createTime = (U_64)getCacheCRC();
+	}
+	return createTime;
+}
+
 bool
 SH_CompositeCacheImpl::hasReadMutex(J9VMThread* currentThread) const
 {
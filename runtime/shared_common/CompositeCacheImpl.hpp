@@ -356,11 +356,19 @@ public:
 	
 	bool isRestrictClasspathsSet(J9VMThread *currentThread);
 
+	bool isResetMostlyStaleSet(J9VMThread *currentThread);
+
+	void getWriteMutexStats(UDATA* entries, U_64* waitNanos);
+
 	bool canStoreClasspaths(void) const;
 
 	IDATA restoreFromSnapshot(J9JavaVM* vm, const char* cacheName, bool* cacheExist);
 	void dontNeedMetadata(J9VMThread *currentThread);
 
+	bool getStartupPageRanges(J9VMThread *currentThread, UDATA *segmentBytes, UDATA *metadataStart, UDATA *metadataEnd);
+
+	void willNeedStartupPages(J9VMThread *currentThread, UDATA segmentBytes, UDATA metadataStart, UDATA metadataEnd);
+
 	void changePartialPageProtection(J9VMThread *currentThread, void *addr, bool readOnly, bool phaseCheck = true);
 
 	void protectPartiallyFilledPages(J9VMThread *currentThread, bool protectSegmentPage = true, bool protectMetadataPage = true, bool protectDebugDataPages = true, bool phaseCheck = true);
@@ -387,6 +395,8 @@ public:
 
 	U_64 getCreateTime(void) const;
 
+	U_64 getCacheUniqueIDTime(void) const;
+
 	bool verifyCacheUniqueID(J9VMThread* currentThread, const char* expectedCacheUniqueID) const;
 	
 	void setMetadataMemorySegment(J9MemorySegment** segment);
@@ -483,6 +493,11 @@ private:
 
 	bool _initializingNewCache;
 
+	/* Number of times the write mutex has been entered and the total time spent waiting for it.
+	 * Only updated while holding the write mutex. */
+	UDATA _writeMutexEntries;
+	U_64 _writeMutexWaitNanos;
+
 	UDATA  _minimumAccessedShrCacheMetadata;
 
 	UDATA _maximumAccessedShrCacheMetadata;
@@ -525,8 +540,8 @@ private:
 	void unprotectMetadataArea();
 	void protectMetadataArea(J9VMThread *currentThread);
 
-	U_32 getCacheCRC(void);
-	U_32 getCacheAreaCRC(U_8* areaStart, U_32 areaSize);
+	U_32 getCacheCRC(void) const;
+	U_32 getCacheAreaCRC(U_8* areaStart, U_32 areaSize) const;
 	void updateCacheCRC(void);
 	bool checkCacheCRC(bool* cacheHasIntegrity, UDATA *crcValue);
 
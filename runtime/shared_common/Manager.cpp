@@ -41,6 +41,10 @@ SH_Manager::SH_Manager()
    _cache(0),
    _htMutex(0),
    _htMutexName("hllTableMutex"),
+   _useReadWriteHashTableLock(false),
+   _htReadWriteMutex(0),
+   _lookupCount(0),
+   _lookupHitCount(0),
    _portlib(0),
    _htEntries(0),
    _runtimeFlagsPtr(0),
@@ -213,6 +217,14 @@ SH_Manager::startup(J9VMThread* currentThread, U_64* runtimeFlags_, UDATA verbos
 		goto _startupFailed;
 	}
 
+	if (_useReadWriteHashTableLock && omrthread_rwmutex_init(&_htReadWriteMutex, 0, "hllTableReadWriteMutex")) {
+		PORT_ACCESS_FROM_PORT(_portlib);
+		_htReadWriteMutex = NULL;
+		M_ERR_TRACE(J9NLS_SHRC_M_FAILED_CREATE_MUTEX);
+		Trc_SHR_M_startup_Exit2(currentThread);
+		goto _startupFailed;
+	}
+
 	if (_cache->enterLocalMutex(currentThread, _htMutex, "_htMutex", "startup")==0) {
 		if (initializeHashTable(currentThread) == -1) {
 			Trc_SHR_M_startup_Exit1(currentThread);
@@ -266,8 +278,14 @@ SH_Manager::cleanup(J9VMThread* currentThread)
 
 	if ((_state == MANAGER_STATE_STARTED) || (_state == MANAGER_STATE_STARTING)) {
 		if (!_htMutex || (_cache->enterLocalMutex(currentThread, _htMutex, "_htMutex", "cleanup")==0)) {
+			if (_htReadWriteMutex) {
+				omrthread_rwmutex_enter_write(_htReadWriteMutex);
+			}
 			tearDownHashTable(currentThread);
 			localPostCleanup(currentThread);
+			if (_htReadWriteMutex) {
+				omrthread_rwmutex_exit_write(_htReadWriteMutex);
+			}
 			_cache->exitLocalMutex(currentThread, _htMutex, "_htMutex", "cleanup");
 		}
 
@@ -277,6 +295,12 @@ SH_Manager::cleanup(J9VMThread* currentThread)
 		}
 	}
 
+	/* Destroyed regardless of _state so that it is not leaked by any startup failure path */
+	if (_htReadWriteMutex) {
+		omrthread_rwmutex_destroy(_htReadWriteMutex);
+		_htReadWriteMutex = NULL;
+	}
+
 	_state = MANAGER_STATE_INITIALIZED;
 	Trc_SHR_M_cleanup_Exit(currentThread);
 }
@@ -300,10 +324,16 @@ SH_Manager::reset(J9VMThread* currentThread)
 
 	if (_state == MANAGER_STATE_STARTED) {
 		if (_cache->enterLocalMutex(currentThread, _htMutex, "_htMutex", "reset")==0) {
+			if (_htReadWriteMutex) {
+				omrthread_rwmutex_enter_write(_htReadWriteMutex);
+			}
 			tearDownHashTable(currentThread);
 			if (initializeHashTable(currentThread) == -1) {
 				returnVal = -1;
 			}
+			if (_htReadWriteMutex) {
+				omrthread_rwmutex_exit_write(_htReadWriteMutex);
+			}
 			_cache->exitLocalMutex(currentThread, _htMutex, "_htMutex", "reset");
 		}
 	}
@@ -372,6 +402,9 @@ SH_Manager::hllTableAdd(J9VMThread* currentThread, const J9Pool* linkPool, const
 		if (_cache->enterLocalMutex(currentThread, _htMutex, "hllTableMutex", "hllTableAdd")==0) {
 			HashLinkedListImpl** rc;
 
+			if (_htReadWriteMutex) {
+				omrthread_rwmutex_enter_write(_htReadWriteMutex);
+			}
 			/* This call will not actually add the new item if there is already an entry of the same key in the hashtable. Instead, the value returned
 				by hashTableAdd is passed back as the addToList parameter. The value returned by this function should then be linked to addToList */
 			if ((rc = (HashLinkedListImpl**)hashTableAdd(_hashTable, &newItem))==NULL) {
@@ -382,6 +415,9 @@ SH_Manager::hllTableAdd(J9VMThread* currentThread, const J9Pool* linkPool, const
 				Trc_SHR_M_hllTableAdd_HashtableAdd(currentThread, rc);
 				*addToList = *rc;
 			}
+			if (_htReadWriteMutex) {
+				omrthread_rwmutex_exit_write(_htReadWriteMutex);
+			}
 
 			_cache->exitLocalMutex(currentThread, _htMutex, "hllTableMutex", "hllTableAdd");
 			break;
@@ -408,9 +444,9 @@ SH_Manager::hllTableLookup(J9VMThread* currentThread, const char* name, U_16 nam
 
 	Trc_SHR_M_hllTableLookup_Entry(currentThread, nameLen, name);
 
-	if (lockHashTable(currentThread, "hllTableLookup")) {
+	if (lockHashTableForRead(currentThread, "hllTableLookup")) {
 		result = hllTableLookupHelper(currentThread, (U_8*)name, nameLen, 0, NULL);
-		unlockHashTable(currentThread, "hllTableLookup");
+		unlockHashTableForRead(currentThread, "hllTableLookup");
 	} else {
 		PORT_ACCESS_FROM_PORT(_portlib);
 		M_ERR_TRACE(J9NLS_SHRC_M_FAILED_ENTER_HTMUTEX);
@@ -493,6 +529,37 @@ SH_Manager::unlockHashTable(J9VMThread* currentThread, const char* funcName)
 	_cache->exitLocalMutex(currentThread, _htMutex, _htMutexName, funcName);
 }
 
+/**
+ * Lock _hashTable for a lookup. When _useReadWriteHashTableLock is set, this takes _htReadWriteMutex
+ * for read instead of entering _htMutex, otherwise this is the same as lockHashTable(). Readers still
+ * briefly enter the monitor inside the rwmutex to update its reader count, but do not hold it for
+ * the duration of the lookup. This is not lock-free, and it blocks while an update is in progress.
+ *
+ * @param currentThread - the currentThread
+ */
+bool
+SH_Manager::lockHashTableForRead(J9VMThread* currentThread, const char* funcName)
+{
+	if (NULL != _htReadWriteMutex) {
+		omrthread_rwmutex_enter_read(_htReadWriteMutex);
+		return true;
+	}
+	return lockHashTable(currentThread, funcName);
+}
+
+/**
+ * @param currentThread - the currentThread
+ */
+void
+SH_Manager::unlockHashTableForRead(J9VMThread* currentThread, const char* funcName)
+{
+	if (NULL != _htReadWriteMutex) {
+		omrthread_rwmutex_exit_read(_htReadWriteMutex);
+	} else {
+		unlockHashTable(currentThread, funcName);
+	}
+}
+
 UDATA
 SH_Manager::generateHash(J9InternalVMFunctions* internalFunctionTable, U_8* key, U_16 keySize)
 {
@@ -566,6 +633,7 @@ SH_Manager::getNumItems(J9VMThread* currentThread, UDATA* nonStaleItems, UDATA*
 		CountData countData(_cache);
 
 		/* WARNING - currentThread can be NULL */
+		/* _htMutex also excludes updates, and unlike the rwmutex it handles a NULL currentThread */
 		if (lockHashTable(currentThread, "getNumItems")) {
 			hashTableForEachDo(_hashTable, _hashTableGetNumItemsDoFn, &countData);
 			unlockHashTable(currentThread, "getNumItems");
@@ -577,6 +645,33 @@ SH_Manager::getNumItems(J9VMThread* currentThread, UDATA* nonStaleItems, UDATA*
 	}
 }
 
+/**
+ * Count a find made for this manager's data
+ *
+ * @param[in] found true if the data was found in the cache
+ */
+void
+SH_Manager::recordLookup(bool found)
+{
+	VM_AtomicSupport::add(&_lookupCount, 1);
+	if (found) {
+		VM_AtomicSupport::add(&_lookupHitCount, 1);
+	}
+}
+
+/**
+ * Get the number of finds made for this manager's data since the JVM started
+ *
+ * @param[out] lookups the number of finds
+ * @param[out] hits the number of finds which found the data
+ */
+void
+SH_Manager::getLookupCounts(UDATA* lookups, UDATA* hits)
+{
+	*lookups = _lookupCount;
+	*hits = _lookupHitCount;
+}
+
 /**
  * Default hashtable item counter.
  * Default implementation works only for managers with one entry per key 
@@ -132,6 +132,10 @@ public:
 	virtual bool storeNew(J9VMThread* currentThread, const ShcItem* itemInCache, SH_CompositeCache* cachelet) = 0;
 	
 	void getNumItems(J9VMThread* currentThread, UDATA* nonStaleItems, UDATA* staleItems);
+
+	void recordLookup(bool found);
+
+	void getLookupCounts(UDATA* lookups, UDATA* hits);
 	
 	IDATA reset(J9VMThread* currentThread);
 	
@@ -154,6 +158,15 @@ protected:
 	SH_SharedCache* _cache;
 	omrthread_monitor_t _htMutex;
 	const char* _htMutexName;
+	/* When set before startup, lookups only take _htReadWriteMutex for read, so concurrent lookups do not
+	 * hold _htMutex while they search the table. They still briefly enter the rwmutex's own monitor.
+	 * Updates still enter _htMutex and then take _htReadWriteMutex for write.
+	 * Only for managers whose hashtable is only accessed through the SH_Manager functions. */
+	bool _useReadWriteHashTableLock;
+	omrthread_rwmutex_t _htReadWriteMutex;
+	/* Number of finds made through SH_CacheMap for this manager's data, and how many of them found it */
+	UDATA _lookupCount;
+	UDATA _lookupHitCount;
 	J9PortLibrary* _portlib;
 	U_32 _htEntries;
 	U_64* _runtimeFlagsPtr;
@@ -207,6 +220,10 @@ protected:
 	bool lockHashTable(J9VMThread* currentThread, const char* funcName);
 	void unlockHashTable(J9VMThread* currentThread, const char* funcName);
 
+	/* Synchronize read-only access to _hashTable */
+	bool lockHashTableForRead(J9VMThread* currentThread, const char* funcName);
+	void unlockHashTableForRead(J9VMThread* currentThread, const char* funcName);
+
 	static UDATA hllHashFn(void* item, void *userData);
 	static UDATA hllHashEqualFn(void* left, void* right, void *userData);
 
@@ -361,6 +361,8 @@ SH_OSCache::commonStartup(J9JavaVM* vm, const char* ctrlDirName, UDATA cacheDirP
 	_createFlags = createFlag;
 	_runtimeFlags = runtimeFlags;
 	_isUserSpecifiedCacheDir = (J9_ARE_ALL_BITS_SET(_runtimeFlags, J9SHR_RUNTIMEFLAG_CACHEDIR_PRESENT));
+	/* With -Xshareclasses:reproducible, do not record times in the cache headers, so the same build creates the same cache file */
+	_reproducible = (NULL != vm->sharedCacheAPI) && (TRUE == vm->sharedCacheAPI->reproducible);
 
 	/* get the cacheDirName for the first time */
 	if (!(_cacheDirName = (char*)j9mem_allocate_memory(J9SH_MAXPATH, J9MEM_CATEGORY_CLASSES))) {
@@ -455,6 +457,12 @@ SH_OSCache::dontNeedMetadata(J9VMThread* currentThread, const void* startAddress
 	return;
 }
 
+/* override if the cache is persistent */
+void
+SH_OSCache::willNeedPages(J9VMThread* currentThread, const void* startAddress, size_t length) {
+	return;
+}
+
 /* Function that initializes class variables common to OSCache subclasses */
 void
 SH_OSCache::commonInit(J9PortLibrary* portLibrary, UDATA generation, I_8 layer)
@@ -480,6 +488,7 @@ SH_OSCache::commonInit(J9PortLibrary* portLibrary, UDATA generation, I_8 layer)
 	_runningReadOnly = false;
 	_doCheckBuildID = false;
 	_isUserSpecifiedCacheDir = false;
+	_reproducible = false;
 }
 
 /* Function that cleans up resources common to OSCache subclasses */
@@ -1032,7 +1041,11 @@ SH_OSCache::initOSCacheHeader(OSCache_header_version_current* header, J9PortShcV
 	header->generation = (U_32)_activeGeneration;
 	header->buildID = getOpenJ9Sha();
 	header->cacheInitComplete = 0;
-	header->createTime = j9time_current_time_nanos(&success);
+	if (_reproducible) {
+		header->createTime = 0;
+	} else {
+		header->createTime = j9time_current_time_nanos(&success);
+	}
 
 	Trc_SHR_OSC_initOSCacheHeader_Exit();
 }
@@ -269,6 +269,8 @@ public:
 	virtual SH_CacheAccess isCacheAccessible(void) const { return J9SH_CACHE_ACCESS_ALLOWED; }
 
 	virtual void  dontNeedMetadata(J9VMThread* currentThread, const void* startAddress, size_t length);
+
+	virtual void  willNeedPages(J9VMThread* currentThread, const void* startAddress, size_t length);
 	
 	virtual IDATA detach(void) = 0;
 
@@ -330,6 +332,7 @@ protected:
 	IDATA _corruptionCode;
 	UDATA _corruptValue;
 	bool _isUserSpecifiedCacheDir;
+	bool _reproducible;
 	
 private:
 	void setEnableVerbose(J9PortLibrary* portLib, J9JavaVM* vm, J9PortShcVersion* versionData, char* cacheNameWithVGen);
@@ -26,6 +26,10 @@
  */
 
 #include <string.h>
+#if defined(LINUX)
+#include <errno.h>
+#include <sys/mman.h>
+#endif /* defined(LINUX) */
 #include "j2sever.h"
 #include "j9cfg.h"
 #include "j9port.h"
@@ -463,6 +467,19 @@ SH_OSCachemmap::dontNeedMetadata(J9VMThread* currentThread, const void* startAdd
 #endif
 }
 
+/**
+ * Advise the OS to read ahead a section of the shared classes cache. The advice is
+ * asynchronous, the pages are read in the background while the JVM starts up.
+ */
+void
+SH_OSCachemmap::willNeedPages(J9VMThread* currentThread, const void* startAddress, size_t length) {
+#if defined(LINUX)
+	if (0 != madvise((void *)startAddress, length, MADV_WILLNEED)) {
+		Trc_SHR_OSC_Mmap_willNeedPages_Failed(currentThread, startAddress, length, errno);
+	}
+#endif /* defined(LINUX) */
+}
+
 /**
  * Destroy a persistent shared classes cache
  *
@@ -1155,6 +1172,10 @@ SH_OSCachemmap::updateLastAttachedTime(OSCachemmap_header_version_current* heade
 		Trc_SHR_OSC_Mmap_updateLastAttachedTime_ReadOnly();
 		return true;
 	}
+	if (_reproducible) {
+		Trc_SHR_OSC_Mmap_updateLastAttachedTime_Reproducible();
+		return true;
+	}
 
 	I_64 newTime = j9time_current_time_millis();
 	Trc_SHR_OSC_Mmap_updateLastAttachedTime_time(newTime, header->lastAttachedTime);
@@ -1184,6 +1205,10 @@ SH_OSCachemmap::updateLastDetachedTime()
 		Trc_SHR_OSC_Mmap_updateLastDetachedTime_ReadOnly();
 		return true;
 	}
+	if (_reproducible) {
+		Trc_SHR_OSC_Mmap_updateLastDetachedTime_Reproducible();
+		return true;
+	}
 
 	newTime = j9time_current_time_millis();
 	Trc_SHR_OSC_Mmap_updateLastDetachedTime_time(newTime, cacheHeader->lastDetachedTime);
@@ -1219,9 +1244,11 @@ SH_OSCachemmap::createCacheHeader(OSCachemmap_header_version_current *cacheHeade
 
 	initOSCacheHeader(&(cacheHeader->oscHdr), versionData, headerLen);
 
-	cacheHeader->createTime = j9time_current_time_millis();
-	cacheHeader->lastAttachedTime = j9time_current_time_millis();
-	cacheHeader->lastDetachedTime = j9time_current_time_millis();
+	if (!_reproducible) {
+		cacheHeader->createTime = j9time_current_time_millis();
+		cacheHeader->lastAttachedTime = j9time_current_time_millis();
+		cacheHeader->lastDetachedTime = j9time_current_time_millis();
+	}
 
 	Trc_SHR_OSC_Mmap_createCacheHeader_header(cacheHeader->eyecatcher,
 													cacheHeader->oscHdr.size,
@@ -94,6 +94,7 @@ public:
 
 	SH_CacheAccess isCacheAccessible(void) const;
 	virtual void dontNeedMetadata(J9VMThread* currentThread, const void* startAddress, size_t length);
+	virtual void willNeedPages(J9VMThread* currentThread, const void* startAddress, size_t length);
 
 protected:
 	virtual void * getAttachedMemory();
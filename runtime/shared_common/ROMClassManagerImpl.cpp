@@ -92,6 +92,9 @@ SH_ROMClassManagerImpl::initialize(J9JavaVM* vm, SH_SharedCache* cache_, SH_Time
 	_tsm = tsm_;
 	_portlib = vm->portLibrary;
 	_htMutex = NULL;
+	/* Every class load looks up this hashtable, and lookups are much more frequent than updates */
+	_useReadWriteHashTableLock = true;
+	_htReadWriteMutex = NULL;
 	_dataTypesRepresented[0] = TYPE_ROMCLASS;
 	_dataTypesRepresented[1] = TYPE_ORPHAN;
 	_dataTypesRepresented[2] = TYPE_SCOPED_ROMCLASS;
@@ -376,6 +376,10 @@ J9SharedClassesOptions J9SHAREDCLASSESOPTIONS[] = {
 	{ OPTION_CREATE_LAYER, PARSE_TYPE_EXACT, RESULT_DO_CREATE_LAYER, 0 },
 #endif /* defined(J9VM_OPT_MULTI_LAYER_SHARED_CLASS_CACHE) */
 	{ OPTION_NO_PERSISTENT_DISK_SPACE_CHECK, PARSE_TYPE_EXACT, RESULT_DO_ADD_RUNTIMEFLAG, J9SHR_RUNTIMEFLAG_NO_PERSISTENT_DISK_SPACE_CHECK},
+	{ OPTION_PREFETCH_PAGES, PARSE_TYPE_EXACT, RESULT_DO_PREFETCH_PAGES, 0},
+	{ OPTION_RESET_WHEN_STALE_EQUALS, PARSE_TYPE_STARTSWITH, RESULT_DO_RESET_WHEN_STALE_EQUALS, 0},
+	{ OPTION_REPRODUCIBLE, PARSE_TYPE_EXACT, RESULT_DO_REPRODUCIBLE, 0},
+	{ OPTION_SEAL, PARSE_TYPE_EXACT, RESULT_DO_SEAL, 0},
 	{ NULL, 0, 0 }
 };
 
@@ -402,6 +406,8 @@ static J9Module* getModule(J9VMThread* vmThread, U_8* className, UDATA className
 static bool isFreeDiskSpaceLow(J9JavaVM *vm, U_64* maxsize, U_64 runtimeFlags);
 static char* generateStartupHintsKey(J9JavaVM *vm);
 static void fetchStartupHintsFromSharedCache(J9VMThread* vmThread);
+static void recordStartupPages(J9VMThread* currentThread);
+static void prefetchStartupPages(J9VMThread* currentThread);
 static void findExistingCacheLayerNumbers(J9JavaVM* vm, const char* ctrlDirName, const char* cacheName, U_64 runtimeFlags, I_8 *maxLayerNo);
 
 typedef struct J9SharedVerifyStringTable {
@@ -692,6 +698,38 @@ parseArgs(J9JavaVM* vm, char* options, U_64* runtimeFlags, UDATA* verboseFlags,
 			vm->sharedCacheAPI->layer = SHRINIT_CREATE_NEW_LAYER;
 			break;
 		}
+		case RESULT_DO_PREFETCH_PAGES:
+		{
+			vm->sharedCacheAPI->prefetchPages = TRUE;
+			break;
+		}
+		case RESULT_DO_RESET_WHEN_STALE_EQUALS:
+		{
+			UDATA temp = 0;
+			char* percentString = options + strlen(OPTION_RESET_WHEN_STALE_EQUALS);
+			char* cursor = percentString;
+			if ((scan_udata(&cursor, &temp) == 0)
+				&& (temp > 0)
+				&& (temp <= 100)
+			) {
+				vm->sharedCacheAPI->resetWhenStalePercent = (U_8)temp;
+			} else {
+				SHRINIT_ERR_TRACE2(1, J9NLS_SHRC_SHRINIT_OPTION_INVALID_PERCENTAGE, temp, OPTION_RESET_WHEN_STALE_EQUALS);
+				return RESULT_PARSE_FAILED;
+			}
+			options += strlen(OPTION_RESET_WHEN_STALE_EQUALS)+ (cursor - percentString) +1;
+			continue;
+		}
+		case RESULT_DO_REPRODUCIBLE:
+		{
+			vm->sharedCacheAPI->reproducible = TRUE;
+			break;
+		}
+		case RESULT_DO_SEAL:
+		{
+			vm->sharedCacheAPI->seal = TRUE;
+			break;
+		}
 		case RESULT_DO_ADJUST_SOFTMX_EQUALS:
 		case RESULT_DO_ADJUST_MINAOT_EQUALS:
 		case RESULT_DO_ADJUST_MAXAOT_EQUALS:
@@ -3805,6 +3843,12 @@ j9shr_lateInit(J9JavaVM *vm, UDATA* nonfatal)
 		} else {
 			/* If bytecode agent has hooked, try to detect this early on... this is also tested on each class load */
 			testForBytecodeModification(vm);
+			if (vm->sharedCacheAPI->prefetchPages) {
+				J9VMThread* currentThread = vm->internalVMFunctions->currentVMThread(vm);
+				if (NULL != currentThread) {
+					prefetchStartupPages(currentThread);
+				}
+			}
 			returnVal = J9VMDLLMAIN_OK;
 		}
 	}
@@ -4916,7 +4960,11 @@ j9shr_jvmPhaseChange(J9VMThread *currentThread, UDATA phase)
 
 		/* OpenJ9 issue; https://github.com/eclipse/openj9/issues/3743
 		 * GC decides whether to calls vm->sharedClassConfig->storeGCHints() to store the GC hints into the shared cache. */
-		storeStartupHintsToSharedCache(currentThread);
+		recordStartupPages(currentThread);
+		/* Startup hints depend on the heap sizes of this run, so they are not stored when building a reproducible cache */
+		if (!vm->sharedCacheAPI->reproducible) {
+			storeStartupHintsToSharedCache(currentThread);
+		}
 		if (J9_ARE_NO_BITS_SET(vm->sharedClassConfig->runtimeFlags, J9SHR_RUNTIMEFLAG_MPROTECT_PARTIAL_PAGES_ON_STARTUP)) {
 			((SH_CacheMap*)vm->sharedClassConfig->sharedClassCache)->protectPartiallyFilledPages(currentThread);
 		}
@@ -5208,6 +5256,48 @@ storeStartupHintsToSharedCache(J9VMThread* currentThread)
 	return ret;
 }
 
+/**
+ * With -Xshareclasses:prefetchPages, record the parts of the shared cache accessed during startup into
+ * vm->sharedClassConfig->localStartupHints.hintsData, unless an earlier run with the same command line already did.
+ * Called at the end of startup, before the accessed metadata is released.
+ * @param[in] currentThread  The current VM thread
+ */
+static void
+recordStartupPages(J9VMThread* currentThread)
+{
+	J9JavaVM* vm = currentThread->javaVM;
+
+	if (!vm->sharedCacheAPI->prefetchPages) {
+		return;
+	}
+	fetchStartupHintsFromSharedCache(currentThread);
+	if (J9_ARE_NO_BITS_SET(vm->sharedClassConfig->localStartupHints.hintsData.flags, J9SHR_STARTUPHINTS_PREFETCH_PAGES_SET)) {
+		J9SharedStartupHintsDataDescriptor* hints = &vm->sharedClassConfig->localStartupHints.hintsData;
+		if (((SH_CacheMap*)vm->sharedClassConfig->sharedClassCache)->getStartupPageRanges(currentThread, hints)) {
+			hints->flags |= J9SHR_STARTUPHINTS_PREFETCH_PAGES_SET;
+			/* The hints may already be in the cache with only the heap sizes set */
+			vm->sharedClassConfig->localStartupHints.localStartupHintFlags |= J9SHR_LOCAL_STARTUPHINTS_FLAG_OVERWRITE_PREFETCH_PAGES;
+			Trc_SHR_INIT_recordStartupPages(currentThread, hints->prefetchSegmentBytes, hints->prefetchMetadataStart, hints->prefetchMetadataEnd);
+		}
+	}
+}
+
+/**
+ * With -Xshareclasses:prefetchPages, read ahead the parts of the shared cache recorded by recordStartupPages()
+ * in an earlier run, so that they do not have to be faulted in one page at a time while classes are loaded.
+ * @param[in] currentThread  The current VM thread
+ */
+static void
+prefetchStartupPages(J9VMThread* currentThread)
+{
+	J9JavaVM* vm = currentThread->javaVM;
+
+	fetchStartupHintsFromSharedCache(currentThread);
+	if (J9_ARE_ALL_BITS_SET(vm->sharedClassConfig->localStartupHints.hintsData.flags, J9SHR_STARTUPHINTS_PREFETCH_PAGES_SET)) {
+		((SH_CacheMap*)vm->sharedClassConfig->sharedClassCache)->prefetchStartupPages(currentThread, &vm->sharedClassConfig->localStartupHints.hintsData);
+	}
+}
+
 /**
  * Stores the GC hints into vm->sharedClassConfig->localStartupHints.hintsData. This function is not thread safe.
  * @param[in] vmThread  The current thread
@@ -194,6 +194,10 @@ typedef struct J9SharedClassesOptions {
 #define OPTION_LAYER_EQUALS "layer="
 #define OPTION_CREATE_LAYER "createLayer"
 #define OPTION_NO_PERSISTENT_DISK_SPACE_CHECK "noPersistentDiskSpaceCheck"
+#define OPTION_PREFETCH_PAGES "prefetchPages"
+#define OPTION_RESET_WHEN_STALE_EQUALS "resetWhenStale="
+#define OPTION_REPRODUCIBLE "reproducible"
+#define OPTION_SEAL "seal"
 
 /* public options for printallstats= and printstats=  */
 #define SUB_OPTION_PRINTSTATS_ALL "all"
@@ -274,6 +278,10 @@ typedef struct J9SharedClassesOptions {
 #define RESULT_DO_CREATE_LAYER 52
 #define RESULT_DO_PRINT_TOP_LAYER_STATS 53
 #define RESULT_DO_PRINT_TOP_LAYER_STATS_EQUALS 54
+#define RESULT_DO_PREFETCH_PAGES 55
+#define RESULT_DO_RESET_WHEN_STALE_EQUALS 56
+#define RESULT_DO_REPRODUCIBLE 57
+#define RESULT_DO_SEAL 58
 
 #define PARSE_TYPE_EXACT 1
 #define PARSE_TYPE_STARTSWITH 2
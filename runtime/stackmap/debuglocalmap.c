@@ -692,4 +692,6 @@ void
 installDebugLocalMapper(J9JavaVM * vm)
 {
 	vm->localMapFunction = j9localmap_DebugLocalBitsForPC;
+	/* Maps cached from the non-debug local mapper no longer apply */
+	j9mapcache_Flush(vm);
 }
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2019 IBM Corp. and others
+ * Copyright (c) 1991, 2020 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -22,6 +22,7 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include "j9.h"
 #include "thread_api.h"
 #include "ut_map.h"
@@ -130,3 +131,143 @@ j9mapmemory_ReleaseResultsBuffer(void * userData)
 	}
 }
 
+
+/*
+ *
+ * Select the map cache entry for a map
+ *
+ */
+
+static J9MapCacheEntry *
+mapCacheEntryFor(J9JavaVM *vm, J9ROMMethod *romMethod, UDATA offsetPC, U_32 slotCount)
+{
+	UDATA index = (((UDATA)romMethod) >> 3) ^ (offsetPC * 31) ^ (UDATA)slotCount;
+
+	return vm->mapCache + (index & (J9_MAP_CACHE_SIZE - 1));
+}
+
+/*
+ *
+ * Discard every cached map. ROM methods may be freed or replaced when classes are
+ * unloaded or redefined, so the cache is emptied rather than searched.
+ *
+ */
+
+static void
+mapCacheFlushHook(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData)
+{
+	j9mapcache_Flush((J9JavaVM *) userData);
+}
+
+/*
+ *
+ * Allocate the global map cache. Failure is not fatal, the maps are simply computed on every lookup.
+ *
+ */
+
+void
+j9mapcache_Initialize(J9JavaVM *vm)
+{
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	J9HookInterface **vmHooks = vm->internalVMFunctions->getVMHookInterface(vm);
+	J9MapCacheEntry *mapCache = (J9MapCacheEntry *) j9mem_allocate_memory(J9_MAP_CACHE_SIZE * sizeof(J9MapCacheEntry), OMRMEM_CATEGORY_VM);
+
+	if (NULL != mapCache) {
+		memset(mapCache, 0, J9_MAP_CACHE_SIZE * sizeof(J9MapCacheEntry));
+		if ((0 != (*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_VM_CLASSES_REDEFINED, mapCacheFlushHook, OMR_GET_CALLSITE(), vm))
+#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+		|| (0 != (*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_VM_CLASSES_UNLOAD, mapCacheFlushHook, OMR_GET_CALLSITE(), vm))
+#endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
+		) {
+			(*vmHooks)->J9HookUnregister(vmHooks, J9HOOK_VM_CLASSES_REDEFINED, mapCacheFlushHook, vm);
+			j9mem_free_memory(mapCache);
+			mapCache = NULL;
+		}
+	}
+	Trc_Map_j9mapcache_Initialize(mapCache, (UDATA) J9_MAP_CACHE_SIZE);
+	vm->mapCache = mapCache;
+}
+
+/*
+ *
+ * Free the global map cache
+ *
+ */
+
+void
+j9mapcache_Shutdown(J9JavaVM *vm)
+{
+	if (NULL != vm->mapCache) {
+		PORT_ACCESS_FROM_JAVAVM(vm);
+		J9HookInterface **vmHooks = vm->internalVMFunctions->getVMHookInterface(vm);
+
+		(*vmHooks)->J9HookUnregister(vmHooks, J9HOOK_VM_CLASSES_REDEFINED, mapCacheFlushHook, vm);
+#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+		(*vmHooks)->J9HookUnregister(vmHooks, J9HOOK_VM_CLASSES_UNLOAD, mapCacheFlushHook, vm);
+#endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
+		j9mem_free_memory(vm->mapCache);
+		vm->mapCache = NULL;
+	}
+}
+
+/*
+ *
+ * Discard every map in the global map cache
+ *
+ */
+
+void
+j9mapcache_Flush(J9JavaVM *vm)
+{
+	if (NULL != vm->mapCache) {
+		omrthread_monitor_enter(vm->mapMemoryBufferMutex);
+		memset(vm->mapCache, 0, J9_MAP_CACHE_SIZE * sizeof(J9MapCacheEntry));
+		Trc_Map_j9mapcache_Flush();
+		omrthread_monitor_exit(vm->mapMemoryBufferMutex);
+	}
+}
+
+/*
+ *
+ * Find a previously computed map of at most 32 slots in the global map cache
+ *
+ */
+
+BOOLEAN
+j9mapcache_FindMap(J9JavaVM *vm, J9ROMMethod *romMethod, UDATA offsetPC, U_32 slotCount, U_32 *result)
+{
+	BOOLEAN found = FALSE;
+
+	if (NULL != vm->mapCache) {
+		J9MapCacheEntry *entry = mapCacheEntryFor(vm, romMethod, offsetPC, slotCount);
+
+		omrthread_monitor_enter(vm->mapMemoryBufferMutex);
+		if ((entry->romMethod == romMethod) && (entry->offsetPC == offsetPC) && (entry->slotCount == slotCount)) {
+			*result = entry->bits;
+			found = TRUE;
+		}
+		omrthread_monitor_exit(vm->mapMemoryBufferMutex);
+	}
+	return found;
+}
+
+/*
+ *
+ * Record a computed map of at most 32 slots in the global map cache, replacing any map in the same entry
+ *
+ */
+
+void
+j9mapcache_StoreMap(J9JavaVM *vm, J9ROMMethod *romMethod, UDATA offsetPC, U_32 slotCount, U_32 bits)
+{
+	if (NULL != vm->mapCache) {
+		J9MapCacheEntry *entry = mapCacheEntryFor(vm, romMethod, offsetPC, slotCount);
+
+		omrthread_monitor_enter(vm->mapMemoryBufferMutex);
+		entry->romMethod = romMethod;
+		entry->offsetPC = offsetPC;
+		entry->slotCount = slotCount;
+		entry->bits = bits;
+		omrthread_monitor_exit(vm->mapMemoryBufferMutex);
+	}
+}
@@ -1170,6 +1170,10 @@ fixITables(J9VMThread * currentThread, J9HashTable * classPairs)
 		if (J9_IS_CLASS_OBSOLETE(clazz)) {
 			clazz->iTable = J9_CURRENT_CLASS(clazz)->iTable;
 		}
+		/* The iTable selector tables are hashed on the interface classes and iTables
+		 * which may have been replaced above, so fall back to walking the iTable chains.
+		 */
+		clazz->iTableSelectorTable = NULL;
 		clazz = vmFuncs->allClassesNextDo(&classWalkState);
 	}
 	vmFuncs->allClassesEndDo(&classWalkState);
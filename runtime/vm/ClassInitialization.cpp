@@ -59,7 +59,13 @@ static char const *statusNames[] = {
 
 #define STATE_NAME(state) (J9_ARE_ANY_BITS_SET(state, ~(UDATA)J9ClassInitStatusMask) ? "IN_PROGRESS" : statusNames[state])
 
+/* The largest number of putstatic bytecodes a <clinit> may contain to be evaluated without running the interpreter */
+#define J9_CONSTANT_CLINIT_MAX_STORES 32
+
+extern J9NameAndSignature const clinitNameAndSig;
+
 static j9object_t setInitStatus(J9VMThread *currentThread, J9Class *clazz, UDATA status, j9object_t initializationLock);
+static bool runConstantClinit(J9VMThread *currentThread, J9Class *clazz);
 static void classInitStateMachine(J9VMThread *currentThread, J9Class *clazz, J9ClassInitState desiredState);
 
 #if defined(J9VM_OPT_VALHALLA_VALUE_TYPES)
@@ -89,6 +95,222 @@ popFromVerificationStack(J9VMThread *currentThread)
 }
 #endif /* defined(J9VM_OPT_VALHALLA_VALUE_TYPES) */
 
+/**
+ * Attempt to run a <clinit> which only stores constants into the static fields of its own class
+ * without building a call-in frame or entering the interpreter. Any <clinit> which does anything
+ * else, or any situation in which the stores might be observed by a debugger or a method or field
+ * watch hook, is rejected and left to the interpreter.
+ *
+ * The bytecodes are validated and every field is resolved before any value is stored, so a
+ * rejected <clinit> has had no visible effect and may be run normally.
+ *
+ * @param[in] *currentThread current thread
+ * @param[in] *clazz the J9Class being initialized
+ *
+ * @return true if the <clinit> has been run, false if it must be run by the interpreter
+ */
+static bool
+runConstantClinit(J9VMThread *currentThread, J9Class *clazz)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+	J9ROMClass *romClass = clazz->romClass;
+	J9ConstantPool *ramCP = J9_CP_FROM_CLASS(clazz);
+	J9ROMConstantPoolItem *romCP = ramCP->romConstantPool;
+	U_32 *cpShapeDescription = J9ROMCLASS_CPSHAPEDESCRIPTION(romClass);
+	J9UTF8 *className = J9ROMCLASS_CLASSNAME(romClass);
+	void *addresses[J9_CONSTANT_CLINIT_MAX_STORES];
+	UDATA modifiers[J9_CONSTANT_CLINIT_MAX_STORES];
+	U_64 values[J9_CONSTANT_CLINIT_MAX_STORES];
+	UDATA storeCount = 0;
+	J9Method *method = NULL;
+	U_8 *pc = NULL;
+	U_8 *end = NULL;
+	/* Width in slots of the constant waiting to be stored, 0 if none has been pushed */
+	UDATA pendingSlots = 0;
+	U_64 pendingValue = 0;
+	bool result = false;
+
+	if (J9_ARE_NO_BITS_SET(vm->extendedRuntimeFlags2, J9_EXTENDED_RUNTIME2_CONSTANT_CLINIT)
+		|| J9_ARE_ANY_BITS_SET(vm->extendedRuntimeFlags, J9_EXTENDED_RUNTIME_DEBUG_MODE | J9_EXTENDED_RUNTIME_METHOD_TRACE_ENABLED)
+		|| J9_ARE_ANY_BITS_SET(clazz->classFlags, J9ClassHasWatchedFields)
+		|| J9_EVENT_IS_HOOKED(vm->hookInterface, J9HOOK_VM_METHOD_ENTER)
+		|| J9_EVENT_IS_HOOKED(vm->hookInterface, J9HOOK_VM_METHOD_RETURN)
+	) {
+		goto done;
+	}
+
+	method = (J9Method*)javaLookupMethod(currentThread, clazz, (J9ROMNameAndSignature*)&clinitNameAndSig, NULL, J9_LOOK_STATIC | J9_LOOK_NO_CLIMB | J9_LOOK_NO_THROW | J9_LOOK_DIRECT_NAS);
+	if (NULL == method) {
+		goto done;
+	}
+	pc = method->bytecodes;
+	end = pc + J9_BYTECODE_SIZE_FROM_ROM_METHOD(J9_ROM_METHOD_FROM_RAM_METHOD(method));
+
+	while (pc < end) {
+		U_8 bytecode = *pc;
+		if (0 != pendingSlots) {
+			/* A constant is on the stack - the only accepted use of it is an immediate putstatic */
+			if (JBputstatic != bytecode) {
+				goto done;
+			}
+		}
+		switch (bytecode) {
+		case JBiconstm1:
+		case JBiconst0:
+		case JBiconst1:
+		case JBiconst2:
+		case JBiconst3:
+		case JBiconst4:
+		case JBiconst5:
+			pendingSlots = 1;
+			pendingValue = (U_32)(I_32)(bytecode - JBiconst0);
+			pc += 1;
+			break;
+		case JBfconst0:
+			pendingSlots = 1;
+			pendingValue = 0;
+			pc += 1;
+			break;
+		case JBfconst1:
+			pendingSlots = 1;
+			pendingValue = 0x3F800000;
+			pc += 1;
+			break;
+		case JBfconst2:
+			pendingSlots = 1;
+			pendingValue = 0x40000000;
+			pc += 1;
+			break;
+		case JBlconst0:
+		case JBlconst1:
+			pendingSlots = 2;
+			pendingValue = (U_64)(bytecode - JBlconst0);
+			pc += 1;
+			break;
+		case JBdconst0:
+			pendingSlots = 2;
+			pendingValue = 0;
+			pc += 1;
+			break;
+		case JBdconst1:
+			pendingSlots = 2;
+			pendingValue = J9CONST64(0x3FF0000000000000);
+			pc += 1;
+			break;
+		case JBbipush:
+			pendingSlots = 1;
+			pendingValue = (U_32)(I_32)*(I_8*)(pc + 1);
+			pc += 2;
+			break;
+		case JBsipush:
+			pendingSlots = 1;
+			pendingValue = (U_32)(I_32)*(I_16*)(pc + 1);
+			pc += 3;
+			break;
+		case JBldc:
+		case JBldcw: {
+			UDATA index = (JBldc == bytecode) ? pc[1] : *(U_16*)(pc + 1);
+			UDATA cpType = J9_CP_TYPE(cpShapeDescription, index);
+			if ((J9CPTYPE_INT != cpType) && (J9CPTYPE_FLOAT != cpType)) {
+				goto done;
+			}
+			pendingSlots = 1;
+			pendingValue = ((J9ROMSingleSlotConstantRef*)romCP)[index].data;
+			pc += (JBldc == bytecode) ? 2 : 3;
+			break;
+		}
+		case JBldc2lw:
+		case JBldc2dw: {
+			UDATA index = *(U_16*)(pc + 1);
+			UDATA cpType = J9_CP_TYPE(cpShapeDescription, index);
+			J9ROMConstantRef *romConstant = (J9ROMConstantRef*)romCP + index;
+			U_32 slots[2];
+			if ((J9CPTYPE_LONG != cpType) && (J9CPTYPE_DOUBLE != cpType)) {
+				goto done;
+			}
+			/* Keep the slot order used by the interpreter stack */
+			slots[0] = romConstant->slot1;
+			slots[1] = romConstant->slot2;
+			memcpy(&pendingValue, slots, sizeof(pendingValue));
+			pendingSlots = 2;
+			pc += 3;
+			break;
+		}
+		case JBputstatic: {
+			UDATA index = *(U_16*)(pc + 1);
+			J9ROMFieldRef *romFieldRef = (J9ROMFieldRef*)&romCP[index];
+			J9ROMClassRef *romClassRef = (J9ROMClassRef*)&romCP[romFieldRef->classRefCPIndex];
+			J9RAMStaticFieldRef localRef;
+			J9ROMFieldShape *field = NULL;
+			void *address = NULL;
+			bool isDouble = false;
+
+			if ((0 == pendingSlots) || (J9_CONSTANT_CLINIT_MAX_STORES == storeCount)) {
+				goto done;
+			}
+			/* Only fields of the class being initialized, so no other class is loaded or initialized */
+			if (!J9UTF8_EQUALS(J9ROMCLASSREF_NAME(romClassRef), className)) {
+				goto done;
+			}
+			address = resolveStaticFieldRefInto(currentThread, method, ramCP, index,
+					J9_RESOLVE_FLAG_FIELD_SETTER | J9_RESOLVE_FLAG_NO_THROW_ON_FAIL | J9_RESOLVE_FLAG_NO_CLASS_LOAD | J9_RESOLVE_FLAG_NO_CLASS_INIT,
+					&field, &localRef);
+			if (VM_VMHelpers::exceptionPending(currentThread)) {
+				/* Leave it to the interpreter to throw the exception at the correct point */
+				VM_VMHelpers::clearException(currentThread);
+				goto done;
+			}
+			if ((NULL == address)
+				|| (clazz != (J9Class*)(J9CLASSANDFLAGS_FROM_FLAGSANDCLASS(localRef.flagsAndClass) & ~(UDATA)J9StaticFieldRefFlagBits))
+				|| J9_ARE_ANY_BITS_SET(field->modifiers, J9FieldFlagObject)
+			) {
+				goto done;
+			}
+			isDouble = J9_ARE_ALL_BITS_SET(field->modifiers, J9FieldSizeDouble);
+			if ((isDouble ? 2 : 1) != pendingSlots) {
+				goto done;
+			}
+			addresses[storeCount] = address;
+			modifiers[storeCount] = field->modifiers;
+			values[storeCount] = pendingValue;
+			storeCount += 1;
+			pendingSlots = 0;
+			pc += 3;
+			break;
+		}
+		case JBreturn0:
+		case JBgenericReturn:
+			/* The return must be the final bytecode */
+			if ((pc + 1) != end) {
+				goto done;
+			}
+			pc += 1;
+			result = true;
+			break;
+		default:
+			goto done;
+		}
+	}
+
+	if (result) {
+		for (UDATA i = 0; i < storeCount; i++) {
+			bool isVolatile = J9_ARE_ALL_BITS_SET(modifiers[i], J9AccVolatile);
+			if (J9_ARE_ALL_BITS_SET(modifiers[i], J9FieldSizeDouble)) {
+				vm->memoryManagerFunctions->j9gc_objaccess_staticStoreU64(currentThread, clazz, (U_64*)addresses[i], values[i], isVolatile);
+			} else {
+				U_32 value = (U_32)values[i];
+				if (J9FieldTypeBoolean == (modifiers[i] & J9FieldTypeMask)) {
+					value &= 1;
+				}
+				vm->memoryManagerFunctions->j9gc_objaccess_staticStoreU32(currentThread, clazz, (U_32*)addresses[i], value, isVolatile);
+			}
+		}
+		Trc_VM_runConstantClinit_evaluated(currentThread, J9UTF8_LENGTH(className), J9UTF8_DATA(className), storeCount);
+	}
+done:
+	return result;
+}
+
 void
 initializeImpl(J9VMThread *currentThread, J9Class *clazz)
 {
@@ -117,8 +339,10 @@ initializeImpl(J9VMThread *currentThread, J9Class *clazz)
 	}
 
 	if (J9ROMCLASS_HAS_CLINIT(clazz->romClass)) {
-		sendClinit(currentThread, clazz);
-		clazz = VM_VMHelpers::currentClass(clazz);
+		if (!runConstantClinit(currentThread, clazz)) {
+			sendClinit(currentThread, clazz);
+			clazz = VM_VMHelpers::currentClass(clazz);
+		}
 		if (VM_VMHelpers::exceptionPending(currentThread)) {
 			TRIGGER_J9HOOK_VM_CLASS_INITIALIZE_FAILED(vm->hookInterface, currentThread, clazz);
 			goto done;
@@ -288,15 +288,11 @@ private:
 		if (interfaceClass == iTable->interfaceClass) {
 			goto foundITable;
 		}
-		iTable = (J9ITable*)receiverClass->iTable;
-		while (NULL != iTable) {
-			if (interfaceClass == iTable->interfaceClass) {
-				receiverClass->lastITable = iTable;
+		iTable = VM_VMHelpers::findITable(receiverClass, interfaceClass);
+		if (NULL != iTable) {
+			receiverClass->lastITable = iTable;
 foundITable:
-				sendMethod = *(J9Method**)((UDATA)receiverClass + ((UDATA*)(iTable + 1))[iTableIndex]);
-				break;
-			}
-			iTable = iTable->next;
+			sendMethod = *(J9Method**)((UDATA)receiverClass + ((UDATA*)(iTable + 1))[iTableIndex]);
 		}
 		return sendMethod;
 	}
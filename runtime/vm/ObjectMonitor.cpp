@@ -630,6 +630,7 @@ spinOnTryEnter(J9VMThread *currentThread, J9ObjectMonitor *objectMonitor, j9obje
 	UDATA tryEnterSpinCount2 = vm->thrMaxTryEnterSpins2BeforeBlocking;
 	UDATA tryEnterYieldCount = vm->thrMaxTryEnterYieldsBeforeBlocking;
 	UDATA const tryEnterNestedSpinning = vm->thrTryEnterNestedSpinning;
+	UDATA const adaptiveSpinning = vm->thrAdaptiveTryEnterSpinning;
 
 #if defined(J9VM_INTERP_CUSTOM_SPIN_OPTIONS)
 	J9Class *ramClass = J9OBJECT_CLAZZ(currentThread, object);
@@ -674,6 +675,16 @@ spinOnTryEnter(J9VMThread *currentThread, J9ObjectMonitor *objectMonitor, j9obje
 	}
 #endif /* defined(OMR_THR_THREE_TIER_LOCKING) && defined(OMR_THR_SPIN_WAKE_CONTROL) */
 
+	if (0 != adaptiveSpinning) {
+		/* Only allow twice as many yield rounds as recent spinning acquires of this monitor have needed. Monitors which
+		 * are not acquired by spinning quickly shrink to a single round, while monitors held briefly keep spinning.
+		 */
+		UDATA adaptiveYieldCount = ((objectMonitor->spinYieldRounds >> J9VM_ADAPTIVE_SPIN_ROUNDS_SHIFT) * 2) + 1;
+		if (adaptiveYieldCount < tryEnterYieldCount) {
+			tryEnterYieldCount = adaptiveYieldCount;
+		}
+	}
+
 	/* Need to store the original value of tryEnterSpinCount2 since it gets overridden during non-nested spinning */
 	UDATA tryEnterSpinCount2Init = tryEnterSpinCount2;
 
@@ -731,6 +742,22 @@ spinOnTryEnter(J9VMThread *currentThread, J9ObjectMonitor *objectMonitor, j9obje
 	}
 
 update_jlm:
+	if (0 != adaptiveSpinning) {
+		/* Learn from the outcome of the spin: spinSuccessRounds is the number of yield rounds it took to acquire
+		 * the monitor, or 0 if the whole window was spun without acquiring it. Leaving the loop early for other
+		 * reasons says nothing about the monitor, so the history is not updated in that case. The history is a
+		 * decaying average kept scaled by 2^J9VM_ADAPTIVE_SPIN_ROUNDS_SHIFT. Racing updates are harmless.
+		 */
+		if ((0 == rc_tryEnterUsingThreadID) || (0 == _tryEnterYieldCount)) {
+			U_32 spinSuccessRounds = 0;
+			if (0 == rc_tryEnterUsingThreadID) {
+				spinSuccessRounds = (U_32)(tryEnterYieldCount - _tryEnterYieldCount + 1);
+			}
+			U_32 const rounds = objectMonitor->spinYieldRounds;
+			objectMonitor->spinYieldRounds = rounds - (rounds >> J9VM_ADAPTIVE_SPIN_ROUNDS_SHIFT) + spinSuccessRounds;
+		}
+	}
+
 #if defined(OMR_THR_JLM)
 	if (NULL != tracing) {
 		/* Add JLM counts atomically:
@@ -143,6 +143,7 @@ static J9Class* markInterfaces(J9ROMClass *romClass, J9Class *superclass, J9Clas
 static void unmarkInterfaces(J9Class *interfaceHead);
 static void createITable(J9VMThread* vmStruct, J9Class *ramClass, J9Class *interfaceClass, J9ITable ***previousLink, UDATA **currentSlot, UDATA depth);
 static UDATA* initializeRAMClassITable(J9VMThread* vmStruct, J9Class *ramClass, J9Class *superclass, UDATA* currentSlot, J9Class *interfaceHead, IDATA maxInterfaceDepth);
+static void initializeITableSelectorTable(J9Class *ramClass, J9ITableSelectorTable *selectorTable, UDATA tableSize);
 static UDATA addInterfaceMethods(J9VMThread *vmStruct, J9ClassLoader *classLoader, J9Class *interfaceClass, UDATA vTableMethodCount, UDATA *vTableAddress, J9Class *superclass, J9ROMClass *romClass, UDATA *defaultConflictCount, J9Pool *equivalentSets, UDATA *equivSetCount, J9OverrideErrorData *errorData);
 static UDATA* computeVTable(J9VMThread *vmStruct, J9ClassLoader *classLoader, J9Class *superclass, J9ROMClass *taggedClass, UDATA packageID, J9ROMMethod ** methodRemapArray, J9Class *interfaceHead, UDATA *defaultConflictCount, UDATA interfaceCount, UDATA inheritedInterfaceCount, J9OverrideErrorData *errorData);
 static void copyVTable(J9VMThread *vmStruct, J9Class *ramClass, J9Class *superclass, UDATA *vTable, UDATA defaultConflictCount);
@@ -423,6 +424,34 @@ initializeRAMClassITable (J9VMThread* vmStruct, J9Class *ramClass, J9Class *supe
 	return currentSlot;
 }
 
+/**
+ * Fill in the iTable selector table of a class from its completed iTable chain, so that
+ * iTable lookups on the class can probe the table rather than walk the chain.
+ *
+ * @param[in] ramClass the class whose iTable chain has been built
+ * @param[in] selectorTable the memory for the table, followed by room for tableSize entries
+ * @param[in] tableSize the number of entries, a power of two at least twice the iTable chain length
+ */
+static void
+initializeITableSelectorTable(J9Class *ramClass, J9ITableSelectorTable *selectorTable, UDATA tableSize)
+{
+	J9ITable **entries = J9ITABLESELECTORTABLE_ENTRIES(selectorTable);
+	J9ITable *iTable = (J9ITable *)ramClass->iTable;
+	UDATA mask = tableSize - 1;
+
+	memset(entries, 0, tableSize * sizeof(J9ITable *));
+	selectorTable->mask = mask;
+	while (NULL != iTable) {
+		UDATA index = J9ITABLESELECTORTABLE_HASH(iTable->interfaceClass) & mask;
+		while (NULL != entries[index]) {
+			index = (index + 1) & mask;
+		}
+		entries[index] = iTable;
+		iTable = iTable->next;
+	}
+	ramClass->iTableSelectorTable = selectorTable;
+}
+
 /* Helper function to compare two name and sigs.
  * It compares the lengths of both name and sig first before doing any memcmp.
  *
@@ -2295,6 +2324,7 @@ internalCreateRAMClassFromROMClassImpl(J9VMThread *vmThread, J9ClassLoader *clas
 	UDATA *instanceDescription = NULL;
 	UDATA instanceDescriptionSlotCount = 0;
 	UDATA iTableSlotCount = 0;
+	UDATA iTableSelectorTableSize = 0;
 	IDATA maxInterfaceDepth = -1;
 	UDATA inheritedInterfaceCount = 0;
 	UDATA defaultConflictCount = 0;
@@ -2507,6 +2537,29 @@ fail:
 					interfaceWalk = (J9Class *)((UDATA)interfaceWalk->instanceDescription & ~INTERFACE_TAG);
 				}
 			}
+			/* A class with a long iTable chain also gets an iTable selector table, allocated
+			 * after its local iTables. The table is kept at most half full.
+			 */
+			{
+				UDATA iTableChainLength = interfaceCount;
+				if ((romClass->modifiers & J9AccInterface) == J9AccInterface) {
+					iTableChainLength += 1;
+				}
+				if (NULL != superclass) {
+					J9ITable *superclassITable = (J9ITable *)superclass->iTable;
+					while (NULL != superclassITable) {
+						iTableChainLength += 1;
+						superclassITable = superclassITable->next;
+					}
+				}
+				if (iTableChainLength >= J9ITABLESELECTORTABLE_MIN_CHAIN_LENGTH) {
+					iTableSelectorTableSize = 2 * J9ITABLESELECTORTABLE_MIN_CHAIN_LENGTH;
+					while (iTableSelectorTableSize < (2 * iTableChainLength)) {
+						iTableSelectorTableSize *= 2;
+					}
+					iTableSlotCount += (sizeof(J9ITableSelectorTable) / sizeof(UDATA)) + iTableSelectorTableSize;
+				}
+			}
 			classSize += iTableSlotCount;
 		}
 
@@ -2989,7 +3042,15 @@ fail:
 
 			if (!fastHCR) {
 				/* Fill in the itable. This will unmark the linked interfaces. */
-				initializeRAMClassITable(vmThread, ramClass, superclass, iTable, interfaceHead, maxInterfaceDepth);
+				UDATA *iTableEnd = initializeRAMClassITable(vmThread, ramClass, superclass, iTable, interfaceHead, maxInterfaceDepth);
+				if (0 != iTableSelectorTableSize) {
+					initializeITableSelectorTable(ramClass, (J9ITableSelectorTable *)iTableEnd, iTableSelectorTableSize);
+				} else {
+					ramClass->iTableSelectorTable = NULL;
+				}
+			} else {
+				/* The iTables are shared with the class being redefined, and so is the selector table */
+				ramClass->iTableSelectorTable = classBeingRedefined->iTableSelectorTable;
 			}
 			/* Ensure that lastITable is never NULL */
 			ramClass->lastITable = (J9ITable *) ramClass->iTable;
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2017 IBM Corp. and others
+ * Copyright (c) 1991, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -92,9 +92,29 @@ static void fixDecompilationRecords(J9VMThread * vmThread, UDATA delta, UDATA ol
 
 UDATA   growJavaStack(J9VMThread * vmThread, UDATA newStackSize)
 {
+	UDATA requestedSize = newStackSize;
+	UDATA maxStackSize = vmThread->javaVM->stackSize;
+	UDATA doubledSize = vmThread->stackObject->size * 2;
 	UDATA rc;
 
+	/* Grow geometrically (capped at -Xss) rather than by a fixed increment, so that a deep
+	 * recursion on a thread with a small initial stack costs O(log n) copies rather than O(n).
+	 * Requests beyond -Xss (e.g. the overflow reserve) are honoured as given.
+	 */
+	if (newStackSize < maxStackSize) {
+		if (doubledSize > maxStackSize) {
+			doubledSize = maxStackSize;
+		}
+		if (doubledSize > newStackSize) {
+			newStackSize = doubledSize;
+		}
+	}
+
 	rc = internalGrowJavaStack(vmThread, newStackSize);
+	if ((0 != rc) && (newStackSize != requestedSize)) {
+		newStackSize = requestedSize;
+		rc = internalGrowJavaStack(vmThread, newStackSize);
+	}
 	if (0 != rc) {
 		vmThread->javaVM->memoryManagerFunctions->j9gc_modron_global_collect_with_overrides(vmThread, J9MMCONSTANT_EXPLICIT_GC_NATIVE_OUT_OF_MEMORY);
 		rc = internalGrowJavaStack(vmThread, newStackSize);
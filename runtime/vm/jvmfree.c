@@ -127,8 +127,9 @@ recycleVMThread(J9VMThread * vmThread)
 {
 	J9JavaVM * vm = vmThread->javaVM;
 
-	/* Preserve J9VMThread->startOfMemoryBlock and J9VMThread->J9RIParameters */
+	/* Preserve J9VMThread->startOfMemoryBlock, J9VMThread->J9RIParameters and the cached stack */
 	void *startOfMemoryBlock = vmThread->startOfMemoryBlock;
+	J9JavaStack *cachedStack = vmThread->stackObject;
 #if defined(J9VM_PORT_RUNTIME_INSTRUMENTATION)
 	J9RIParameters *riParameters = vmThread->riParameters;
 #endif /* defined(J9VM_PORT_RUNTIME_INSTRUMENTATION) */
@@ -146,8 +147,9 @@ recycleVMThread(J9VMThread * vmThread)
 	memset((U_8 *) vmThread, 0, startRegion);
 	memset(((U_8 *) vmThread) + endRegion, 0, J9_VMTHREAD_SEGREGATED_ALLOCATION_CACHE_OFFSET + vm->segregatedAllocationCacheSize - endRegion);
 
-	/* Restore J9VMThread->startOfMemoryBlock and J9VMThread->J9RIParameters */
+	/* Restore J9VMThread->startOfMemoryBlock, J9VMThread->J9RIParameters and the cached stack */
 	vmThread->startOfMemoryBlock = startOfMemoryBlock;
+	vmThread->stackObject = cachedStack;
 #if defined(J9VM_PORT_RUNTIME_INSTRUMENTATION)
 	vmThread->riParameters = riParameters;
 	memset(vmThread->riParameters, 0, sizeof(J9RIParameters));
@@ -223,13 +225,25 @@ deallocateVMThread(J9VMThread * vmThread, UDATA decrementZombieCount, UDATA send
 	j9port_tls_free();
 
 	if (vmThread->stackObject) {
-		/* Free all stacks that were used by this thread */
+		/* Free all stacks that were used by this thread, except that a stack which was never
+		 * grown is cached in the recycled vmThread for reuse by the next thread to be created.
+		 */
+#if defined(J9VM_INTERP_GROWABLE_STACKS)
+		UDATA initialStackSize = OMR_MIN(vm->initialStackSize, vm->stackSize);
+#else /* J9VM_INTERP_GROWABLE_STACKS */
+		UDATA initialStackSize = vm->stackSize;
+#endif /* J9VM_INTERP_GROWABLE_STACKS */
 
 		currentStack = vmThread->stackObject;
+		vmThread->stackObject = NULL;
 		do {
 			J9JavaStack * previous = currentStack->previous;
 
-			freeJavaStack(vm, currentStack);
+			if ((NULL == vmThread->stackObject) && (currentStack->size == initialStackSize)) {
+				vmThread->stackObject = currentStack;
+			} else {
+				freeJavaStack(vm, currentStack);
+			}
 			currentStack = previous;
 		} while (currentStack);
 	}
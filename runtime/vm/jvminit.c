@@ -2170,6 +2170,12 @@ IDATA VMInitStages(J9JavaVM *vm, IDATA stage, void* reserved) {
 			}
 #endif /* JAVA_SPEC_VERSION >= 15 */
 
+			argIndex = FIND_AND_CONSUME_ARG(EXACT_MATCH, VMOPT_XXCONSTANTCLINIT, NULL);
+			argIndex2 = FIND_AND_CONSUME_ARG(EXACT_MATCH, VMOPT_XXNOCONSTANTCLINIT, NULL);
+			if (argIndex > argIndex2) {
+				vm->extendedRuntimeFlags2 |= J9_EXTENDED_RUNTIME2_CONSTANT_CLINIT;
+			}
+
 			break;
 
 		case ALL_DEFAULT_LIBRARIES_LOADED :
@@ -2354,6 +2360,15 @@ IDATA VMInitStages(J9JavaVM *vm, IDATA stage, void* reserved) {
 				}
 			}
 
+			/* By default Throwable stack traces are not truncated */
+			vm->maxStackTraceDepth = 0;
+			if ((argIndex = FIND_AND_CONSUME_ARG(STARTSWITH_MATCH, VMOPT_XXMAXJAVASTACKTRACEDEPTH_EQUALS, NULL)) >= 0) {
+				UDATA depth = 0;
+				char *optname = VMOPT_XXMAXJAVASTACKTRACEDEPTH_EQUALS;
+				GET_INTEGER_VALUE(argIndex, optname, depth);
+				vm->maxStackTraceDepth = depth;
+			}
+
 #if defined(J9VM_OPT_VALHALLA_VALUE_TYPES)
 			/* By default flattening is disabled */
 			vm->valueFlatteningThreshold = 0;
@@ -3608,6 +3623,9 @@ processVMArgsFromFirstToLast(J9JavaVM * vm)
 static jint runInitializationStage(J9JavaVM* vm, IDATA stage) {
 	RunDllMainData userData;
 	J9VMThread *mainThread = vm->mainThread;
+	I_64 start = 0;
+	I_64 end = 0;
+	PORT_ACCESS_FROM_JAVAVM(vm);
 
 	/* Once the main J9VMThread has been created, each init stage expects the thread
 	 * to have entered the VM and released VM access.
@@ -3632,7 +3650,14 @@ static jint runInitializationStage(J9JavaVM* vm, IDATA stage) {
 #ifdef J9VM_INTERP_VERBOSE
 	JVMINIT_VERBOSE_INIT_VM_TRACE1(vm, "\nRunning initialization stage %s\n", getNameForStage(stage));
 #endif
+	if (vm->verboseLevel & VERBOSE_INIT) {
+		start = j9time_nano_time();
+	}
 	pool_do(vm->dllLoadTable, runJ9VMDllMain, &userData);
+	if (vm->verboseLevel & VERBOSE_INIT) {
+		end = j9time_nano_time();
+	}
+	JVMINIT_VERBOSE_INIT_VM_TRACE2(vm, "\tstage %s completed in %lld nano sec.\n", getNameForStage(stage), (end-start));
 
 	return checkPostStage(vm, stage);
 }
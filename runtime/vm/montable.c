@@ -281,12 +281,27 @@ monitorTableAt(J9VMThread* vmStruct, j9object_t object)
 	} else {
 		objectMonitor = hashTableFind(monitorTable, &key_objectMonitor);
 		if (objectMonitor == NULL) {
-			omrthread_monitor_t monitor;
+			omrthread_monitor_t monitor = NULL;
 			UDATA monitorFlags = J9THREAD_MONITOR_OBJECT;
 
-			key_objectMonitor.alternateLockword = 0;
+			/* Initializing the omrthread monitor is the expensive part of inflation, so do it without
+			 * holding the monitorTableMutex. The caller holds VM access, which keeps the object from
+			 * moving and its entry (if another thread adds one meanwhile) from being removed.
+			 */
+			omrthread_monitor_exit(mutex);
+			if (omrthread_monitor_init_with_name(&monitor, monitorFlags, NULL) != 0) {
+				monitor = NULL;
+			}
+			omrthread_monitor_enter(mutex);
+
+			objectMonitor = hashTableFind(monitorTable, &key_objectMonitor);
+			if (NULL != objectMonitor) {
+				TRACE("Found monitor added by another thread");
+			} else if (NULL != monitor) {
+				key_objectMonitor.alternateLockword = 0;
+				/* start with the full tryEnter yield window until the monitor has learned how much spinning it needs */
+				key_objectMonitor.spinYieldRounds = (U_32)(vm->thrMaxTryEnterYieldsBeforeBlocking << J9VM_ADAPTIVE_SPIN_ROUNDS_SHIFT);
 
-			if (omrthread_monitor_init_with_name(&monitor, monitorFlags, NULL) == 0) {
 				TRACE("Adding monitor");
 				((J9ThreadAbstractMonitor*)monitor)->userData = (UDATA) object;
 
@@ -324,12 +339,18 @@ monitorTableAt(J9VMThread* vmStruct, j9object_t object)
 
 				objectMonitor = hashTableAdd(monitorTable, &key_objectMonitor);
 				if (objectMonitor == NULL) {
-					omrthread_monitor_destroy(monitor);
 					TRACE("Out of memory adding to hash table");
+				} else {
+					/* the monitor is now owned by the table */
+					monitor = NULL;
 				}
 			} else {
 				TRACE("Out of memory creating omrthread_monitor_t");
-				objectMonitor = NULL;
+			}
+
+			if (NULL != monitor) {
+				/* another thread inflated the object first, or the table add failed */
+				omrthread_monitor_destroy(monitor);
 			}
 		} else {
 			TRACE("Found monitor");
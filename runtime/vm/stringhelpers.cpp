@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2020 IBM Corp. and others
+ * Copyright (c) 1991, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -30,6 +30,54 @@
 
 #include "VMHelpers.hpp"
 
+/**
+ * Count the leading bytes which modified UTF8 encodes as themselves (0x01 to 0x7F).
+ * Most strings handled by the VM are ASCII, so the bytes are examined a word at a time.
+ * @param data the bytes to examine
+ * @param length the number of bytes
+ * @returns the number of leading bytes in the range 0x01 to 0x7F
+ */
+static VMINLINE UDATA
+countLeadingASCII(const U_8 *data, UDATA length)
+{
+	const UDATA lowBits = ((UDATA)-1) / 0xFF;
+	const UDATA highBits = lowBits << 7;
+	UDATA count = 0;
+
+	while ((length - count) >= sizeof(UDATA)) {
+		UDATA word = 0;
+		memcpy(&word, data + count, sizeof(UDATA));
+		/* ((word - lowBits) & ~word) has a high bit set iff some byte is zero; word has one set iff some byte is >= 0x80 */
+		if (0 != ((((word - lowBits) & ~word) | word) & highBits)) {
+			break;
+		}
+		count += sizeof(UDATA);
+	}
+	while ((count < length) && ((U_8)(data[count] - 1) < 0x7F)) {
+		count += 1;
+	}
+	return count;
+}
+
+/**
+ * Get the address of the elements of a byte array if they can be read directly.
+ * @param *vmThread
+ * @param array the byte array
+ * @returns the address of the first element, or NULL if the elements must be accessed through the access barrier
+ */
+static VMINLINE const U_8 *
+directByteArrayData(J9VMThread *vmThread, j9object_t array)
+{
+#if defined(J9VM_GC_ALWAYS_CALL_OBJECT_ACCESS_BARRIER)
+	return NULL;
+#else /* defined(J9VM_GC_ALWAYS_CALL_OBJECT_ACCESS_BARRIER) */
+	if (J9ISCONTIGUOUSARRAY(vmThread, array)) {
+		return (const U_8 *)J9JAVAARRAYCONTIGUOUS_EA(vmThread, array, 0, U_8);
+	}
+	return NULL;
+#endif /* defined(J9VM_GC_ALWAYS_CALL_OBJECT_ACCESS_BARRIER) */
+}
+
 extern "C" {
 
 /**
@@ -176,8 +224,20 @@ compareStringToUTF8(J9VMThread *vmThread, j9object_t string, UDATA translateDots
 	j9object_t unicodeBytes = J9VMJAVALANGSTRING_VALUE(vmThread, string);
 
 	if (IS_STRING_COMPRESSED(vmThread, string)) {
+		const U_8 *stringData = directByteArrayData(vmThread, unicodeBytes);
+		if ((NULL != stringData) && !translateDots) {
+			/* Compare the ASCII prefix in bulk; ASCII characters are encoded as themselves */
+			UDATA asciiLength = countLeadingASCII(tmpUtfData, OMR_MIN(tmpUtfLength, tmpStringLength));
+			if (0 != memcmp(stringData, tmpUtfData, asciiLength)) {
+				return 0;
+			}
+			tmpStringLength -= asciiLength;
+			tmpUtfData += asciiLength;
+			tmpUtfLength -= asciiLength;
+			i += asciiLength;
+		}
 		while ((tmpUtfLength != 0) && (tmpStringLength != 0)) {
-			U_16 unicodeChar = (U_16)J9JAVAARRAYOFBYTE_LOAD(vmThread, unicodeBytes, i);
+			U_16 unicodeChar = (U_16)(U_8)J9JAVAARRAYOFBYTE_LOAD(vmThread, unicodeBytes, i);
 			U_16 utfChar;
 			UDATA consumed = decodeUTF8Char(tmpUtfData, &utfChar);
 
@@ -227,8 +287,25 @@ copyStringToUTF8Helper(J9VMThread *vmThread, j9object_t string, UDATA stringFlag
 	if (IS_STRING_COMPRESSED(vmThread, string)) {
 		/* Manually version J9_STR_XLAT flag checking from the loop for performance as the compiler does not do it */
 		if ((stringFlags & J9_STR_XLAT) == 0) {
-			for (UDATA i = stringOffset; i < stringOffset + stringLength; i++) {
-				data += VM_VMHelpers::encodeUTF8CharI8(J9JAVAARRAYOFBYTE_LOAD(vmThread, stringValue, i), data);
+			const U_8 *source = directByteArrayData(vmThread, stringValue);
+			if (NULL != source) {
+				/* Copy runs of ASCII characters, which are encoded as themselves, in bulk */
+				UDATA i = stringOffset;
+				UDATA end = stringOffset + stringLength;
+				while (i < end) {
+					UDATA asciiLength = countLeadingASCII(source + i, end - i);
+					memcpy(data, source + i, asciiLength);
+					data += asciiLength;
+					i += asciiLength;
+					if (i < end) {
+						data += VM_VMHelpers::encodeUTF8CharI8((I_8)source[i], data);
+						i += 1;
+					}
+				}
+			} else {
+				for (UDATA i = stringOffset; i < stringOffset + stringLength; i++) {
+					data += VM_VMHelpers::encodeUTF8CharI8(J9JAVAARRAYOFBYTE_LOAD(vmThread, stringValue, i), data);
+				}
 			}
 		} else {
 			for (UDATA i = stringOffset; i < stringOffset + stringLength; i++) {
@@ -358,8 +435,23 @@ getStringUTF8Length(J9VMThread *vmThread, j9object_t string)
 	UDATA i;
 
 	if (IS_STRING_COMPRESSED(vmThread, string)) {
-		for (i = 0; i < unicodeLength; i++) {
-			utf8Length += VM_VMHelpers::encodedUTF8LengthI8(J9JAVAARRAYOFBYTE_LOAD(vmThread, unicodeBytes, i));
+		const U_8 *data = directByteArrayData(vmThread, unicodeBytes);
+		if (NULL != data) {
+			i = 0;
+			while (i < unicodeLength) {
+				UDATA asciiLength = countLeadingASCII(data + i, unicodeLength - i);
+				utf8Length += asciiLength;
+				i += asciiLength;
+				if (i < unicodeLength) {
+					/* '\0' and all non-ASCII Latin1 characters take two bytes */
+					utf8Length += 2;
+					i += 1;
+				}
+			}
+		} else {
+			for (i = 0; i < unicodeLength; i++) {
+				utf8Length += VM_VMHelpers::encodedUTF8LengthI8(J9JAVAARRAYOFBYTE_LOAD(vmThread, unicodeBytes, i));
+			}
 		}
 	} else {
 		for (i = 0; i < unicodeLength; i++) {
@@ -455,7 +547,14 @@ isValidUtf8(const U_8 * utf8Data, size_t length)
 {
 	while (length > 0) {
 		U_16 dummy;
-		U_32 consumed =  decodeUTF8CharN(utf8Data, &dummy, length);
+		U_32 consumed = 0;
+		UDATA asciiLength = countLeadingASCII(utf8Data, length);
+		utf8Data += asciiLength;
+		length -= asciiLength;
+		if (0 == length) {
+			break;
+		}
+		consumed = decodeUTF8CharN(utf8Data, &dummy, length);
 		if (0 == consumed) { /* 0 indicates parsing error */
 			return 0;
 		}
@@ -1462,11 +1462,25 @@ getLocalsMap(J9StackWalkState * walkState, J9ROMClass * romClass, J9ROMMethod *
 		}
 	}
 
+	/* Maps which fit in a single word are cached, as deep stacks often have many frames at the same PC */
+	if (argTempCount <= 32) {
+		if (j9mapcache_FindMap(vm, romMethod, offsetPC, (U_32)argTempCount, result)) {
+#ifdef J9VM_INTERP_STACKWALK_TRACING
+			swPrintf(walkState, 4, "\tUsing cached local map\n");
+#endif
+			return;
+		}
+	}
+
 #ifdef J9VM_INTERP_STACKWALK_TRACING
 	swPrintf(walkState, 4, "\tUsing local mapper\n");
 #endif
 	errorCode = vm->localMapFunction(PORTLIB, romClass, romMethod, offsetPC, result, vm, j9mapmemory_GetBuffer, j9mapmemory_ReleaseBuffer);
 
+	if ((errorCode >= 0) && (argTempCount <= 32)) {
+		j9mapcache_StoreMap(vm, romMethod, offsetPC, (U_32)argTempCount, *result);
+	}
+
 	if (errorCode < 0) {
 		/* Local map failed, result = %p - aborting VM - needs new message TBD */
 		j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_VM_STACK_MAP_FAILED, errorCode);
@@ -1486,8 +1500,21 @@ getStackMap(J9StackWalkState * walkState, J9ROMClass * romClass, J9ROMMethod * r
 {
 	PORT_ACCESS_FROM_WALKSTATE(walkState);
 	IDATA errorCode;
+	J9JavaVM *vm = walkState->walkThread->javaVM;
+
+	if (pushCount <= 32) {
+		if (j9mapcache_FindMap(vm, romMethod, offsetPC, (U_32)pushCount | J9_MAP_CACHE_STACK_MAP, result)) {
+#ifdef J9VM_INTERP_STACKWALK_TRACING
+			swPrintf(walkState, 4, "\tUsing cached stack map\n");
+#endif
+			return;
+		}
+	}
 
-	errorCode = j9stackmap_StackBitsForPC(PORTLIB, offsetPC, romClass, romMethod, result, pushCount, walkState->walkThread->javaVM, j9mapmemory_GetBuffer, j9mapmemory_ReleaseBuffer);
+	errorCode = j9stackmap_StackBitsForPC(PORTLIB, offsetPC, romClass, romMethod, result, pushCount, vm, j9mapmemory_GetBuffer, j9mapmemory_ReleaseBuffer);
+	if ((errorCode >= 0) && (pushCount <= 32)) {
+		j9mapcache_StoreMap(vm, romMethod, offsetPC, (U_32)pushCount | J9_MAP_CACHE_STACK_MAP, *result);
+	}
 	if (errorCode < 0) {
 		/* Local map failed, result = %p - aborting VM */
 		j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_VM_STACK_MAP_FAILED, errorCode);
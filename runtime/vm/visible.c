@@ -46,7 +46,13 @@ checkModuleAccess(J9VMThread *currentThread, J9JavaVM* vm, J9ROMClass* srcRomCla
 			}
 		}
 
-		if (J9_VISIBILITY_ALLOWED == result) {
+		/* Unnamed and open modules export all of their packages, and neither property changes once
+		 * the module is defined, so the package lookup and its mutex can be skipped.
+		 */
+		if ((J9_VISIBILITY_ALLOWED == result)
+			&& !J9_IS_J9MODULE_UNNAMED(vm, destModule)
+			&& !J9_IS_J9MODULE_OPEN(destModule)
+		) {
 			const U_8* packageName = NULL;
 			UDATA packageNameLength = 0;
 			J9PackageIDTableEntry entry = {0};
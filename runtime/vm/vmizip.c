@@ -150,7 +150,7 @@ vmizip_openZipFile(VMInterface * vmi, char *filename, VMIZipFile * vmizipFile, I
 		/* open the zip file but do not call zip_readCacheData().
 		 * we need to search data in shared class cache before reading it from disk.
 		 */
-		result = zip_openZipFile(PORTLIB, filename, zipFile, vm->zipCachePool, J9ZIP_OPEN_NO_FLAGS);
+		result = zip_openZipFile(PORTLIB, filename, zipFile, vm->zipCachePool, J9_ARE_ANY_BITS_SET(flags, ZIP_FLAG_BOOTSTRAP) ? J9ZIP_OPEN_MAP_FILE : J9ZIP_OPEN_NO_FLAGS);
 		if (result) {
 			if (zipCachePool) {
 				TRIGGER_J9HOOK_VM_ZIP_LOAD(zipCachePool->hookInterface, PORTLIB, zipCachePool->userData, (const struct J9ZipFile*)zipFile, J9ZIP_STATE_OPEN, (U_8*)filename, result);
@@ -246,7 +246,7 @@ vmizip_openZipFile(VMInterface * vmi, char *filename, VMIZipFile * vmizipFile, I
 			zipCachePool = zipCachePool_new(PORTLIB, vm);
 			vm->zipCachePool = zipCachePool;
 		}
-		result = zip_openZipFile(PORTLIB, filename, zipFile, vm->zipCachePool, J9ZIP_OPEN_READ_CACHE_DATA);
+		result = zip_openZipFile(PORTLIB, filename, zipFile, vm->zipCachePool, J9ZIP_OPEN_READ_CACHE_DATA | (J9_ARE_ANY_BITS_SET(flags, ZIP_FLAG_BOOTSTRAP) ? J9ZIP_OPEN_MAP_FILE : J9ZIP_OPEN_NO_FLAGS));
 	} else {
 		result = zip_openZipFile(PORTLIB, filename, zipFile, NULL, J9ZIP_OPEN_NO_FLAGS);
 	}
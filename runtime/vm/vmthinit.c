@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2020 IBM Corp. and others
+ * Copyright (c) 1991, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -118,6 +118,9 @@ void terminateVMThreading(J9JavaVM *vm)
 	while (!J9_LINKED_LIST_IS_EMPTY(vm->deadThreadList)) {
 		J9_LINKED_LIST_REMOVE_FIRST(vm->deadThreadList, vmThread);
 
+		if (NULL != vmThread->stackObject) {
+			freeJavaStack(vm, vmThread->stackObject);
+		}
 		if (NULL != vmThread->publicFlagsMutex) {
 			omrthread_monitor_destroy(vmThread->publicFlagsMutex);
 		}
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2020 IBM Corp. and others
+ * Copyright (c) 1991, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -103,14 +103,6 @@ allocateVMThread(J9JavaVM * vm, omrthread_t osThread, UDATA privateFlags, void *
 
 	omrthread_monitor_enter(vm->vmThreadListMutex);
 
-	/* Allocate the stack */
-
-	if ((stack = allocateJavaStack(vm, VMTHR_INITIAL_STACK_SIZE, NULL)) == NULL) {
-		goto fail;
-	}
-
-#undef VMTHR_INITIAL_STACK_SIZE
-
 	/* Try to reuse a dead thread; otherwise allocate a new one */
 	if (J9_LINKED_LIST_IS_EMPTY(vm->deadThreadList)) {
 
@@ -171,8 +163,31 @@ allocateVMThread(J9JavaVM * vm, omrthread_t osThread, UDATA privateFlags, void *
 			}
 		}
 		omrthread_monitor_exit(newThread->publicFlagsMutex);
+
+		/* Dead threads may cache their initial-sized stack - reuse it if it still matches */
+		stack = newThread->stackObject;
+		newThread->stackObject = NULL;
+		if (NULL != stack) {
+			if ((stack->size != VMTHR_INITIAL_STACK_SIZE) || J9_ARE_ANY_BITS_SET(vm->runtimeFlags, J9_RUNTIME_PAINT_STACK)) {
+				freeJavaStack(vm, stack);
+				stack = NULL;
+			} else {
+				stack->previous = NULL;
+				stack->firstReferenceFrame = 0;
+			}
+		}
 	}
 
+	/* Allocate the stack */
+
+	if (NULL == stack) {
+		if ((stack = allocateJavaStack(vm, VMTHR_INITIAL_STACK_SIZE, NULL)) == NULL) {
+			goto fail;
+		}
+	}
+
+#undef VMTHR_INITIAL_STACK_SIZE
+
 	if (0 != vm->segregatedAllocationCacheSize) {
 		newThread->segregatedAllocationCache = (J9VMGCSegregatedAllocationCacheEntry *)(((UDATA)newThread) + J9_VMTHREAD_SEGREGATED_ALLOCATION_CACHE_OFFSET);
 	}
@@ -314,6 +329,7 @@ fail:
 
 		/* Return the new thread to the deadThreadList if it came from there */
 		if (threadIsRecycled) {
+			newThread->stackObject = NULL;
 			J9_LINKED_LIST_ADD_LAST(vm->deadThreadList, newThread);
 		} else {
 			if (newThread->publicFlagsMutex) {
@@ -506,6 +522,7 @@ threadParseArguments(J9JavaVM *vm, char *optArg)
 	vm->thrMaxTryEnterYieldsBeforeBlocking = 45;
 	vm->thrNestedSpinning = 1;
 	vm->thrTryEnterNestedSpinning = 1;
+	vm->thrAdaptiveTryEnterSpinning = 0;
 	vm->thrDeflationPolicy = J9VM_DEFLATION_POLICY_ASAP;
 
 	if (cpus > 1) {
@@ -741,6 +758,16 @@ threadParseArguments(J9JavaVM *vm, char *optArg)
 			continue;
 		}
 
+		if (try_scan(&scan_start, "adaptiveTryEnterSpinning")) {
+			vm->thrAdaptiveTryEnterSpinning = 1;
+			continue;
+		}
+
+		if (try_scan(&scan_start, "noAdaptiveTryEnterSpinning")) {
+			vm->thrAdaptiveTryEnterSpinning = 0;
+			continue;
+		}
+
 
 		if (try_scan(&scan_start, "staggerStep=")) {
 			if (scan_udata(&scan_start, &vm->thrStaggerStep)) {
@@ -1309,6 +1336,7 @@ dumpThreadingInfo(J9JavaVM* jvm)
 	j9tty_printf(PORTLIB, LEADING_SPACE "tryEnterYield=%zu,\n", jvm->thrMaxTryEnterYieldsBeforeBlocking);
 	j9tty_printf(PORTLIB, LEADING_SPACE "%sestedSpinning,\n", (jvm->thrNestedSpinning) ? "n" : "noN");
 	j9tty_printf(PORTLIB, LEADING_SPACE "%sryEnterNestedSpinning,\n", (jvm->thrTryEnterNestedSpinning) ? "t" : "noT");
+	j9tty_printf(PORTLIB, LEADING_SPACE "%sdaptiveTryEnterSpinning,\n", (jvm->thrAdaptiveTryEnterSpinning) ? "a" : "noA");
 	j9tty_printf(PORTLIB, LEADING_SPACE "%sestroyMutexOnMonitorFree,\n", 
 		J9_ARE_ALL_BITS_SET(omrthread_lib_get_flags(), J9THREAD_LIB_FLAG_DESTROY_MUTEX_ON_MONITOR_FREE) ? "d" : "noD");
 #if !defined(WIN32) && defined(OMR_NOTIFY_POLICY_CONTROL)
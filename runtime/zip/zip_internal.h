@@ -123,6 +123,7 @@ typedef struct J9ZipCacheInternal {
 	J9ZipCacheEntry *entry;
 	IDATA zipFileFd;
 	U_8 zipFileType;
+	struct J9MmapHandle *zipFileMmap;
 } J9ZipCacheInternal;
 
 /**
@@ -122,6 +122,7 @@ J9ZipCache *zipCache_new(J9PortLibrary * portLib, char *zipName, IDATA zipNameLe
 	zci->entry = zce;
 	zci->zipFileFd = -1;
 	zci->zipFileType = ZIP_Unknown;
+	zci->zipFileMmap = NULL;
 
 	zci->info.portLib = portLib;
 	ZIP_SRP_SET(zce->currentChunk, chunk);
@@ -776,6 +777,9 @@ void zipCache_kill(J9ZipCache * zipCache)
 	PORT_ACCESS_FROM_PORT(portLib);
 
 	zipCache_freeChunks(portLib, zce);
+	if (NULL != zci->zipFileMmap) {
+		j9mmap_unmap_file(zci->zipFileMmap);
+	}
 	if (-1 != zci->zipFileFd) {
 		j9file_close(zci->zipFileFd);
 	}
@@ -91,6 +91,8 @@ static I_32 getZipEntryUsingDirectory(J9PortLibrary *portLib, J9ZipFile *zipFile
 		const char *fileName, IDATA fileNameLength, BOOLEAN readDataPointer);
 static BOOLEAN isSeekFailure(I_64 seekResult, I_64 expectedValue);
 static BOOLEAN isOutside4Gig(I_64 value);
+static void mapZipFile(J9PortLibrary *portLib, J9ZipFile *zipFile);
+static U_8 *getMappedZipData(J9ZipFile *zipFile, IDATA offset, U_32 length);
 
 #if defined(J9VM_THR_PREEMPTIVE)
 #include "omrthread.h"
@@ -211,6 +213,55 @@ isOutside4Gig(I_64 value) {
 			ZIP_ERR_OUT_OF_MEMORY
 			ZIP_ERR_INTERNAL_ERROR
 */
+/**
+ * Map the zip file of the cache used by zipFile into memory, if it is not already mapped
+ * and the platform supports read only file mappings. Failure to map is not an error, the
+ * entry data is then read from the file.
+ *
+ * @param[in] portLib the port library
+ * @param[in] zipFile the zip file, which must have a cache
+ */
+static void
+mapZipFile(J9PortLibrary *portLib, J9ZipFile *zipFile)
+{
+	PORT_ACCESS_FROM_PORT(portLib);
+	J9ZipCacheInternal *zci = (J9ZipCacheInternal *)zipFile->cache;
+
+	if ((NULL != zci) && (NULL == zci->zipFileMmap) && (-1 != zci->zipFileFd)
+		&& J9_ARE_ALL_BITS_SET(j9mmap_capabilities(), J9PORT_MMAP_CAPABILITY_READ)
+	) {
+		I_64 fileLength = j9file_length((const char *)zipFile->filename);
+
+		if ((fileLength > 0) && !isOutside4Gig(fileLength)) {
+			zci->zipFileMmap = j9mmap_map_file(zci->zipFileFd, 0, (UDATA)fileLength, (const char *)zipFile->filename, J9PORT_MMAP_FLAG_READ, J9MEM_CATEGORY_VM_JCL);
+		}
+	}
+}
+
+/**
+ * Find length bytes at offset in the memory mapped image of the zip file.
+ *
+ * @param[in] zipFile the zip file
+ * @param[in] offset the offset in the file
+ * @param[in] length the number of bytes needed
+ *
+ * @return a pointer to the bytes, or NULL if the file is not mapped or the range is outside the mapping
+ */
+static U_8 *
+getMappedZipData(J9ZipFile *zipFile, IDATA offset, U_32 length)
+{
+	J9ZipCacheInternal *zci = (J9ZipCacheInternal *)zipFile->cache;
+	U_8 *data = NULL;
+
+	if ((NULL != zci) && (NULL != zci->zipFileMmap) && (offset >= 0)) {
+		J9MmapHandle *handle = zci->zipFileMmap;
+		if (((UDATA)offset <= handle->size) && (length <= (handle->size - (UDATA)offset))) {
+			data = (U_8 *)handle->pointer + offset;
+		}
+	}
+	return data;
+}
+
 static I_32 inflateData(struct workBuffer* workBuf, U_8* inputBuffer, U_32 inputBufferSize, U_8* outputBuffer, U_32 outputBufferSize)
 {
 	PORT_ACCESS_FROM_PORT(workBuf->portLib);
@@ -1871,6 +1922,13 @@ I_32 zip_getZipEntryData(J9PortLibrary* portLib, J9ZipFile* zipFile, J9ZipEntry*
 
 	if(entry->compressionMethod == ZIP_CM_Stored) {
 		IDATA readResult = 0;
+		U_8 *mappedData = getMappedZipData(zipFile, entry->dataPointer, entry->compressedSize);
+		if (NULL != mappedData) {
+			/* The uncompressed data is already in memory */
+			memcpy(dataBuffer, mappedData, entry->compressedSize);
+			EXIT();
+			return 0;
+		}
 		/* No compression - just read the data in. */
 		if (zipFile->pointer != entry->dataPointer)  {
 			zipFile->pointer = (U_32) entry->dataPointer;
@@ -1893,6 +1951,15 @@ I_32 zip_getZipEntryData(J9PortLibrary* portLib, J9ZipFile* zipFile, J9ZipEntry*
 
 	if(entry->compressionMethod == ZIP_CM_Deflated) {
 		U_8* readBuffer;
+		U_8 *mappedData = getMappedZipData(zipFile, entry->dataPointer, entry->compressedSize);
+
+		if (NULL != mappedData) {
+			/* Inflate directly from the mapped file */
+			result = inflateData(&wb, mappedData, entry->compressedSize, dataBuffer, entry->uncompressedSize);
+			if(result)  goto finished;
+			EXIT();
+			return 0;
+		}
 
 		/* Read the file contents. */
 		if (entry->compressedSize < ZIP_WORK_BUFFER_SIZE) {
@@ -2368,6 +2435,9 @@ zip_openZipFile(J9PortLibrary *portLib, char *filename, J9ZipFile *zipFile, J9Zi
 	if (NULL != cachePool) {
 		result = zip_setupCache(portLib, zipFile, cache, cachePool);
 		fd = zipFile->fd;
+		if ((0 == result) && J9_ARE_ANY_BITS_SET(flags, J9ZIP_OPEN_MAP_FILE)) {
+			mapZipFile(portLib, zipFile);
+		}
 		if ((0 == result) && (TRUE == doReadCacheData)) {
 			result = zip_readCacheData(portLib, zipFile);
 		}
@@ -0,0 +1,120 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+package org.openj9.test.java.lang.management;
+
+import org.testng.annotations.BeforeClass;
+import org.testng.annotations.Test;
+import org.testng.Assert;
+import org.testng.SkipException;
+import java.lang.management.ManagementFactory;
+import java.util.List;
+
+import javax.management.JMX;
+import javax.management.MBeanServer;
+import javax.management.ObjectName;
+
+import com.ibm.lang.management.CompilationCostMXBean;
+import com.ibm.lang.management.MethodCompilationCost;
+
+/**
+ * Checks the shape of what CompilationCostMXBean returns. The ledger is only
+ * populated with -Xjit:compilationCostLedger, so an empty result is valid
+ * unless that option is given, in which case testLedgerPopulated requires entries.
+ */
+@Test(groups = { "level.sanity" })
+public class TestCompilationCostMXBean {
+	private CompilationCostMXBean costBean;
+
+	@BeforeClass
+	public void setUp() throws Exception {
+		ObjectName mxbeanName = new ObjectName("com.ibm.lang.management:type=CompilationCost");
+		MBeanServer mbeanServer = ManagementFactory.getPlatformMBeanServer();
+		Assert.assertTrue(mbeanServer.isRegistered(mxbeanName), "CompilationCostMXBean is not registered");
+		costBean = JMX.newMXBeanProxy(mbeanServer, mxbeanName, CompilationCostMXBean.class);
+	}
+
+	@Test
+	public void testTopCompilationCosts() {
+		MethodCompilationCost[] costs = costBean.getTopCompilationCosts(10);
+		Assert.assertNotNull(costs);
+		Assert.assertTrue(costs.length <= 10);
+		for (int i = 0; i < costs.length; ++i) {
+			MethodCompilationCost cost = costs[i];
+			Assert.assertNotNull(cost.getMethodName());
+			Assert.assertTrue(cost.getCompilations() >= cost.getRecompilations());
+			Assert.assertTrue(cost.getCompilations() >= cost.getFailures());
+			if (i > 0) {
+				Assert.assertTrue(costs[i - 1].getCpuTime() >= cost.getCpuTime(), "costs are not sorted");
+			}
+		}
+	}
+
+	@Test
+	public void testLedgerPopulated() throws InterruptedException {
+		boolean ledgerEnabled = false;
+		List<String> args = ManagementFactory.getRuntimeMXBean().getInputArguments();
+		for (String arg : args) {
+			if (arg.equals("-Xint") || arg.equals("-Xnojit")) {
+				throw new SkipException("The JIT is disabled");
+			}
+			if (arg.startsWith("-Xjit") && arg.contains("compilationCostLedger")) {
+				ledgerEnabled = true;
+			}
+		}
+		if (!ledgerEnabled) {
+			throw new SkipException("-Xjit:compilationCostLedger is not set");
+		}
+
+		/* Give the JIT a hot method to compile in case nothing was compiled yet. */
+		MethodCompilationCost[] costs = costBean.getTopCompilationCosts(10);
+		long sum = 0;
+		for (int round = 0; (costs.length == 0) && (round < 60); ++round) {
+			for (int i = 0; i < 100000; ++i) {
+				sum += hotMethod(i);
+			}
+			Thread.sleep(500);
+			costs = costBean.getTopCompilationCosts(10);
+		}
+		Assert.assertTrue(costs.length > 0, "no compilation was recorded with -Xjit:compilationCostLedger (" + sum + ")");
+		for (MethodCompilationCost cost : costs) {
+			Assert.assertTrue(cost.getCompilations() > 0, "ledger entry without compilations for " + cost.getMethodName());
+			Assert.assertTrue(cost.getCpuTime() >= 0);
+		}
+	}
+
+	private static long hotMethod(int i) {
+		return (i * 31L) ^ (i >>> 3);
+	}
+
+	@Test
+	public void testCountLimits() {
+		Assert.assertEquals(costBean.getTopCompilationCosts(0).length, 0);
+		Assert.assertTrue(costBean.getTopCompilationCosts(Integer.MAX_VALUE).length
+				<= CompilationCostMXBean.MAX_TOP_COMPILATION_COSTS);
+	}
+
+	@Test(expectedExceptions = IllegalArgumentException.class)
+	public void testNegativeCount() {
+		costBean.getTopCompilationCosts(-1);
+	}
+}